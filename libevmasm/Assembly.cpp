@@ -34,6 +34,7 @@
 #include <liblangutil/CharStream.h>
 #include <liblangutil/Exceptions.h>
 
+#include <libsolutil/CommonData.h>
 #include <libsolutil/JSON.h>
 #include <libsolutil/StringUtils.h>
 
@@ -44,9 +45,12 @@
 #include <range/v3/view/enumerate.hpp>
 #include <range/v3/view/map.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <limits>
 #include <iterator>
+#include <thread>
 
 using namespace solidity;
 using namespace solidity::evmasm;
@@ -60,22 +64,51 @@ AssemblyItem const& Assembly::append(AssemblyItem _i)
 	assertThrow(m_deposit >= 0, AssemblyException, "Stack underflow.");
 	m_deposit += static_cast<int>(_i.deposit());
 	m_items.emplace_back(std::move(_i));
-	if (!m_items.back().location().isValid() && m_currentSourceLocation.isValid())
-		m_items.back().setLocation(m_currentSourceLocation);
+	if (m_items.back().locationId() == SourceLocationPool::emptyId)
+		m_items.back().setLocationId(m_currentSourceLocationId);
 	m_items.back().m_modifierDepth = m_currentModifierDepth;
 	return m_items.back();
 }
 
+void Assembly::appendInstructions(std::vector<Instruction> const& _instructions)
+{
+	m_items.reserve(m_items.size() + _instructions.size());
+	for (Instruction instruction: _instructions)
+	{
+		assertThrow(m_deposit >= 0, AssemblyException, "Stack underflow.");
+		AssemblyItem item(instruction);
+		m_deposit += static_cast<int>(item.deposit());
+		item.setLocationId(m_currentSourceLocationId);
+		item.m_modifierDepth = m_currentModifierDepth;
+		m_items.emplace_back(std::move(item));
+	}
+}
+
 unsigned Assembly::codeSize(unsigned subTagSize) const
 {
+	// Only references to tags, data and sub-assemblies grow with the address length.
+	// Sum the size of everything else once and count the references, so that each
+	// relaxation round below is a multiplication instead of a sweep over all items.
+	size_t staticSize = 1;
+	for (auto const& i: m_data)
+		staticSize += i.second.size();
+
+	size_t numAddressReferences = 0;
+	for (AssemblyItem const& i: m_items)
+		switch (i.type())
+		{
+		case PushTag:
+		case PushData:
+		case PushSub:
+			++numAddressReferences;
+			break;
+		default:
+			staticSize += i.bytesRequired(0, Precision::Approximate);
+		}
+
 	for (unsigned tagSize = subTagSize; true; ++tagSize)
 	{
-		size_t ret = 1;
-		for (auto const& i: m_data)
-			ret += i.second.size();
-
-		for (AssemblyItem const& i: m_items)
-			ret += i.bytesRequired(tagSize, Precision::Approximate);
+		size_t ret = staticSize + numAddressReferences * (1 + tagSize);
 		if (numberEncodingSize(ret) <= tagSize)
 			return static_cast<unsigned>(ret);
 	}
@@ -646,6 +679,8 @@ void Assembly::encodeAllPossibleSubPathsInAssemblyTree(std::vector<size_t> _path
 
 std::shared_ptr<std::string const> Assembly::sharedSourceName(std::string const& _name) const
 {
+	static std::mutex sharedSourceNamesMutex;
+	std::lock_guard lock(sharedSourceNamesMutex);
 	if (s_sharedSourceNames.find(_name) == s_sharedSourceNames.end())
 		s_sharedSourceNames[_name] = std::make_shared<std::string>(_name);
 
@@ -716,39 +751,64 @@ std::map<u256, u256> const& Assembly::optimiseInternal(
 
 	std::map<u256, u256> tagReplacements;
 	// Iterate until no new optimisation possibilities are found.
-	for (unsigned count = 1; count > 0;)
+	// Every change to the items bumps the version and each pass records the
+	// version it last ran on, so a pass is only re-run if the items actually
+	// changed since then. This reaches the same fixpoint as re-running all
+	// passes in full rounds, minus the redundant clean runs on unchanged items.
+	unsigned version = 1;
+	unsigned inlinerSeen = 0;
+	unsigned jumpdestSeen = 0;
+	unsigned peepholeSeen = 0;
+	unsigned dedupSeen = 0;
+	unsigned cseSeen = 0;
+	auto needsRun = [&](bool _enabled, unsigned _seen) { return _enabled && _seen != version; };
+	while (
+		needsRun(_settings.runInliner, inlinerSeen) ||
+		needsRun(_settings.runJumpdestRemover, jumpdestSeen) ||
+		needsRun(_settings.runPeephole, peepholeSeen) ||
+		needsRun(_settings.runDeduplicate, dedupSeen) ||
+		needsRun(_settings.runCSE, cseSeen)
+	)
 	{
-		count = 0;
-
-		if (_settings.runInliner)
-			Inliner{
+		if (needsRun(_settings.runInliner, inlinerSeen))
+		{
+			inlinerSeen = version;
+			if (Inliner{
 				m_items,
 				_tagsReferencedFromOutside,
 				_settings.expectedExecutionsPerDeployment,
 				isCreation(),
 				_settings.evmVersion
-			}.optimise();
+			}.optimise())
+				version++;
+		}
 
-		if (_settings.runJumpdestRemover)
+		if (needsRun(_settings.runJumpdestRemover, jumpdestSeen))
 		{
+			jumpdestSeen = version;
 			JumpdestRemover jumpdestOpt{m_items};
 			if (jumpdestOpt.optimise(_tagsReferencedFromOutside))
-				count++;
+				version++;
 		}
 
-		if (_settings.runPeephole)
+		if (needsRun(_settings.runPeephole, peepholeSeen))
 		{
+			peepholeSeen = version;
 			PeepholeOptimiser peepOpt{m_items};
+			unsigned rounds = 0;
 			while (peepOpt.optimise())
 			{
-				count++;
-				assertThrow(count < 64000, OptimizerException, "Peephole optimizer seems to be stuck.");
+				rounds++;
+				assertThrow(rounds < 64000, OptimizerException, "Peephole optimizer seems to be stuck.");
 			}
+			if (rounds > 0)
+				version++;
 		}
 
 		// This only modifies PushTags, we have to run again to actually remove code.
-		if (_settings.runDeduplicate)
+		if (needsRun(_settings.runDeduplicate, dedupSeen))
 		{
+			dedupSeen = version;
 			BlockDeduplicator deduplicator{m_items};
 			if (deduplicator.deduplicate())
 			{
@@ -768,34 +828,47 @@ std::map<u256, u256> const& Assembly::optimiseInternal(
 					if (_tagsReferencedFromOutside.erase(static_cast<size_t>(replacement.first)))
 						_tagsReferencedFromOutside.insert(static_cast<size_t>(replacement.second));
 				}
-				count++;
+				version++;
 			}
 		}
 
-		if (_settings.runCSE)
+		if (needsRun(_settings.runCSE, cseSeen))
 		{
+			cseSeen = version;
 			// Control flow graph optimization has been here before but is disabled because it
 			// assumes we only jump to tags that are pushed. This is not the case anymore with
 			// function types that can be stored in storage.
-			AssemblyItems optimisedItems;
-
 			bool usesMSize = ranges::any_of(m_items, [](AssemblyItem const& _i) {
 				return _i == AssemblyItem{Instruction::MSIZE} || _i.type() == VerbatimBytecode;
 			});
 
-			auto iter = m_items.begin();
-			while (iter != m_items.end())
+			// Each eliminator instance starts from an empty state and only looks at its own
+			// chunk, so the chunks can be processed concurrently once their bounds are known.
+			using ItemIterator = AssemblyItems::const_iterator;
+			std::vector<std::pair<ItemIterator, ItemIterator>> chunks;
+			for (auto iter = m_items.cbegin(); iter != m_items.cend();)
+			{
+				ItemIterator chunkEnd = CommonSubexpressionEliminator::chunkEnd(iter, m_items.cend(), usesMSize);
+				chunks.emplace_back(iter, chunkEnd);
+				iter = chunkEnd;
+			}
+
+			// Entry i contains the optimised items of chunk i, or nothing if the original
+			// items are kept, either because they are already optimal or because the
+			// reconstruction failed.
+			std::vector<std::optional<AssemblyItems>> optimisedChunks(chunks.size());
+			auto optimiseChunk = [&](size_t _chunkIndex)
 			{
+				auto const& [orig, chunkEnd] = chunks[_chunkIndex];
 				KnownState emptyState;
 				CommonSubexpressionEliminator eliminator{emptyState};
-				auto orig = iter;
-				iter = eliminator.feedItems(iter, m_items.end(), usesMSize);
-				bool shouldReplace = false;
-				AssemblyItems optimisedChunk;
+				ItemIterator iter = eliminator.feedItems(orig, chunkEnd, usesMSize);
+				assertThrow(iter == chunkEnd, OptimizerException, "");
 				try
 				{
-					optimisedChunk = eliminator.getOptimizedItems();
-					shouldReplace = (optimisedChunk.size() < static_cast<size_t>(iter - orig));
+					AssemblyItems optimisedChunk = eliminator.getOptimizedItems();
+					if (optimisedChunk.size() < static_cast<size_t>(chunkEnd - orig))
+						optimisedChunks[_chunkIndex] = std::move(optimisedChunk);
 				}
 				catch (StackTooDeepException const&)
 				{
@@ -807,19 +880,64 @@ std::map<u256, u256> const& Assembly::optimiseInternal(
 					// This might happen if e.g. associativity and commutativity rules
 					// reorganise the expression tree, but not all leaves are available.
 				}
+			};
 
-				if (shouldReplace)
-				{
-					count++;
-					optimisedItems += optimisedChunk;
-				}
-				else
-					copy(orig, iter, back_inserter(optimisedItems));
+			unsigned threadCount = std::min<unsigned>(
+				std::max<unsigned>(1, std::thread::hardware_concurrency()),
+				static_cast<unsigned>(chunks.size())
+			);
+			if (threadCount <= 1)
+			{
+				for (size_t chunkIndex = 0; chunkIndex < chunks.size(); ++chunkIndex)
+					optimiseChunk(chunkIndex);
+			}
+			else
+			{
+				std::atomic<size_t> nextChunk{0};
+				std::exception_ptr workerException;
+				std::mutex exceptionMutex;
+				auto work = [&]() {
+					while (true)
+					{
+						size_t chunkIndex = nextChunk.fetch_add(1);
+						if (chunkIndex >= chunks.size())
+							break;
+						try
+						{
+							optimiseChunk(chunkIndex);
+						}
+						catch (...)
+						{
+							std::lock_guard<std::mutex> exceptionLock(exceptionMutex);
+							if (!workerException)
+								workerException = std::current_exception();
+							// Let the remaining workers drain the queue.
+							nextChunk.store(chunks.size());
+							break;
+						}
+					}
+				};
+				std::vector<std::thread> threads;
+				for (unsigned i = 1; i < threadCount; ++i)
+					threads.emplace_back(work);
+				work();
+				for (std::thread& thread: threads)
+					thread.join();
+				if (workerException)
+					std::rethrow_exception(workerException);
 			}
+
+			AssemblyItems optimisedItems;
+			optimisedItems.reserve(m_items.size());
+			for (size_t chunkIndex = 0; chunkIndex < chunks.size(); ++chunkIndex)
+				if (optimisedChunks[chunkIndex])
+					optimisedItems += std::move(*optimisedChunks[chunkIndex]);
+				else
+					copy(chunks[chunkIndex].first, chunks[chunkIndex].second, back_inserter(optimisedItems));
 			if (optimisedItems.size() < m_items.size())
 			{
 				m_items = std::move(optimisedItems);
-				count++;
+				version++;
 			}
 		}
 	}
@@ -836,16 +954,179 @@ std::map<u256, u256> const& Assembly::optimiseInternal(
 	return *m_tagReplacements;
 }
 
+namespace
+{
+
+/**
+ * Process-wide cache of assembled objects, keyed by the content hash of the assembly.
+ * Distinct assemblies with identical content are common when many contracts share runtime
+ * subobjects, e.g. minimal proxies or libraries compiled into several contracts. The cache
+ * assembles each distinct content only once and lets all copies share one linker object.
+ * Entries are never evicted.
+ */
+class AssembledObjectCache
+{
+public:
+	struct Entry
+	{
+		std::shared_ptr<LinkerObject const> object;
+		std::vector<size_t> tagPositions;
+	};
+
+	static AssembledObjectCache& instance()
+	{
+		static AssembledObjectCache cache;
+		return cache;
+	}
+
+	std::optional<Entry> lookup(util::h256 const& _contentHash)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto it = m_entries.find(_contentHash);
+		if (it == m_entries.end())
+			return std::nullopt;
+		return it->second;
+	}
+
+	void store(util::h256 const& _contentHash, Entry _entry)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_entries.emplace(_contentHash, std::move(_entry));
+	}
+
+private:
+	std::mutex m_mutex;
+	std::map<util::h256, Entry> m_entries;
+};
+
+}
+
+util::h256 Assembly::contentHash() const
+{
+	// Holding the lock while recursing into the sub-assemblies is fine for the same reason
+	// it is fine in Assembly::assemble: locks are only acquired in the direction from
+	// enclosing to nested assembly.
+	std::lock_guard contentHashLock(m_assembleMutex);
+	if (m_contentHash)
+		return *m_contentHash;
+
+	// The serialization covers everything the assembled linker object depends on. Members
+	// that only affect the text and JSON representations, like the name and the source
+	// locations, are deliberately left out.
+	bytes preimage;
+	auto appendSize = [&](size_t _value) { preimage += toBigEndian(u256(_value)); };
+	auto appendBytes = [&](bytes const& _data) { appendSize(_data.size()); preimage += _data; };
+	auto appendString = [&](std::string const& _str) { appendSize(_str.size()); preimage += asBytes(_str); };
+
+	appendString(m_evmVersion.name());
+	appendSize(m_usedTags);
+	appendSize(m_items.size());
+	for (AssemblyItem const& item: m_items)
+	{
+		preimage.push_back(static_cast<uint8_t>(item.type()));
+		if (item.type() == Operation)
+			preimage.push_back(static_cast<uint8_t>(item.instruction()));
+		else if (item.type() == VerbatimBytecode)
+			appendBytes(item.verbatimData());
+		else
+			preimage += toBigEndian(item.data());
+	}
+	appendSize(m_data.size());
+	for (auto const& [hash, data]: m_data)
+	{
+		preimage += hash.asBytes();
+		appendBytes(data);
+	}
+	appendBytes(m_auxiliaryData);
+	appendSize(m_libraries.size());
+	for (auto const& [hash, name]: m_libraries)
+	{
+		preimage += hash.asBytes();
+		appendString(name);
+	}
+	appendSize(m_immutables.size());
+	for (auto const& [hash, name]: m_immutables)
+	{
+		preimage += hash.asBytes();
+		appendString(name);
+	}
+	appendSize(m_namedTags.size());
+	for (auto const& [name, tagInfo]: m_namedTags)
+	{
+		appendString(name);
+		appendSize(tagInfo.id);
+		preimage.push_back(tagInfo.sourceID.has_value() ? 1 : 0);
+		appendSize(tagInfo.sourceID.value_or(0));
+		appendSize(tagInfo.params);
+		appendSize(tagInfo.returns);
+	}
+	appendSize(m_subPaths.size());
+	for (auto const& [path, subId]: m_subPaths)
+	{
+		appendSize(subId);
+		appendSize(path.size());
+		for (size_t element: path)
+			appendSize(element);
+	}
+	appendSize(m_subs.size());
+	for (auto const& sub: m_subs)
+		preimage += sub->contentHash().asBytes();
+
+	m_contentHash = keccak256(preimage);
+	return *m_contentHash;
+}
+
 LinkerObject const& Assembly::assemble() const
 {
 	assertThrow(!m_invalid, AssemblyException, "Attempted to assemble invalid Assembly object.");
+	// Computed before taking the lock: contentHash acquires the lock itself.
+	util::h256 contentHash = this->contentHash();
+	// The lock makes it safe to assemble a sub-assembly shared between multiple enclosing
+	// assemblies from multiple threads. Since sub-assemblies form a directed acyclic graph and
+	// locks are only acquired in the direction from enclosing to nested assembly, there can be
+	// no deadlock.
+	std::lock_guard assembleLock(m_assembleMutex);
 	// Return the already assembled object, if present.
-	if (!m_assembledObject.bytecode.empty())
-		return m_assembledObject;
-	// Otherwise ensure the object is actually clear.
-	assertThrow(m_assembledObject.linkReferences.empty(), AssemblyException, "Unexpected link references.");
+	if (m_assembledObject)
+		return *m_assembledObject;
 
-	LinkerObject& ret = m_assembledObject;
+	auto assembledObject = std::make_shared<LinkerObject>();
+	LinkerObject& ret = *assembledObject;
+
+	if (m_subs.size() >= 2)
+	{
+		// Sub-assemblies are independent of each other until their bytecode is merged into the
+		// enclosing object below, so they can be assembled concurrently. The calls to
+		// Assembly::assemble further down then return the cached objects.
+		std::vector<Assembly const*> subsToAssemble;
+		for (auto const& sub: m_subs)
+			if (!util::contains(subsToAssemble, sub.get()))
+				subsToAssemble.push_back(sub.get());
+
+		std::exception_ptr exception;
+		std::mutex exceptionMutex;
+		auto guardedAssemble = [&](Assembly const* _sub)
+		{
+			try
+			{
+				_sub->assemble();
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> exceptionLock(exceptionMutex);
+				if (!exception)
+					exception = std::current_exception();
+			}
+		};
+		std::vector<std::thread> threads;
+		for (size_t i = 1; i < subsToAssemble.size(); ++i)
+			threads.emplace_back(guardedAssemble, subsToAssemble[i]);
+		guardedAssemble(subsToAssemble.front());
+		for (std::thread& thread: threads)
+			thread.join();
+		if (exception)
+			std::rethrow_exception(exception);
+	}
 
 	size_t subTagSize = 1;
 	std::map<u256, std::pair<std::string, std::vector<size_t>>> immutableReferencesBySub;
@@ -884,12 +1165,51 @@ LinkerObject const& Assembly::assemble() const
 			"Cannot push and assign immutables in the same assembly subroutine."
 		);
 
+	if (std::optional<AssembledObjectCache::Entry> cached = AssembledObjectCache::instance().lookup(contentHash))
+	{
+		// The pushed values of PushSubSize items are normally recorded while the bytecode is
+		// generated; recompute them here so that the text and JSON representations of the
+		// assembly do not depend on whether the object came out of the cache.
+		for (AssemblyItem const& i: m_items)
+			if (i.type() == PushSubSize)
+				i.setPushedValue(u256(subAssemblyById(static_cast<size_t>(i.data()))->assemble().bytecode.size()));
+		m_tagPositionsInBytecode = std::move(cached->tagPositions);
+		m_assembledObject = std::move(cached->object);
+		return *m_assembledObject;
+	}
+
 	unsigned bytesRequiredForCode = codeSize(static_cast<unsigned>(subTagSize));
 	m_tagPositionsInBytecode = std::vector<size_t>(m_usedTags, std::numeric_limits<size_t>::max());
-	std::map<size_t, std::pair<size_t, size_t>> tagRef;
-	std::multimap<h256, unsigned> dataRef;
-	std::multimap<size_t, size_t> subRef;
+	// Patch lists for everything that can only be filled in once the code has been
+	// emitted. Flat vectors instead of node-based maps, so that recording a reference
+	// is an append into exactly reserved storage instead of a tree insertion.
+	std::vector<std::pair<size_t, std::pair<size_t, size_t>>> tagRef;
+	std::vector<std::pair<h256, unsigned>> dataRef;
+	std::vector<std::pair<size_t, size_t>> subRef;
 	std::vector<unsigned> sizeRef; ///< Pointers to code locations where the size of the program is inserted
+	{
+		size_t numTagRefs = 0;
+		size_t numDataRefs = 0;
+		size_t numSubRefs = 0;
+		for (AssemblyItem const& i: m_items)
+			switch (i.type())
+			{
+			case PushTag:
+				++numTagRefs;
+				break;
+			case PushData:
+				++numDataRefs;
+				break;
+			case PushSub:
+				++numSubRefs;
+				break;
+			default:
+				break;
+			}
+		tagRef.reserve(numTagRefs);
+		dataRef.reserve(numDataRefs);
+		subRef.reserve(numSubRefs);
+	}
 	unsigned bytesPerTag = numberEncodingSize(bytesRequiredForCode);
 	uint8_t tagPush = static_cast<uint8_t>(pushInstruction(bytesPerTag));
 
@@ -931,19 +1251,19 @@ LinkerObject const& Assembly::assemble() const
 		case PushTag:
 		{
 			ret.bytecode.push_back(tagPush);
-			tagRef[ret.bytecode.size()] = i.splitForeignPushTag();
+			tagRef.emplace_back(ret.bytecode.size(), i.splitForeignPushTag());
 			ret.bytecode.resize(ret.bytecode.size() + bytesPerTag);
 			break;
 		}
 		case PushData:
 			ret.bytecode.push_back(dataRefPush);
-			dataRef.insert(std::make_pair(h256(i.data()), ret.bytecode.size()));
+			dataRef.emplace_back(h256(i.data()), static_cast<unsigned>(ret.bytecode.size()));
 			ret.bytecode.resize(ret.bytecode.size() + bytesPerDataRef);
 			break;
 		case PushSub:
 			assertThrow(i.data() <= std::numeric_limits<size_t>::max(), AssemblyException, "");
 			ret.bytecode.push_back(dataRefPush);
-			subRef.insert(std::make_pair(static_cast<size_t>(i.data()), ret.bytecode.size()));
+			subRef.emplace_back(static_cast<size_t>(i.data()), ret.bytecode.size());
 			ret.bytecode.resize(ret.bytecode.size() + bytesPerDataRef);
 			break;
 		case PushSubSize:
@@ -1040,6 +1360,9 @@ LinkerObject const& Assembly::assemble() const
 		// Append an INVALID here to help tests find miscompilation.
 		ret.bytecode.push_back(static_cast<uint8_t>(Instruction::INVALID));
 
+	// Sorting by id (ties broken by the ascending bytecode offsets) appends the
+	// sub-assemblies in the same order the multimap iteration produced before.
+	std::sort(subRef.begin(), subRef.end());
 	std::map<LinkerObject, size_t> subAssemblyOffsets;
 	for (auto const& [subIdPath, bytecodeOffset]: subRef)
 	{
@@ -1095,17 +1418,24 @@ LinkerObject const& Assembly::assemble() const
 		};
 	}
 
-	for (auto const& dataItem: m_data)
+	// Sorting groups the references per data item; the ascending hash order matches
+	// the previous iteration over m_data, so the data is appended in the same order.
+	std::sort(dataRef.begin(), dataRef.end());
+	for (size_t begin = 0; begin < dataRef.size();)
 	{
-		auto references = dataRef.equal_range(dataItem.first);
-		if (references.first == references.second)
-			continue;
-		for (auto ref = references.first; ref != references.second; ++ref)
+		size_t end = begin;
+		while (end < dataRef.size() && dataRef[end].first == dataRef[begin].first)
+			++end;
+		if (auto dataIt = m_data.find(dataRef[begin].first); dataIt != m_data.end())
 		{
-			bytesRef r(ret.bytecode.data() + ref->second, bytesPerDataRef);
-			toBigEndian(ret.bytecode.size(), r);
+			for (size_t refIndex = begin; refIndex < end; ++refIndex)
+			{
+				bytesRef r(ret.bytecode.data() + dataRef[refIndex].second, bytesPerDataRef);
+				toBigEndian(ret.bytecode.size(), r);
+			}
+			ret.bytecode += dataIt->second;
 		}
-		ret.bytecode += dataItem.second;
+		begin = end;
 	}
 
 	ret.bytecode += m_auxiliaryData;
@@ -1115,6 +1445,9 @@ LinkerObject const& Assembly::assemble() const
 		bytesRef r(ret.bytecode.data() + pos, bytesPerDataRef);
 		toBigEndian(ret.bytecode.size(), r);
 	}
+
+	m_assembledObject = assembledObject;
+	AssembledObjectCache::instance().store(contentHash, {assembledObject, m_tagPositionsInBytecode});
 	return ret;
 }
 
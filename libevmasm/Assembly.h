@@ -39,6 +39,7 @@
 #include <sstream>
 #include <memory>
 #include <map>
+#include <mutex>
 #include <utility>
 
 namespace solidity::evmasm
@@ -53,6 +54,8 @@ public:
 
 	AssemblyItem newTag() { assertThrow(m_usedTags < 0xffffffff, AssemblyException, ""); return AssemblyItem(Tag, m_usedTags++); }
 	AssemblyItem newPushTag() { assertThrow(m_usedTags < 0xffffffff, AssemblyException, ""); return AssemblyItem(PushTag, m_usedTags++); }
+	/// @returns the number of tag ids used so far, i.e. the id the next created tag will get.
+	unsigned usedTags() const { return m_usedTags; }
 	/// Returns a tag identified by the given name. Creates it if it does not yet exist.
 	AssemblyItem namedTag(std::string const& _name, size_t _params, size_t _returns, std::optional<uint64_t> _sourceID);
 	AssemblyItem newData(bytes const& _data) { util::h256 h(util::keccak256(util::asString(_data))); m_data[h] = _data; return AssemblyItem(PushData, h); }
@@ -68,6 +71,8 @@ public:
 
 	AssemblyItem const& append(AssemblyItem _i);
 	AssemblyItem const& append(bytes const& _data) { return append(newData(_data)); }
+	/// Appends a run of plain instructions in one go, reserving the item storage upfront.
+	void appendInstructions(std::vector<Instruction> const& _instructions);
 
 	template <class T> Assembly& operator<<(T const& _d) { append(_d); return *this; }
 
@@ -110,13 +115,24 @@ public:
 	std::string const& name() const { return m_name; }
 
 	/// Changes the source location used for each appended item.
-	void setSourceLocation(langutil::SourceLocation const& _location) { m_currentSourceLocation = _location; }
+	void setSourceLocation(langutil::SourceLocation const& _location)
+	{
+		m_currentSourceLocation = _location;
+		m_currentSourceLocationId = langutil::SourceLocationPool::instance().id(_location);
+	}
 	langutil::SourceLocation const& currentSourceLocation() const { return m_currentSourceLocation; }
 	langutil::EVMVersion const& evmVersion() const { return m_evmVersion; }
 
 	/// Assembles the assembly into bytecode. The assembly should not be modified after this call, since the assembled version is cached.
+	/// Sub-assemblies are assembled concurrently. It is safe to call this from multiple threads
+	/// on assemblies sharing sub-assemblies.
 	LinkerObject const& assemble() const;
 
+	/// @returns a hash identifying the assembled output of this assembly. Two assemblies with
+	/// the same content hash assemble to identical linker objects, even if they are distinct
+	/// objects. The hash is cached, so the assembly should not be modified after this call.
+	util::h256 contentHash() const;
+
 	struct OptimiserSettings
 	{
 		bool runInliner = false;
@@ -235,7 +251,13 @@ protected:
 	/// If set, it means the optimizer has run and we will not run it again.
 	std::optional<std::map<u256, u256>> m_tagReplacements;
 
-	mutable LinkerObject m_assembledObject;
+	/// Guards the lazy assembly of this object, so that a sub-assembly shared between multiple
+	/// enclosing assemblies can be assembled from multiple threads.
+	mutable std::mutex m_assembleMutex;
+	/// Held by a shared pointer so that assemblies with identical content can share one
+	/// assembled object instead of each storing their own copy of the bytecode.
+	mutable std::shared_ptr<LinkerObject const> m_assembledObject;
+	mutable std::optional<util::h256> m_contentHash;
 	mutable std::vector<size_t> m_tagPositionsInBytecode;
 
 	langutil::EVMVersion m_evmVersion;
@@ -247,6 +269,9 @@ protected:
 	/// currently
 	std::string m_name;
 	langutil::SourceLocation m_currentSourceLocation;
+	/// Id of @a m_currentSourceLocation in the SourceLocationPool, cached so that
+	/// appending an item stamps it without interning the location again.
+	uint32_t m_currentSourceLocationId = langutil::SourceLocationPool::emptyId;
 
 	// FIXME: This being static means that the strings won't be freed when they're no longer needed
 	static std::map<std::string, std::shared_ptr<std::string const>> s_sharedSourceNames;
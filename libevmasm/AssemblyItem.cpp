@@ -25,8 +25,10 @@
 #include <libsolutil/Numeric.h>
 #include <libsolutil/StringUtils.h>
 #include <libsolutil/FixedHash.h>
+#include <libsolutil/FlatHashMap.h>
 #include <liblangutil/SourceLocation.h>
 
+#include <charconv>
 #include <fstream>
 #include <limits>
 
@@ -74,7 +76,7 @@ std::pair<std::string, std::string> AssemblyItem::nameAndData(langutil::EVMVersi
 	switch (type())
 	{
 	case Operation:
-		return {instructionInfo(instruction(), _evmVersion).name, m_data != nullptr ? toStringInHex(*m_data) : ""};
+		return {instructionInfo(instruction(), _evmVersion).name, ""};
 	case Push:
 		return {"PUSH", toStringInHex(data())};
 	case PushTag:
@@ -429,6 +431,21 @@ std::string AssemblyItem::computeSourceMapping(
 )
 {
 	std::string ret;
+	// Six characters per item - delta encoding elides most fields - is a generous
+	// estimate that avoids repeated reallocation of the output buffer.
+	ret.reserve(_items.size() * 6);
+
+	/// The fields of a mapping entry that only depend on the source location, cached
+	/// per interned location id since runs of consecutive items share few distinct
+	/// locations and the source index lookup walks a string-keyed map.
+	struct LocationFields { int start; int length; int sourceIndex; };
+	util::FlatHashMap<uint32_t, LocationFields> fieldsPerLocation;
+
+	auto appendInt = [&ret](int _value) {
+		char buffer[12];
+		std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), _value);
+		ret.append(buffer, result.ptr);
+	};
 
 	int prevStart = -1;
 	int prevLength = -1;
@@ -439,14 +456,20 @@ std::string AssemblyItem::computeSourceMapping(
 	for (auto const& item: _items)
 	{
 		if (!ret.empty())
-			ret += ";";
-
-		SourceLocation const& location = item.location();
-		int length = location.start != -1 && location.end != -1 ? location.end - location.start : -1;
-		int sourceIndex =
-			(location.sourceName && _sourceIndicesMap.count(*location.sourceName)) ?
-			static_cast<int>(_sourceIndicesMap.at(*location.sourceName)) :
-			-1;
+			ret += ';';
+
+		auto [fieldsIt, inserted] = fieldsPerLocation.try_emplace(item.locationId());
+		if (inserted)
+		{
+			SourceLocation const& location = item.location();
+			auto sourceIndexIt = location.sourceName ? _sourceIndicesMap.find(*location.sourceName) : _sourceIndicesMap.end();
+			fieldsIt->second = LocationFields{
+				location.start,
+				location.start != -1 && location.end != -1 ? location.end - location.start : -1,
+				sourceIndexIt != _sourceIndicesMap.end() ? static_cast<int>(sourceIndexIt->second) : -1
+			};
+		}
+		auto const& [start, length, sourceIndex] = fieldsIt->second;
 		char jump = '-';
 		if (item.getJumpType() == evmasm::AssemblyItem::JumpType::IntoFunction)
 			jump = 'i';
@@ -467,7 +490,7 @@ std::string AssemblyItem::computeSourceMapping(
 					if (length == prevLength)
 					{
 						components--;
-						if (location.start == prevStart)
+						if (start == prevStart)
 							components--;
 					}
 				}
@@ -476,18 +499,18 @@ std::string AssemblyItem::computeSourceMapping(
 
 		if (components-- > 0)
 		{
-			if (location.start != prevStart)
-				ret += std::to_string(location.start);
+			if (start != prevStart)
+				appendInt(start);
 			if (components-- > 0)
 			{
 				ret += ':';
 				if (length != prevLength)
-					ret += std::to_string(length);
+					appendInt(length);
 				if (components-- > 0)
 				{
 					ret += ':';
 					if (sourceIndex != prevSourceIndex)
-						ret += std::to_string(sourceIndex);
+						appendInt(sourceIndex);
 					if (components-- > 0)
 					{
 						ret += ':';
@@ -497,7 +520,7 @@ std::string AssemblyItem::computeSourceMapping(
 						{
 							ret += ':';
 							if (modifierDepth != prevModifierDepth)
-								ret += std::to_string(modifierDepth);
+								appendInt(modifierDepth);
 						}
 					}
 				}
@@ -505,9 +528,9 @@ std::string AssemblyItem::computeSourceMapping(
 		}
 
 		if (item.opcodeCount() > 1)
-			ret += std::string(item.opcodeCount() - 1, ';');
+			ret.append(item.opcodeCount() - 1, ';');
 
-		prevStart = location.start;
+		prevStart = start;
 		prevLength = length;
 		prevSourceIndex = sourceIndex;
 		prevJump = jump;
@@ -25,6 +25,7 @@
 #include <libevmasm/Instruction.h>
 #include <libevmasm/Exceptions.h>
 #include <liblangutil/SourceLocation.h>
+#include <liblangutil/SourceLocationPool.h>
 #include <libsolutil/Common.h>
 #include <libsolutil/Numeric.h>
 #include <libsolutil/Assertions.h>
@@ -69,16 +70,16 @@ public:
 	AssemblyItem(Instruction _i, langutil::SourceLocation _location = langutil::SourceLocation()):
 		m_type(Operation),
 		m_instruction(_i),
-		m_location(std::move(_location))
+		m_locationId(langutil::SourceLocationPool::instance().id(_location))
 	{}
 	AssemblyItem(AssemblyItemType _type, u256 _data = 0, langutil::SourceLocation _location = langutil::SourceLocation()):
 		m_type(_type),
-		m_location(std::move(_location))
+		m_locationId(langutil::SourceLocationPool::instance().id(_location))
 	{
 		if (m_type == Operation)
 			m_instruction = Instruction(uint8_t(_data));
 		else
-			m_data = std::make_shared<u256>(std::move(_data));
+			m_data = std::move(_data);
 	}
 	explicit AssemblyItem(bytes _verbatimData, size_t _arguments, size_t _returnVariables):
 		m_type(VerbatimBytecode),
@@ -103,8 +104,8 @@ public:
 	void setPushTagSubIdAndTag(size_t _subId, size_t _tag);
 
 	AssemblyItemType type() const { return m_type; }
-	u256 const& data() const { assertThrow(m_type != Operation, util::Exception, ""); return *m_data; }
-	void setData(u256 const& _data) { assertThrow(m_type != Operation, util::Exception, ""); m_data = std::make_shared<u256>(_data); }
+	u256 const& data() const { assertThrow(m_type != Operation, util::Exception, ""); return m_data; }
+	void setData(u256 const& _data) { assertThrow(m_type != Operation, util::Exception, ""); m_data = _data; }
 
 	/// This function is used in `Assembly::assemblyJSON`.
 	/// It returns the name & data of the current assembly item.
@@ -170,8 +171,12 @@ public:
 	/// @returns true if the assembly item can be used in a functional context.
 	bool canBeFunctional() const;
 
-	void setLocation(langutil::SourceLocation const& _location) { m_location = _location; }
-	langutil::SourceLocation const& location() const { return m_location; }
+	void setLocation(langutil::SourceLocation const& _location) { m_locationId = langutil::SourceLocationPool::instance().id(_location); }
+	langutil::SourceLocation const& location() const { return langutil::SourceLocationPool::instance().location(m_locationId); }
+	/// Id of the location in the SourceLocationPool, for copying locations between
+	/// items without resolving them.
+	uint32_t locationId() const { return m_locationId; }
+	void setLocationId(uint32_t _locationId) { m_locationId = _locationId; }
 
 	void setJumpType(JumpType _jumpType) { m_jumpType = _jumpType; }
 	static std::optional<JumpType> parseJumpType(std::string const& _jumpType);
@@ -192,11 +197,15 @@ private:
 
 	AssemblyItemType m_type;
 	Instruction m_instruction; ///< Only valid if m_type == Operation
-	std::shared_ptr<u256> m_data; ///< Only valid if m_type != Operation
+	/// Only valid if m_type != Operation. Stored inline so that creating and copying
+	/// items does not allocate.
+	u256 m_data;
 	/// If m_type == VerbatimBytecode, this holds number of arguments, number of
 	/// return variables and verbatim bytecode.
 	std::optional<std::tuple<size_t, size_t, bytes>> m_verbatimBytecode;
-	langutil::SourceLocation m_location;
+	/// The source location interned in the SourceLocationPool. Kept as an id so that
+	/// copying items is trivial and does not touch the source name reference count.
+	uint32_t m_locationId = langutil::SourceLocationPool::emptyId;
 	JumpType m_jumpType = JumpType::Ordinary;
 	/// Pushed value for operations with data to be determined during assembly stage,
 	/// e.g. PushSubSize, PushTag, PushSub, etc.
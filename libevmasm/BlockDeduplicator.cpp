@@ -27,8 +27,10 @@
 #include <libevmasm/AssemblyItem.h>
 #include <libevmasm/SemanticInformation.h>
 
-#include <functional>
-#include <set>
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <vector>
 
 using namespace solidity;
 using namespace solidity::evmasm;
@@ -48,48 +50,94 @@ bool BlockDeduplicator::deduplicate()
 	)
 		return false;
 
-	std::function<bool(size_t, size_t)> comparator = [&](size_t _i, size_t _j)
+	using diff_type = BlockIterator::difference_type;
+	BlockIterator end{m_items.end(), m_items.end()};
+
+	// To compare recursive loops, we have to already unify PushTag opcodes of the
+	// block's own tag.
+	auto pushOwnTag = [&](size_t _i)
 	{
-		if (_i == _j)
-			return false;
+		if (_i < m_items.size() && m_items.at(_i).type() == Tag)
+			return m_items.at(_i).pushTag();
+		return pushSelf;
+	};
 
-		// To compare recursive loops, we have to already unify PushTag opcodes of the
-		// block's own tag.
-		AssemblyItem pushFirstTag{pushSelf};
-		AssemblyItem pushSecondTag{pushSelf};
+	// Content hash of the block starting at _i under the normalization above. Blocks with
+	// equal content always hash equally, so only hash-equal blocks have to be compared.
+	auto hashBlock = [&](size_t _i)
+	{
+		AssemblyItem pushTag = pushOwnTag(_i);
+		BlockIterator it{m_items.begin() + diff_type(_i), m_items.end(), &pushTag, &pushSelf};
+		if (it != end && (*it).type() == Tag)
+			++it;
+		// FNV-1a
+		uint64_t hash = 14695981039346656037u;
+		auto feed = [&](uint64_t _value) {
+			for (size_t byte = 0; byte < 8; ++byte)
+			{
+				hash ^= _value & 0xff;
+				hash *= 1099511628211u;
+				_value >>= 8;
+			}
+		};
+		for (; it != end; ++it)
+		{
+			AssemblyItem const& item = *it;
+			feed(static_cast<uint64_t>(item.type()));
+			if (item.type() == Operation)
+				feed(static_cast<uint64_t>(item.instruction()));
+			else if (item.type() == VerbatimBytecode)
+				for (uint8_t byte: item.verbatimData())
+					feed(byte);
+			else
+				for (size_t word = 0; word < 4; ++word)
+					feed(static_cast<uint64_t>(item.data() >> (64 * word)));
+		}
+		return hash;
+	};
 
-		if (_i < m_items.size() && m_items.at(_i).type() == Tag)
-			pushFirstTag = m_items.at(_i).pushTag();
-		if (_j < m_items.size() && m_items.at(_j).type() == Tag)
-			pushSecondTag = m_items.at(_j).pushTag();
+	auto blocksEqual = [&](size_t _i, size_t _j)
+	{
+		AssemblyItem pushFirstTag = pushOwnTag(_i);
+		AssemblyItem pushSecondTag = pushOwnTag(_j);
 
-		using diff_type = BlockIterator::difference_type;
 		BlockIterator first{m_items.begin() + diff_type(_i), m_items.end(), &pushFirstTag, &pushSelf};
 		BlockIterator second{m_items.begin() + diff_type(_j), m_items.end(), &pushSecondTag, &pushSelf};
-		BlockIterator end{m_items.end(), m_items.end()};
 
 		if (first != end && (*first).type() == Tag)
 			++first;
 		if (second != end && (*second).type() == Tag)
 			++second;
 
-		return std::lexicographical_compare(first, end, second, end);
+		return std::equal(first, end, second, end);
 	};
 
 	size_t iterations = 0;
 	for (; ; ++iterations)
 	{
-		//@todo this should probably be optimized.
-		std::set<size_t, std::function<bool(size_t, size_t)>> blocksSeen(comparator);
+		std::map<uint64_t, std::vector<size_t>> blocksByHash;
 		for (size_t i = 0; i < m_items.size(); ++i)
+			if (m_items.at(i).type() == Tag)
+				blocksByHash[hashBlock(i)].push_back(i);
+
+		for (auto const& [hash, blocks]: blocksByHash)
 		{
-			if (m_items.at(i).type() != Tag)
-				continue;
-			auto it = blocksSeen.find(i);
-			if (it == blocksSeen.end())
-				blocksSeen.insert(i);
-			else
-				m_replacedTags[m_items.at(i).data()] = m_items.at(*it).data();
+			// Within a bucket the block with the lowest index that has a given content
+			// becomes the representative of all later blocks with the same content.
+			std::vector<size_t> representatives;
+			for (size_t i: blocks)
+			{
+				bool replaced = false;
+				for (size_t representative: representatives)
+					if (blocksEqual(representative, i))
+					{
+						m_replacedTags[m_items.at(i).data()] = m_items.at(representative).data();
+						replaced = true;
+						break;
+					}
+				if (!replaced)
+					representatives.push_back(i);
+			}
 		}
 
 		if (!applyTagReplacement(m_items, m_replacedTags))
@@ -74,6 +74,13 @@ public:
 	template <class AssemblyItemIterator>
 	AssemblyItemIterator feedItems(AssemblyItemIterator _iterator, AssemblyItemIterator _end, bool _msizeImportant);
 
+	/// @returns the iterator feedItems() would return for the given range without feeding
+	/// anything, i.e. the end of the chunk an eliminator instance would work on. Allows
+	/// determining all chunk bounds up front so that the chunks can be processed
+	/// independently.
+	template <class AssemblyItemIterator>
+	static AssemblyItemIterator chunkEnd(AssemblyItemIterator _iterator, AssemblyItemIterator _end, bool _msizeImportant);
+
 	/// @returns the resulting items after optimization.
 	AssemblyItems getOptimizedItems();
 
@@ -93,6 +100,9 @@ private:
 	/// The item that breaks the basic block, can be nullptr.
 	/// It is usually appended to the block but can be optimized in some cases.
 	AssemblyItem const* m_breakingItem = nullptr;
+
+	/// Maximum number of items feedItems() accepts before forcing a chunk break.
+	static unsigned constexpr maxChunkSize = 2000;
 };
 
 /**
@@ -179,7 +189,6 @@ AssemblyItemIterator CommonSubexpressionEliminator::feedItems(
 )
 {
 	assertThrow(!m_breakingItem, OptimizerException, "Invalid use of CommonSubexpressionEliminator.");
-	unsigned const maxChunkSize = 2000;
 	unsigned chunkSize = 0;
 	for (
 		;
@@ -192,4 +201,25 @@ AssemblyItemIterator CommonSubexpressionEliminator::feedItems(
 	return _iterator;
 }
 
+template <class AssemblyItemIterator>
+AssemblyItemIterator CommonSubexpressionEliminator::chunkEnd(
+	AssemblyItemIterator _iterator,
+	AssemblyItemIterator _end,
+	bool _msizeImportant
+)
+{
+	// Has to mirror the loop of feedItems().
+	unsigned chunkSize = 0;
+	for (
+		;
+		_iterator != _end && !SemanticInformation::breaksCSEAnalysisBlock(*_iterator, _msizeImportant) && chunkSize < maxChunkSize;
+		++_iterator, ++chunkSize
+	)
+	{
+	}
+	if (_iterator != _end && chunkSize < maxChunkSize)
+		++_iterator;
+	return _iterator;
+}
+
 }
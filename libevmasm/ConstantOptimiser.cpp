@@ -24,9 +24,55 @@
 #include <libevmasm/Assembly.h>
 #include <libevmasm/GasMeter.h>
 
+#include <mutex>
+#include <optional>
+#include <tuple>
+
 using namespace solidity;
 using namespace solidity::evmasm;
 
+namespace
+{
+
+/**
+ * Process-wide memo of the routines found by ComputeMethod's representation search.
+ * The chosen routine depends on all gas-relevant parameters, so they are all part of
+ * the key. Identical constants - addresses and hashes in particular - recur across
+ * subassemblies and contracts and would otherwise re-run the same bounded search
+ * every time. Entries are never evicted.
+ */
+class RepresentationCache
+{
+public:
+	static RepresentationCache& instance()
+	{
+		static RepresentationCache cache;
+		return cache;
+	}
+
+	using Key = std::tuple<u256, bool, size_t, size_t, langutil::EVMVersion>;
+
+	std::optional<AssemblyItems> lookup(Key const& _key)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (auto it = m_representations.find(_key); it != m_representations.end())
+			return it->second;
+		return std::nullopt;
+	}
+
+	void store(Key const& _key, AssemblyItems const& _routine)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_representations.emplace(_key, _routine);
+	}
+
+private:
+	std::mutex m_mutex;
+	std::map<Key, AssemblyItems> m_representations;
+};
+
+}
+
 unsigned ConstantOptimisationMethod::optimiseConstants(
 	bool _isCreation,
 	size_t _runs,
@@ -186,6 +232,16 @@ AssemblyItems const& CodeCopyMethod::copyRoutine()
 	return copyRoutine;
 }
 
+AssemblyItems ComputeMethod::cachedFindRepresentation()
+{
+	RepresentationCache::Key key{m_value, m_params.isCreation, m_params.runs, m_params.multiplicity, m_params.evmVersion};
+	if (auto routine = RepresentationCache::instance().lookup(key))
+		return std::move(*routine);
+	AssemblyItems routine = findRepresentation(m_value);
+	RepresentationCache::instance().store(key, routine);
+	return routine;
+}
+
 AssemblyItems ComputeMethod::findRepresentation(u256 const& _value)
 {
 	if (_value < 0x10000)
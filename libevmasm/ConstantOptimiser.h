@@ -135,7 +135,7 @@ public:
 	explicit ComputeMethod(Params const& _params, u256 const& _value):
 		ConstantOptimisationMethod(_params, _value)
 	{
-		m_routine = findRepresentation(m_value);
+		m_routine = cachedFindRepresentation();
 		assertThrow(
 			checkRepresentation(m_value, m_routine),
 			OptimizerException,
@@ -150,6 +150,9 @@ public:
 	}
 
 protected:
+	/// Returns the memoized result of @a findRepresentation for the value and
+	/// gas parameters of this instance, running the search on a cache miss.
+	AssemblyItems cachedFindRepresentation();
 	/// Tries to recursively find a way to compute @a _value.
 	AssemblyItems findRepresentation(u256 const& _value);
 	/// Recomputes the value from the calculated representation and checks for correctness.
@@ -27,48 +27,51 @@ using namespace solidity::util;
 using namespace solidity::evmasm;
 
 
+namespace
+{
+
+/// @returns the immediate of @a _view as a number, with immediates truncated
+/// by the end of the code padded with zeros, as if the code went on.
+u256 paddedImmediate(InstructionView const& _view, langutil::EVMVersion _evmVersion)
+{
+	u256 data{};
+	for (uint8_t immediateByte: _view.immediate)
+	{
+		data <<= 8;
+		data |= immediateByte;
+	}
+	size_t width = 0;
+	if (isValidInstruction(_view.instruction))
+		width = static_cast<size_t>(instructionInfo(_view.instruction, _evmVersion).additional);
+	data <<= 8 * (width - _view.immediate.size());
+	return data;
+}
+
+}
+
 void solidity::evmasm::eachInstruction(
 	bytes const& _mem,
 	langutil::EVMVersion _evmVersion,
 	std::function<void(Instruction,u256 const&)> const& _onInstruction
 )
 {
-	for (auto it = _mem.begin(); it < _mem.end(); ++it)
-	{
-		Instruction const instr{*it};
-		int additional = 0;
-		if (isValidInstruction(instr))
-			additional = instructionInfo(instr, _evmVersion).additional;
-
-		u256 data{};
-
-		// fill the data with the additional data bytes from the instruction stream
-		while (additional > 0 && std::next(it) < _mem.end())
-		{
-			data <<= 8;
-			data |= *++it;
-			--additional;
-		}
-
-		// pad the remaining number of additional octets with zeros
-		data <<= 8 * additional;
-
-		_onInstruction(instr, data);
-	}
+	eachInstructionView(_mem, _evmVersion, [&](InstructionView const& _view) {
+		_onInstruction(_view.instruction, paddedImmediate(_view, _evmVersion));
+	});
 }
 
 std::string solidity::evmasm::disassemble(bytes const& _mem, langutil::EVMVersion _evmVersion, std::string const& _delimiter)
 {
 	std::stringstream ret;
-	eachInstruction(_mem, _evmVersion, [&](Instruction _instr, u256 const& _data) {
-		if (!isValidInstruction(_instr))
-			ret << "0x" << std::uppercase << std::hex << static_cast<int>(_instr) << _delimiter;
+	eachInstructionView(_mem, _evmVersion, [&](InstructionView const& _view) {
+		if (!isValidInstruction(_view.instruction))
+			ret << "0x" << std::uppercase << std::hex << static_cast<int>(_view.instruction) << _delimiter;
 		else
 		{
-			InstructionInfo info = instructionInfo(_instr, _evmVersion);
+			InstructionInfo info = instructionInfo(_view.instruction, _evmVersion);
 			ret << info.name;
 			if (info.additional)
-				ret << " 0x" << std::uppercase << std::hex << _data;
+				ret << " 0x" << std::uppercase << std::hex << paddedImmediate(_view, _evmVersion);
 			ret << _delimiter;
 		}
 	});
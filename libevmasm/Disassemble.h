@@ -23,13 +23,43 @@
 
 #include <libevmasm/Instruction.h>
 
+#include <algorithm>
 #include <functional>
 #include <string>
 
 namespace solidity::evmasm
 {
 
+/// View of one decoded instruction inside a bytecode blob.
+struct InstructionView
+{
+	/// Offset of the opcode byte within the disassembled code.
+	size_t offset = 0;
+	Instruction instruction{};
+	/// Immediate argument bytes as present in the code. Can be shorter than the
+	/// instruction's immediate width if the code ends inside the immediate.
+	bytesConstRef immediate;
+};
+
+/// Iterate through EVM code and call @a _onInstruction with a view of each
+/// instruction. The views point into @a _code and no allocations are performed.
+template<typename Callback>
+void eachInstructionView(bytes const& _code, langutil::EVMVersion _evmVersion, Callback&& _onInstruction)
+{
+	for (size_t offset = 0; offset < _code.size(); ++offset)
+	{
+		Instruction const instr{_code[offset]};
+		size_t immediateSize = 0;
+		if (isValidInstruction(instr))
+			immediateSize = static_cast<size_t>(instructionInfo(instr, _evmVersion).additional);
+		size_t available = std::min(immediateSize, _code.size() - offset - 1);
+		_onInstruction(InstructionView{offset, instr, bytesConstRef(_code.data() + offset + 1, available)});
+		offset += available;
+	}
+}
+
 /// Iterate through EVM code and call a function on each instruction.
+/// Immediates truncated by the end of the code are padded with zeros.
 void eachInstruction(bytes const& _mem, langutil::EVMVersion _evmVersion, std::function<void(Instruction, u256 const&)> const& _onInstruction);
 
 /// Convert from EVM code to simple EVM assembly language.
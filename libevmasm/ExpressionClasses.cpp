@@ -109,8 +109,9 @@ ExpressionClasses::Id ExpressionClasses::find(
 		exp.id = static_cast<Id>(m_representatives.size());
 		m_representatives.push_back(exp);
 	}
-	m_expressions.insert(exp);
-	return exp.id;
+	Id resultId = exp.id;
+	m_expressions.insert(std::move(exp));
+	return resultId;
 }
 
 void ExpressionClasses::forceEqual(
@@ -131,7 +132,7 @@ void ExpressionClasses::forceEqual(
 	if (_copyItem)
 		exp.item = storeItem(_item);
 
-	m_expressions.insert(exp);
+	m_expressions.insert(std::move(exp));
 }
 
 ExpressionClasses::Id ExpressionClasses::newClass(SourceLocation const& _location)
@@ -140,8 +141,8 @@ ExpressionClasses::Id ExpressionClasses::newClass(SourceLocation const& _locatio
 	exp.id = static_cast<Id>(m_representatives.size());
 	exp.item = storeItem(AssemblyItem(UndefinedItem, (u256(1) << 255) + exp.id, _location));
 	m_representatives.push_back(exp);
-	m_expressions.insert(exp);
-	return exp.id;
+	m_expressions.insert(std::move(exp));
+	return m_representatives.back().id;
 }
 
 bool ExpressionClasses::knownToBeDifferent(ExpressionClasses::Id _a, ExpressionClasses::Id _b)
@@ -170,7 +171,7 @@ bool ExpressionClasses::knownNonZero(Id _c)
 
 u256 const* ExpressionClasses::knownConstant(Id _c)
 {
-	std::map<unsigned, Expression const*> matchGroups;
+	SimplificationMatchGroups<Expression> matchGroups;
 	Pattern constant(Push);
 	constant.setMatchGroup(1, matchGroups);
 	if (!constant.matches(representative(_c), *this))
@@ -180,8 +181,21 @@ u256 const* ExpressionClasses::knownConstant(Id _c)
 
 AssemblyItem const* ExpressionClasses::storeItem(AssemblyItem const& _item)
 {
-	m_spareAssemblyItems.push_back(std::make_shared<AssemblyItem>(_item));
-	return m_spareAssemblyItems.back().get();
+	if (_item.type() == Push)
+	{
+		// Constants are pooled by value because the simplification rules produce the same
+		// values over and over again. Items that only differ in their debug information are
+		// kept apart so that source mappings stay intact.
+		std::vector<AssemblyItem const*>& pooled = m_pooledConstants[_item.data()];
+		for (AssemblyItem const* candidate: pooled)
+			if (candidate->location() == _item.location() && candidate->m_modifierDepth == _item.m_modifierDepth)
+				return candidate;
+		m_spareAssemblyItems.emplace_back(_item);
+		pooled.emplace_back(&m_spareAssemblyItems.back());
+		return pooled.back();
+	}
+	m_spareAssemblyItems.emplace_back(_item);
+	return &m_spareAssemblyItems.back();
 }
 
 std::string ExpressionClasses::fullDAGToString(ExpressionClasses::Id _id) const
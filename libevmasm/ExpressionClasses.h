@@ -28,6 +28,8 @@
 
 #include <libsolutil/Common.h>
 
+#include <deque>
+#include <map>
 #include <memory>
 #include <unordered_set>
 #include <vector>
@@ -129,7 +131,12 @@ private:
 	std::vector<Expression> m_representatives;
 	/// All expression ever encountered.
 	std::unordered_set<Expression, Expression::ExpressionHash> m_expressions;
-	std::vector<std::shared_ptr<AssemblyItem>> m_spareAssemblyItems;
+	/// Storage for items whose lifetime has to be tied to this object. A deque so that the
+	/// stored items have stable addresses while allocating in chunks instead of per item.
+	std::deque<AssemblyItem> m_spareAssemblyItems;
+	/// Pointers into m_spareAssemblyItems for plain constants, keyed by value, so that the
+	/// many identical constants produced by the simplification rules are stored only once.
+	std::map<u256, std::vector<AssemblyItem const*>> m_pooledConstants;
 };
 
 }
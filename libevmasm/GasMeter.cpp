@@ -262,7 +262,9 @@ unsigned GasMeter::runGas(Instruction _instruction, langutil::EVMVersion _evmVer
 	if (_instruction == Instruction::JUMPDEST)
 		return 1;
 
-	switch (instructionInfo(_instruction, _evmVersion).gasPriceTier)
+	// NOTE: Gas price tiers are the same across all EVM versions, so this is a plain
+	// table lookup and does not have to construct the full instruction info.
+	switch (instructionGasPriceTier(_instruction))
 	{
 	case Tier::Zero:    return GasCosts::tier0Gas;
 	case Tier::Base:    return GasCosts::tier1Gas;
@@ -235,13 +235,14 @@ std::optional<AssemblyItem> Inliner::shouldInline(size_t _tag, AssemblyItem cons
 }
 
 
-void Inliner::optimise()
+bool Inliner::optimise()
 {
 	std::map<size_t, InlinableBlock> inlinableBlocks = determineInlinableBlocks(m_items);
 
 	if (inlinableBlocks.empty())
-		return;
+		return false;
 
+	bool inlined = false;
 	AssemblyItems newItems;
 	for (auto it = m_items.begin(); it != m_items.end(); ++it)
 	{
@@ -268,6 +269,7 @@ void Inliner::optimise()
 											++block->pushTagCount;
 
 							// Skip the original jump to the inlined tag and continue.
+							inlined = true;
 							++it;
 							continue;
 						}
@@ -277,4 +279,5 @@ void Inliner::optimise()
 	}
 
 	m_items = std::move(newItems);
+	return inlined;
 }
@@ -53,7 +53,8 @@ public:
 	}
 	virtual ~Inliner() = default;
 
-	void optimise();
+	/// @returns true if any jump was inlined.
+	bool optimise();
 
 private:
 	struct InlinableBlock
@@ -310,6 +310,11 @@ struct InstructionInfo
 /// Information on all the instructions.
 InstructionInfo instructionInfo(Instruction _inst, langutil::EVMVersion _evmVersion);
 
+/// @returns the gas price tier of the instruction or Tier::Invalid for invalid instructions.
+/// Cheaper than instructionInfo() since no name string needs to be constructed and the same
+/// across all EVM versions.
+Tier instructionGasPriceTier(Instruction _inst);
+
 /// check whether instructions exists.
 bool isValidInstruction(Instruction _inst);
 
@@ -149,7 +149,8 @@ public:
 	std::map<int, Id> const& stackElements() const { return m_stackElements; }
 	ExpressionClasses& expressionClasses() const { return *m_expressionClasses; }
 
-	std::map<Id, Id> const& storageContent() const { return m_storageContent; }
+	std::map<Id, Id> const& storageContent() const { return *m_storageContent; }
+	std::map<Id, Id> const& memoryContent() const { return *m_memoryContent; }
 
 private:
 	/// Assigns a new equivalence class to the next sequence number of the given stack element.
@@ -175,6 +176,46 @@ private:
 	/// @returns a new or already used Id representing the given set of tags.
 	Id tagUnion(std::set<u256> _tags);
 
+	/// Copy-on-write handle for the knowledge containers. Copying a state (which happens at
+	/// every control flow split) only bumps a reference count; the container is cloned
+	/// lazily as soon as one of the copies modifies it.
+	template<typename Container>
+	class Shared
+	{
+	public:
+		Shared(): m_container(std::make_shared<Container>()) {}
+		Shared& operator=(Container _container)
+		{
+			m_container = std::make_shared<Container>(std::move(_container));
+			return *this;
+		}
+		Container const& operator*() const { return *m_container; }
+		Container const* operator->() const { return m_container.get(); }
+		/// @returns a mutable reference to the container, cloning it first if it is shared.
+		Container& mutableContainer()
+		{
+			if (m_container.use_count() != 1)
+				m_container = std::make_shared<Container>(*m_container);
+			return *m_container;
+		}
+		void clear()
+		{
+			if (m_container.use_count() == 1)
+				m_container->clear();
+			else
+				m_container = std::make_shared<Container>();
+		}
+		/// @returns true if both handles refer to the same container object.
+		bool sharesContainerWith(Shared const& _other) const { return m_container == _other.m_container; }
+		bool operator==(Shared const& _other) const
+		{
+			return sharesContainerWith(_other) || *m_container == *_other.m_container;
+		}
+		bool operator!=(Shared const& _other) const { return !(*this == _other); }
+	private:
+		std::shared_ptr<Container> m_container;
+	};
+
 	/// Current stack height, can be negative.
 	int m_stackHeight = 0;
 	/// Current stack layout, mapping stack height -> equivalence class
@@ -182,18 +223,18 @@ private:
 	/// Current sequence number, this is incremented with each modification to storage or memory.
 	unsigned m_sequenceNumber = 1;
 	/// Knowledge about storage content.
-	std::map<Id, Id> m_storageContent;
+	Shared<std::map<Id, Id>> m_storageContent;
 	/// Knowledge about memory content. Keys are memory addresses, note that the values overlap
 	/// and are not contained here if they are not completely known.
-	std::map<Id, Id> m_memoryContent;
+	Shared<std::map<Id, Id>> m_memoryContent;
 	/// Keeps record of all Keccak-256 hashes that are computed. The first parameter in the
 	/// std::pair corresponds to memory content and the second parameter corresponds to the length
 	/// that is accessed.
-	std::map<std::pair<std::vector<Id>, unsigned>, Id> m_knownKeccak256Hashes;
+	Shared<std::map<std::pair<std::vector<Id>, unsigned>, Id>> m_knownKeccak256Hashes;
 	/// Structure containing the classes of equivalent expressions.
 	std::shared_ptr<ExpressionClasses> m_expressionClasses;
 	/// Container for unions of tags stored on the stack.
-	boost::bimap<Id, std::set<u256>> m_tagUnions;
+	Shared<boost::bimap<Id, std::set<u256>>> m_tagUnions;
 };
 
 }
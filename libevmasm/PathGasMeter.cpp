@@ -58,10 +58,54 @@ void PathGasMeter::queue(std::unique_ptr<GasPath>&& _newPath)
 		_newPath->gas < m_highestGasUsagePerJumpdest.at(_newPath->index)
 	)
 		return;
+
+	// If this point was already reached in the same abstract state with at least as much
+	// gas, walking the items again cannot increase the estimate, so paths that join an
+	// already explored state are only followed once.
+	std::pair<size_t, uint64_t> const explorationKey{_newPath->index, abstractStateHash(*_newPath->state)};
+	auto explored = m_exploredStates.find(explorationKey);
+	if (explored != m_exploredStates.end() && !(explored->second < _newPath->gas))
+		return;
+	m_exploredStates[explorationKey] = _newPath->gas;
+
 	m_highestGasUsagePerJumpdest[_newPath->index] = _newPath->gas;
 	m_queue[_newPath->index] = std::move(_newPath);
 }
 
+uint64_t PathGasMeter::abstractStateHash(KnownState const& _state)
+{
+	// FNV-1a over the parts of the state that the estimation depends on. All states of a
+	// run share the same ExpressionClasses instance, so the equivalence class ids hashed
+	// here are comparable between paths. The sequence number is deliberately left out:
+	// states that only differ in it carry the same knowledge.
+	uint64_t hash = 14695981039346656037u;
+	auto feed = [&](uint64_t _value) {
+		for (size_t i = 0; i < 8; ++i)
+		{
+			hash ^= _value & 0xff;
+			hash *= 1099511628211u;
+			_value >>= 8;
+		}
+	};
+	feed(static_cast<uint64_t>(static_cast<int64_t>(_state.stackHeight())));
+	for (auto const& [height, id]: _state.stackElements())
+	{
+		feed(static_cast<uint64_t>(static_cast<int64_t>(height)));
+		feed(id);
+	}
+	for (auto const& [slot, value]: _state.storageContent())
+	{
+		feed(slot);
+		feed(value);
+	}
+	for (auto const& [address, value]: _state.memoryContent())
+	{
+		feed(address);
+		feed(value);
+	}
+	return hash;
+}
+
 GasMeter::GasConsumption PathGasMeter::handleQueueItem()
 {
 	assertThrow(!m_queue.empty(), OptimizerException, "");
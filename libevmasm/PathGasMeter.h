@@ -74,10 +74,18 @@ private:
 	void queue(std::unique_ptr<GasPath>&& _newPath);
 	GasMeter::GasConsumption handleQueueItem();
 
+	/// @returns a hash of the parts of @a _state that can influence the gas estimation
+	/// of the items following a jumpdest, i.e. stack layout, storage and memory knowledge.
+	static uint64_t abstractStateHash(KnownState const& _state);
+
 	/// Map of jumpdest -> gas path, so not really a queue. We only have one queued up
 	/// item per jumpdest, because of the behaviour of `queue` above.
 	std::map<size_t, std::unique_ptr<GasPath>> m_queue;
 	std::map<size_t, GasMeter::GasConsumption> m_highestGasUsagePerJumpdest;
+	/// Highest gas value already explored per (jumpdest, abstract state hash). Paths that
+	/// join an already explored state with at most the explored gas are dropped, so each
+	/// merged state is only walked once even if the search reaches it along many paths.
+	std::map<std::pair<size_t, uint64_t>, GasMeter::GasConsumption> m_exploredStates;
 	std::map<u256, size_t> m_tagPositions;
 	AssemblyItems const& m_items;
 	langutil::EVMVersion m_evmVersion;
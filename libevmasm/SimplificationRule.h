@@ -23,6 +23,9 @@
 
 #include <libevmasm/Instruction.h>
 #include <libsolutil/CommonData.h>
+
+#include <array>
+#include <cstdint>
 #include <functional>
 
 namespace solidity::evmasm
@@ -51,6 +54,77 @@ struct SimplificationRule
 	std::function<bool()> feasible;
 };
 
+/**
+ * Coarse classification of the top-level arguments of a rule pattern, resp. of a candidate
+ * expression, by which most rules that cannot match a candidate are discarded without
+ * running the full recursive pattern match. Rules are usually already grouped by the
+ * instruction of their top-level pattern, so only the arguments are classified here.
+ * Only the first few arguments take part in the classification - rules with more
+ * arguments are merely filtered less precisely.
+ */
+class SimplificationRulePrefilter
+{
+public:
+	/// Class of arguments about which nothing is known, resp. of pattern arguments that
+	/// match anything. Compatible with every other class.
+	static constexpr uint16_t anythingClass = 0;
+	/// Class of constant arguments, resp. of pattern arguments requiring a constant.
+	static constexpr uint16_t constantClass = 1;
+	/// First class value available for further argument kinds specific to the expression
+	/// representation of the user.
+	static constexpr uint16_t customClassBase = 2 + 256;
+
+	/// @returns the class of arguments known to be an operation with @a _instruction.
+	static uint16_t operationClass(Instruction _instruction)
+	{
+		return 2 + static_cast<uint16_t>(static_cast<uint8_t>(_instruction));
+	}
+
+	void setArgumentClass(size_t _argument, uint16_t _class)
+	{
+		if (_argument < m_argumentClasses.size())
+			m_argumentClasses[_argument] = _class;
+	}
+
+	/// @returns true, if an expression whose arguments were classified as in @a _expression
+	/// can possibly match a pattern whose arguments were classified in this prefilter.
+	bool canMatch(SimplificationRulePrefilter const& _expression) const
+	{
+		for (size_t i = 0; i < m_argumentClasses.size(); ++i)
+			if (
+				m_argumentClasses[i] != anythingClass &&
+				_expression.m_argumentClasses[i] != anythingClass &&
+				m_argumentClasses[i] != _expression.m_argumentClasses[i]
+			)
+				return false;
+		return true;
+	}
+
+private:
+	std::array<uint16_t, 3> m_argumentClasses{{anythingClass, anythingClass, anythingClass}};
+};
+
+/**
+ * Flat storage for the expressions bound to the match groups of a rule list while
+ * a pattern is matched. The rule lists only use small consecutive group identifiers
+ * starting at one, so a plain array lookup replaces a map search and resetting the
+ * groups between match attempts does not deallocate.
+ */
+template <class Expression>
+class SimplificationMatchGroups
+{
+public:
+	/// One past the largest match group identifier used by the rule lists.
+	static constexpr size_t maxGroups = 8;
+
+	Expression const*& operator[](unsigned _group) { return m_values.at(_group); }
+	Expression const* operator[](unsigned _group) const { return m_values.at(_group); }
+	void clear() { m_values.fill(nullptr); }
+
+private:
+	std::array<Expression const*, maxGroups> m_values{};
+};
+
 template <typename Pattern>
 struct EVMBuiltins
 {
@@ -44,8 +44,14 @@ SimplificationRule<Pattern> const* Rules::findFirstMatch(
 	resetMatchGroups();
 
 	assertThrow(_expr.item, OptimizerException, "");
-	for (auto const& rule: m_rules[uint8_t(_expr.item->instruction())])
+	uint8_t instruction = uint8_t(_expr.item->instruction());
+	SimplificationRulePrefilter expressionPrefilter = prefilterFor(_expr, _classes);
+	for (size_t ruleIndex = 0; ruleIndex < m_rules[instruction].size(); ++ruleIndex)
 	{
+		if (!m_rulePrefilters[instruction][ruleIndex].canMatch(expressionPrefilter))
+			continue;
+
+		auto const& rule = m_rules[instruction][ruleIndex];
 		if (rule.pattern.matches(_expr, _classes))
 			if (!rule.feasible || rule.feasible())
 				return &rule;
@@ -55,6 +61,61 @@ SimplificationRule<Pattern> const* Rules::findFirstMatch(
 	return nullptr;
 }
 
+SimplificationRulePrefilter Rules::prefilterFor(Pattern const& _pattern)
+{
+	SimplificationRulePrefilter prefilter;
+	std::vector<Pattern> const arguments = _pattern.arguments();
+	for (size_t argumentIndex = 0; argumentIndex < arguments.size(); ++argumentIndex)
+	{
+		Pattern const& argument = arguments[argumentIndex];
+		switch (argument.type())
+		{
+		case UndefinedItem:
+			break;
+		case Operation:
+			prefilter.setArgumentClass(argumentIndex, SimplificationRulePrefilter::operationClass(argument.instruction()));
+			break;
+		case Push:
+			prefilter.setArgumentClass(argumentIndex, SimplificationRulePrefilter::constantClass);
+			break;
+		default:
+			prefilter.setArgumentClass(
+				argumentIndex,
+				SimplificationRulePrefilter::customClassBase + static_cast<uint16_t>(argument.type())
+			);
+			break;
+		}
+	}
+	return prefilter;
+}
+
+SimplificationRulePrefilter Rules::prefilterFor(Expression const& _expr, ExpressionClasses const& _classes)
+{
+	SimplificationRulePrefilter prefilter;
+	for (size_t argumentIndex = 0; argumentIndex < _expr.arguments.size(); ++argumentIndex)
+	{
+		Expression const& argument = _classes.representative(_expr.arguments[argumentIndex]);
+		if (!argument.item)
+			continue;
+		switch (argument.item->type())
+		{
+		case Operation:
+			prefilter.setArgumentClass(argumentIndex, SimplificationRulePrefilter::operationClass(argument.item->instruction()));
+			break;
+		case Push:
+			prefilter.setArgumentClass(argumentIndex, SimplificationRulePrefilter::constantClass);
+			break;
+		default:
+			prefilter.setArgumentClass(
+				argumentIndex,
+				SimplificationRulePrefilter::customClassBase + static_cast<uint16_t>(argument.item->type())
+			);
+			break;
+		}
+	}
+	return prefilter;
+}
+
 bool Rules::isInitialized() const
 {
 	return !m_rules[uint8_t(Instruction::ADD)].empty();
@@ -69,6 +130,7 @@ void Rules::addRules(std::vector<SimplificationRule<Pattern>> const& _rules)
 void Rules::addRule(SimplificationRule<Pattern> const& _rule)
 {
 	m_rules[uint8_t(_rule.pattern.instruction())].push_back(_rule);
+	m_rulePrefilters[uint8_t(_rule.pattern.instruction())].push_back(prefilterFor(_rule.pattern));
 }
 
 Rules::Rules()
@@ -102,7 +164,7 @@ Pattern::Pattern(Instruction _instruction, std::initializer_list<Pattern> _argum
 {
 }
 
-void Pattern::setMatchGroup(unsigned _group, std::map<unsigned, Expression const*>& _matchGroups)
+void Pattern::setMatchGroup(unsigned _group, SimplificationMatchGroups<Expression>& _matchGroups)
 {
 	m_matchGroup = _group;
 	m_matchGroups = &_matchGroups;
@@ -114,7 +176,7 @@ bool Pattern::matches(Expression const& _expr, ExpressionClasses const& _classes
 		return false;
 	if (m_matchGroup)
 	{
-		if (!m_matchGroups->count(m_matchGroup))
+		if (!(*m_matchGroups)[m_matchGroup])
 			(*m_matchGroups)[m_matchGroup] = &_expr;
 		else if ((*m_matchGroups)[m_matchGroup]->id != _expr.id)
 			return false;
@@ -71,12 +71,19 @@ private:
 	void addRules(std::vector<SimplificationRule<Pattern>> const& _rules);
 	void addRule(SimplificationRule<Pattern> const& _rule);
 
+	/// @returns the argument classification of @a _pattern for the rule prefilter.
+	static SimplificationRulePrefilter prefilterFor(Pattern const& _pattern);
+	/// @returns the argument classification of @a _expr for the rule prefilter.
+	static SimplificationRulePrefilter prefilterFor(Expression const& _expr, ExpressionClasses const& _classes);
+
 	void resetMatchGroups() { m_matchGroups.clear(); }
 
-	std::map<unsigned, Expression const*> m_matchGroups;
+	SimplificationMatchGroups<Expression> m_matchGroups;
 	/// Pattern to match, replacement to be applied and flag indicating whether
 	/// the replacement might remove some elements (except constants).
 	std::vector<SimplificationRule<Pattern>> m_rules[256];
+	/// Argument classifications of the rules in @a m_rules, kept in the same order.
+	std::vector<SimplificationRulePrefilter> m_rulePrefilters[256];
 };
 
 /**
@@ -107,7 +114,7 @@ public:
 	/// Sets this pattern to be part of the match group with the identifier @a _group.
 	/// Inside one rule, all patterns in the same match group have to match expressions from the
 	/// same expression equivalence class.
-	void setMatchGroup(unsigned _group, std::map<unsigned, Expression const*>& _matchGroups);
+	void setMatchGroup(unsigned _group, SimplificationMatchGroups<Expression>& _matchGroups);
 	unsigned matchGroup() const { return m_matchGroup; }
 	bool matches(Expression const& _expr, ExpressionClasses const& _classes) const;
 
@@ -139,7 +146,7 @@ private:
 	std::shared_ptr<u256> m_data; ///< Only valid if m_type is not Operation
 	std::vector<Pattern> m_arguments;
 	unsigned m_matchGroup = 0;
-	std::map<unsigned, Expression const*>* m_matchGroups = nullptr;
+	SimplificationMatchGroups<Expression>* m_matchGroups = nullptr;
 };
 
 /**
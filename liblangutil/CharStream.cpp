@@ -51,6 +51,8 @@
 #include <liblangutil/CharStream.h>
 #include <liblangutil/Exceptions.h>
 
+#include <algorithm>
+
 using namespace solidity;
 using namespace solidity::langutil;
 
@@ -61,7 +63,7 @@ char CharStream::advanceAndGet(size_t _chars)
 	m_position += _chars;
 	if (isPastEndOfInput())
 		return 0;
-	return m_source[m_position];
+	return sourceView()[m_position];
 }
 
 char CharStream::rollback(size_t _amount)
@@ -73,47 +75,60 @@ char CharStream::rollback(size_t _amount)
 
 char CharStream::setPosition(size_t _location)
 {
-	solAssert(_location <= m_source.size(), "Attempting to set position past end of source.");
+	solAssert(_location <= sourceView().size(), "Attempting to set position past end of source.");
 	m_position = _location;
 	return get();
 }
 
 std::string CharStream::lineAtPosition(int _position) const
+{
+	return std::string{lineViewAtPosition(_position)};
+}
+
+std::string_view CharStream::lineViewAtPosition(int _position) const
 {
 	// if _position points to \n, it returns the line before the \n
 	using size_type = std::string::size_type;
-	size_type searchStart = std::min<size_type>(m_source.size(), size_type(_position));
+	std::string_view source = sourceView();
+	size_type searchStart = std::min<size_type>(source.size(), size_type(_position));
 	if (searchStart > 0)
 		searchStart--;
-	size_type lineStart = m_source.rfind('\n', searchStart);
+	size_type lineStart = source.rfind('\n', searchStart);
 	if (lineStart == std::string::npos)
 		lineStart = 0;
 	else
 		lineStart++;
-	std::string line = m_source.substr(
+	std::string_view line = source.substr(
 		lineStart,
-		std::min(m_source.find('\n', lineStart), m_source.size()) - lineStart
+		std::min(source.find('\n', lineStart), source.size()) - lineStart
 	);
 	if (!line.empty() && line.back() == '\r')
-		line.pop_back();
+		line.remove_suffix(1);
 	return line;
 }
 
-LineColumn CharStream::translatePositionToLineColumn(int _position) const
+std::vector<size_t> const& CharStream::lineStarts() const
 {
-	using size_type = std::string::size_type;
-	using diff_type = std::string::difference_type;
-	size_type searchPosition = std::min<size_type>(m_source.size(), size_type(_position));
-	int lineNumber = static_cast<int>(count(m_source.begin(), m_source.begin() + diff_type(searchPosition), '\n'));
-	size_type lineStart;
-	if (searchPosition == 0)
-		lineStart = 0;
-	else
+	if (m_lineStarts.empty())
 	{
-		lineStart = m_source.rfind('\n', searchPosition - 1);
-		lineStart = lineStart == std::string::npos ? 0 : lineStart + 1;
+		std::string_view source = sourceView();
+		m_lineStarts.push_back(0);
+		for (size_t i = 0; i < source.size(); ++i)
+			if (source[i] == '\n')
+				m_lineStarts.push_back(i + 1);
 	}
-	return LineColumn{lineNumber, static_cast<int>(searchPosition - lineStart)};
+	return m_lineStarts;
+}
+
+LineColumn CharStream::translatePositionToLineColumn(int _position) const
+{
+	size_t searchPosition = std::min(sourceView().size(), static_cast<size_t>(_position));
+	std::vector<size_t> const& starts = lineStarts();
+	// The first line that starts past the position belongs to the line after the one
+	// we are looking for. Line 0 starts at offset 0, so the iterator cannot be begin().
+	auto nextLine = std::upper_bound(starts.begin(), starts.end(), searchPosition);
+	size_t lineNumber = static_cast<size_t>(nextLine - starts.begin()) - 1;
+	return LineColumn{static_cast<int>(lineNumber), static_cast<int>(searchPosition - starts[lineNumber])};
 }
 
 std::string_view CharStream::text(SourceLocation const& _location) const
@@ -121,8 +136,8 @@ std::string_view CharStream::text(SourceLocation const& _location) const
 	if (!_location.hasText())
 		return {};
 	solAssert(_location.sourceName && *_location.sourceName == m_name, "");
-	solAssert(static_cast<size_t>(_location.end) <= m_source.size(), "");
-	return std::string_view{m_source}.substr(
+	solAssert(static_cast<size_t>(_location.end) <= sourceView().size(), "");
+	return sourceView().substr(
 		static_cast<size_t>(_location.start),
 		static_cast<size_t>(_location.end - _location.start)
 	);
@@ -146,10 +161,22 @@ std::string CharStream::singleLineSnippet(std::string const& _sourceCode, Source
 
 std::optional<int> CharStream::translateLineColumnToPosition(LineColumn const& _lineColumn) const
 {
-	return translateLineColumnToPosition(m_source, _lineColumn);
+	if (_lineColumn.line < 0 || _lineColumn.column < 0)
+		return std::nullopt;
+
+	std::vector<size_t> const& starts = lineStarts();
+	auto line = static_cast<size_t>(_lineColumn.line);
+	if (line >= starts.size())
+		return std::nullopt;
+
+	size_t offset = starts[line];
+	size_t endOfLine = line + 1 < starts.size() ? starts[line + 1] - 1 : sourceView().size();
+	if (offset + static_cast<size_t>(_lineColumn.column) > endOfLine)
+		return std::nullopt;
+	return static_cast<int>(offset + static_cast<size_t>(_lineColumn.column));
 }
 
-std::optional<int> CharStream::translateLineColumnToPosition(std::string const& _text, LineColumn const& _input)
+std::optional<int> CharStream::translateLineColumnToPosition(std::string_view _text, LineColumn const& _input)
 {
 	if (_input.line < 0)
 		return std::nullopt;
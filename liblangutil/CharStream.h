@@ -50,17 +50,23 @@
 
 #pragma once
 
+#include <libsolutil/MemoryMappedFile.h>
+
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 namespace solidity::langutil
 {
 
 struct SourceLocation;
 struct LineColumn;
+class TokenStream;
 
 /**
  * Bidirectional stream of characters.
@@ -78,12 +84,16 @@ public:
 		m_name(std::move(_name)),
 		m_importedFromAST(_importedFromAST)
 	{ }
+	/// Creates a stream backed by a memory-mapped file without copying its contents.
+	/// The mapping is shared so that multiple streams can refer to the same file.
+	CharStream(std::shared_ptr<util::MemoryMappedFile const> _mapping, std::string _name):
+		m_mapping(std::move(_mapping)), m_name(std::move(_name)) {}
 
 	size_t position() const { return m_position; }
-	bool isPastEndOfInput(size_t _charsForward = 0) const { return (m_position + _charsForward) >= m_source.size(); }
+	bool isPastEndOfInput(size_t _charsForward = 0) const { return (m_position + _charsForward) >= sourceView().size(); }
 	bool isImportedFromAST() const { return m_importedFromAST; }
 
-	char get(size_t _charsForward = 0) const { return m_source[m_position + _charsForward]; }
+	char get(size_t _charsForward = 0) const { return sourceView()[m_position + _charsForward]; }
 	char advanceAndGet(size_t _chars = 1);
 	/// Sets scanner position to @ _amount characters backwards in source text.
 	/// @returns The character of the current location after update is returned.
@@ -95,24 +105,45 @@ public:
 
 	void reset() { m_position = 0; }
 
-	std::string const& source() const noexcept { return m_source; }
+	/// @returns a view of the source, without copying it out of a memory-mapped file.
+	std::string_view sourceView() const noexcept { return m_mapping ? m_mapping->view() : std::string_view{m_source}; }
+	/// @returns the source as an owned string. For memory-mapped streams this materializes
+	/// a copy on first use - prefer sourceView() where a view is sufficient.
+	std::string const& source() const
+	{
+		if (m_mapping && m_source.size() != m_mapping->view().size())
+			m_source = std::string{m_mapping->view()};
+		return m_source;
+	}
 	std::string const& name() const noexcept { return m_name; }
 
-	size_t size() const { return m_source.size(); }
+	size_t size() const { return sourceView().size(); }
+
+	/// @returns the token stream recorded by a previous full scan of this stream or nullptr.
+	std::shared_ptr<TokenStream const> const& tokenStream() const noexcept { return m_tokenStream; }
+	/// Attaches the token stream of a full scan so that later scans of this stream can
+	/// replay it instead of re-lexing the source text.
+	void setTokenStream(std::shared_ptr<TokenStream const> _tokenStream) { m_tokenStream = std::move(_tokenStream); }
 
 	///@{
 	///@name Error printing helper functions
 	/// Functions that help pretty-printing parse errors
 	/// Do only use in error cases, they are quite expensive.
 	std::string lineAtPosition(int _position) const;
-	LineColumn translatePositionToLineColumn(int _position) const;
+	/// Same as lineAtPosition(), but returns a view into the source buffer instead of a copy.
+	/// The view stays valid for the lifetime of the char stream.
+	std::string_view lineViewAtPosition(int _position) const;
 	///@}
 
+	/// Translates the absolute position to a line:column pair. Uses a newline offset
+	/// index built on first use, so a single translation costs only a binary search.
+	LineColumn translatePositionToLineColumn(int _position) const;
+
 	/// Translates a line:column to the absolute position.
 	std::optional<int> translateLineColumnToPosition(LineColumn const& _lineColumn) const;
 
 	/// Translates a line:column to the absolute position for the given input text.
-	static std::optional<int> translateLineColumnToPosition(std::string const& _text, LineColumn const& _input);
+	static std::optional<int> translateLineColumnToPosition(std::string_view _text, LineColumn const& _input);
 
 	/// Tests whether or not given octet sequence is present at the current position in stream.
 	/// @returns true if the sequence could be found, false otherwise.
@@ -136,14 +167,24 @@ public:
 	/// one line, appends an ellipsis to indicate that.
 	std::string singleLineSnippet(SourceLocation const& _location) const
 	{
-		return singleLineSnippet(m_source, _location);
+		return singleLineSnippet(std::string{sourceView()}, _location);
 	}
 
 	static std::string singleLineSnippet(std::string const& _sourceCode, SourceLocation const& _location);
 
 private:
-	std::string m_source;
+	/// @returns the start offsets of all lines, building the index on first use.
+	/// The entry at index i is the offset of the first character of line i.
+	std::vector<size_t> const& lineStarts() const;
+
+	/// Owned source. For memory-mapped streams this stays empty until source() is called.
+	mutable std::string m_source;
+	std::shared_ptr<util::MemoryMappedFile const> m_mapping;
 	std::string m_name;
+	std::shared_ptr<TokenStream const> m_tokenStream;
+	/// Offsets of the first character of each line, empty until built by lineStarts().
+	/// The source text never changes after construction, so the index is never invalidated.
+	mutable std::vector<size_t> m_lineStarts;
 	bool m_importedFromAST{false};
 	size_t m_position{0};
 };
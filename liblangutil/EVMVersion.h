@@ -21,12 +21,11 @@
 
 #pragma once
 
+#include <compare>
 #include <cstdint>
 #include <optional>
 #include <string>
 
-#include <boost/operators.hpp>
-
 
 namespace solidity::evmasm
 {
@@ -40,25 +39,26 @@ namespace solidity::langutil
 /**
  * A version specifier of the EVM we want to compile to.
  * Defaults to the latest version deployed on Ethereum Mainnet at the time of compiler release.
+ *
+ * The class is fully constexpr so that feature checks constant-fold wherever the version
+ * is known at compile time.
  */
-class EVMVersion:
-	boost::less_than_comparable<EVMVersion>,
-	boost::equality_comparable<EVMVersion>
+class EVMVersion
 {
 public:
-	EVMVersion() = default;
-
-	static EVMVersion homestead() { return {Version::Homestead}; }
-	static EVMVersion tangerineWhistle() { return {Version::TangerineWhistle}; }
-	static EVMVersion spuriousDragon() { return {Version::SpuriousDragon}; }
-	static EVMVersion byzantium() { return {Version::Byzantium}; }
-	static EVMVersion constantinople() { return {Version::Constantinople}; }
-	static EVMVersion petersburg() { return {Version::Petersburg}; }
-	static EVMVersion istanbul() { return {Version::Istanbul}; }
-	static EVMVersion berlin() { return {Version::Berlin}; }
-	static EVMVersion london() { return {Version::London}; }
-	static EVMVersion paris() { return {Version::Paris}; }
-	static EVMVersion shanghai() { return {Version::Shanghai}; }
+	constexpr EVMVersion() = default;
+
+	static constexpr EVMVersion homestead() { return {Version::Homestead}; }
+	static constexpr EVMVersion tangerineWhistle() { return {Version::TangerineWhistle}; }
+	static constexpr EVMVersion spuriousDragon() { return {Version::SpuriousDragon}; }
+	static constexpr EVMVersion byzantium() { return {Version::Byzantium}; }
+	static constexpr EVMVersion constantinople() { return {Version::Constantinople}; }
+	static constexpr EVMVersion petersburg() { return {Version::Petersburg}; }
+	static constexpr EVMVersion istanbul() { return {Version::Istanbul}; }
+	static constexpr EVMVersion berlin() { return {Version::Berlin}; }
+	static constexpr EVMVersion london() { return {Version::London}; }
+	static constexpr EVMVersion paris() { return {Version::Paris}; }
+	static constexpr EVMVersion shanghai() { return {Version::Shanghai}; }
 
 	static std::optional<EVMVersion> fromString(std::string const& _version)
 	{
@@ -68,8 +68,8 @@ public:
 		return std::nullopt;
 	}
 
-	bool operator==(EVMVersion const& _other) const { return m_version == _other.m_version; }
-	bool operator<(EVMVersion const& _other) const { return m_version < _other.m_version; }
+	constexpr bool operator==(EVMVersion const& _other) const = default;
+	constexpr auto operator<=>(EVMVersion const& _other) const = default;
 
 	std::string name() const
 	{
@@ -91,27 +91,27 @@ public:
 	}
 
 	/// Has the RETURNDATACOPY and RETURNDATASIZE opcodes.
-	bool supportsReturndata() const { return *this >= byzantium(); }
-	bool hasStaticCall() const { return *this >= byzantium(); }
-	bool hasBitwiseShifting() const { return *this >= constantinople(); }
-	bool hasCreate2() const { return *this >= constantinople(); }
-	bool hasExtCodeHash() const { return *this >= constantinople(); }
-	bool hasChainID() const { return *this >= istanbul(); }
-	bool hasSelfBalance() const { return *this >= istanbul(); }
-	bool hasBaseFee() const { return *this >= london(); }
-	bool hasPrevRandao() const { return *this >= paris(); }
-	bool hasPush0() const { return *this >= shanghai(); }
+	constexpr bool supportsReturndata() const { return *this >= byzantium(); }
+	constexpr bool hasStaticCall() const { return *this >= byzantium(); }
+	constexpr bool hasBitwiseShifting() const { return *this >= constantinople(); }
+	constexpr bool hasCreate2() const { return *this >= constantinople(); }
+	constexpr bool hasExtCodeHash() const { return *this >= constantinople(); }
+	constexpr bool hasChainID() const { return *this >= istanbul(); }
+	constexpr bool hasSelfBalance() const { return *this >= istanbul(); }
+	constexpr bool hasBaseFee() const { return *this >= london(); }
+	constexpr bool hasPrevRandao() const { return *this >= paris(); }
+	constexpr bool hasPush0() const { return *this >= shanghai(); }
 
 	bool hasOpcode(evmasm::Instruction _opcode) const;
 
 	/// Whether we have to retain the costs for the call opcode itself (false),
 	/// or whether we can just forward easily all remaining gas (true).
-	bool canOverchargeGasForCall() const { return *this >= tangerineWhistle(); }
+	constexpr bool canOverchargeGasForCall() const { return *this >= tangerineWhistle(); }
 
 private:
 	enum class Version { Homestead, TangerineWhistle, SpuriousDragon, Byzantium, Constantinople, Petersburg, Istanbul, Berlin, London, Paris, Shanghai };
 
-	EVMVersion(Version _version): m_version(_version) {}
+	constexpr EVMVersion(Version _version): m_version(_version) {}
 
 	Version m_version = Version::Shanghai;
 };
@@ -33,6 +33,7 @@ ErrorReporter& ErrorReporter::operator=(ErrorReporter const& _errorReporter)
 	if (&_errorReporter == this)
 		return *this;
 	m_errorList = _errorReporter.m_errorList;
+	m_minimumSeverity = _errorReporter.m_minimumSeverity;
 	return *this;
 }
 
@@ -60,20 +61,39 @@ void ErrorReporter::warning(
 	error(_error, Error::Type::Warning, _location, _secondaryLocation, _description);
 }
 
+void ErrorReporter::warning(
+	ErrorId _error,
+	SourceLocation const& _location,
+	LazyDescription const& _description
+)
+{
+	error(_error, Error::Type::Warning, _location, _description);
+}
+
 void ErrorReporter::error(ErrorId _errorId, Error::Type _type, SourceLocation const& _location, std::string const& _description)
 {
-	if (checkForExcessiveErrors(_type))
-		return;
+	error(_errorId, _type, _location, [&]() -> std::string { return _description; });
+}
 
-	m_errorList.push_back(std::make_shared<Error>(_errorId, _type, _description, _location));
+void ErrorReporter::error(ErrorId _errorId, Error::Type _type, SourceLocation const& _location, LazyDescription const& _description)
+{
+	error(_errorId, _type, _location, SecondarySourceLocation(), _description);
 }
 
 void ErrorReporter::error(ErrorId _errorId, Error::Type _type, SourceLocation const& _location, SecondarySourceLocation const& _secondaryLocation, std::string const& _description)
 {
+	error(_errorId, _type, _location, _secondaryLocation, [&]() -> std::string { return _description; });
+}
+
+void ErrorReporter::error(ErrorId _errorId, Error::Type _type, SourceLocation const& _location, SecondarySourceLocation const& _secondaryLocation, LazyDescription const& _description)
+{
+	if (Error::errorSeverity(_type) < m_minimumSeverity)
+		return;
+
 	if (checkForExcessiveErrors(_type))
 		return;
 
-	m_errorList.push_back(std::make_shared<Error>(_errorId, _type, _description, _location, _secondaryLocation));
+	m_errorList.push_back(std::make_shared<Error>(_errorId, _type, _description(), _location, _secondaryLocation));
 }
 
 bool ErrorReporter::hasExcessiveErrors() const
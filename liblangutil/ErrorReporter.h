@@ -33,6 +33,9 @@
 #include <range/v3/range/conversion.hpp>
 #include <range/v3/view/filter.hpp>
 
+#include <deque>
+#include <functional>
+
 namespace solidity::langutil
 {
 
@@ -44,7 +47,8 @@ public:
 		m_errorList(_errors) { }
 
 	ErrorReporter(ErrorReporter const& _errorReporter) noexcept:
-		m_errorList(_errorReporter.m_errorList) { }
+		m_errorList(_errorReporter.m_errorList),
+		m_minimumSeverity(_errorReporter.m_minimumSeverity) { }
 
 	ErrorReporter& operator=(ErrorReporter const& _errorReporter);
 
@@ -53,10 +57,26 @@ public:
 		m_errorList += _errorList;
 	}
 
+	/// Callback producing an error description. Only invoked for reports that are
+	/// actually recorded, i.e. that survive the severity filter and the per-type
+	/// limits, so expensive description construction can be deferred by using the
+	/// overloads below.
+	using LazyDescription = std::function<std::string()>;
+
+	/// Sets the least severe class of reports that is still recorded. Anything below
+	/// the threshold is discarded before the error object and its description are
+	/// constructed and does not count towards the per-type limits.
+	void setMinimumSeverity(Error::Severity _severity) { m_minimumSeverity = _severity; }
+
+	/// @returns the least severe class of reports that is still recorded.
+	Error::Severity minimumSeverity() const { return m_minimumSeverity; }
+
 	void warning(ErrorId _error, std::string const& _description);
 
 	void warning(ErrorId _error, SourceLocation const& _location, std::string const& _description);
 
+	void warning(ErrorId _error, SourceLocation const& _location, LazyDescription const& _description);
+
 	void warning(
 		ErrorId _error,
 		SourceLocation const& _location,
@@ -73,6 +93,13 @@ public:
 		std::string const& _description
 	);
 
+	void error(
+		ErrorId _error,
+		Error::Type _type,
+		SourceLocation const& _location,
+		LazyDescription const& _description
+	);
+
 	void info(ErrorId _error, std::string const& _description);
 
 	void declarationError(
@@ -107,10 +134,10 @@ public:
 		std::initializer_list<std::string> const descs = { _descriptions... };
 		solAssert(descs.size() > 0, "Need error descriptions!");
 
-		auto nonEmpty = [](std::string const& _s) { return !_s.empty(); };
-		std::string errorStr = util::joinHumanReadable(descs | ranges::views::filter(nonEmpty) | ranges::to_vector, " ");
-
-		error(_error, Error::Type::TypeError, _location, errorStr);
+		error(_error, Error::Type::TypeError, _location, [&]() {
+			auto nonEmpty = [](std::string const& _s) { return !_s.empty(); };
+			return util::joinHumanReadable(descs | ranges::views::filter(nonEmpty) | ranges::to_vector, " ");
+		});
 	}
 
 	void fatalTypeError(ErrorId _error, SourceLocation const& _location, std::string const& _description);
@@ -167,6 +194,13 @@ private:
 		SecondarySourceLocation const& _secondaryLocation,
 		std::string const& _description = std::string());
 
+	void error(
+		ErrorId _error,
+		Error::Type _type,
+		SourceLocation const& _location,
+		SecondarySourceLocation const& _secondaryLocation,
+		LazyDescription const& _description);
+
 	void fatalError(
 		ErrorId _error,
 		Error::Type _type,
@@ -185,6 +219,8 @@ private:
 
 	ErrorList& m_errorList;
 
+	Error::Severity m_minimumSeverity = Error::Severity::Info;
+
 	unsigned m_errorCount = 0;
 	unsigned m_warningCount = 0;
 	unsigned m_infoCount = 0;
@@ -194,4 +230,61 @@ private:
 	unsigned const c_maxInfosAllowed = 256;
 };
 
+/**
+ * Collects the reports of concurrent workers into per-shard error lists and merges
+ * them into a target reporter in shard order. Workers processing items that have a
+ * deterministic order - e.g. sources or functions in source order - report through
+ * the reporter of the item's shard; the merged result is then identical to the
+ * output of a serial run visiting the items in shard order, regardless of how the
+ * items were scheduled onto threads.
+ *
+ * The reporters of different shards can be used from different threads at the same
+ * time, but each individual shard reporter is single-threaded. The per-type report
+ * limits apply per shard and, matching ErrorReporter::append(), the merge does not
+ * update the error counts of the target reporter.
+ */
+class ShardedErrorReporter
+{
+public:
+	ShardedErrorReporter(ErrorReporter& _target, size_t _shardCount):
+		m_target(_target),
+		m_shards(_shardCount)
+	{
+		for (Shard& shard: m_shards)
+			shard.reporter.setMinimumSeverity(_target.minimumSeverity());
+	}
+
+	ErrorReporter& reporter(size_t _shard) { return m_shards.at(_shard).reporter; }
+
+	ErrorList const& errors(size_t _shard) const { return m_shards.at(_shard).errors; }
+
+	/// @returns true iff any shard recorded an error (ignores warnings and infos).
+	bool hasErrors() const
+	{
+		for (Shard const& shard: m_shards)
+			if (shard.reporter.hasErrors())
+				return true;
+		return false;
+	}
+
+	/// Appends the collected errors to the target reporter in shard order.
+	/// To be called after all workers are done.
+	void merge()
+	{
+		for (Shard const& shard: m_shards)
+			m_target.append(shard.errors);
+	}
+
+private:
+	struct Shard
+	{
+		ErrorList errors;
+		ErrorReporter reporter{errors};
+	};
+
+	ErrorReporter& m_target;
+	/// Deque so that the references the reporters hold into their shards stay stable.
+	std::deque<Shard> m_shards;
+};
+
 }
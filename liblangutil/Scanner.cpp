@@ -56,6 +56,7 @@
 
 #include <boost/algorithm/string/classification.hpp>
 
+#include <algorithm>
 #include <optional>
 #include <string_view>
 #include <tuple>
@@ -140,15 +141,31 @@ void Scanner::reset()
 {
 	m_source.reset();
 	m_kind = ScannerKind::Solidity;
+	m_replayedTokens = m_source.tokenStream();
+	if (m_replayedTokens && m_replayedTokens->kind() != m_kind)
+		m_replayedTokens = nullptr;
+	m_replayIndex = 0;
+	m_recordedTokens = m_replayedTokens ? nullptr : std::make_shared<TokenStream>(m_kind);
 	m_char = m_source.get();
-	skipWhitespace();
-	next();
-	next();
-	next();
+	if (m_replayedTokens)
+		updateReplayPointers();
+	else
+	{
+		useLookaheadBuffer();
+		skipWhitespace();
+		next();
+		next();
+		next();
+	}
 }
 
 void Scanner::setPosition(size_t _offset)
 {
+	// Error recovery jumps around in the source, so neither a replayed nor a recorded
+	// token stream can represent the scan anymore.
+	m_replayedTokens = nullptr;
+	m_recordedTokens = nullptr;
+	useLookaheadBuffer();
 	m_char = m_source.setPosition(_offset);
 	scanToken();
 	next();
@@ -211,14 +228,49 @@ void Scanner::addUnicodeAsUTF8(unsigned codepoint)
 void Scanner::rescan()
 {
 	size_t rollbackTo = 0;
-	if (m_skippedComments[Current].literal.empty())
-		rollbackTo = static_cast<size_t>(m_tokens[Current].location.start);
+	if (m_currentCommentDesc->literal.empty())
+		rollbackTo = static_cast<size_t>(m_currentTokenDesc->location.start);
 	else
-		rollbackTo = static_cast<size_t>(m_skippedComments[Current].location.start);
-	m_char = m_source.rollback(m_source.position() - rollbackTo);
-	next();
-	next();
-	next();
+		rollbackTo = static_cast<size_t>(m_currentCommentDesc->location.start);
+
+	// A scanner mode change invalidates the recording in progress and stops any replay.
+	// If nothing was consumed yet (only the initial look-ahead of three tokens exists),
+	// a cached token stream of the new kind can still be replayed or a fresh recording
+	// can be started.
+	bool atStartOfSource =
+		m_replayedTokens ? m_replayIndex == 0 :
+		m_recordedTokens ? m_recordedTokens->m_entries.size() <= 3 :
+		false;
+	if (m_replayedTokens)
+	{
+		// The character stream is not advanced while replaying - reposition it behind the
+		// replayed look-ahead, like it would be after actual scanning, before rolling back.
+		std::vector<TokenStream::Entry> const& entries = m_replayedTokens->m_entries;
+		TokenStream::Entry const& lookaheadEntry = entries[std::min(m_replayIndex + 2, entries.size() - 1)];
+		m_char = m_source.setPosition(std::min(lookaheadEntry.sourcePosition, m_source.size()));
+	}
+	m_replayedTokens = nullptr;
+	m_replayIndex = 0;
+	m_recordedTokens = nullptr;
+	useLookaheadBuffer();
+	if (atStartOfSource)
+	{
+		m_replayedTokens = m_source.tokenStream();
+		if (m_replayedTokens && m_replayedTokens->kind() != m_kind)
+			m_replayedTokens = nullptr;
+		if (!m_replayedTokens)
+			m_recordedTokens = std::make_shared<TokenStream>(m_kind);
+	}
+
+	if (m_replayedTokens)
+		updateReplayPointers();
+	else
+	{
+		m_char = m_source.rollback(m_source.position() - rollbackTo);
+		next();
+		next();
+		next();
+	}
 }
 
 // Ensure that tokens can be stored in a byte.
@@ -226,16 +278,77 @@ BOOST_STATIC_ASSERT(TokenTraits::count() <= 0x100);
 
 Token Scanner::next()
 {
+	if (m_replayedTokens)
+	{
+		// Serve the tokens directly from the contiguous recorded stream. Streams are only
+		// attached after the terminating EOS token was recorded, so replaying past the
+		// end keeps repeating the last (EOS) entry, like actual scanning would.
+		if (m_replayIndex + 1 < m_replayedTokens->m_entries.size())
+			++m_replayIndex;
+		updateReplayPointers();
+		return m_currentTokenDesc->token;
+	}
+
 	m_tokens[Current] = std::move(m_tokens[Next]);
 	m_tokens[Next] = std::move(m_tokens[NextNext]);
 	m_skippedComments[Current] = std::move(m_skippedComments[Next]);
 	m_skippedComments[Next] = std::move(m_skippedComments[NextNext]);
 
 	scanToken();
+	if (m_recordedTokens)
+		recordToken();
 
 	return m_tokens[Current].token;
 }
 
+void Scanner::recordToken()
+{
+	m_recordedTokens->m_entries.push_back({m_tokens[NextNext], m_skippedComments[NextNext], m_source.position()});
+	if (m_tokens[NextNext].token == Token::EOS)
+		// The whole source was scanned - attach the recording to the character stream so
+		// that later scanner instances can replay it instead of re-lexing the text.
+		m_source.setTokenStream(std::move(m_recordedTokens));
+}
+
+void Scanner::useLookaheadBuffer()
+{
+	m_currentTokenDesc = &m_tokens[Current];
+	m_nextTokenDesc = &m_tokens[Next];
+	m_nextNextTokenDesc = &m_tokens[NextNext];
+	m_currentCommentDesc = &m_skippedComments[Current];
+}
+
+void Scanner::updateReplayPointers()
+{
+	std::vector<TokenStream::Entry> const& entries = m_replayedTokens->m_entries;
+	auto entryAt = [&](size_t _index) -> TokenStream::Entry const& {
+		return entries[std::min(_index, entries.size() - 1)];
+	};
+	m_currentTokenDesc = &entryAt(m_replayIndex).token;
+	m_nextTokenDesc = &entryAt(m_replayIndex + 1).token;
+	m_nextNextTokenDesc = &entryAt(m_replayIndex + 2).token;
+	m_currentCommentDesc = &entryAt(m_replayIndex).skippedComment;
+}
+
+void Scanner::pretokenize()
+{
+	if (m_replayedTokens || !m_recordedTokens)
+		return;
+
+	// The current token and the look-ahead have already been recorded, so the index of
+	// the current token within the stream is known.
+	solAssert(m_recordedTokens->m_entries.size() >= 3, "");
+	size_t const current = m_recordedTokens->m_entries.size() - 3;
+	// Recording the terminating EOS token attaches the stream to the character stream
+	// and ends the recording.
+	while (m_recordedTokens)
+		next();
+	m_replayedTokens = m_source.tokenStream();
+	solAssert(m_replayedTokens && m_replayedTokens->kind() == m_kind, "");
+	m_replayIndex = current;
+	updateReplayPointers();
+}
+
 Token Scanner::selectToken(char _next, Token _then, Token _else)
 {
 	advance();
@@ -245,11 +358,33 @@ Token Scanner::selectToken(char _next, Token _then, Token _else)
 		return _else;
 }
 
+namespace
+{
+
+/// @returns the number of characters at the start of @a _text that satisfy @a _predicate.
+template<typename Predicate>
+size_t spanLength(std::string_view _text, Predicate _predicate)
+{
+	size_t length = 0;
+	while (length < _text.size() && _predicate(_text[length]))
+		++length;
+	return length;
+}
+
+}
+
 bool Scanner::skipWhitespace()
 {
 	size_t const startPosition = sourcePos();
 	while (isWhiteSpace(m_char))
+	{
 		advance();
+		// After the first advance the current character is synchronized with the stream
+		// again (it can differ e.g. after a multi-line comment), so the rest of the run
+		// can be skipped on the source buffer in one step.
+		if (size_t run = spanLength(remainingSource(), isWhiteSpace))
+			m_char = m_source.advanceAndGet(run);
+	}
 	// Return whether or not we skipped any characters.
 	return sourcePos() != startPosition;
 }
@@ -258,7 +393,12 @@ bool Scanner::skipWhitespaceExceptUnicodeLinebreak()
 {
 	size_t const startPosition = sourcePos();
 	while (isWhiteSpace(m_char) && !isUnicodeLinebreak())
+	{
 		advance();
+		// Of the whitespace characters, only ' ' and '\t' are not also line breaks.
+		if (size_t run = spanLength(remainingSource(), [](char _c) { return _c == ' ' || _c == '\t'; }))
+			m_char = m_source.advanceAndGet(run);
+	}
 	// Return whether or not we skipped any characters.
 	return sourcePos() != startPosition;
 }
@@ -312,8 +452,18 @@ Token Scanner::skipSingleLineComment()
 	// non-ascii line terminator, it will result in a parser error.
 	size_t startPosition = m_source.position();
 	while (!isUnicodeLinebreak())
+	{
 		if (!advance())
 			break;
+		// The characters '\x0a'-'\x0d' and the first bytes of the UTF-8 encodings of NEL,
+		// LS and PS are the only ones that can start a line break - runs of all other
+		// characters are skipped on the source buffer in one step.
+		size_t run = spanLength(remainingSource(), [](char _c) {
+			return !('\x0a' <= _c && _c <= '\x0d') && uint8_t(_c) != 0xc2 && uint8_t(_c) != 0xe2;
+		});
+		if (run > 0)
+			m_char = m_source.advanceAndGet(run);
+	}
 
 	ScannerError unicodeDirectionError = validateBiDiMarkup(m_source, startPosition);
 	if (unicodeDirectionError != ScannerError::NoError)
@@ -391,26 +541,25 @@ size_t Scanner::scanSingleLineDocComment()
 Token Scanner::skipMultiLineComment()
 {
 	size_t startPosition = m_source.position();
-	while (!isSourcePastEndOfInput())
+	// Searching for the terminator on the source buffer directly avoids advancing over the
+	// comment body one character at a time.
+	size_t terminator = m_source.sourceView().find("*/", startPosition);
+	if (terminator == std::string_view::npos)
 	{
-		char prevChar = m_char;
-		advance();
+		// Unterminated multi-line comment.
+		m_char = m_source.advanceAndGet(m_source.size() - std::min(startPosition, m_source.size()));
+		return setError(ScannerError::IllegalCommentTerminator);
+	}
 
-		// If we have reached the end of the multi-line comment, we
-		// consume the '/' and insert a whitespace. This way all
-		// multi-line comments are treated as whitespace.
-		if (prevChar == '*' && m_char == '/')
-		{
-			ScannerError unicodeDirectionError = validateBiDiMarkup(m_source, startPosition);
-			if (unicodeDirectionError != ScannerError::NoError)
-				return setError(unicodeDirectionError);
+	m_char = m_source.advanceAndGet(terminator + 1 - startPosition);
+	ScannerError unicodeDirectionError = validateBiDiMarkup(m_source, startPosition);
+	if (unicodeDirectionError != ScannerError::NoError)
+		return setError(unicodeDirectionError);
 
-			m_char = ' ';
-			return Token::Whitespace;
-		}
-	}
-	// Unterminated multi-line comment.
-	return setError(ScannerError::IllegalCommentTerminator);
+	// We consume the '/' and insert a whitespace. This way all
+	// multi-line comments are treated as whitespace.
+	m_char = ' ';
+	return Token::Whitespace;
 }
 
 Token Scanner::scanMultiLineDocComment()
@@ -828,6 +977,26 @@ Token Scanner::scanString(bool const _isUnicode)
 	LiteralScope literal(this, LITERAL_TYPE_STRING);
 	while (m_char != quote && !isSourcePastEndOfInput() && !isUnicodeLinebreak())
 	{
+		// Add runs of ordinary characters to the literal in one piece. The quote, escape
+		// sequences and anything that is not printable or may be (part of) a line break
+		// falls through to the per-character handling below.
+		std::string_view rest = remainingSource();
+		size_t run =
+			_isUnicode ?
+			spanLength(rest, [&](char _c) {
+				uint8_t c = static_cast<uint8_t>(_c);
+				return _c != quote && _c != '\\' && !(0x0a <= c && c <= 0x0d) && c != 0xc2 && c != 0xe2;
+			}) :
+			spanLength(rest, [&](char _c) {
+				uint8_t c = static_cast<uint8_t>(_c);
+				return _c != quote && _c != '\\' && 0x20 <= c && c < 0x7f;
+			});
+		if (run > 0)
+		{
+			m_tokens[NextNext].literal.append(rest.data(), run);
+			m_char = m_source.advanceAndGet(run);
+			continue;
+		}
 		char c = m_char;
 		advance();
 		if (c == '\\')
@@ -875,6 +1044,18 @@ Token Scanner::scanHexString()
 	bool allowUnderscore = false;
 	while (m_char != quote && !isSourcePastEndOfInput())
 	{
+		// Decode runs of hex digits in whole bytes on the source buffer directly.
+		// Underscores and any unexpected characters fall through to the
+		// per-character handling below.
+		std::string_view rest = remainingSource();
+		if (size_t run = spanLength(rest, isHexDigit) / 2 * 2)
+		{
+			for (size_t i = 0; i < run; i += 2)
+				addLiteralChar(static_cast<char>(hexValue(rest[i]) * 16 + hexValue(rest[i + 1])));
+			m_char = m_source.advanceAndGet(run);
+			allowUnderscore = true;
+			continue;
+		}
 		char c = m_char;
 
 		if (scanHexByte(c))
@@ -1015,9 +1196,18 @@ std::tuple<Token, unsigned, unsigned> Scanner::scanIdentifierOrKeyword()
 	solAssert(isIdentifierStart(m_char), "");
 	LiteralScope literal(this, LITERAL_TYPE_STRING);
 	addLiteralCharAndAdvance();
-	// Scan the rest of the identifier characters.
-	while (isIdentifierPart(m_char) || (m_char == '.' && m_kind == ScannerKind::Yul))
-		addLiteralCharAndAdvance();
+	// Determine the extent of the identifier on the source buffer first, so that the rest
+	// of its characters can be added to the literal in one piece.
+	std::string_view rest = remainingSource();
+	size_t length =
+		m_kind == ScannerKind::Yul ?
+		spanLength(rest, [](char _c) { return isIdentifierPart(_c) || _c == '.'; }) :
+		spanLength(rest, isIdentifierPart);
+	if (length > 0)
+	{
+		m_tokens[NextNext].literal.append(rest.data(), length);
+		m_char = m_source.advanceAndGet(length);
+	}
 	literal.complete();
 
 	auto const token = TokenTraits::fromIdentifierOrKeyword(m_tokens[NextNext].literal);
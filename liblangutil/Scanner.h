@@ -56,8 +56,11 @@
 #include <liblangutil/CharStream.h>
 #include <liblangutil/SourceLocation.h>
 
+#include <memory>
 #include <optional>
 #include <iosfwd>
+#include <string_view>
+#include <vector>
 
 namespace solidity::langutil
 {
@@ -65,6 +68,7 @@ namespace solidity::langutil
 class AstRawString;
 class AstValueFactory;
 class ParserRecorder;
+class TokenStream;
 
 enum class ScannerKind
 {
@@ -101,6 +105,7 @@ std::ostream& operator<<(std::ostream& os, ScannerError _errorCode);
 class Scanner
 {
 	friend class LiteralScope;
+	friend class TokenStream;
 public:
 	explicit Scanner(CharStream& _source):
 		m_source(_source),
@@ -115,6 +120,9 @@ public:
 	/// Changes the scanner mode.
 	void setScannerMode(ScannerKind _kind)
 	{
+		if (_kind == m_kind)
+			return;
+
 		m_kind = _kind;
 
 		// Invalidate lookahead buffer.
@@ -126,6 +134,14 @@ public:
 	/// @returns the next token and advances input
 	Token next();
 
+	/// Tokenizes the rest of the source into the contiguous recorded token stream in one
+	/// go and serves all further token accesses directly from that array, so that parsing
+	/// does not interleave with scanning and needs no per-token bookkeeping. Only has an
+	/// effect while a full recording is in progress, i.e. when no token was consumed since
+	/// the scanner was (re)set at the start of the source; otherwise it is a no-op, so it
+	/// can be called unconditionally.
+	void pretokenize();
+
 	/// Set scanner to a specific offset. This is used in error recovery.
 	void setPosition(size_t _offset);
 
@@ -135,32 +151,42 @@ public:
 	/// @returns the current token
 	Token currentToken() const
 	{
-		return m_tokens[Current].token;
+		return m_currentTokenDesc->token;
 	}
 	ElementaryTypeNameToken currentElementaryTypeNameToken() const
 	{
 		unsigned firstSize;
 		unsigned secondSize;
-		std::tie(firstSize, secondSize) = m_tokens[Current].extendedTokenInfo;
-		return ElementaryTypeNameToken(m_tokens[Current].token, firstSize, secondSize);
+		std::tie(firstSize, secondSize) = m_currentTokenDesc->extendedTokenInfo;
+		return ElementaryTypeNameToken(m_currentTokenDesc->token, firstSize, secondSize);
 	}
 
-	SourceLocation currentLocation() const { return m_tokens[Current].location; }
-	std::string const& currentLiteral() const { return m_tokens[Current].literal; }
-	std::tuple<unsigned, unsigned> const& currentTokenInfo() const { return m_tokens[Current].extendedTokenInfo; }
+	SourceLocation currentLocation() const { return m_currentTokenDesc->location; }
+	std::string const& currentLiteral() const { return m_currentTokenDesc->literal; }
+	std::tuple<unsigned, unsigned> const& currentTokenInfo() const { return m_currentTokenDesc->extendedTokenInfo; }
 
 	/// Retrieves the last error that occurred during lexical analysis.
 	/// @note If no error occurred, the value is undefined.
-	ScannerError currentError() const noexcept { return m_tokens[Current].error; }
+	ScannerError currentError() const noexcept { return m_currentTokenDesc->error; }
 	///@}
 
 	///@{
 	///@name Information about the current comment token
 
-	SourceLocation currentCommentLocation() const { return m_skippedComments[Current].location; }
-	std::string const& currentCommentLiteral() const { return m_skippedComments[Current].literal; }
+	SourceLocation currentCommentLocation() const { return m_currentCommentDesc->location; }
+	std::string const& currentCommentLiteral() const { return m_currentCommentDesc->literal; }
 	/// Called by the parser during FunctionDefinition parsing to clear the current comment
-	void clearCurrentCommentLiteral() { m_skippedComments[Current].literal.clear(); }
+	void clearCurrentCommentLiteral()
+	{
+		if (m_currentCommentDesc != &m_skippedComments[Current])
+		{
+			// Copy the replayed comment into the look-ahead buffer instead of modifying
+			// the shared token stream.
+			m_skippedComments[Current] = *m_currentCommentDesc;
+			m_currentCommentDesc = &m_skippedComments[Current];
+		}
+		m_skippedComments[Current].literal.clear();
+	}
 
 	ScannerKind scannerKind() const { return m_kind; }
 
@@ -170,11 +196,11 @@ public:
 	///@name Information about the next token
 
 	/// @returns the next token without advancing input.
-	Token peekNextToken() const { return m_tokens[Next].token; }
-	SourceLocation peekLocation() const { return m_tokens[Next].location; }
-	std::string const& peekLiteral() const { return m_tokens[Next].literal; }
+	Token peekNextToken() const { return m_nextTokenDesc->token; }
+	SourceLocation peekLocation() const { return m_nextTokenDesc->location; }
+	std::string const& peekLiteral() const { return m_nextTokenDesc->literal; }
 
-	Token peekNextNextToken() const { return m_tokens[NextNext].token; }
+	Token peekNextNextToken() const { return m_nextNextTokenDesc->token; }
 	///@}
 
 private:
@@ -208,6 +234,15 @@ private:
 	/// Rolls back to the start of the current token and re-runs the scanner.
 	void rescan();
 
+	/// Appends the freshly scanned look-ahead token to the recording and attaches the
+	/// recording to the character stream once the end of the source was reached.
+	void recordToken();
+	/// Points the token descriptions served to the parser at the look-ahead buffer.
+	void useLookaheadBuffer();
+	/// Points the token descriptions served to the parser directly at the replayed stream
+	/// entries around @a m_replayIndex, so that replaying does not copy per token.
+	void updateReplayPointers();
+
 	inline Token selectErrorToken(ScannerError _err) { advance(); return setError(_err); }
 	inline Token selectToken(Token _tok) { advance(); return _tok; }
 	/// If the next character is _next, advance and return _then, otherwise return _else.
@@ -255,19 +290,72 @@ private:
 	/// Return the current source position.
 	size_t sourcePos() const { return m_source.position(); }
 	bool isSourcePastEndOfInput() const { return m_source.isPastEndOfInput(); }
+	/// @returns the source text from the current position to the end as a view, so that
+	/// character runs can be scanned on the buffer directly instead of one character at a time.
+	std::string_view remainingSource() const
+	{
+		return m_source.sourceView().substr(std::min(m_source.position(), m_source.size()));
+	}
 
 	enum TokenIndex { Current, Next, NextNext };
 
 	TokenDesc m_skippedComments[3] = {}; // desc for the current, next and nextnext skipped comment
 	TokenDesc m_tokens[3] = {}; // desc for the current, next and nextnext token
 
+	/// Descriptions of the current token and the look-ahead as served to the parser.
+	/// They point into @a m_tokens / @a m_skippedComments while scanning and directly
+	/// into the entries of the replayed token stream while replaying.
+	TokenDesc const* m_currentTokenDesc = &m_tokens[Current];
+	TokenDesc const* m_nextTokenDesc = &m_tokens[Next];
+	TokenDesc const* m_nextNextTokenDesc = &m_tokens[NextNext];
+	TokenDesc const* m_currentCommentDesc = &m_skippedComments[Current];
+
 	CharStream& m_source;
 	std::shared_ptr<std::string const> m_sourceName;
 
 	ScannerKind m_kind = ScannerKind::Solidity;
 
+	/// Token stream of a previous full scan being replayed, if any.
+	std::shared_ptr<TokenStream const> m_replayedTokens;
+	/// Index of the next entry of @a m_replayedTokens to replay.
+	size_t m_replayIndex = 0;
+	/// Token stream being recorded during a fresh scan, if any. Reset whenever the
+	/// recording can no longer represent a plain full scan (mode switches, jumps).
+	std::shared_ptr<TokenStream> m_recordedTokens;
+
 	/// one character look-ahead, equals 0 at end of input
 	char m_char;
 };
 
+/**
+ * Immutable recording of the token sequence produced by a full scan of a character stream.
+ * It is attached to the CharStream once a scan reaches the end of the source; later Scanner
+ * instances on the same stream replay the recorded tokens instead of re-lexing the text,
+ * e.g. when the same sources are compiled again after a stack reset.
+ */
+class TokenStream
+{
+public:
+	explicit TokenStream(ScannerKind _kind): m_kind(_kind) {}
+
+	/// @returns the scanner mode the stream was recorded with.
+	ScannerKind kind() const noexcept { return m_kind; }
+	/// @returns the number of recorded tokens, including the terminating EOS token.
+	size_t size() const noexcept { return m_entries.size(); }
+
+private:
+	friend class Scanner;
+
+	struct Entry
+	{
+		Scanner::TokenDesc token;
+		Scanner::TokenDesc skippedComment;
+		/// Position of the character stream directly after the token was scanned.
+		size_t sourcePosition = 0;
+	};
+
+	ScannerKind m_kind = ScannerKind::Solidity;
+	std::vector<Entry> m_entries;
+};
+
 }
@@ -0,0 +1,111 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Process-wide interning pool for source locations.
+ */
+
+#pragma once
+
+#include <liblangutil/SourceLocation.h>
+
+#include <libsolutil/FlatHashMap.h>
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+
+namespace solidity::langutil
+{
+
+/**
+ * Process-wide interning pool mapping source locations to dense 32-bit ids.
+ *
+ * A full SourceLocation is three words including a shared_ptr to the source name, so
+ * structures that exist in the millions per compilation - most notably assembly items -
+ * store an id instead and resolve it on demand. This halves their size and turns every
+ * copy made by the optimiser passes from a pair of atomic reference count operations
+ * into a trivial integer copy.
+ *
+ * Interned locations are never released; the pool grows with the number of distinct
+ * locations encountered by the process, which is bounded by the source size of the
+ * compiled contracts. Thread-safe, like the other process-wide caches.
+ */
+class SourceLocationPool
+{
+public:
+	/// Id of the default-constructed (invalid) location, which is interned upfront so
+	/// that location-less items do not have to consult the pool at all.
+	static uint32_t constexpr emptyId = 0;
+
+	static SourceLocationPool& instance()
+	{
+		static SourceLocationPool pool;
+		return pool;
+	}
+
+	/// Interns @a _location and @returns its id. Equal locations share one id.
+	uint32_t id(SourceLocation const& _location)
+	{
+		if (!_location.isValid())
+			return emptyId;
+		{
+			std::shared_lock lock(m_mutex);
+			if (auto it = m_ids.find(_location); it != m_ids.end())
+				return it->second;
+		}
+		std::unique_lock lock(m_mutex);
+		auto [it, inserted] = m_ids.try_emplace(_location, static_cast<uint32_t>(m_locations.size()));
+		if (inserted)
+			m_locations.emplace_back(_location);
+		return it->second;
+	}
+
+	/// @returns the location interned under @a _id. The reference stays valid for the
+	/// lifetime of the process.
+	SourceLocation const& location(uint32_t _id) const
+	{
+		std::shared_lock lock(m_mutex);
+		return m_locations[_id];
+	}
+
+private:
+	SourceLocationPool()
+	{
+		m_locations.emplace_back();
+	}
+
+	struct Hash
+	{
+		size_t operator()(SourceLocation const& _location) const
+		{
+			size_t hash = _location.sourceName ? std::hash<std::string>{}(*_location.sourceName) : 0;
+			hash = hash * 0x9e3779b97f4a7c15ULL + static_cast<size_t>(_location.start);
+			hash = hash * 0x9e3779b97f4a7c15ULL + static_cast<size_t>(_location.end);
+			return util::detail::mixHash(hash);
+		}
+	};
+
+	mutable std::shared_mutex m_mutex;
+	/// Interned locations indexed by id. A deque so that references handed out by
+	/// @a location stay valid while the pool grows.
+	std::deque<SourceLocation> m_locations;
+	util::FlatHashMap<SourceLocation, uint32_t, Hash> m_ids;
+};
+
+}
@@ -77,7 +77,10 @@ SourceReference SourceReferenceExtractor::extract(
 	LineColumn end = charStream.translatePositionToLineColumn(_location->end);
 	bool const isMultiline = start.line != end.line;
 
-	std::string line = charStream.lineAtPosition(_location->start);
+	// The common case is a view into the source buffer; only lines that have to be rewritten
+	// for truncation are materialized into an owned string.
+	std::string_view line = charStream.lineViewAtPosition(_location->start);
+	std::shared_ptr<std::string const> ownedText;
 
 	int locationLength =
 		isMultiline ?
@@ -88,7 +91,10 @@ SourceReference SourceReferenceExtractor::extract(
 	{
 		auto const lhs = static_cast<size_t>(start.column) + 35;
 		std::string::size_type const rhs = (isMultiline ? line.length() : static_cast<size_t>(end.column)) - 35;
-		line = line.substr(0, lhs) + " ... " + line.substr(rhs);
+		ownedText = std::make_shared<std::string const>(
+			std::string(line.substr(0, lhs)) + " ... " + std::string(line.substr(rhs))
+		);
+		line = *ownedText;
 		end.column = start.column + 75;
 		locationLength = 75;
 	}
@@ -102,13 +108,17 @@ SourceReference SourceReferenceExtractor::extract(
 				std::min(locationLength + 35, len - start.column)
 			)
 		);
-		if (start.column + locationLength + 35 < len)
-			line += " ...";
-		if (start.column > 35)
+		bool const truncatedRight = start.column + locationLength + 35 < len;
+		bool const truncatedLeft = start.column > 35;
+		if (truncatedLeft || truncatedRight)
 		{
-			line = " ... " + line;
-			start.column = 40;
+			ownedText = std::make_shared<std::string const>(
+				(truncatedLeft ? " ... " : "") + std::string(line) + (truncatedRight ? " ..." : "")
+			);
+			line = *ownedText;
 		}
+		if (truncatedLeft)
+			start.column = 40;
 		end.column = start.column + static_cast<int>(locationLength);
 	}
 
@@ -118,6 +128,7 @@ SourceReference SourceReferenceExtractor::extract(
 		interest,
 		isMultiline,
 		line,
+		std::move(ownedText),
 		std::min(start.column, static_cast<int>(line.length())),
 		std::min(end.column, static_cast<int>(line.length()))
 	};
@@ -20,8 +20,10 @@
 #include <liblangutil/Exceptions.h>
 
 #include <iosfwd>
+#include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <vector>
 #include <variant>
@@ -37,7 +39,13 @@ struct SourceReference
 	std::string sourceName;   ///< Underlying source name (for example the filename).
 	LineColumn position;      ///< Actual (error) position this source reference is surrounding.
 	bool multiline = {false}; ///< Indicates whether the actual SourceReference is truncated to one line.
-	std::string text;         ///< Extracted source code text (potentially truncated if multiline or too long).
+	/// Extracted source code text (potentially truncated if multiline or too long).
+	/// Usually a view into the source buffer of the char stream; only when the line had to be
+	/// rewritten for truncation it views the heap-allocated @a ownedText instead.
+	std::string_view text;
+	/// Owns the extracted text when it could not remain a view into the source buffer.
+	/// On the heap so that the view stays valid when the source reference is copied or moved.
+	std::shared_ptr<std::string const> ownedText;
 	int startColumn = {-1};   ///< Highlighting range-start of text field.
 	int endColumn = {-1};     ///< Highlighting range-end of text field.
 
@@ -44,7 +44,10 @@
 #include <liblangutil/Token.h>
 #include <libsolutil/StringUtils.h>
 
-#include <map>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <string_view>
 
 namespace solidity::langutil
 {
@@ -134,17 +137,86 @@ std::string friendlyName(Token tok)
 }
 
 
-static Token keywordByName(std::string const& _name)
+namespace
 {
-	// The following macros are used inside TOKEN_LIST and cause non-keyword tokens to be ignored
-	// and keywords to be put inside the keywords variable.
-#define KEYWORD(name, string, precedence) {string, Token::name},
+
+struct KeywordEntry
+{
+	std::string_view name;
+	Token token = Token::Identifier;
+};
+
+// The following macros are used inside TOKEN_LIST and cause non-keyword tokens to be ignored
+// and keywords to be put inside the keywords variable.
+#define KEYWORD(name, string, precedence) KeywordEntry{string, Token::name},
 #define TOKEN(name, string, precedence)
-	static std::map<std::string, Token> const keywords({TOKEN_LIST(TOKEN, KEYWORD)});
+constexpr KeywordEntry keywords[] = {TOKEN_LIST(TOKEN, KEYWORD)};
 #undef KEYWORD
 #undef TOKEN
-	auto it = keywords.find(_name);
-	return it == keywords.end() ? Token::Identifier : it->second;
+
+/// Size of the hash table. Keeping the load factor well below one half makes collisions
+/// rare enough that a lookup usually needs a single probe.
+constexpr size_t keywordTableSize = 256;
+
+constexpr uint64_t keywordHash(std::string_view _name)
+{
+	// FNV-1a
+	uint64_t hash = 14695981039346656037u;
+	for (char c: _name)
+	{
+		hash ^= static_cast<uint8_t>(c);
+		hash *= 1099511628211u;
+	}
+	return hash;
+}
+
+constexpr size_t shortestKeywordLength()
+{
+	size_t length = std::numeric_limits<size_t>::max();
+	for (KeywordEntry const& keyword: keywords)
+		length = std::min(length, keyword.name.size());
+	return length;
+}
+
+constexpr size_t longestKeywordLength()
+{
+	size_t length = 0;
+	for (KeywordEntry const& keyword: keywords)
+		length = std::max(length, keyword.name.size());
+	return length;
+}
+
+constexpr std::array<KeywordEntry, keywordTableSize> buildKeywordTable()
+{
+	std::array<KeywordEntry, keywordTableSize> table{};
+	for (KeywordEntry const& keyword: keywords)
+	{
+		size_t slot = keywordHash(keyword.name) % keywordTableSize;
+		while (!table[slot].name.empty())
+			slot = (slot + 1) % keywordTableSize;
+		table[slot] = keyword;
+	}
+	return table;
+}
+
+/// Open-addressing hash table mapping keywords to their tokens, built at compile time
+/// so that keyword classification neither allocates nor touches lazily initialized state.
+constexpr std::array<KeywordEntry, keywordTableSize> keywordTable = buildKeywordTable();
+
+Token keywordByName(std::string_view _name)
+{
+	if (_name.size() < shortestKeywordLength() || _name.size() > longestKeywordLength())
+		return Token::Identifier;
+	size_t slot = keywordHash(_name) % keywordTableSize;
+	while (!keywordTable[slot].name.empty())
+	{
+		if (keywordTable[slot].name == _name)
+			return keywordTable[slot].token;
+		slot = (slot + 1) % keywordTableSize;
+	}
+	return Token::Identifier;
+}
+
 }
 
 bool isYulKeyword(std::string const& _literal)
@@ -183,7 +255,7 @@ std::tuple<Token, unsigned int, unsigned int> fromIdentifierOrKeyword(std::strin
 	auto positionM = find_if(_literal.begin(), _literal.end(), util::isDigit);
 	if (positionM != _literal.end())
 	{
-		std::string baseType(_literal.begin(), positionM);
+		std::string_view baseType{_literal.data(), static_cast<size_t>(positionM - _literal.begin())};
 		auto positionX = find_if_not(positionM, _literal.end(), util::isDigit);
 		int m = parseSize(positionM, positionX);
 		Token keyword = keywordByName(baseType);
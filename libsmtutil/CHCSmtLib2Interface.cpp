@@ -26,10 +26,12 @@
 #include <range/v3/view.hpp>
 
 #include <array>
+#include <atomic>
 #include <fstream>
 #include <iostream>
 #include <memory>
 #include <stdexcept>
+#include <thread>
 
 using namespace solidity;
 using namespace solidity::util;
@@ -55,6 +57,10 @@ void CHCSmtLib2Interface::reset()
 {
 	m_accumulatedOutput.clear();
 	m_variables.clear();
+	m_cachedHeader.clear();
+	m_cachedUserSortCount = 0;
+	m_cachedForall.clear();
+	m_cachedForallVariableCount = 0;
 	m_unhandledQueries.clear();
 	m_sortNames.clear();
 }
@@ -90,16 +96,18 @@ void CHCSmtLib2Interface::addRule(Expression const& _expr, std::string const& /*
 
 std::tuple<CheckResult, Expression, CHCSolverInterface::CexGraph> CHCSmtLib2Interface::query(Expression const& _block)
 {
-	std::string query = dumpQuery(_block);
-	std::string response = querySolver(query);
+	return parseQueryResponse(querySolver(dumpQuery(_block)));
+}
 
+std::tuple<CheckResult, Expression, CHCSolverInterface::CexGraph> CHCSmtLib2Interface::parseQueryResponse(std::string const& _response)
+{
 	CheckResult result;
 	// TODO proper parsing
-	if (boost::starts_with(response, "sat"))
+	if (boost::starts_with(_response, "sat"))
 		result = CheckResult::UNSATISFIABLE;
-	else if (boost::starts_with(response, "unsat"))
+	else if (boost::starts_with(_response, "unsat"))
 		result = CheckResult::SATISFIABLE;
-	else if (boost::starts_with(response, "unknown"))
+	else if (boost::starts_with(_response, "unknown"))
 		result = CheckResult::UNKNOWN;
 	else
 		result = CheckResult::ERROR;
@@ -107,6 +115,56 @@ std::tuple<CheckResult, Expression, CHCSolverInterface::CexGraph> CHCSmtLib2Inte
 	return {result, Expression(true), {}};
 }
 
+std::vector<std::tuple<CheckResult, Expression, CHCSolverInterface::CexGraph>> CHCSmtLib2Interface::parallelQuery(std::vector<std::string> const& _queries)
+{
+	std::vector<std::tuple<CheckResult, Expression, CexGraph>> results(
+		_queries.size(),
+		{CheckResult::ERROR, Expression(true), CexGraph{}}
+	);
+
+	unsigned jobs = static_cast<unsigned>(std::min<size_t>(
+		std::max<unsigned>(std::thread::hardware_concurrency(), 1),
+		_queries.size()
+	));
+	if (jobs <= 1)
+	{
+		for (size_t i = 0; i < _queries.size(); ++i)
+			results[i] = parseQueryResponse(querySolver(_queries[i]));
+		return results;
+	}
+
+	std::atomic<size_t> nextQuery{0};
+	std::mutex exceptionMutex;
+	std::exception_ptr workerException;
+	auto work = [&]()
+	{
+		try
+		{
+			for (size_t i = nextQuery.fetch_add(1); i < _queries.size(); i = nextQuery.fetch_add(1))
+				results[i] = parseQueryResponse(querySolver(_queries[i]));
+		}
+		catch (...)
+		{
+			std::lock_guard<std::mutex> lock(exceptionMutex);
+			if (!workerException)
+				workerException = std::current_exception();
+			// Drain the queue so that the other workers finish early.
+			nextQuery = _queries.size();
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (unsigned i = 1; i < jobs; ++i)
+		threads.emplace_back(work);
+	work();
+	for (std::thread& thread: threads)
+		thread.join();
+	if (workerException)
+		std::rethrow_exception(workerException);
+
+	return results;
+}
+
 void CHCSmtLib2Interface::declareVariable(std::string const& _name, SortPointer const& _sort)
 {
 	smtAssert(_sort);
@@ -135,17 +193,22 @@ std::string CHCSmtLib2Interface::toSmtLibSort(std::vector<SortPointer> const& _s
 	return ssort;
 }
 
-std::string CHCSmtLib2Interface::forall()
+std::string const& CHCSmtLib2Interface::forall()
 {
-	std::string vars("(");
-	for (auto const& [name, sort]: m_smtlib2->variables())
+	if (m_cachedForall.empty() || m_cachedForallVariableCount != m_smtlib2->variables().size())
 	{
-		solAssert(sort, "");
-		if (sort->kind != Kind::Function)
-			vars += " (" + name + " " + toSmtLibSort(*sort) + ")";
+		std::string vars("(");
+		for (auto const& [name, sort]: m_smtlib2->variables())
+		{
+			solAssert(sort, "");
+			if (sort->kind != Kind::Function)
+				vars += " (" + name + " " + toSmtLibSort(*sort) + ")";
+		}
+		vars += ")";
+		m_cachedForall = std::move(vars);
+		m_cachedForallVariableCount = m_smtlib2->variables().size();
 	}
-	vars += ")";
-	return vars;
+	return m_cachedForall;
 }
 
 void CHCSmtLib2Interface::declareFunction(std::string const& _name, SortPointer const& _sort)
@@ -191,33 +254,41 @@ std::string CHCSmtLib2Interface::querySolver(std::string const& _input)
 			return result.responseOrErrorMessage;
 	}
 
+	std::lock_guard<std::mutex> lock(m_unhandledQueriesMutex);
 	m_unhandledQueries.push_back(_input);
 	return "unknown\n";
 }
 
 std::string CHCSmtLib2Interface::dumpQuery(Expression const& _expr)
 {
-	std::stringstream s;
-
-	s
-		<< createHeaderAndDeclarations()
-		<< m_accumulatedOutput << std::endl
-		<< createQueryAssertion(_expr.name) << std::endl
-		<< "(check-sat)" << std::endl;
-
-	return s.str();
+	std::string const& header = createHeaderAndDeclarations();
+	std::string query = createQueryAssertion(_expr.name);
+
+	std::string result;
+	result.reserve(header.size() + m_accumulatedOutput.size() + query.size() + 15);
+	result += header;
+	result += m_accumulatedOutput;
+	result += '\n';
+	result += query;
+	result += "\n(check-sat)\n";
+	return result;
 }
 
-std::string CHCSmtLib2Interface::createHeaderAndDeclarations() {
-	std::stringstream s;
-	if (m_queryTimeout)
-		s << "(set-option :timeout " + std::to_string(*m_queryTimeout) + ")\n";
-	s << "(set-logic HORN)" << std::endl;
+std::string const& CHCSmtLib2Interface::createHeaderAndDeclarations() {
+	if (m_cachedHeader.empty() || m_cachedUserSortCount != m_smtlib2->userSorts().size())
+	{
+		std::stringstream s;
+		if (m_queryTimeout)
+			s << "(set-option :timeout " + std::to_string(*m_queryTimeout) + ")\n";
+		s << "(set-logic HORN)" << std::endl;
 
-	for (auto const& decl: m_smtlib2->userSorts() | ranges::views::values)
-		s << decl << std::endl;
+		for (auto const& decl: m_smtlib2->userSorts() | ranges::views::values)
+			s << decl << std::endl;
 
-	return s.str();
+		m_cachedHeader = s.str();
+		m_cachedUserSortCount = m_smtlib2->userSorts().size();
+	}
+	return m_cachedHeader;
 }
 
 std::string CHCSmtLib2Interface::createQueryAssertion(std::string name) {
@@ -26,6 +26,8 @@
 
 #include <libsmtutil/SMTLib2Interface.h>
 
+#include <mutex>
+
 namespace solidity::smtutil
 {
 
@@ -49,6 +51,11 @@ public:
 	/// @returns solving result, an invariant, and counterexample graph, if possible.
 	std::tuple<CheckResult, Expression, CexGraph> query(Expression const& _expr) override;
 
+	/// Solves the pre-serialized queries @a _queries, produced via dumpQuery, concurrently
+	/// using up to one worker thread per hardware core.
+	/// @returns the result of each query, in the same order as the queries.
+	std::vector<std::tuple<CheckResult, Expression, CexGraph>> parallelQuery(std::vector<std::string> const& _queries);
+
 	void declareVariable(std::string const& _name, SortPointer const& _sort) override;
 
 	std::string dumpQuery(Expression const& _expr);
@@ -62,26 +69,44 @@ private:
 	std::string toSmtLibSort(std::vector<SortPointer> const& _sort);
 
 	void writeHeader();
-	std::string forall();
+	/// @returns the quantified variable list for rule and query assertions. The string
+	/// only changes when new variables are declared, so it is cached between calls.
+	std::string const& forall();
 
 	void declareFunction(std::string const& _name, SortPointer const& _sort);
 
 	void write(std::string _data);
 
 	std::string createQueryAssertion(std::string name);
-	std::string createHeaderAndDeclarations();
+	/// @returns the header and sort declaration prefix shared by all queries. Rebuilt
+	/// only when new user sorts have been declared since the last call.
+	std::string const& createHeaderAndDeclarations();
 
 	/// Communicates with the solver via the callback. Throws SMTSolverError on error.
+	/// Can be called from multiple threads at the same time.
 	std::string querySolver(std::string const& _input);
 
+	/// @returns the check result encoded in the solver response @a _response.
+	static std::tuple<CheckResult, Expression, CexGraph> parseQueryResponse(std::string const& _response);
+
 	/// Used to access toSmtLibSort, SExpr, and handle variables.
 	std::unique_ptr<SMTLib2Interface> m_smtlib2;
 
 	std::string m_accumulatedOutput;
 	std::set<std::string> m_variables;
 
+	/// Cached result of createHeaderAndDeclarations() together with the number of user
+	/// sorts it covers.
+	std::string m_cachedHeader;
+	size_t m_cachedUserSortCount = 0;
+	/// Cached result of forall() together with the number of variables it covers.
+	std::string m_cachedForall;
+	size_t m_cachedForallVariableCount = 0;
+
 	std::map<util::h256, std::string> const& m_queryResponses;
 	std::vector<std::string> m_unhandledQueries;
+	/// Guards m_unhandledQueries against concurrent access from parallelQuery workers.
+	std::mutex m_unhandledQueriesMutex;
 
 	frontend::ReadCallback::Callback m_smtCallback;
 	SMTSolverChoice m_enabledSolvers;
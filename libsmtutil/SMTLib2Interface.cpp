@@ -110,7 +110,10 @@ void SMTLib2Interface::declareFunction(std::string const& _name, SortPointer con
 
 void SMTLib2Interface::addAssertion(Expression const& _expr)
 {
-	write("(assert " + toSExpr(_expr) + ")");
+	std::string assertion = "(assert ";
+	toSExpr(assertion, _expr);
+	assertion += ')';
+	write(std::move(assertion));
 }
 
 std::pair<CheckResult, std::vector<std::string>> SMTLib2Interface::check(std::vector<Expression> const& _expressionsToEvaluate)
@@ -139,22 +142,20 @@ std::pair<CheckResult, std::vector<std::string>> SMTLib2Interface::check(std::ve
 
 std::string SMTLib2Interface::toSExpr(Expression const& _expr)
 {
-	if (_expr.arguments.empty())
-		return _expr.name;
+	std::string sexpr;
+	toSExpr(sexpr, _expr);
+	return sexpr;
+}
 
-	std::string sexpr = "(";
-	if (_expr.name == "int2bv")
+void SMTLib2Interface::toSExpr(std::string& _sexpr, Expression const& _expr)
+{
+	if (_expr.arguments.empty())
 	{
-		size_t size = std::stoul(_expr.arguments[1].name);
-		auto arg = toSExpr(_expr.arguments.front());
-		auto int2bv = "(_ int2bv " + std::to_string(size) + ")";
-		// Some solvers treat all BVs as unsigned, so we need to manually apply 2's complement if needed.
-		sexpr += std::string("ite ") +
-			"(>= " + arg + " 0) " +
-			"(" + int2bv + " " + arg + ") " +
-			"(bvneg (" + int2bv + " (- " + arg + ")))";
+		_sexpr += _expr.name;
+		return;
 	}
-	else if (_expr.name == "bv2int")
+
+	if (_expr.name == "bv2int")
 	{
 		auto intSort = std::dynamic_pointer_cast<IntSort>(_expr.sort);
 		smtAssert(intSort, "");
@@ -163,18 +164,34 @@ std::string SMTLib2Interface::toSExpr(Expression const& _expr)
 		auto nat = "(bv2nat " + arg + ")";
 
 		if (!intSort->isSigned)
-			return nat;
+		{
+			_sexpr += nat;
+			return;
+		}
 
 		auto bvSort = std::dynamic_pointer_cast<BitVectorSort>(_expr.arguments.front().sort);
 		smtAssert(bvSort, "");
-		auto size = std::to_string(bvSort->size);
 		auto pos = std::to_string(bvSort->size - 1);
 
 		// Some solvers treat all BVs as unsigned, so we need to manually apply 2's complement if needed.
-		sexpr += std::string("ite ") +
+		_sexpr += "(ite "
 			"(= ((_ extract " + pos + " " + pos + ")" + arg + ") #b0) " +
 			nat + " " +
-			"(- (bv2nat (bvneg " + arg + ")))";
+			"(- (bv2nat (bvneg " + arg + "))))";
+		return;
+	}
+
+	_sexpr += '(';
+	if (_expr.name == "int2bv")
+	{
+		size_t size = std::stoul(_expr.arguments[1].name);
+		auto arg = toSExpr(_expr.arguments.front());
+		auto int2bv = "(_ int2bv " + std::to_string(size) + ")";
+		// Some solvers treat all BVs as unsigned, so we need to manually apply 2's complement if needed.
+		_sexpr += std::string("ite ") +
+			"(>= " + arg + " 0) " +
+			"(" + int2bv + " " + arg + ") " +
+			"(bvneg (" + int2bv + " (- " + arg + ")))";
 	}
 	else if (_expr.name == "const_array")
 	{
@@ -183,8 +200,8 @@ std::string SMTLib2Interface::toSExpr(Expression const& _expr)
 		smtAssert(sortSort, "");
 		auto arraySort = std::dynamic_pointer_cast<ArraySort>(sortSort->inner);
 		smtAssert(arraySort, "");
-		sexpr += "(as const " + toSmtLibSort(*arraySort) + ") ";
-		sexpr += toSExpr(_expr.arguments.at(1));
+		_sexpr += "(as const " + toSmtLibSort(*arraySort) + ") ";
+		toSExpr(_sexpr, _expr.arguments.at(1));
 	}
 	else if (_expr.name == "tuple_get")
 	{
@@ -192,24 +209,30 @@ std::string SMTLib2Interface::toSExpr(Expression const& _expr)
 		auto tupleSort = std::dynamic_pointer_cast<TupleSort>(_expr.arguments.at(0).sort);
 		size_t index = std::stoul(_expr.arguments.at(1).name);
 		smtAssert(index < tupleSort->members.size(), "");
-		sexpr += "|" + tupleSort->members.at(index) + "| " + toSExpr(_expr.arguments.at(0));
+		_sexpr += "|" + tupleSort->members.at(index) + "| ";
+		toSExpr(_sexpr, _expr.arguments.at(0));
 	}
 	else if (_expr.name == "tuple_constructor")
 	{
 		auto tupleSort = std::dynamic_pointer_cast<TupleSort>(_expr.sort);
 		smtAssert(tupleSort, "");
-		sexpr += "|" + tupleSort->name + "|";
+		_sexpr += "|" + tupleSort->name + "|";
 		for (auto const& arg: _expr.arguments)
-			sexpr += " " + toSExpr(arg);
+		{
+			_sexpr += ' ';
+			toSExpr(_sexpr, arg);
+		}
 	}
 	else
 	{
-		sexpr += _expr.name;
+		_sexpr += _expr.name;
 		for (auto const& arg: _expr.arguments)
-			sexpr += " " + toSExpr(arg);
+		{
+			_sexpr += ' ';
+			toSExpr(_sexpr, arg);
+		}
 	}
-	sexpr += ")";
-	return sexpr;
+	_sexpr += ')';
 }
 
 std::string SMTLib2Interface::toSmtLibSort(Sort const& _sort)
@@ -279,7 +302,9 @@ std::string SMTLib2Interface::checkSatAndGetValuesCommand(std::vector<Expression
 			auto const& e = _expressionsToEvaluate.at(i);
 			smtAssert(e.sort->kind == Kind::Int || e.sort->kind == Kind::Bool, "Invalid sort for expression to evaluate.");
 			command += "(declare-const |EVALEXPR_" + std::to_string(i) + "| " + (e.sort->kind == Kind::Int ? "Int" : "Bool") + ")\n";
-			command += "(assert (= |EVALEXPR_" + std::to_string(i) + "| " + toSExpr(e) + "))\n";
+			command += "(assert (= |EVALEXPR_" + std::to_string(i) + "| ";
+			toSExpr(command, e);
+			command += "))\n";
 		}
 		command += "(check-sat)\n";
 		command += "(get-value (";
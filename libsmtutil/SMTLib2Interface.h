@@ -61,10 +61,13 @@ public:
 
 	// Used by CHCSmtLib2Interface
 	std::string toSExpr(Expression const& _expr);
+	/// Serializes @a _expr by appending to @a _sexpr, avoiding the quadratic
+	/// copying that concatenating sub-results would cause for large expressions.
+	void toSExpr(std::string& _sexpr, Expression const& _expr);
 	std::string toSmtLibSort(Sort const& _sort);
 	std::string toSmtLibSort(std::vector<SortPointer> const& _sort);
 
-	std::map<std::string, SortPointer> variables() { return m_variables; }
+	std::map<std::string, SortPointer> const& variables() const { return m_variables; }
 
 	std::vector<std::pair<std::string, std::string>> const& userSorts() const { return m_userSorts; }
 
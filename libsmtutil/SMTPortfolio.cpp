@@ -26,11 +26,28 @@
 #endif
 #include <libsmtutil/SMTLib2Interface.h>
 
+#include <libsolutil/Keccak256.h>
+
+#include <exception>
+#include <mutex>
+#include <thread>
+
 using namespace solidity;
 using namespace solidity::util;
 using namespace solidity::frontend;
 using namespace solidity::smtutil;
 
+namespace
+{
+
+/// Process-wide cache of conclusive solver answers, keyed by the hash of the canonical
+/// SMTLib2 text of the query. Model checking engines re-issue structurally identical
+/// queries across targets and across repeated compilations in long-running processes.
+std::mutex g_queryCacheMutex;
+std::map<h256, std::pair<CheckResult, std::vector<std::string>>> g_queryCache;
+
+}
+
 SMTPortfolio::SMTPortfolio(
 	std::map<h256, std::string> _smtlib2Responses,
 	frontend::ReadCallback::Callback _smtCallback,
@@ -116,13 +133,57 @@ void SMTPortfolio::addAssertion(Expression const& _expr)
 */
 std::pair<CheckResult, std::vector<std::string>> SMTPortfolio::check(std::vector<Expression> const& _expressionsToEvaluate)
 {
+	// The canonical SMTLib2 text of the query includes the requested get-value commands,
+	// so an identical hash guarantees that a cached model is valid as well.
+	std::optional<h256> queryHash;
+	if (!m_solvers.empty())
+		if (auto smtlib2 = dynamic_cast<SMTLib2Interface*>(m_solvers.front().get()))
+			queryHash = keccak256(smtlib2->dumpQuery(_expressionsToEvaluate));
+	if (queryHash)
+	{
+		std::lock_guard<std::mutex> cacheLock(g_queryCacheMutex);
+		if (auto it = g_queryCache.find(*queryHash); it != g_queryCache.end())
+			return it->second;
+	}
+
+	// Each solver is queried on its own worker thread so that the latency of the portfolio
+	// is determined by the slowest solver instead of the sum of all of them.
+	// The solver objects are independent of each other and each one is only touched by its
+	// own thread until the join below. Exceptions are propagated after all threads finished.
+	std::vector<std::pair<CheckResult, std::vector<std::string>>> solverResults(
+		m_solvers.size(),
+		{CheckResult::ERROR, {}}
+	);
+	std::vector<std::exception_ptr> solverExceptions(m_solvers.size());
+	auto querySolver = [&](size_t _index) {
+		try
+		{
+			solverResults[_index] = m_solvers[_index]->check(_expressionsToEvaluate);
+		}
+		catch (...)
+		{
+			solverExceptions[_index] = std::current_exception();
+		}
+	};
+	if (m_solvers.size() > 1)
+	{
+		std::vector<std::thread> threads;
+		for (size_t i = 1; i < m_solvers.size(); ++i)
+			threads.emplace_back(querySolver, i);
+		querySolver(0);
+		for (std::thread& thread: threads)
+			thread.join();
+	}
+	else if (m_solvers.size() == 1)
+		querySolver(0);
+	for (std::exception_ptr const& exception: solverExceptions)
+		if (exception)
+			std::rethrow_exception(exception);
+
 	CheckResult lastResult = CheckResult::ERROR;
 	std::vector<std::string> finalValues;
-	for (auto const& s: m_solvers)
+	for (auto& [result, values]: solverResults)
 	{
-		CheckResult result;
-		std::vector<std::string> values;
-		tie(result, values) = s->check(_expressionsToEvaluate);
 		if (solverAnswered(result))
 		{
 			if (!solverAnswered(lastResult))
@@ -139,9 +200,20 @@ std::pair<CheckResult, std::vector<std::string>> SMTPortfolio::check(std::vector
 		else if (result == CheckResult::UNKNOWN && lastResult == CheckResult::ERROR)
 			lastResult = result;
 	}
+	if (queryHash && solverAnswered(lastResult))
+	{
+		std::lock_guard<std::mutex> cacheLock(g_queryCacheMutex);
+		g_queryCache[*queryHash] = {lastResult, finalValues};
+	}
 	return std::make_pair(lastResult, finalValues);
 }
 
+void SMTPortfolio::clearQueryCache()
+{
+	std::lock_guard<std::mutex> cacheLock(g_queryCacheMutex);
+	g_queryCache.clear();
+}
+
 std::vector<std::string> SMTPortfolio::unhandledQueries()
 {
 	// This code assumes that the constructor guarantees that
@@ -64,6 +64,10 @@ public:
 	std::vector<std::string> unhandledQueries() override;
 	size_t solvers() override { return m_solvers.size(); }
 
+	/// Clears the process-wide cache of solver answers that check() consults
+	/// before invoking any solver.
+	static void clearQueryCache();
+
 	std::string dumpQuery(std::vector<Expression> const& _expressionsToEvaluate);
 
 private:
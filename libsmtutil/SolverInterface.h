@@ -503,7 +503,7 @@ public:
 private:
 	/// Manual constructors, should only be used by SolverInterface and this class itself.
 	Expression(std::string _name, std::vector<Expression> _arguments, Kind _kind):
-		Expression(std::move(_name), std::move(_arguments), std::make_shared<Sort>(_kind)) {}
+		Expression(std::move(_name), std::move(_arguments), SortProvider::simpleSort(_kind)) {}
 
 	explicit Expression(std::string _name, Kind _kind):
 		Expression(std::move(_name), std::vector<Expression>{}, _kind) {}
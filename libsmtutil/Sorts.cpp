@@ -19,9 +19,31 @@
 
 #include <libsmtutil/Sorts.h>
 
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <utility>
+
 namespace solidity::smtutil
 {
 
+namespace
+{
+
+/// Guards the hash-consing pools of the sort factories.
+std::mutex sortPoolMutex;
+
+std::vector<Sort const*> identities(std::vector<SortPointer> const& _sorts)
+{
+	std::vector<Sort const*> result;
+	result.reserve(_sorts.size());
+	for (SortPointer const& sort: _sorts)
+		result.push_back(sort.get());
+	return result;
+}
+
+}
+
 std::shared_ptr<Sort> const SortProvider::boolSort{std::make_shared<Sort>(Kind::Bool)};
 std::shared_ptr<IntSort> const SortProvider::uintSort{std::make_shared<IntSort>(false)};
 std::shared_ptr<IntSort> const SortProvider::sintSort{std::make_shared<IntSort>(true)};
@@ -35,4 +57,67 @@ std::shared_ptr<IntSort> SortProvider::intSort(bool _signed)
 
 std::shared_ptr<BitVectorSort> const SortProvider::bitVectorSort{std::make_shared<BitVectorSort>(256)};
 
+SortPointer SortProvider::simpleSort(Kind _kind)
+{
+	if (_kind == Kind::Bool)
+		return boolSort;
+
+	static std::map<Kind, SortPointer> pool;
+	std::lock_guard<std::mutex> lock(sortPoolMutex);
+	SortPointer& sort = pool[_kind];
+	if (!sort)
+		sort = std::make_shared<Sort>(_kind);
+	return sort;
+}
+
+std::shared_ptr<FunctionSort> SortProvider::functionSort(std::vector<SortPointer> _domain, SortPointer _codomain)
+{
+	// The cached sort keeps the keyed component sorts alive, so their addresses
+	// stay unambiguous for the lifetime of the pool entry.
+	static std::map<std::pair<std::vector<Sort const*>, Sort const*>, std::shared_ptr<FunctionSort>> pool;
+	std::pair<std::vector<Sort const*>, Sort const*> key{identities(_domain), _codomain.get()};
+	std::lock_guard<std::mutex> lock(sortPoolMutex);
+	std::shared_ptr<FunctionSort>& sort = pool[std::move(key)];
+	if (!sort)
+		sort = std::make_shared<FunctionSort>(std::move(_domain), std::move(_codomain));
+	return sort;
+}
+
+std::shared_ptr<ArraySort> SortProvider::arraySort(SortPointer _domain, SortPointer _range)
+{
+	static std::map<std::pair<Sort const*, Sort const*>, std::shared_ptr<ArraySort>> pool;
+	std::pair<Sort const*, Sort const*> key{_domain.get(), _range.get()};
+	std::lock_guard<std::mutex> lock(sortPoolMutex);
+	std::shared_ptr<ArraySort>& sort = pool[key];
+	if (!sort)
+		sort = std::make_shared<ArraySort>(std::move(_domain), std::move(_range));
+	return sort;
+}
+
+std::shared_ptr<SortSort> SortProvider::sortSort(SortPointer _inner)
+{
+	static std::map<Sort const*, std::shared_ptr<SortSort>> pool;
+	Sort const* key = _inner.get();
+	std::lock_guard<std::mutex> lock(sortPoolMutex);
+	std::shared_ptr<SortSort>& sort = pool[key];
+	if (!sort)
+		sort = std::make_shared<SortSort>(std::move(_inner));
+	return sort;
+}
+
+std::shared_ptr<TupleSort> SortProvider::tupleSort(
+	std::string _name,
+	std::vector<std::string> _members,
+	std::vector<SortPointer> _components
+)
+{
+	static std::map<std::tuple<std::string, std::vector<std::string>, std::vector<Sort const*>>, std::shared_ptr<TupleSort>> pool;
+	std::tuple<std::string, std::vector<std::string>, std::vector<Sort const*>> key{_name, _members, identities(_components)};
+	std::lock_guard<std::mutex> lock(sortPoolMutex);
+	std::shared_ptr<TupleSort>& sort = pool[std::move(key)];
+	if (!sort)
+		sort = std::make_shared<TupleSort>(std::move(_name), std::move(_members), std::move(_components));
+	return sort;
+}
+
 }
@@ -216,6 +216,21 @@ struct SortProvider
 	static std::shared_ptr<IntSort> const sintSort;
 	static std::shared_ptr<IntSort> intSort(bool _signed = false);
 	static std::shared_ptr<BitVectorSort> const bitVectorSort;
+
+	/// The factories below hash-cons the returned sorts: structurally identical requests
+	/// made through them yield the same shared sort object. Compound sorts are keyed by
+	/// the identity of their component sorts, so maximal sharing is achieved when the
+	/// components were obtained through the factories as well. The pools are shared
+	/// process-wide and guarded by a mutex, since compilations may run concurrently.
+	static SortPointer simpleSort(Kind _kind);
+	static std::shared_ptr<FunctionSort> functionSort(std::vector<SortPointer> _domain, SortPointer _codomain);
+	static std::shared_ptr<ArraySort> arraySort(SortPointer _domain, SortPointer _range);
+	static std::shared_ptr<SortSort> sortSort(SortPointer _inner);
+	static std::shared_ptr<TupleSort> tupleSort(
+		std::string _name,
+		std::vector<std::string> _members,
+		std::vector<SortPointer> _components
+	);
 };
 
 }
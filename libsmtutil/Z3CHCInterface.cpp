@@ -20,6 +20,7 @@
 
 #include <libsolutil/CommonIO.h>
 
+#include <algorithm>
 #include <set>
 #include <stack>
 
@@ -50,6 +51,22 @@ Z3CHCInterface::Z3CHCInterface(std::optional<unsigned> _queryTimeout):
 	setSpacerOptions();
 }
 
+void Z3CHCInterface::setQueryBudgetDivisor(unsigned _divisor)
+{
+	smtAssert(_divisor > 0);
+	if (m_queryTimeout)
+		m_context->set("timeout", int(std::max(*m_queryTimeout / _divisor, 1u)));
+	else
+		z3::set_param("rlimit", Z3Interface::resourceLimit / int(_divisor));
+}
+
+void Z3CHCInterface::reset()
+{
+	m_z3Interface->reset();
+	m_solver = z3::fixedpoint(*m_context);
+	setSpacerOptions();
+}
+
 void Z3CHCInterface::declareVariable(std::string const& _name, SortPointer const& _sort)
 {
 	smtAssert(_sort, "");
@@ -89,7 +106,7 @@ std::tuple<CheckResult, Expression, CHCSolverInterface::CexGraph> Z3CHCInterface
 			result = CheckResult::SATISFIABLE;
 			// z3 version 4.8.8 modified Spacer to also return
 			// proofs containing nonlinear clauses.
-			if (m_version >= std::tuple(4, 8, 8, 0))
+			if (m_produceCounterexamples && m_version >= std::tuple(4, 8, 8, 0))
 			{
 				auto proof = m_solver.get_answer();
 				return {result, Expression(true), cexGraph(proof)};
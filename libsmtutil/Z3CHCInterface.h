@@ -36,6 +36,11 @@ class Z3CHCInterface: public CHCSolverInterface
 public:
 	Z3CHCInterface(std::optional<unsigned> _queryTimeout = {});
 
+	/// Drops all registered relations and rules but keeps the z3 context warm, so that
+	/// repeated analyses do not pay for context setup and teardown again.
+	/// z3::fixedpoint cannot retract rules, so the Horn solver itself is replaced.
+	void reset();
+
 	/// Forwards variable declaration to Z3Interface.
 	void declareVariable(std::string const& _name, SortPointer const& _sort) override;
 
@@ -47,8 +52,18 @@ public:
 
 	Z3Interface* z3Interface() const { return m_z3Interface.get(); }
 
+	/// Sets the budget of subsequent queries to the configured one divided by
+	/// @a _divisor: the timeout if one was given, the resource limit ("rlimit")
+	/// otherwise. A divisor of 1 restores the full budget.
+	void setQueryBudgetDivisor(unsigned _divisor);
+
 	void setSpacerOptions(bool _preProcessing = true);
 
+	/// Enables or disables the reconstruction of counterexample graphs from
+	/// Spacer's refutation proofs. When disabled, satisfiable queries report
+	/// their verdict with an empty counterexample, skipping the proof walk.
+	void setCounterexampleGeneration(bool _enabled) { m_produceCounterexamples = _enabled; }
+
 private:
 	/// Constructs a nonlinear counterexample graph from the refutation.
 	CHCSolverInterface::CexGraph cexGraph(z3::expr const& _proof);
@@ -67,6 +82,9 @@ private:
 	z3::fixedpoint m_solver;
 
 	std::tuple<unsigned, unsigned, unsigned, unsigned> m_version = std::tuple(0, 0, 0, 0);
+
+	/// Whether counterexample graphs are reconstructed for satisfiable queries.
+	bool m_produceCounterexamples = true;
 };
 
 }
@@ -24,11 +24,17 @@
 #include <libsolc/libsolc.h>
 #include <libsolidity/interface/StandardCompiler.h>
 #include <libsolidity/interface/Version.h>
+#include <libsolutil/CommonData.h>
+#include <libsolutil/JSON.h>
 #include <libyul/YulString.h>
 
 #include <cstdlib>
 #include <list>
+#include <map>
+#include <ostream>
+#include <streambuf>
 #include <string>
+#include <tuple>
 
 #include "license.h"
 
@@ -111,6 +117,106 @@ std::string compile(std::string _input, CStyleReadFileCallback _readCallback, vo
 	return compiler.compile(std::move(_input));
 }
 
+Json::Value formatJSONError(std::string const& _message)
+{
+	Json::Value error{Json::objectValue};
+	error["type"] = "JSONError";
+	error["component"] = "general";
+	error["severity"] = "error";
+	error["message"] = _message;
+	error["formattedMessage"] = _message;
+	Json::Value output{Json::objectValue};
+	output["errors"] = Json::arrayValue;
+	output["errors"].append(std::move(error));
+	return output;
+}
+
+/// Stream buffer that forwards everything written to it to a CStyleOutputCallback.
+class CallbackStreamBuffer: public std::streambuf
+{
+public:
+	CallbackStreamBuffer(CStyleOutputCallback _callback, void* _context):
+		m_callback(_callback),
+		m_context(_context)
+	{}
+
+protected:
+	std::streamsize xsputn(char const* _data, std::streamsize _count) override
+	{
+		m_callback(m_context, _data, static_cast<size_t>(_count));
+		return _count;
+	}
+
+	int overflow(int _c) override
+	{
+		if (_c != traits_type::eof())
+		{
+			char c = static_cast<char>(_c);
+			m_callback(m_context, &c, 1);
+		}
+		return _c;
+	}
+
+private:
+	CStyleOutputCallback m_callback;
+	void* m_context;
+};
+
+}
+
+/// A long-lived compiler context. Owns the compiler, so that per-process caches attached to
+/// it survive between compilations, as well as the outputs of the last compilation and any
+/// decoded bytecode buffers handed out to the caller.
+struct SolidityContext
+{
+	explicit SolidityContext(ReadCallback::Callback _readCallback):
+		compiler(std::move(_readCallback))
+	{}
+
+	StandardCompiler compiler;
+	/// Parsed output of the last call to solidity_context_compile().
+	Json::Value lastOutput;
+	/// Serialized form of lastOutput, handed out to the caller.
+	std::string lastOutputSerialized;
+	/// Bytecode decoded from lastOutput, keyed by source name, contract name and kind,
+	/// so that repeated retrievals hand out the same buffer.
+	std::map<std::tuple<std::string, std::string, bool>, bytes> bytecodeBuffers;
+};
+
+namespace
+{
+
+/// Shared implementation of solidity_context_compile() and solidity_context_compile_buffer().
+char const* contextCompile(SolidityContext& _context, std::string _input) noexcept
+{
+	_context.lastOutput = Json::Value();
+	_context.lastOutputSerialized.clear();
+	_context.bytecodeBuffers.clear();
+
+	try
+	{
+		Json::Value input;
+		std::string errors;
+		bool parsed = util::jsonParseStrict(_input, input, &errors);
+		// The raw input is not needed anymore once it has been parsed - release it
+		// before compiling instead of keeping it alive until the end of the call.
+		_input = std::string();
+		if (!parsed)
+			_context.lastOutput = formatJSONError(errors);
+		else if (input.isArray())
+			_context.lastOutput = _context.compiler.compileBatch(input);
+		else
+			_context.lastOutput = _context.compiler.compile(input);
+		_context.lastOutputSerialized = util::jsonCompactPrint(_context.lastOutput);
+	}
+	catch (...)
+	{
+		_context.lastOutput = Json::Value();
+		_context.lastOutputSerialized = "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error processing input JSON.\"}]}";
+	}
+	return _context.lastOutputSerialized.c_str();
+}
+
 }
 
 extern "C"
@@ -149,6 +255,100 @@ extern void solidity_free(char* _data) noexcept
 	takeOverAllocation(_data);
 }
 
+extern SolidityContext* solidity_context_create(CStyleReadFileCallback _readCallback, void* _readContext) noexcept
+{
+	try
+	{
+		return new SolidityContext(wrapReadCallback(_readCallback, _readContext));
+	}
+	catch (...)
+	{
+		// most likely a std::bad_alloc(), if at all.
+		return nullptr;
+	}
+}
+
+extern void solidity_context_destroy(SolidityContext* _context) noexcept
+{
+	delete _context;
+}
+
+extern char const* solidity_context_compile(SolidityContext* _context, char const* _input) noexcept
+{
+	return contextCompile(*_context, std::string(_input));
+}
+
+extern char const* solidity_context_compile_buffer(
+	SolidityContext* _context,
+	char* _input,
+	size_t* o_outputSize
+) noexcept
+{
+	std::string input = takeOverAllocation(_input);
+	truncateCString(input);
+	char const* output = contextCompile(*_context, std::move(input));
+	if (o_outputSize)
+		*o_outputSize = _context->lastOutputSerialized.size();
+	return output;
+}
+
+extern void solidity_context_compile_callback(
+	SolidityContext* _context,
+	char const* _input,
+	CStyleOutputCallback _outputCallback,
+	void* _outputContext
+) noexcept
+{
+	// The outputs of a streamed compilation are not retained in the context.
+	_context->lastOutput = Json::Value();
+	_context->lastOutputSerialized.clear();
+	_context->bytecodeBuffers.clear();
+
+	CallbackStreamBuffer buffer(_outputCallback, _outputContext);
+	std::ostream outputStream(&buffer);
+	_context->compiler.compile(std::string(_input), outputStream);
+}
+
+extern bool solidity_context_bytecode(
+	SolidityContext* _context,
+	char const* _sourceName,
+	char const* _contractName,
+	bool _runtime,
+	unsigned char const** o_data,
+	size_t* o_size
+) noexcept
+{
+	*o_data = nullptr;
+	*o_size = 0;
+	try
+	{
+		auto key = std::make_tuple(std::string(_sourceName), std::string(_contractName), _runtime);
+		auto cached = _context->bytecodeBuffers.find(key);
+		if (cached == _context->bytecodeBuffers.end())
+		{
+			Json::Value const& object =
+				_context->lastOutput
+					["contracts"][_sourceName][_contractName]
+					["evm"][_runtime ? "deployedBytecode" : "bytecode"]["object"];
+			if (!object.isString())
+				return false;
+			std::string hex = object.asString();
+			bytes decoded = fromHex(hex);
+			// Hex decoding fails e.g. on unlinked library placeholders.
+			if (decoded.empty() && !hex.empty())
+				return false;
+			cached = _context->bytecodeBuffers.emplace(std::move(key), std::move(decoded)).first;
+		}
+		*o_data = cached->second.data();
+		*o_size = cached->second.size();
+		return true;
+	}
+	catch (...)
+	{
+		return false;
+	}
+}
+
 extern void solidity_reset() noexcept
 {
 	// This is called right before each compilation, but not at the end, so additional memory
@@ -52,6 +52,19 @@ extern "C" {
 /// If the callback is not supported, *o_contents and *o_error must be set to NULL.
 typedef void (*CStyleReadFileCallback)(void* _context, char const* _kind, char const* _data, char** o_contents, char** o_error);
 
+/// Callback used to receive the serialized output of a compilation in chunks.
+///
+/// @param _context The outputContext passed to solidity_context_compile_callback. Can be NULL.
+/// @param _data A pointer to the next chunk of output. Only valid for the duration of the call.
+/// @param _size The size of the chunk in bytes.
+///
+/// The chunks, concatenated in the order of the calls, form the output JSON. The data is
+/// not zero-terminated and must be copied by the callback if it is to be retained.
+typedef void (*CStyleOutputCallback)(void* _context, char const* _data, size_t _size);
+
+/// Opaque handle to a long-lived compiler context created via solidity_context_create().
+typedef struct SolidityContext SolidityContext;
+
 /// Returns the complete license document.
 ///
 /// The pointer returned must NOT be freed by the caller.
@@ -90,6 +103,87 @@ void solidity_free(char* _data) SOLC_NOEXCEPT;
 /// @returns A pointer to the result. The pointer returned must be freed by the caller using solidity_free() or solidity_reset().
 char* solidity_compile(char const* _input, CStyleReadFileCallback _readCallback, void* _readContext) SOLC_NOEXCEPT;
 
+/// Creates a compiler context that can be reused for multiple compilations, avoiding the
+/// setup cost per compile and giving access to the outputs of the last compilation without
+/// going through the serialized JSON.
+///
+/// @param _readCallback The optional callback pointer. Can be NULL. See solidity_compile.
+/// @param _readContext An optional context pointer passed to _readCallback. Can be NULL.
+///
+/// @returns A handle that must be freed using solidity_context_destroy(), or NULL if the
+/// context could not be allocated. The handle is not affected by solidity_reset().
+SolidityContext* solidity_context_create(CStyleReadFileCallback _readCallback, void* _readContext) SOLC_NOEXCEPT;
+
+/// Frees the given compiler context and all buffers handed out for it.
+void solidity_context_destroy(SolidityContext* _context) SOLC_NOEXCEPT;
+
+/// Takes a "Standard Input JSON" and compiles it in the given context.
+///
+/// @param _context The context created via solidity_context_create().
+/// @param _input The input JSON to process.
+///
+/// @returns A pointer to the serialized output JSON. The pointer is owned by the context -
+/// it must NOT be freed by the caller and stays valid until the next compilation in the
+/// same context or until the context is destroyed.
+char const* solidity_context_compile(SolidityContext* _context, char const* _input) SOLC_NOEXCEPT;
+
+/// Same as solidity_context_compile, but takes ownership of the input buffer and reports
+/// the size of the output, so that no copy of either is needed when the embedder exchanges
+/// the data through shared memory, e.g. across the wasm boundary.
+///
+/// @param _context The context created via solidity_context_create().
+/// @param _input The input JSON, allocated via solidity_alloc(). Ownership passes to the
+///               compiler, which frees the buffer - it must NOT be passed to solidity_free().
+///               Like in read callbacks, the content ends at the first zero byte.
+///               Passing a pointer not obtained from solidity_alloc() will abort().
+/// @param o_outputSize If not NULL, set to the size of the returned output in bytes, so
+///                     the caller does not have to scan for the zero terminator.
+///
+/// @returns A pointer to the serialized output JSON, owned by the context as with
+/// solidity_context_compile().
+char const* solidity_context_compile_buffer(
+	SolidityContext* _context,
+	char* _input,
+	size_t* o_outputSize
+) SOLC_NOEXCEPT;
+
+/// Same as solidity_context_compile, but hands the serialized output to @p _outputCallback
+/// in chunks instead of materializing it, bounding the memory needed to retrieve large
+/// outputs. Note that the outputs of a compilation performed this way cannot be accessed
+/// via solidity_context_bytecode().
+void solidity_context_compile_callback(
+	SolidityContext* _context,
+	char const* _input,
+	CStyleOutputCallback _outputCallback,
+	void* _outputContext
+) SOLC_NOEXCEPT;
+
+/// Retrieves the bytecode of a contract from the last call to solidity_context_compile()
+/// in the given context as raw bytes, i.e. without the round trip through the hex string
+/// embedded in the output JSON.
+///
+/// @param _context The context created via solidity_context_create().
+/// @param _sourceName The source unit name of the contract.
+/// @param _contractName The name of the contract.
+/// @param _runtime If true, retrieves the deployed (runtime) bytecode instead of the
+///                 creation bytecode.
+/// @param o_data Set to the start of the bytecode buffer. The buffer is owned by the
+///               context and stays valid until the next compilation in the same context
+///               or until the context is destroyed.
+/// @param o_size Set to the size of the bytecode buffer in bytes.
+///
+/// @returns true on success. Returns false if the contract or the requested bytecode is
+/// not present in the output, e.g. because it was not selected, the compilation failed or
+/// the bytecode contains unlinked library placeholders.
+bool solidity_context_bytecode(
+	SolidityContext* _context,
+	char const* _sourceName,
+	char const* _contractName,
+	bool _runtime,
+	unsigned char const** o_data,
+	size_t* o_size
+) SOLC_NOEXCEPT;
+
 /// Frees up any allocated memory.
 ///
 /// NOTE: the pointer returned by solidity_compile as well as any other pointer retrieved via solidity_alloc()
@@ -263,15 +263,20 @@ std::optional<TypedRational> constantToTypedValue(Type const& _type)
 
 std::optional<TypedRational> ConstantEvaluator::evaluate(
 	langutil::ErrorReporter& _errorReporter,
-	Expression const& _expr
+	Expression const& _expr,
+	EvaluationCache* _cache
 )
 {
-	return ConstantEvaluator{_errorReporter}.evaluate(_expr);
+	return ConstantEvaluator{_errorReporter, _cache}.evaluate(_expr);
 }
 
 
 std::optional<TypedRational> ConstantEvaluator::evaluate(ASTNode const& _node)
 {
+	if (m_cache)
+		if (auto it = m_cache->find(_node.id()); it != m_cache->end())
+			return it->second;
+
 	if (!m_values.count(&_node))
 	{
 		if (auto const* varDecl = dynamic_cast<VariableDeclaration const*>(&_node))
@@ -300,7 +305,13 @@ std::optional<TypedRational> ConstantEvaluator::evaluate(ASTNode const& _node)
 				m_values[&_node] = std::nullopt;
 		}
 	}
-	return m_values.at(&_node);
+
+	std::optional<TypedRational> const& value = m_values.at(&_node);
+	// Only successful evaluations are memoized: a failed one can still succeed in a later
+	// phase, e.g. once the type of a referenced constant variable is known.
+	if (m_cache && value)
+		m_cache->emplace(_node.id(), *value);
+	return value;
 }
 
 void ConstantEvaluator::endVisit(UnaryOperation const& _operation)
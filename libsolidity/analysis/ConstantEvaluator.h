@@ -52,9 +52,17 @@ public:
 		rational value;
 	};
 
+	/// Memo table of successfully folded constants, keyed by AST node ID. Can be shared between
+	/// evaluations (typically by the CompilerStack owning the AST) so that each constant is
+	/// folded at most once per compilation run, no matter how often it is referenced.
+	/// Has to be cleared whenever the AST or the type system is reset, since both the keys and
+	/// the types of the values are only meaningful for the current compilation.
+	using EvaluationCache = std::map<int64_t, TypedRational>;
+
 	static std::optional<TypedRational> evaluate(
 		langutil::ErrorReporter& _errorReporter,
-		Expression const& _expr
+		Expression const& _expr,
+		EvaluationCache* _cache = nullptr
 	);
 
 	/// Performs arbitrary-precision evaluation of a binary operator. Returns nullopt on cases like
@@ -66,7 +74,10 @@ public:
 	static std::optional<rational> evaluateUnaryOperator(Token _operator, rational const& _input);
 
 private:
-	explicit ConstantEvaluator(langutil::ErrorReporter& _errorReporter): m_errorReporter(_errorReporter) {}
+	explicit ConstantEvaluator(langutil::ErrorReporter& _errorReporter, EvaluationCache* _cache = nullptr):
+		m_errorReporter(_errorReporter),
+		m_cache(_cache)
+	{}
 
 	std::optional<TypedRational> evaluate(ASTNode const& _node);
 
@@ -81,6 +92,8 @@ private:
 	size_t m_depth = 0;
 	/// Values of sub-expressions and variable declarations.
 	std::map<ASTNode const*, std::optional<TypedRational>> m_values;
+	/// Memo table shared across evaluations, if any.
+	EvaluationCache* m_cache = nullptr;
 };
 
 }
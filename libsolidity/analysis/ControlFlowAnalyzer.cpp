@@ -23,7 +23,11 @@
 
 #include <range/v3/algorithm/sort.hpp>
 
+#include <atomic>
+#include <exception>
 #include <functional>
+#include <mutex>
+#include <thread>
 
 using namespace std::placeholders;
 using namespace solidity::langutil;
@@ -32,35 +36,89 @@ using namespace solidity::frontend;
 
 bool ControlFlowAnalyzer::run()
 {
-	for (auto& [pair, flow]: m_cfg.allFunctionFlows())
-		analyze(*pair.function, pair.contract, *flow);
+	std::vector<std::pair<CFG::FunctionContractTuple, FunctionFlow const*>> functionFlows;
+	for (auto const& [pair, flow]: m_cfg.allFunctionFlows())
+		functionFlows.emplace_back(pair, flow.get());
+
+	// Analyze the flows in parallel. The analysis only reads the control flow graph, so the
+	// workers share no mutable state; each one stores its findings under the flow's index.
+	std::vector<Findings> findings(functionFlows.size());
+
+	auto analyzeFlow = [&](size_t _index) {
+		findings[_index] = analyze(*functionFlows[_index].first.function, *functionFlows[_index].second);
+	};
+
+	unsigned jobs = std::min<unsigned>(m_jobs, static_cast<unsigned>(functionFlows.size()));
+	if (jobs <= 1)
+		for (size_t index = 0; index < functionFlows.size(); ++index)
+			analyzeFlow(index);
+	else
+	{
+		std::atomic<size_t> nextFlow{0};
+		std::mutex exceptionMutex;
+		std::exception_ptr workerException;
+
+		auto work = [&]() {
+			while (true)
+			{
+				size_t index = nextFlow.fetch_add(1);
+				if (index >= functionFlows.size())
+					break;
+				try
+				{
+					analyzeFlow(index);
+				}
+				catch (...)
+				{
+					std::lock_guard<std::mutex> lock(exceptionMutex);
+					if (!workerException)
+						workerException = std::current_exception();
+					// Let the remaining workers drain the queue without starting new flows.
+					nextFlow.store(functionFlows.size());
+					break;
+				}
+			}
+		};
+
+		std::vector<std::thread> threads;
+		for (unsigned i = 1; i < jobs; ++i)
+			threads.emplace_back(work);
+		work();
+		for (std::thread& thread: threads)
+			thread.join();
+
+		if (workerException)
+			std::rethrow_exception(workerException);
+	}
+
+	// Report the findings sequentially in flow order, so that the emitted errors and the
+	// deduplication of warnings do not depend on the thread scheduling.
+	for (size_t index = 0; index < functionFlows.size(); ++index)
+	{
+		reportUninitializedAccesses(
+			*functionFlows[index].first.function,
+			functionFlows[index].first.contract,
+			findings[index].uninitializedAccesses
+		);
+		reportUnreachable(findings[index].unreachableLocations);
+	}
 
 	return !Error::containsErrors(m_errorReporter.errors());
 }
 
-void ControlFlowAnalyzer::analyze(FunctionDefinition const& _function, ContractDefinition const* _contract, FunctionFlow const& _flow)
+ControlFlowAnalyzer::Findings ControlFlowAnalyzer::analyze(FunctionDefinition const& _function, FunctionFlow const& _flow)
 {
 	if (!_function.isImplemented())
-		return;
-
-	std::optional<std::string> mostDerivedContractName;
-
-	// The name of the most derived contract only required if it differs from
-	// the functions contract
-	if (_contract && _contract != _function.annotation().contract)
-		mostDerivedContractName = _contract->name();
+		return {};
 
-	checkUninitializedAccess(
-		_flow.entry,
-		_flow.exit,
-		_function.body().statements().empty(),
-		mostDerivedContractName
-	);
-	checkUnreachable(_flow.entry, _flow.exit, _flow.revert, _flow.transactionReturn);
+	return {
+		collectUninitializedAccesses(_flow.entry, _flow.exit),
+		collectUnreachable(_flow.entry, _flow.exit, _flow.revert, _flow.transactionReturn)
+	};
 }
 
 
-void ControlFlowAnalyzer::checkUninitializedAccess(CFGNode const* _entry, CFGNode const* _exit, bool _emptyBody, std::optional<std::string> _contractName)
+std::vector<VariableOccurrence const*> ControlFlowAnalyzer::collectUninitializedAccesses(CFGNode const* _entry, CFGNode const* _exit)
 {
 	struct NodeInfo
 	{
@@ -135,65 +193,80 @@ void ControlFlowAnalyzer::checkUninitializedAccess(CFGNode const* _entry, CFGNod
 	}
 
 	auto const& exitInfo = nodeInfos[_exit];
-	if (!exitInfo.uninitializedVariableAccesses.empty())
+	std::vector<VariableOccurrence const*> uninitializedAccessesOrdered(
+		exitInfo.uninitializedVariableAccesses.begin(),
+		exitInfo.uninitializedVariableAccesses.end()
+	);
+	ranges::sort(
+		uninitializedAccessesOrdered,
+		[](VariableOccurrence const* lhs, VariableOccurrence const* rhs) -> bool
+		{
+			return *lhs < *rhs;
+		}
+	);
+
+	return uninitializedAccessesOrdered;
+}
+
+void ControlFlowAnalyzer::reportUninitializedAccesses(
+	FunctionDefinition const& _function,
+	ContractDefinition const* _contract,
+	std::vector<VariableOccurrence const*> const& _accesses
+)
+{
+	std::optional<std::string> mostDerivedContractName;
+
+	// The name of the most derived contract only required if it differs from
+	// the functions contract
+	if (_contract && _contract != _function.annotation().contract)
+		mostDerivedContractName = _contract->name();
+
+	bool emptyBody = _function.body().statements().empty();
+
+	for (auto const* variableOccurrence: _accesses)
 	{
-		std::vector<VariableOccurrence const*> uninitializedAccessesOrdered(
-			exitInfo.uninitializedVariableAccesses.begin(),
-			exitInfo.uninitializedVariableAccesses.end()
-		);
-		ranges::sort(
-			uninitializedAccessesOrdered,
-			[](VariableOccurrence const* lhs, VariableOccurrence const* rhs) -> bool
-			{
-				return *lhs < *rhs;
-			}
-		);
+		VariableDeclaration const& varDecl = variableOccurrence->declaration();
 
-		for (auto const* variableOccurrence: uninitializedAccessesOrdered)
-		{
-			VariableDeclaration const& varDecl = variableOccurrence->declaration();
-
-			SecondarySourceLocation ssl;
-			if (variableOccurrence->occurrence())
-				ssl.append("The variable was declared here.", varDecl.location());
-
-			bool isStorage = varDecl.type()->dataStoredIn(DataLocation::Storage);
-			bool isCalldata = varDecl.type()->dataStoredIn(DataLocation::CallData);
-			if (isStorage || isCalldata)
-				m_errorReporter.typeError(
-					3464_error,
-					variableOccurrence->occurrence() ?
-						*variableOccurrence->occurrence() :
-						varDecl.location(),
-					ssl,
-					"This variable is of " +
-					std::string(isStorage ? "storage" : "calldata") +
-					" pointer type and can be " +
-					(variableOccurrence->kind() == VariableOccurrence::Kind::Return ? "returned" : "accessed") +
-					" without prior assignment, which would lead to undefined behaviour."
-				);
-			else if (!_emptyBody && varDecl.name().empty())
-			{
-				if (!m_unassignedReturnVarsAlreadyWarnedFor.emplace(&varDecl).second)
-					continue;
+		SecondarySourceLocation ssl;
+		if (variableOccurrence->occurrence())
+			ssl.append("The variable was declared here.", varDecl.location());
 
-				m_errorReporter.warning(
-					6321_error,
+		bool isStorage = varDecl.type()->dataStoredIn(DataLocation::Storage);
+		bool isCalldata = varDecl.type()->dataStoredIn(DataLocation::CallData);
+		if (isStorage || isCalldata)
+			m_errorReporter.typeError(
+				3464_error,
+				variableOccurrence->occurrence() ?
+					*variableOccurrence->occurrence() :
 					varDecl.location(),
-					"Unnamed return variable can remain unassigned" +
-					(
-						_contractName.has_value() ?
-						" when the function is called when \"" + _contractName.value() + "\" is the most derived contract." :
-						"."
-					) +
-					" Add an explicit return with value to all non-reverting code paths or name the variable."
-				);
-			}
+				ssl,
+				"This variable is of " +
+				std::string(isStorage ? "storage" : "calldata") +
+				" pointer type and can be " +
+				(variableOccurrence->kind() == VariableOccurrence::Kind::Return ? "returned" : "accessed") +
+				" without prior assignment, which would lead to undefined behaviour."
+			);
+		else if (!emptyBody && varDecl.name().empty())
+		{
+			if (!m_unassignedReturnVarsAlreadyWarnedFor.emplace(&varDecl).second)
+				continue;
+
+			m_errorReporter.warning(
+				6321_error,
+				varDecl.location(),
+				"Unnamed return variable can remain unassigned" +
+				(
+					mostDerivedContractName.has_value() ?
+					" when the function is called when \"" + mostDerivedContractName.value() + "\" is the most derived contract." :
+					"."
+				) +
+				" Add an explicit return with value to all non-reverting code paths or name the variable."
+			);
 		}
 	}
 }
 
-void ControlFlowAnalyzer::checkUnreachable(CFGNode const* _entry, CFGNode const* _exit, CFGNode const* _revert, CFGNode const* _transactionReturn)
+std::vector<SourceLocation> ControlFlowAnalyzer::collectUnreachable(CFGNode const* _entry, CFGNode const* _exit, CFGNode const* _revert, CFGNode const* _transactionReturn)
 {
 	// collect all nodes reachable from the entry point
 	std::set<CFGNode const*> reachable = util::BreadthFirstSearch<CFGNode const*>{{_entry}}.run(
@@ -215,6 +288,7 @@ void ControlFlowAnalyzer::checkUnreachable(CFGNode const* _entry, CFGNode const*
 		}
 	);
 
+	std::vector<SourceLocation> unreachableMerged;
 	for (auto it = unreachable.begin(); it != unreachable.end();)
 	{
 		SourceLocation location = *it++;
@@ -222,7 +296,15 @@ void ControlFlowAnalyzer::checkUnreachable(CFGNode const* _entry, CFGNode const*
 		for (; it != unreachable.end() && it->start <= location.end; ++it)
 			location.end = std::max(location.end, it->end);
 
+		unreachableMerged.emplace_back(std::move(location));
+	}
+
+	return unreachableMerged;
+}
+
+void ControlFlowAnalyzer::reportUnreachable(std::vector<SourceLocation> const& _locations)
+{
+	for (SourceLocation const& location: _locations)
 		if (m_unreachableLocationsAlreadyWarnedFor.emplace(location).second)
 			m_errorReporter.warning(5740_error, location, "Unreachable code.");
-	}
 }
@@ -21,6 +21,7 @@
 #include <libsolidity/analysis/ControlFlowGraph.h>
 #include <liblangutil/ErrorReporter.h>
 #include <set>
+#include <vector>
 
 namespace solidity::frontend
 {
@@ -28,26 +29,45 @@ namespace solidity::frontend
 class ControlFlowAnalyzer
 {
 public:
-	explicit ControlFlowAnalyzer(CFG const& _cfg, langutil::ErrorReporter& _errorReporter):
-		m_cfg(_cfg), m_errorReporter(_errorReporter) {}
+	/// @param _jobs the number of threads used to analyze the function flows. The flows are
+	/// independent of each other, so they can be processed in parallel; the findings are
+	/// reported sequentially afterwards to keep the emitted errors deterministic.
+	explicit ControlFlowAnalyzer(CFG const& _cfg, langutil::ErrorReporter& _errorReporter, unsigned _jobs = 1):
+		m_cfg(_cfg), m_errorReporter(_errorReporter), m_jobs(std::max(1u, _jobs)) {}
 
 	bool run();
 
 private:
-	void analyze(FunctionDefinition const& _function, ContractDefinition const* _contract, FunctionFlow const& _flow);
-	/// Checks for uninitialized variable accesses in the control flow between @param _entry and @param _exit.
-	/// @param _entry entry node
-	/// @param _exit exit node
-	/// @param _emptyBody whether the body of the function is empty (true) or not (false)
-	/// @param _contractName name of the most derived contract, should be empty
-	///        if the function is also defined in it
-	void checkUninitializedAccess(CFGNode const* _entry, CFGNode const* _exit, bool _emptyBody, std::optional<std::string> _contractName = {});
-	/// Checks for unreachable code, i.e. code ending in @param _exit, @param _revert or @param _transactionReturn
-	/// that can not be reached from @param _entry.
-	void checkUnreachable(CFGNode const* _entry, CFGNode const* _exit, CFGNode const* _revert, CFGNode const* _transactionReturn);
+	/// Issues found by analyzing the control flow of a single function.
+	struct Findings
+	{
+		/// Accesses of variables that can happen before an assignment, ordered by occurrence.
+		std::vector<VariableOccurrence const*> uninitializedAccesses;
+		/// Locations of unreachable code, with overlapping locations already merged.
+		std::vector<langutil::SourceLocation> unreachableLocations;
+	};
+
+	/// Analyzes the control flow of a single function without reporting anything.
+	/// Has no access to shared state and can run concurrently for different functions.
+	static Findings analyze(FunctionDefinition const& _function, FunctionFlow const& _flow);
+	/// Collects accesses of uninitialized variables in the control flow between @param _entry and @param _exit.
+	static std::vector<VariableOccurrence const*> collectUninitializedAccesses(CFGNode const* _entry, CFGNode const* _exit);
+	/// Collects the locations of unreachable code, i.e. code ending in @param _exit, @param _revert
+	/// or @param _transactionReturn that can not be reached from @param _entry.
+	static std::vector<langutil::SourceLocation> collectUnreachable(CFGNode const* _entry, CFGNode const* _exit, CFGNode const* _revert, CFGNode const* _transactionReturn);
+	/// Reports the collected uninitialized accesses of a function.
+	/// @param _contract the most derived contract, can differ from the contract the function is defined in.
+	void reportUninitializedAccesses(
+		FunctionDefinition const& _function,
+		ContractDefinition const* _contract,
+		std::vector<VariableOccurrence const*> const& _accesses
+	);
+	/// Reports the collected unreachable code locations of a function.
+	void reportUnreachable(std::vector<langutil::SourceLocation> const& _locations);
 
 	CFG const& m_cfg;
 	langutil::ErrorReporter& m_errorReporter;
+	unsigned m_jobs;
 
 	std::set<langutil::SourceLocation> m_unreachableLocationsAlreadyWarnedFor;
 	std::set<VariableDeclaration const*> m_unassignedReturnVarsAlreadyWarnedFor;
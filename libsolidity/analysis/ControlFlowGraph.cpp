@@ -59,6 +59,7 @@ FunctionFlow const& CFG::functionFlow(FunctionDefinition const& _function, Contr
 
 CFGNode* CFG::NodeContainer::newNode()
 {
-	m_nodes.emplace_back(std::make_unique<CFGNode>());
-	return m_nodes.back().get();
+	auto* node = new (m_nodePool.allocate(sizeof(CFGNode), alignof(CFGNode))) CFGNode{};
+	m_nodes.emplace_back(node);
+	return node;
 }
@@ -24,8 +24,11 @@
 #include <liblangutil/EVMVersion.h>
 #include <liblangutil/SourceLocation.h>
 
+#include <libsolutil/Arena.h>
+
 #include <map>
 #include <memory>
+#include <new>
 #include <stack>
 #include <utility>
 #include <vector>
@@ -166,9 +169,26 @@ public:
 	class NodeContainer
 	{
 	public:
+		NodeContainer() = default;
+		NodeContainer(NodeContainer const&) = delete;
+		NodeContainer& operator=(NodeContainer const&) = delete;
+		~NodeContainer()
+		{
+			// The pool releases the nodes' storage without running destructors.
+			for (CFGNode* node: m_nodes)
+				node->~CFGNode();
+		}
+
 		CFGNode* newNode();
 	private:
-		std::vector<std::unique_ptr<CFGNode>> m_nodes;
+		/// Memory pool all nodes are carved out of, avoiding a separate allocation per node
+		/// and keeping nodes created back-to-back adjacent in memory for the graph traversals.
+		/// Has to be declared before ``m_nodes``: the destructor destroys the nodes before
+		/// the pool releases their storage.
+		util::Arena m_nodePool;
+		/// The nodes in creation order, for explicit ownership. The pointed-to nodes live
+		/// in ``m_nodePool``.
+		std::vector<CFGNode*> m_nodes;
 	};
 private:
 	langutil::ErrorReporter& m_errorReporter;
@@ -29,9 +29,22 @@
 #include <range/v3/view/filter.hpp>
 #include <range/v3/range/conversion.hpp>
 
+#include <algorithm>
+
 using namespace solidity;
 using namespace solidity::frontend;
 
+namespace
+{
+
+// because the edit distance computation has quadratic runtime - it will not magically improve once a better algorithm is discovered ;)
+// since 80 is the suggested line length limit, we use 80^2 as length threshold
+constexpr size_t MAXIMUM_LENGTH_THRESHOLD = 80 * 80;
+
+}
+
+std::atomic<uint64_t> DeclarationContainer::s_generation{0};
+
 Declaration const* DeclarationContainer::conflictingDeclaration(
 	Declaration const& _declaration,
 	ASTString const* _name
@@ -91,6 +104,7 @@ void DeclarationContainer::activateVariable(ASTString const& _name)
 	solAssert(m_declarations.count(_name) == 0 || m_declarations.at(_name).empty(), "");
 	m_declarations[_name].emplace_back(m_invisibleDeclarations.at(_name).front());
 	m_invisibleDeclarations.erase(_name);
+	invalidateLookupCaches();
 }
 
 bool DeclarationContainer::isInvisible(ASTString const& _name) const
@@ -129,6 +143,7 @@ bool DeclarationContainer::registerDeclaration(
 	std::vector<Declaration const*>& decls = _invisible ? m_invisibleDeclarations[*_name] : m_declarations[*_name];
 	if (!util::contains(decls, &_declaration))
 		decls.push_back(&_declaration);
+	invalidateLookupCaches();
 	return true;
 }
 
@@ -147,6 +162,16 @@ std::vector<Declaration const*> DeclarationContainer::resolveName(
 ) const
 {
 	solAssert(!_name.empty(), "Attempt to resolve empty name.");
+
+	size_t settingsIndex =
+		(_settings.recursive ? 1u : 0u) |
+		(_settings.alsoInvisible ? 2u : 0u) |
+		(_settings.onlyVisibleAsUnqualifiedNames ? 4u : 0u);
+	util::FlatHashMap<ASTString, CachedLookup>& cache = m_lookupCache[settingsIndex];
+	uint64_t generation = s_generation.load(std::memory_order_relaxed);
+	if (auto it = cache.find(_name); it != cache.end() && it->second.generation == generation)
+		return it->second.declarations;
+
 	std::vector<Declaration const*> result;
 
 	if (m_declarations.count(_name))
@@ -168,30 +193,98 @@ std::vector<Declaration const*> DeclarationContainer::resolveName(
 	if (result.empty() && _settings.recursive && m_enclosingContainer)
 		result = m_enclosingContainer->resolveName(_name, _settings);
 
+	cache.insert_or_assign(_name, CachedLookup{generation, result});
 	return result;
 }
 
-std::vector<ASTString> DeclarationContainer::similarNames(ASTString const& _name) const
+DeclarationContainer::SimilarityIndex const& DeclarationContainer::similarityIndex() const
 {
+	uint64_t generation = s_generation.load(std::memory_order_relaxed);
+	if (m_similarityIndex && m_similarityIndex->generation == generation)
+		return *m_similarityIndex;
 
-	// because the function below has quadratic runtime - it will not magically improve once a better algorithm is discovered ;)
-	// since 80 is the suggested line length limit, we use 80^2 as length threshold
-	static size_t const MAXIMUM_LENGTH_THRESHOLD = 80 * 80;
+	m_similarityIndex.emplace();
+	m_similarityIndex->generation = generation;
+	std::vector<SimilarityIndex::Node>& nodes = m_similarityIndex->nodes;
 
-	std::vector<ASTString> similar;
-	size_t maximumEditDistance = _name.size() > 3 ? 2 : _name.size() / 2;
-	for (auto const& declaration: m_declarations)
+	auto insert = [&](ASTString const& _name, uint8_t _occurrence)
 	{
-		std::string const& declarationName = declaration.first;
-		if (util::stringWithinDistance(_name, declarationName, maximumEditDistance, MAXIMUM_LENGTH_THRESHOLD))
-			similar.push_back(declarationName);
-	}
+		// All names in the tree are short enough for the length threshold to never trigger,
+		// which keeps the distance computations during construction and search cheap.
+		if (_name.size() * _name.size() > MAXIMUM_LENGTH_THRESHOLD)
+		{
+			m_similarityIndex->longNames.emplace_back(_name, _occurrence);
+			return;
+		}
+		if (nodes.empty())
+		{
+			nodes.push_back({_name, _occurrence, {}});
+			return;
+		}
+		size_t index = 0;
+		while (true)
+		{
+			size_t distance = util::stringDistance(_name, nodes[index].name);
+			if (distance == 0)
+			{
+				nodes[index].occurrences |= _occurrence;
+				return;
+			}
+			auto [it, inserted] = nodes[index].children.emplace(distance, nodes.size());
+			if (inserted)
+			{
+				nodes.push_back({_name, _occurrence, {}});
+				return;
+			}
+			index = it->second;
+		}
+	};
+
+	for (auto const& declaration: m_declarations)
+		insert(declaration.first, SimilarityIndex::Visible);
 	for (auto const& declaration: m_invisibleDeclarations)
+		insert(declaration.first, SimilarityIndex::Invisible);
+
+	return *m_similarityIndex;
+}
+
+std::vector<ASTString> DeclarationContainer::similarNames(ASTString const& _name) const
+{
+	size_t maximumEditDistance = _name.size() > 3 ? 2 : _name.size() / 2;
+
+	SimilarityIndex const& index = similarityIndex();
+	std::vector<std::pair<ASTString, uint8_t>> matches;
+	if (!index.nodes.empty())
 	{
-		std::string const& declarationName = declaration.first;
-		if (util::stringWithinDistance(_name, declarationName, maximumEditDistance, MAXIMUM_LENGTH_THRESHOLD))
-			similar.push_back(declarationName);
+		std::vector<size_t> candidates{0};
+		while (!candidates.empty())
+		{
+			SimilarityIndex::Node const& node = index.nodes[candidates.back()];
+			candidates.pop_back();
+			size_t distance = util::stringDistance(_name, node.name);
+			if (distance <= maximumEditDistance)
+				matches.emplace_back(node.name, node.occurrences);
+			// Only subtrees whose distance to the query can still be within the tolerance
+			// need to be visited.
+			for (auto const& [edge, child]: node.children)
+				if (edge + maximumEditDistance >= distance && edge <= distance + maximumEditDistance)
+					candidates.push_back(child);
+		}
 	}
+	for (auto const& [longName, occurrence]: index.longNames)
+		if (util::stringWithinDistance(_name, longName, maximumEditDistance, MAXIMUM_LENGTH_THRESHOLD))
+			matches.emplace_back(longName, occurrence);
+
+	// Report the matches in the order the previous linear scan over the declaration maps
+	// produced them: visible declarations first, each group sorted by name.
+	std::sort(matches.begin(), matches.end());
+	std::vector<ASTString> similar;
+	for (auto const& [matchedName, occurrences]: matches)
+		if (occurrences & SimilarityIndex::Visible)
+			similar.push_back(matchedName);
+	for (auto const& [matchedName, occurrences]: matches)
+		if (occurrences & SimilarityIndex::Invisible)
+			similar.push_back(matchedName);
 
 	if (m_enclosingContainer)
 		similar += m_enclosingContainer->similarNames(_name);
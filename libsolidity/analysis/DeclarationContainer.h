@@ -27,7 +27,13 @@
 #include <liblangutil/Exceptions.h>
 #include <liblangutil/SourceLocation.h>
 
+#include <libsolutil/FlatHashMap.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <optional>
 
 namespace solidity::frontend
 {
@@ -80,7 +86,7 @@ public:
 	std::vector<Declaration const*> resolveName(ASTString const& _name, ResolvingSettings _settings = ResolvingSettings{}) const;
 	ASTNode const* enclosingNode() const { return m_enclosingNode; }
 	DeclarationContainer const* enclosingContainer() const { return m_enclosingContainer; }
-	std::map<ASTString, std::vector<Declaration const*>> const& declarations() const { return m_declarations; }
+	util::FlatHashMap<ASTString, std::vector<Declaration const*>> const& declarations() const { return m_declarations; }
 	/// @returns whether declaration is valid, and if not also returns previous declaration.
 	Declaration const* conflictingDeclaration(Declaration const& _declaration, ASTString const* _name = nullptr) const;
 
@@ -100,11 +106,65 @@ public:
 	void populateHomonyms(std::back_insert_iterator<Homonyms> _it) const;
 
 private:
+	/// Result of a previous call to @a resolveName, valid as long as no container was modified
+	/// since it was stored.
+	struct CachedLookup
+	{
+		uint64_t generation;
+		std::vector<Declaration const*> declarations;
+	};
+
+	/// Invalidates the lookup caches of all containers. Must be called whenever the declarations
+	/// of any container change, e.g. when imports or inherited scopes are registered.
+	static void invalidateLookupCaches() { s_generation.fetch_add(1, std::memory_order_relaxed); }
+
+	/// BK-tree over the names declared in this container, used by @a similarNames to find
+	/// spelling suggestions without computing the edit distance to every declaration.
+	/// Since the edit distance is a metric, a subtree reached over an edge labelled e from
+	/// a node at distance d to the query can only contain matches if |d - e| is within the
+	/// tolerance.
+	struct SimilarityIndex
+	{
+		/// Records in which declaration maps a name occurs, to reproduce the order in which
+		/// a linear scan would have reported the matches.
+		enum Occurrence: uint8_t { Visible = 1, Invisible = 2 };
+
+		struct Node
+		{
+			ASTString name;
+			uint8_t occurrences = 0;
+			/// Child nodes (as indices into @a nodes), keyed by their edit distance to @a name.
+			std::map<size_t, size_t> children;
+		};
+
+		/// Generation this index was built for; stale if it does not match @a s_generation.
+		uint64_t generation = 0;
+		std::vector<Node> nodes;
+		/// Names too long for the quadratic edit distance computation to be worthwhile;
+		/// matched linearly with the usual length threshold applied.
+		std::vector<std::pair<ASTString, uint8_t>> longNames;
+	};
+
+	/// @returns the similarity index for this container, building or rebuilding it if the
+	/// container was modified since the last use.
+	SimilarityIndex const& similarityIndex() const;
+
+	/// Generation counter shared by all containers. Cache entries stamped with an older
+	/// generation are stale. Atomic so that independent compilations running in parallel
+	/// threads can bump it safely; the caches themselves are per-container and not shared.
+	static std::atomic<uint64_t> s_generation;
+
 	ASTNode const* m_enclosingNode = nullptr;
 	DeclarationContainer const* m_enclosingContainer = nullptr;
 	std::vector<DeclarationContainer const*> m_innerContainers;
-	std::map<ASTString, std::vector<Declaration const*>> m_declarations;
-	std::map<ASTString, std::vector<Declaration const*>> m_invisibleDeclarations;
+	util::FlatHashMap<ASTString, std::vector<Declaration const*>> m_declarations;
+	util::FlatHashMap<ASTString, std::vector<Declaration const*>> m_invisibleDeclarations;
+	/// Flattened cache of @a resolveName results, one map per combination of settings flags.
+	/// Recursive lookups get cached at every level of the scope chain, so repeated queries for
+	/// hot names hit a single hash table lookup instead of re-walking the chain.
+	mutable std::array<util::FlatHashMap<ASTString, CachedLookup>, 8> m_lookupCache;
+	/// Lazily built index for @a similarNames. See @a similarityIndex().
+	mutable std::optional<SimilarityIndex> m_similarityIndex;
 	/// List of declarations (name and location) to check later for homonymity.
 	std::vector<std::pair<std::string, langutil::SourceLocation const*>> m_homonymCandidates;
 };
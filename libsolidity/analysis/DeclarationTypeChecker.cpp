@@ -338,7 +338,7 @@ void DeclarationTypeChecker::endVisit(ArrayTypeName const& _typeName)
 		std::optional<rational> lengthValue;
 		if (length->annotation().type && length->annotation().type->category() == Type::Category::RationalNumber)
 			lengthValue = dynamic_cast<RationalNumberType const&>(*length->annotation().type).value();
-		else if (std::optional<ConstantEvaluator::TypedRational> value = ConstantEvaluator::evaluate(m_errorReporter, *length))
+		else if (std::optional<ConstantEvaluator::TypedRational> value = ConstantEvaluator::evaluate(m_errorReporter, *length, m_constantEvaluatorCache))
 			lengthValue = value->value;
 
 		if (!lengthValue)
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <libsolidity/analysis/ConstantEvaluator.h>
 #include <libsolidity/ast/ASTVisitor.h>
 #include <libsolidity/ast/ASTAnnotations.h>
 #include <liblangutil/EVMVersion.h>
@@ -41,10 +42,12 @@ class DeclarationTypeChecker: private ASTConstVisitor
 public:
 	DeclarationTypeChecker(
 		langutil::ErrorReporter& _errorReporter,
-		langutil::EVMVersion _evmVersion
+		langutil::EVMVersion _evmVersion,
+		ConstantEvaluator::EvaluationCache* _constantEvaluatorCache = nullptr
 	):
 		m_errorReporter(_errorReporter),
-		m_evmVersion(_evmVersion)
+		m_evmVersion(_evmVersion),
+		m_constantEvaluatorCache(_constantEvaluatorCache)
 	{}
 
 	bool check(ASTNode const& _contract);
@@ -66,6 +69,8 @@ private:
 
 	langutil::ErrorReporter& m_errorReporter;
 	langutil::EVMVersion m_evmVersion;
+	/// Memo table shared with other constant evaluations of the same compilation, if any.
+	ConstantEvaluator::EvaluationCache* m_constantEvaluatorCache = nullptr;
 	bool m_insideFunctionType = false;
 	bool m_recursiveStructSeen = false;
 	std::set<StructDefinition const*> m_currentStructsSeen;
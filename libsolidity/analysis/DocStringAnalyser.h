@@ -32,7 +32,7 @@ namespace solidity::frontend
  * Analyses and validates the doc strings.
  * Stores the parsing results in the AST annotations and reports errors.
  */
-class DocStringAnalyser: private ASTConstVisitor
+class DocStringAnalyser: public ASTConstVisitor
 {
 public:
 	DocStringAnalyser(langutil::ErrorReporter& _errorReporter): m_errorReporter(_errorReporter) {}
@@ -27,9 +27,12 @@
 using namespace solidity::frontend;
 using namespace solidity::util;
 
-CallGraph FunctionCallGraphBuilder::buildCreationGraph(ContractDefinition const& _contract)
+CallGraph FunctionCallGraphBuilder::buildCreationGraph(
+	ContractDefinition const& _contract,
+	BodySummaries* _summaries
+)
 {
-	FunctionCallGraphBuilder builder(_contract);
+	FunctionCallGraphBuilder builder(_contract, _summaries);
 	solAssert(builder.m_currentNode == CallGraph::Node(CallGraph::SpecialNode::Entry), "");
 
 	// Create graph for constructor, state vars, etc
@@ -65,10 +68,11 @@ CallGraph FunctionCallGraphBuilder::buildCreationGraph(ContractDefinition const&
 
 CallGraph FunctionCallGraphBuilder::buildDeployedGraph(
 	ContractDefinition const& _contract,
-	CallGraph const& _creationGraph
+	CallGraph const& _creationGraph,
+	BodySummaries* _summaries
 )
 {
-	FunctionCallGraphBuilder builder(_contract);
+	FunctionCallGraphBuilder builder(_contract, _summaries);
 	solAssert(builder.m_currentNode == CallGraph::Node(CallGraph::SpecialNode::Entry), "");
 
 	auto getSecondElement = [](auto const& _tuple){ return std::get<1>(_tuple); };
@@ -120,12 +124,23 @@ bool FunctionCallGraphBuilder::visit(FunctionCall const& _functionCall)
 	solAssert(functionType, "");
 
 	if (functionType->kind() == FunctionType::Kind::Internal && !_functionCall.expression().annotation().calledDirectly)
+	{
 		// If it's not a direct call, we don't really know which function will be called (it may even
 		// change at runtime). All we can do is to add an edge to the dispatch which in turn has
 		// edges to all functions could possibly be called.
-		add(m_currentNode, CallGraph::SpecialNode::InternalDispatch);
+		if (m_currentSummary)
+			m_currentSummary->edgeToInternalDispatch = true;
+		else
+			add(m_currentNode, CallGraph::SpecialNode::InternalDispatch);
+	}
 	else if (functionType->kind() == FunctionType::Kind::Error)
-		m_graph.usedErrors.insert(&dynamic_cast<ErrorDefinition const&>(functionType->declaration()));
+	{
+		auto const& error = dynamic_cast<ErrorDefinition const&>(functionType->declaration());
+		if (m_currentSummary)
+			m_currentSummary->usedErrors.insert(&error);
+		else
+			m_graph.usedErrors.insert(&error);
+	}
 
 	return true;
 }
@@ -135,7 +150,11 @@ bool FunctionCallGraphBuilder::visit(EmitStatement const& _emitStatement)
 	auto const* functionType = dynamic_cast<FunctionType const*>(_emitStatement.eventCall().expression().annotation().type);
 	solAssert(functionType, "");
 
-	m_graph.emittedEvents.insert(&dynamic_cast<EventDefinition const&>(functionType->declaration()));
+	auto const& event = dynamic_cast<EventDefinition const&>(functionType->declaration());
+	if (m_currentSummary)
+		m_currentSummary->emittedEvents.insert(&event);
+	else
+		m_graph.emittedEvents.insert(&event);
 
 	return true;
 }
@@ -175,7 +194,10 @@ bool FunctionCallGraphBuilder::visit(MemberAccess const& _memberAccess)
 		))
 		{
 			ContractType const& accessedContractType = dynamic_cast<ContractType const&>(*magicType->typeArgument());
-			m_graph.bytecodeDependency.emplace(&accessedContractType.contractDefinition(), &_memberAccess);
+			if (m_currentSummary)
+				m_currentSummary->bytecodeDependencies.emplace_back(&accessedContractType.contractDefinition(), &_memberAccess);
+			else
+				m_graph.bytecodeDependency.emplace(&accessedContractType.contractDefinition(), &_memberAccess);
 		}
 
 	auto functionType = dynamic_cast<FunctionType const*>(_memberAccess.annotation().type);
@@ -238,7 +260,12 @@ bool FunctionCallGraphBuilder::visit(ModifierInvocation const& _modifierInvocati
 bool FunctionCallGraphBuilder::visit(NewExpression const& _newExpression)
 {
 	if (ContractType const* contractType = dynamic_cast<ContractType const*>(_newExpression.typeName().annotation().type))
-		m_graph.bytecodeDependency.emplace(&contractType->contractDefinition(), &_newExpression);
+	{
+		if (m_currentSummary)
+			m_currentSummary->bytecodeDependencies.emplace_back(&contractType->contractDefinition(), &_newExpression);
+		else
+			m_graph.bytecodeDependency.emplace(&contractType->contractDefinition(), &_newExpression);
+	}
 
 	return true;
 }
@@ -264,19 +291,53 @@ void FunctionCallGraphBuilder::processQueue()
 		solAssert(std::holds_alternative<CallableDeclaration const*>(m_currentNode), "");
 
 		m_visitQueue.pop_front();
-		std::get<CallableDeclaration const*>(m_currentNode)->accept(*this);
+		CallableDeclaration const* callable = std::get<CallableDeclaration const*>(m_currentNode);
+		if (m_summaries)
+		{
+			auto it = m_summaries->find(callable);
+			if (it == m_summaries->end())
+			{
+				BodySummary summary;
+				m_currentSummary = &summary;
+				callable->accept(*this);
+				m_currentSummary = nullptr;
+				it = m_summaries->emplace(callable, std::move(summary)).first;
+			}
+			applySummary(it->second);
+		}
+		else
+			callable->accept(*this);
 	}
 
 	m_currentNode = CallGraph::SpecialNode::Entry;
 }
 
+void FunctionCallGraphBuilder::applySummary(BodySummary const& _summary)
+{
+	for (auto const& [callable, calledDirectly]: _summary.referencedCallables)
+		functionReferenced(*callable, calledDirectly);
+	if (_summary.edgeToInternalDispatch)
+		add(m_currentNode, CallGraph::SpecialNode::InternalDispatch);
+	m_graph.emittedEvents.insert(_summary.emittedEvents.begin(), _summary.emittedEvents.end());
+	m_graph.usedErrors.insert(_summary.usedErrors.begin(), _summary.usedErrors.end());
+	for (auto const& [contract, referencee]: _summary.bytecodeDependencies)
+		m_graph.bytecodeDependency.emplace(contract, referencee);
+}
+
 void FunctionCallGraphBuilder::add(CallGraph::Node _caller, CallGraph::Node _callee)
 {
 	m_graph.edges[_caller].insert(_callee);
+	m_graph.reverseEdges[_callee].insert(_caller);
 }
 
 void FunctionCallGraphBuilder::functionReferenced(CallableDeclaration const& _callable, bool _calledDirectly)
 {
+	if (m_currentSummary)
+	{
+		m_currentSummary->referencedCallables.emplace_back(&_callable, _calledDirectly);
+		return;
+	}
+
 	if (_calledDirectly)
 	{
 		solAssert(
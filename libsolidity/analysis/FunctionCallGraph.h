@@ -57,15 +57,40 @@ namespace solidity::frontend
 class FunctionCallGraphBuilder: private ASTConstVisitor
 {
 public:
-	static CallGraph buildCreationGraph(ContractDefinition const& _contract);
+	/// Summary of the direct effects of traversing a single callable's body.
+	/// Within one compilation AST nodes are immutable, so the callable itself is a
+	/// sufficient cache key and the summary can be replayed instead of traversing
+	/// the body again when it is reachable in both the creation and the deployed graph.
+	struct BodySummary
+	{
+		/// Referenced callables together with whether they were called directly.
+		std::vector<std::pair<CallableDeclaration const*, bool>> referencedCallables;
+		/// Whether the body performs internal calls whose target is only known at runtime.
+		bool edgeToInternalDispatch = false;
+		std::set<EventDefinition const*, ASTNode::CompareByID> emittedEvents;
+		std::set<ErrorDefinition const*, ASTNode::CompareByID> usedErrors;
+		std::vector<std::pair<ContractDefinition const*, ASTNode const*>> bytecodeDependencies;
+	};
+	using BodySummaries = std::map<CallableDeclaration const*, BodySummary, ASTCompareByID<CallableDeclaration>>;
+
+	/// If @param _summaries is not null, it is used as a cache of body summaries, filled
+	/// for every callable traversed and consulted before traversing one. Sharing the
+	/// cache between the creation and deployed graph builds of the same contract avoids
+	/// visiting the bodies reachable in both twice.
+	static CallGraph buildCreationGraph(
+		ContractDefinition const& _contract,
+		BodySummaries* _summaries = nullptr
+	);
 	static CallGraph buildDeployedGraph(
 		ContractDefinition const& _contract,
-		CallGraph const& _creationGraph
+		CallGraph const& _creationGraph,
+		BodySummaries* _summaries = nullptr
 	);
 
 private:
-	FunctionCallGraphBuilder(ContractDefinition const& _contract):
-		m_contract(_contract)
+	FunctionCallGraphBuilder(ContractDefinition const& _contract, BodySummaries* _summaries):
+		m_contract(_contract),
+		m_summaries(_summaries)
 	{}
 
 	bool visit(FunctionCall const& _functionCall) override;
@@ -79,6 +104,8 @@ private:
 
 	void enqueueCallable(CallableDeclaration const& _callable);
 	void processQueue();
+	/// Replays a cached body summary for the callable @a m_currentNode points at.
+	void applySummary(BodySummary const& _summary);
 
 	void add(CallGraph::Node _caller, CallGraph::Node _callee);
 	void functionReferenced(CallableDeclaration const& _callable, bool _calledDirectly = true);
@@ -87,6 +114,11 @@ private:
 	ContractDefinition const& m_contract;
 	CallGraph m_graph;
 	std::deque<CallableDeclaration const*> m_visitQueue;
+	/// Optional cache of body summaries shared between builds. See buildCreationGraph().
+	BodySummaries* m_summaries = nullptr;
+	/// Summary currently being recorded. While set, the visit functions divert their
+	/// effects into it instead of the graph; processQueue() replays it afterwards.
+	BodySummary* m_currentSummary = nullptr;
 };
 
 std::ostream& operator<<(std::ostream& _out, CallGraph::Node const& _node);
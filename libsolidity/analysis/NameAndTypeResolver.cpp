@@ -35,6 +35,19 @@ using namespace solidity::langutil;
 namespace solidity::frontend
 {
 
+namespace
+{
+
+/// Copies the declarations of a scope into an ordered map. The declaration maps of
+/// DeclarationContainer iterate in hash order, so the names are sorted wherever the
+/// order is user-visible, e.g. in reported errors or AST annotations.
+std::map<ASTString, std::vector<Declaration const*>> sortedDeclarations(DeclarationContainer const& _scope)
+{
+	return {_scope.declarations().begin(), _scope.declarations().end()};
+}
+
+}
+
 NameAndTypeResolver::NameAndTypeResolver(
 	GlobalContext& _globalContext,
 	langutil::EVMVersion _evmVersion,
@@ -111,14 +124,14 @@ bool NameAndTypeResolver::performImports(SourceUnit& _sourceUnit, std::map<std::
 								error = true;
 				}
 			else if (imp->name().empty())
-				for (auto const& nameAndDeclaration: scope->second->declarations())
+				for (auto const& nameAndDeclaration: sortedDeclarations(*scope->second))
 					for (auto const& declaration: nameAndDeclaration.second)
 						if (!DeclarationRegistrationHelper::registerDeclaration(
 							target, *declaration, &nameAndDeclaration.first, &imp->location(), false, m_errorReporter
 						))
 							error =  true;
 		}
-	_sourceUnit.annotation().exportedSymbols = m_scopes[&_sourceUnit]->declarations();
+	_sourceUnit.annotation().exportedSymbols = sortedDeclarations(*m_scopes[&_sourceUnit]);
 	return !error;
 }
 
@@ -353,7 +366,7 @@ void NameAndTypeResolver::importInheritedScope(ContractDefinition const& _base)
 {
 	auto iterator = m_scopes.find(&_base);
 	solAssert(iterator != end(m_scopes), "");
-	for (auto const& nameAndDeclaration: iterator->second->declarations())
+	for (auto const& nameAndDeclaration: sortedDeclarations(*iterator->second))
 		for (auto const& declaration: nameAndDeclaration.second)
 			// Import if it was declared in the base, is not the constructor and is visible in derived classes
 			if (declaration->scope() == &_base && declaration->isVisibleInDerivedContracts())
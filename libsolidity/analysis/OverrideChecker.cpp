@@ -26,9 +26,11 @@
 #include <libsolidity/ast/TypeProvider.h>
 #include <libsolidity/analysis/TypeChecker.h>
 #include <liblangutil/ErrorReporter.h>
+#include <libsolutil/CommonData.h>
 #include <libsolutil/Visitor.h>
 
 #include <boost/algorithm/string/predicate.hpp>
+#include <boost/container_hash/hash.hpp>
 
 
 using namespace solidity;
@@ -413,6 +415,23 @@ bool OverrideProxy::OverrideComparator::operator<(OverrideComparator const& _oth
 	return boost::lexicographical_compare(*parameterTypes, *_other.parameterTypes);
 }
 
+size_t OverrideProxy::OverrideComparator::hash() const
+{
+	size_t result = 0;
+	boost::hash_combine(result, name);
+	// Mirrors operator<: the function kind only matters if it is present and the
+	// parameters only matter for regular functions. The sets the hash is used on are
+	// homogeneous (either all functions and public state variables or all modifiers),
+	// so components that operator< ignores for mixed items can safely be hashed.
+	if (functionKind)
+	{
+		boost::hash_combine(result, static_cast<unsigned>(*functionKind));
+		if (*functionKind == Token::Function && parameterTypes)
+			boost::hash_combine(result, *parameterTypes);
+	}
+	return result;
+}
+
 OverrideProxy::OverrideComparator const& OverrideProxy::overrideComparator() const
 {
 	if (!m_comparator)
@@ -472,6 +491,8 @@ void OverrideChecker::checkIllegalOverrides(ContractDefinition const& _contract)
 {
 	OverrideProxyBySignatureMultiSet const& inheritedFuncs = inheritedFunctions(_contract);
 	OverrideProxyBySignatureMultiSet const& inheritedMods = inheritedModifiers(_contract);
+	OverrideProxyBySignatureIndex const& inheritedFuncsBySignature = inheritedFunctionsBySignature(_contract);
+	OverrideProxyBySignatureIndex const& inheritedModsBySignature = inheritedModifiersBySignature(_contract);
 
 	for (ModifierDefinition const* modifier: _contract.functionModifiers())
 	{
@@ -482,7 +503,7 @@ void OverrideChecker::checkIllegalOverrides(ContractDefinition const& _contract)
 				"Override changes function or public state variable to modifier."
 			);
 
-		checkOverrideList(OverrideProxy{modifier}, inheritedMods);
+		checkOverrideList(OverrideProxy{modifier}, inheritedModsBySignature);
 	}
 
 	for (FunctionDefinition const* function: _contract.definedFunctions())
@@ -493,7 +514,7 @@ void OverrideChecker::checkIllegalOverrides(ContractDefinition const& _contract)
 		if (contains_if(inheritedMods, MatchByName{function->name()}))
 			m_errorReporter.typeError(1469_error, function->location(), "Override changes modifier to function.");
 
-		checkOverrideList(OverrideProxy{function}, inheritedFuncs);
+		checkOverrideList(OverrideProxy{function}, inheritedFuncsBySignature);
 	}
 	for (auto const* stateVar: _contract.stateVariables())
 	{
@@ -508,7 +529,7 @@ void OverrideChecker::checkIllegalOverrides(ContractDefinition const& _contract)
 		if (contains_if(inheritedMods, MatchByName{stateVar->name()}))
 			m_errorReporter.typeError(1456_error, stateVar->location(), "Override changes modifier to public state variable.");
 
-		checkOverrideList(OverrideProxy{stateVar}, inheritedFuncs);
+		checkOverrideList(OverrideProxy{stateVar}, inheritedFuncsBySignature);
 	}
 
 }
@@ -839,7 +860,7 @@ std::set<ContractDefinition const*, OverrideChecker::CompareByID> OverrideChecke
 	return resolved;
 }
 
-void OverrideChecker::checkOverrideList(OverrideProxy _item, OverrideProxyBySignatureMultiSet const& _inherited)
+void OverrideChecker::checkOverrideList(OverrideProxy _item, OverrideProxyBySignatureIndex const& _inherited)
 {
 	std::set<ContractDefinition const*, CompareByID> specifiedContracts =
 		_item.overrides() ?
@@ -882,13 +903,19 @@ void OverrideChecker::checkOverrideList(OverrideProxy _item, OverrideProxyBySign
 	std::set<ContractDefinition const*, CompareByID> expectedContracts;
 
 	// Build list of expected contracts
-	for (auto [begin, end] = _inherited.equal_range(_item); begin != end; begin++)
-	{
-		// Validate the override
-		checkOverride(_item, *begin);
+	if (std::vector<OverrideProxy> const* candidates = util::valueOrNullptr(_inherited, _item.overrideComparator().hash()))
+		for (OverrideProxy const& candidate: *candidates)
+		{
+			// Skip items that merely collide on the signature hash.
+			OverrideProxy::CompareBySignature compare;
+			if (compare(_item, candidate) || compare(candidate, _item))
+				continue;
 
-		expectedContracts.insert(&begin->contract());
-	}
+			// Validate the override
+			checkOverride(_item, candidate);
+
+			expectedContracts.insert(&candidate.contract());
+		}
 
 	if (_item.overrides() && expectedContracts.empty())
 		m_errorReporter.typeError(
@@ -974,3 +1001,31 @@ OverrideChecker::OverrideProxyBySignatureMultiSet const& OverrideChecker::inheri
 
 	return m_inheritedModifiers[&_contract];
 }
+
+OverrideChecker::OverrideProxyBySignatureIndex const& OverrideChecker::inheritedFunctionsBySignature(ContractDefinition const& _contract) const
+{
+	if (!m_inheritedFunctionsBySignature.count(&_contract))
+	{
+		OverrideProxyBySignatureIndex index;
+		// Iterating the signature-sorted set keeps the items of each signature in the
+		// same relative order in which equal_range on the set would visit them.
+		for (OverrideProxy const& func: inheritedFunctions(_contract))
+			index[func.overrideComparator().hash()].emplace_back(func);
+		m_inheritedFunctionsBySignature[&_contract] = std::move(index);
+	}
+
+	return m_inheritedFunctionsBySignature[&_contract];
+}
+
+OverrideChecker::OverrideProxyBySignatureIndex const& OverrideChecker::inheritedModifiersBySignature(ContractDefinition const& _contract) const
+{
+	if (!m_inheritedModifiersBySignature.count(&_contract))
+	{
+		OverrideProxyBySignatureIndex index;
+		for (OverrideProxy const& mod: inheritedModifiers(_contract))
+			index[mod.overrideComparator().hash()].emplace_back(mod);
+		m_inheritedModifiersBySignature[&_contract] = std::move(index);
+	}
+
+	return m_inheritedModifiersBySignature[&_contract];
+}
@@ -27,7 +27,9 @@
 #include <map>
 #include <functional>
 #include <set>
+#include <unordered_map>
 #include <variant>
+#include <vector>
 #include <optional>
 
 namespace solidity::langutil
@@ -114,6 +116,10 @@ public:
 		std::optional<std::vector<std::string>> parameterTypes;
 
 		bool operator<(OverrideComparator const& _other) const;
+
+		/// @returns a hash over the components that operator< compares, i.e. two
+		/// comparators that are equivalent with regards to the ordering have equal hashes.
+		size_t hash() const;
 	};
 
 	/// @returns a structure used to compare override items with regards to whether
@@ -138,6 +144,7 @@ class OverrideChecker
 {
 public:
 	using OverrideProxyBySignatureMultiSet = std::multiset<OverrideProxy, OverrideProxy::CompareBySignature>;
+	using OverrideProxyBySignatureIndex = std::unordered_map<size_t, std::vector<OverrideProxy>>;
 
 	/// @param _errorReporter provides the error logging functionality.
 	explicit OverrideChecker(langutil::ErrorReporter& _errorReporter):
@@ -156,6 +163,12 @@ public:
 	OverrideProxyBySignatureMultiSet const& inheritedFunctions(ContractDefinition const& _contract) const;
 	OverrideProxyBySignatureMultiSet const& inheritedModifiers(ContractDefinition const& _contract) const;
 
+	/// The same items as inheritedFunctions() / inheritedModifiers(), indexed by signature
+	/// hash, so that all items a given item can override are found in constant time
+	/// instead of through comparator-driven tree searches.
+	OverrideProxyBySignatureIndex const& inheritedFunctionsBySignature(ContractDefinition const& _contract) const;
+	OverrideProxyBySignatureIndex const& inheritedModifiersBySignature(ContractDefinition const& _contract) const;
+
 private:
 	void checkIllegalOverrides(ContractDefinition const& _contract);
 	/// Performs various checks related to @a _overriding overriding @a _super like
@@ -184,13 +197,16 @@ private:
 	/// Resolves an override list of UserDefinedTypeNames to a list of contracts.
 	std::set<ContractDefinition const*, CompareByID> resolveOverrideList(OverrideSpecifier const& _overrides) const;
 
-	void checkOverrideList(OverrideProxy _item, OverrideProxyBySignatureMultiSet const& _inherited);
+	void checkOverrideList(OverrideProxy _item, OverrideProxyBySignatureIndex const& _inherited);
 
 	langutil::ErrorReporter& m_errorReporter;
 
 	/// Cache for inheritedFunctions().
 	std::map<ContractDefinition const*, OverrideProxyBySignatureMultiSet> mutable m_inheritedFunctions;
 	std::map<ContractDefinition const*, OverrideProxyBySignatureMultiSet> mutable m_inheritedModifiers;
+	/// Cache for inheritedFunctionsBySignature() / inheritedModifiersBySignature().
+	std::map<ContractDefinition const*, OverrideProxyBySignatureIndex> mutable m_inheritedFunctionsBySignature;
+	std::map<ContractDefinition const*, OverrideProxyBySignatureIndex> mutable m_inheritedModifiersBySignature;
 };
 
 }
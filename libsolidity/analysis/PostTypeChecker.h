@@ -48,7 +48,7 @@ namespace solidity::frontend
  *  The return value for the visit function of a checker is ignored, all nodes
  *  will always be visited.
  */
-class PostTypeChecker: private ASTConstVisitor
+class PostTypeChecker: public ASTConstVisitor
 {
 public:
 	struct Checker: public ASTConstVisitor
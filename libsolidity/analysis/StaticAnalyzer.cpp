@@ -73,8 +73,12 @@ private:
 	std::map<ContractDefinition const*, bool> m_usesAssembly;
 };
 
-StaticAnalyzer::StaticAnalyzer(ErrorReporter& _errorReporter):
-	m_errorReporter(_errorReporter)
+StaticAnalyzer::StaticAnalyzer(
+	ErrorReporter& _errorReporter,
+	ConstantEvaluator::EvaluationCache* _constantEvaluatorCache
+):
+	m_errorReporter(_errorReporter),
+	m_constantEvaluatorCache(_constantEvaluatorCache)
 {
 }
 
@@ -300,7 +304,7 @@ bool StaticAnalyzer::visit(BinaryOperation const& _operation)
 		*_operation.rightExpression().annotation().isPure &&
 		(_operation.getOperator() == Token::Div || _operation.getOperator() == Token::Mod)
 	)
-		if (auto rhs = ConstantEvaluator::evaluate(m_errorReporter, _operation.rightExpression()))
+		if (auto rhs = ConstantEvaluator::evaluate(m_errorReporter, _operation.rightExpression(), m_constantEvaluatorCache))
 			if (rhs->value == 0)
 				m_errorReporter.typeError(
 					1211_error,
@@ -321,7 +325,7 @@ bool StaticAnalyzer::visit(FunctionCall const& _functionCall)
 		{
 			solAssert(_functionCall.arguments().size() == 3, "");
 			if (*_functionCall.arguments()[2]->annotation().isPure)
-				if (auto lastArg = ConstantEvaluator::evaluate(m_errorReporter, *(_functionCall.arguments())[2]))
+				if (auto lastArg = ConstantEvaluator::evaluate(m_errorReporter, *(_functionCall.arguments())[2], m_constantEvaluatorCache))
 					if (lastArg->value == 0)
 						m_errorReporter.typeError(
 							4195_error,
@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <libsolidity/analysis/ConstantEvaluator.h>
 #include <libsolidity/analysis/TypeChecker.h>
 #include <libsolidity/ast/Types.h>
 #include <libsolidity/ast/ASTAnnotations.h>
@@ -46,11 +47,16 @@ class ConstructorUsesAssembly;
  * programmers write cleaner code. For every warning generated here, it has to be possible to write
  * equivalent code that does not generate the warning.
  */
-class StaticAnalyzer: private ASTConstVisitor
+class StaticAnalyzer: public ASTConstVisitor
 {
 public:
 	/// @param _errorReporter provides the error logging functionality.
-	explicit StaticAnalyzer(langutil::ErrorReporter& _errorReporter);
+	/// @param _constantEvaluatorCache optional memo table shared with other constant
+	/// evaluations of the same compilation.
+	explicit StaticAnalyzer(
+		langutil::ErrorReporter& _errorReporter,
+		ConstantEvaluator::EvaluationCache* _constantEvaluatorCache = nullptr
+	);
 	~StaticAnalyzer() override;
 
 	/// Performs static analysis on the given source unit and all of its sub-nodes.
@@ -76,6 +82,9 @@ private:
 
 	langutil::ErrorReporter& m_errorReporter;
 
+	/// Memo table shared with other constant evaluations of the same compilation, if any.
+	ConstantEvaluator::EvaluationCache* m_constantEvaluatorCache = nullptr;
+
 	/// Flag that indicates whether the current contract definition is a library.
 	bool m_library = false;
 
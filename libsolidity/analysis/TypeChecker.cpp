@@ -204,7 +204,7 @@ void TypeChecker::checkDoubleStorageAssignment(Assignment const& _assignment)
 
 TypePointers TypeChecker::typeCheckABIDecodeAndRetrieveReturnType(FunctionCall const& _functionCall, bool _abiEncoderV2)
 {
-	std::vector<ASTPointer<Expression const>> arguments = _functionCall.arguments();
+	std::vector<ASTPointer<Expression const>> const& arguments = _functionCall.arguments();
 	if (arguments.size() != 2)
 		m_errorReporter.typeError(
 			5782_error,
@@ -295,7 +295,7 @@ TypePointers TypeChecker::typeCheckABIDecodeAndRetrieveReturnType(FunctionCall c
 
 TypePointers TypeChecker::typeCheckMetaTypeFunctionAndRetrieveReturnType(FunctionCall const& _functionCall)
 {
-	std::vector<ASTPointer<Expression const>> arguments = _functionCall.arguments();
+	std::vector<ASTPointer<Expression const>> const& arguments = _functionCall.arguments();
 	if (arguments.size() != 1)
 		m_errorReporter.fatalTypeError(
 			8885_error,
@@ -555,7 +555,12 @@ bool TypeChecker::visit(FunctionDefinition const& _function)
 			m_errorReporter.typeError(7634_error, _function.location(), "Constructor cannot be defined in libraries.");
 
 	if (_function.isImplemented())
+	{
 		_function.body().accept(*this);
+		// All expression temporaries placed in the arena while checking the body are dead
+		// by now; reclaim their memory in bulk.
+		m_temporaryArena->reset();
+	}
 	else if (_function.isConstructor())
 		m_errorReporter.typeError(5700_error, _function.location(), "Constructor must be implemented if declared.");
 	else if (_function.libraryFunction())
@@ -2359,13 +2364,13 @@ void TypeChecker::typeCheckABIEncodeCallFunction(FunctionCall const& _functionCa
 	}
 	solAssert(!externalFunctionType->takesArbitraryParameters(), "Function must have fixed parameters.");
 	// Tuples with only one component become that component
-	std::vector<ASTPointer<Expression const>> callArguments;
+	TemporaryVector<ASTPointer<Expression const>> callArguments = makeTemporaryVector<ASTPointer<Expression const>>();
 
 	auto const* tupleType = dynamic_cast<TupleType const*>(type(*arguments[1]));
 	if (tupleType)
 	{
 		if (TupleExpression const* argumentTuple = dynamic_cast<TupleExpression const*>(arguments[1].get()))
-			callArguments = decltype(callArguments){argumentTuple->components().begin(), argumentTuple->components().end()};
+			callArguments.assign(argumentTuple->components().begin(), argumentTuple->components().end());
 		else
 		{
 			m_errorReporter.typeError(
@@ -2587,7 +2592,8 @@ void TypeChecker::typeCheckFunctionGeneralChecks(
 	}
 
 	// Parameter to argument map
-	std::vector<Expression const*> paramArgMap(parameterTypes.size());
+	TemporaryVector<Expression const*> paramArgMap = makeTemporaryVector<Expression const*>();
+	paramArgMap.resize(parameterTypes.size());
 
 	// Map parameters to arguments - trivially for positional calls, less so for named calls
 	if (isPositionalCall)
@@ -3664,7 +3670,7 @@ bool TypeChecker::visit(Identifier const& _identifier)
 		else if (!annotation.arguments)
 		{
 			// The identifier should be a public state variable shadowing other functions
-			std::vector<Declaration const*> candidates;
+			TemporaryVector<Declaration const*> candidates = makeTemporaryVector<Declaration const*>();
 
 			for (Declaration const* declaration: annotation.overloadedDeclarations)
 			{
@@ -3680,7 +3686,7 @@ bool TypeChecker::visit(Identifier const& _identifier)
 		}
 		else
 		{
-			std::vector<Declaration const*> candidates;
+			TemporaryVector<Declaration const*> candidates = makeTemporaryVector<Declaration const*>();
 
 			for (Declaration const* declaration: annotation.overloadedDeclarations)
 			{
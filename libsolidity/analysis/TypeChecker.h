@@ -30,6 +30,8 @@
 #include <libsolidity/ast/ASTVisitor.h>
 #include <libsolidity/ast/Types.h>
 
+#include <libsolutil/Arena.h>
+
 namespace solidity::langutil
 {
 class ErrorReporter;
@@ -187,6 +189,19 @@ private:
 
 	bool useABICoderV2() const;
 
+	/// Vector for container temporaries that are discarded once the enclosing expression
+	/// has been checked. Backed by @a m_temporaryArena, which is reset after each function
+	/// body, so such vectors must never escape into annotations or types.
+	template<typename T>
+	using TemporaryVector = std::vector<T, util::ArenaAllocator<T>>;
+
+	/// @returns an empty arena-backed vector for expression-local temporaries.
+	template<typename T>
+	TemporaryVector<T> makeTemporaryVector() const
+	{
+		return TemporaryVector<T>(util::ArenaAllocator<T>(m_temporaryArena));
+	}
+
 	/// @returns the current scope that can have function or type definitions.
 	/// This is either a contract or a source unit.
 	ASTNode const* currentDefinitionScope() const
@@ -203,6 +218,10 @@ private:
 	langutil::EVMVersion m_evmVersion;
 
 	langutil::ErrorReporter& m_errorReporter;
+
+	/// Arena backing @a TemporaryVector. Reset after each checked function body to reclaim
+	/// the memory of the expression temporaries in bulk.
+	std::shared_ptr<util::Arena> m_temporaryArena = std::make_shared<util::Arena>();
 };
 
 }
@@ -35,7 +35,7 @@ struct SourceLocation;
 namespace solidity::frontend
 {
 
-class ViewPureChecker: private ASTConstVisitor
+class ViewPureChecker: public ASTConstVisitor
 {
 public:
 	ViewPureChecker(std::vector<std::shared_ptr<ASTNode>> const& _ast, langutil::ErrorReporter& _errorReporter):
@@ -160,20 +160,22 @@ bool ContractDefinition::derivesFrom(ContractDefinition const& _base) const
 	return util::contains(annotation().linearizedBaseContracts, &_base);
 }
 
-std::map<util::FixedHash<4>, FunctionTypePointer> ContractDefinition::interfaceFunctions(bool _includeInheritedFunctions) const
+std::map<util::FixedHash<4>, FunctionTypePointer> const& ContractDefinition::interfaceFunctions(bool _includeInheritedFunctions) const
 {
-	auto exportedFunctionList = interfaceFunctionList(_includeInheritedFunctions);
+	return m_interfaceFunctions[_includeInheritedFunctions].init([&]{
+		auto const& exportedFunctionList = interfaceFunctionList(_includeInheritedFunctions);
 
-	std::map<util::FixedHash<4>, FunctionTypePointer> exportedFunctions;
-	for (auto const& it: exportedFunctionList)
-		exportedFunctions.insert(it);
+		std::map<util::FixedHash<4>, FunctionTypePointer> exportedFunctions;
+		for (auto const& it: exportedFunctionList)
+			exportedFunctions.insert(it);
 
-	solAssert(
-		exportedFunctionList.size() == exportedFunctions.size(),
-		"Hash collision at Function Definition Hash calculation"
-	);
+		solAssert(
+			exportedFunctionList.size() == exportedFunctions.size(),
+			"Hash collision at Function Definition Hash calculation"
+		);
 
-	return exportedFunctions;
+		return exportedFunctions;
+	});
 }
 
 FunctionDefinition const* ContractDefinition::constructor() const
@@ -514,6 +516,10 @@ FunctionDefinition const& FunctionDefinition::resolveVirtual(
 	solAssert(isOrdinary(), "");
 	solAssert(!libraryFunction(), "");
 
+	CallableDeclaration const*& cached = _mostDerivedContract.virtualLookupCacheSlot(*this, _searchStart);
+	if (cached)
+		return dynamic_cast<FunctionDefinition const&>(*cached);
+
 	// We actually do not want the externally callable function here.
 	// This is just to add an assertion since the comparison used to be less strict.
 	FunctionType const* externalFunctionType = TypeProvider::function(*this)->asExternallyCallableFunction(false);
@@ -535,6 +541,7 @@ FunctionDefinition const& FunctionDefinition::resolveVirtual(
 			)
 			{
 				solAssert(FunctionType(*function).hasEqualParameterTypes(*TypeProvider::function(*this)));
+				cached = function;
 				return *function;
 			}
 	}
@@ -567,10 +574,17 @@ ModifierDefinition const& ModifierDefinition::resolveVirtual(
 
 	solAssert(!dynamic_cast<ContractDefinition const&>(*scope()).isLibrary(), "");
 
+	CallableDeclaration const*& cached = _mostDerivedContract.virtualLookupCacheSlot(*this, _searchStart);
+	if (cached)
+		return dynamic_cast<ModifierDefinition const&>(*cached);
+
 	for (ContractDefinition const* c: _mostDerivedContract.annotation().linearizedBaseContracts)
 		for (ModifierDefinition const* modifier: c->functionModifiers())
 			if (modifier->name() == name())
+			{
+				cached = modifier;
 				return *modifier;
+			}
 
 	solAssert(false, "Virtual modifier " + name() + " not found.");
 	return *this; // not reached
@@ -80,6 +80,10 @@ public:
 
 	/// @returns an identifier of this AST node that is unique for a single compilation run.
 	int64_t id() const { return int64_t(m_id); }
+	/// Adds @a _shift to the ID of this node. Used to restore the uniqueness of the IDs across
+	/// a compilation run after source units have been parsed concurrently by separate parsers,
+	/// each numbering its nodes from one.
+	void shiftID(int64_t _shift) { m_id += static_cast<size_t>(_shift); }
 
 	virtual void accept(ASTVisitor& _visitor) = 0;
 	virtual void accept(ASTConstVisitor& _visitor) const = 0;
@@ -126,7 +130,7 @@ public:
 	///@}
 
 protected:
-	size_t const m_id = 0;
+	size_t m_id = 0;
 
 	template <class T>
 	T& initAnnotation() const
@@ -548,8 +552,8 @@ public:
 	bool derivesFrom(ContractDefinition const& _base) const;
 
 	/// @returns a map of canonical function signatures to FunctionDefinitions
-	/// as intended for use by the ABI.
-	std::map<util::FixedHash<4>, FunctionTypePointer> interfaceFunctions(bool _includeInheritedFunctions = true) const;
+	/// as intended for use by the ABI. The result is cached after the first call.
+	std::map<util::FixedHash<4>, FunctionTypePointer> const& interfaceFunctions(bool _includeInheritedFunctions = true) const;
 	std::vector<std::pair<util::FixedHash<4>, FunctionTypePointer>> const& interfaceFunctionList(bool _includeInheritedFunctions = true) const;
 	/// @returns the EIP-165 compatible interface identifier. This will exclude inherited functions.
 	uint32_t interfaceId() const;
@@ -583,6 +587,19 @@ public:
 	/// @returns the next constructor in the inheritance hierarchy.
 	FunctionDefinition const* nextConstructor(ContractDefinition const& _mostDerivedContract) const;
 
+	/// @returns a slot memoizing the virtual lookup of @a _declaration with this contract as
+	/// the most derived contract and @a _searchStart as the starting point of the search
+	/// (nullptr for a regular virtual lookup). Initially nullptr; filled by the
+	/// @a resolveVirtual overrides, so that repeated lookups during analysis and code
+	/// generation do not re-walk the linearized bases.
+	CallableDeclaration const*& virtualLookupCacheSlot(
+		CallableDeclaration const& _declaration,
+		ContractDefinition const* _searchStart
+	) const
+	{
+		return m_virtualLookupCache[{&_declaration, _searchStart}];
+	}
+
 private:
 	std::multimap<std::string, FunctionDefinition const*> const& definedFunctionsByName() const;
 
@@ -592,8 +609,12 @@ private:
 	bool m_abstract{false};
 
 	util::LazyInit<std::vector<std::pair<util::FixedHash<4>, FunctionTypePointer>>> m_interfaceFunctionList[2];
+	util::LazyInit<std::map<util::FixedHash<4>, FunctionTypePointer>> m_interfaceFunctions[2];
 	util::LazyInit<std::vector<EventDefinition const*>> m_interfaceEvents;
 	util::LazyInit<std::multimap<std::string, FunctionDefinition const*>> m_definedFunctionsByName;
+	/// Vtable-like cache of resolved virtual lookups with this contract as the most derived
+	/// contract. See @a virtualLookupCacheSlot().
+	mutable std::map<std::pair<CallableDeclaration const*, ContractDefinition const*>, CallableDeclaration const*> m_virtualLookupCache;
 };
 
 /**
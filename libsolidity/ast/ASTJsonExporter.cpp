@@ -72,12 +72,26 @@ void addIfSet(std::vector<std::pair<std::string, Json::Value>>& _attributes, std
 namespace solidity::frontend
 {
 
-ASTJsonExporter::ASTJsonExporter(CompilerStack::State _stackState, std::map<std::string, unsigned> _sourceIndices):
+ASTJsonExporter::ASTJsonExporter(CompilerStack::State _stackState, std::map<std::string, unsigned> _sourceIndices, Filter _filter):
 	m_stackState(_stackState),
-	m_sourceIndices(std::move(_sourceIndices))
+	m_sourceIndices(std::move(_sourceIndices)),
+	m_filter(std::move(_filter))
 {
 }
 
+bool ASTJsonExporter::selectedByRange(ASTNode const& _node) const
+{
+	if (!m_filter.sourceRange)
+		return true;
+	SourceLocation const& range = *m_filter.sourceRange;
+	SourceLocation const& location = _node.location();
+	if (!range.hasText() || !location.hasText())
+		return true;
+	if (range.sourceName && location.sourceName && *range.sourceName != *location.sourceName)
+		return false;
+	return location.start < range.end && range.start < location.end;
+}
+
 
 void ASTJsonExporter::setJsonNode(
 	ASTNode const& _node,
@@ -213,7 +227,7 @@ bool ASTJsonExporter::visit(SourceUnit const& _node)
 {
 	std::vector<std::pair<std::string, Json::Value>> attributes = {
 		std::make_pair("license", _node.licenseString() ? Json::Value(*_node.licenseString()) : Json::nullValue),
-		std::make_pair("nodes", toJson(_node.nodes())),
+		std::make_pair("nodes", toJsonFiltered(_node.nodes())),
 	};
 
 	if (_node.experimentalSolidity())
@@ -291,7 +305,7 @@ bool ASTJsonExporter::visit(ContractDefinition const& _node)
 		// Do not require call graph because the AST is also created for incorrect sources.
 		std::make_pair("usedEvents", getContainerIds(_node.interfaceEvents(false))),
 		std::make_pair("usedErrors", getContainerIds(_node.interfaceErrors(false))),
-		std::make_pair("nodes", toJson(_node.subNodes())),
+		std::make_pair("nodes", toJsonFiltered(_node.subNodes())),
 		std::make_pair("scope", idOrNull(_node.scope()))
 	};
 	addIfSet(attributes, "canonicalName", _node.annotation().canonicalName);
@@ -461,7 +475,7 @@ bool ASTJsonExporter::visit(FunctionDefinition const& _node)
 		std::make_pair("parameters", toJson(_node.parameterList())),
 		std::make_pair("returnParameters", toJson(*_node.returnParameterList())),
 		std::make_pair("modifiers", toJson(_node.modifiers())),
-		std::make_pair("body", _node.isImplemented() ? toJson(_node.body()) : Json::nullValue),
+		std::make_pair("body", _node.isImplemented() && m_filter.includeFunctionBodies ? toJson(_node.body()) : Json::nullValue),
 		std::make_pair("implemented", _node.isImplemented()),
 		std::make_pair("scope", idOrNull(_node.scope()))
 	};
@@ -525,7 +539,7 @@ bool ASTJsonExporter::visit(ModifierDefinition const& _node)
 		std::make_pair("parameters", toJson(_node.parameterList())),
 		std::make_pair("virtual", _node.markedVirtual()),
 		std::make_pair("overrides", _node.overrides() ? toJson(*_node.overrides()) : Json::nullValue),
-		std::make_pair("body", _node.isImplemented() ? toJson(_node.body()) : Json::nullValue)
+		std::make_pair("body", _node.isImplemented() && m_filter.includeFunctionBodies ? toJson(_node.body()) : Json::nullValue)
 	};
 	if (!_node.annotation().baseFunctions.empty())
 		attributes.emplace_back(std::make_pair("baseModifiers", getContainerIds(_node.annotation().baseFunctions, true)));
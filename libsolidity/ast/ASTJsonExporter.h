@@ -27,6 +27,7 @@
 #include <libsolidity/ast/ASTVisitor.h>
 #include <libsolidity/interface/CompilerStack.h>
 #include <liblangutil/Exceptions.h>
+#include <liblangutil/SourceLocation.h>
 
 #include <json/json.h>
 #include <libsolutil/JSON.h>
@@ -51,12 +52,28 @@ namespace solidity::frontend
 class ASTJsonExporter: public ASTConstVisitor
 {
 public:
+	/// Selects which parts of the AST are exported. By default everything is exported.
+	/// Tools that only need declaration-level information can skip statement-level
+	/// subtrees or restrict the export to a source range; node IDs of the exported
+	/// nodes are the same as in a full export.
+	struct Filter
+	{
+		/// If false, the statement-level bodies of functions and modifiers are omitted.
+		bool includeFunctionBodies = true;
+		/// If set, source-unit and contract level definitions whose source range does not
+		/// intersect the given range are omitted. A range without a source name applies
+		/// to all sources.
+		std::optional<langutil::SourceLocation> sourceRange;
+	};
+
 	/// Create a converter to JSON for the given abstract syntax tree.
 	/// @a _stackState state of the compiler stack to avoid outputting incomplete data
 	/// @a _sourceIndices is used to abbreviate source names in source locations.
+	/// @a _filter restricts the export to the selected parts of the AST.
 	explicit ASTJsonExporter(
 		CompilerStack::State _stackState,
-		std::map<std::string, unsigned> _sourceIndices = std::map<std::string, unsigned>()
+		std::map<std::string, unsigned> _sourceIndices = std::map<std::string, unsigned>(),
+		Filter _filter = Filter{}
 	);
 	/// Output the json representation of the AST to _stream.
 	void print(std::ostream& _stream, ASTNode const& _node, util::JsonFormat const& _format);
@@ -154,6 +171,18 @@ private:
 	{
 		return _node ? toJson(*_node) : Json::nullValue;
 	}
+	/// @returns whether the node passes the source-range filter (always true without one).
+	bool selectedByRange(ASTNode const& _node) const;
+	/// Same as toJson for a list of nodes, but omits nodes rejected by the source-range filter.
+	template <class T>
+	Json::Value toJsonFiltered(std::vector<ASTPointer<T>> const& _nodes)
+	{
+		Json::Value ret(Json::arrayValue);
+		for (auto const& n: _nodes)
+			if (n && selectedByRange(*n))
+				appendMove(ret, toJson(*n));
+		return ret;
+	}
 	Json::Value inlineAssemblyIdentifierToJson(std::pair<yul::Identifier const* , InlineAssemblyAnnotation::ExternalIdentifierInfo> _info) const;
 	static std::string location(VariableDeclaration::Location _location);
 	static std::string contractKind(ContractKind _kind);
@@ -200,6 +229,7 @@ private:
 	bool m_inEvent = false; ///< whether we are currently inside an event or not
 	Json::Value m_currentValue;
 	std::map<std::string, unsigned> m_sourceIndices;
+	Filter m_filter;
 };
 
 }
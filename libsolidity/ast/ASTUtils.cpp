@@ -95,4 +95,24 @@ Expression const* resolveOuterUnaryTuples(Expression const* _expr)
 	return _expr;
 }
 
+void shiftNodeIDs(ASTNode& _root, int64_t _shift)
+{
+	class NodeIDShifter: public ASTVisitor
+	{
+	public:
+		explicit NodeIDShifter(int64_t _shift): m_shift(_shift) {}
+	protected:
+		bool visitNode(ASTNode& _node) override
+		{
+			_node.shiftID(m_shift);
+			return true;
+		}
+	private:
+		int64_t m_shift;
+	};
+
+	NodeIDShifter shifter{_shift};
+	_root.accept(shifter);
+}
+
 }
@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 namespace solidity::frontend
 {
 
@@ -42,4 +44,9 @@ ASTNode const* locateInnermostASTNode(int _offsetInFile, SourceUnit const& _sour
 /// into unary tuples and returns the contained expression.
 Expression const* resolveOuterUnaryTuples(Expression const* _expr);
 
+/// Adds @a _shift to the IDs of all nodes in the AST rooted at @a _root.
+/// Used to make node IDs unique for a compilation run again after source units have been
+/// parsed concurrently by separate parsers, each numbering its nodes from one.
+void shiftNodeIDs(ASTNode& _root, int64_t _shift);
+
 }
@@ -329,4 +329,172 @@ private:
 	std::function<void(ASTNode const&)> m_onEndVisit;
 };
 
+/**
+ * Utility visitor that dispatches the nodes of a single traversal to several const
+ * visitors, so that independent analysis passes can share one walk over the AST
+ * instead of each touching every node separately. If a sub-visitor skips a subtree
+ * by returning false from visit, it receives no events for the nodes inside the
+ * subtree, but still receives the endVisit call for the subtree's root, mirroring
+ * what accept() would have done.
+ */
+class CombinedASTConstVisitor: public ASTConstVisitor
+{
+public:
+	explicit CombinedASTConstVisitor(std::vector<ASTConstVisitor*> _visitors)
+	{
+		for (ASTConstVisitor* visitor: _visitors)
+			m_visitors.push_back({visitor, nullptr});
+	}
+
+	bool visit(SourceUnit const& _node) override { return forwardVisit(_node); }
+	bool visit(PragmaDirective const& _node) override { return forwardVisit(_node); }
+	bool visit(ImportDirective const& _node) override { return forwardVisit(_node); }
+	bool visit(ContractDefinition const& _node) override { return forwardVisit(_node); }
+	bool visit(IdentifierPath const& _node) override { return forwardVisit(_node); }
+	bool visit(InheritanceSpecifier const& _node) override { return forwardVisit(_node); }
+	bool visit(StructDefinition const& _node) override { return forwardVisit(_node); }
+	bool visit(UsingForDirective const& _node) override { return forwardVisit(_node); }
+	bool visit(UserDefinedValueTypeDefinition const& _node) override { return forwardVisit(_node); }
+	bool visit(EnumDefinition const& _node) override { return forwardVisit(_node); }
+	bool visit(EnumValue const& _node) override { return forwardVisit(_node); }
+	bool visit(ParameterList const& _node) override { return forwardVisit(_node); }
+	bool visit(OverrideSpecifier const& _node) override { return forwardVisit(_node); }
+	bool visit(FunctionDefinition const& _node) override { return forwardVisit(_node); }
+	bool visit(VariableDeclaration const& _node) override { return forwardVisit(_node); }
+	bool visit(ModifierDefinition const& _node) override { return forwardVisit(_node); }
+	bool visit(ModifierInvocation const& _node) override { return forwardVisit(_node); }
+	bool visit(EventDefinition const& _node) override { return forwardVisit(_node); }
+	bool visit(ErrorDefinition const& _node) override { return forwardVisit(_node); }
+	bool visit(ElementaryTypeName const& _node) override { return forwardVisit(_node); }
+	bool visit(UserDefinedTypeName const& _node) override { return forwardVisit(_node); }
+	bool visit(FunctionTypeName const& _node) override { return forwardVisit(_node); }
+	bool visit(Mapping const& _node) override { return forwardVisit(_node); }
+	bool visit(ArrayTypeName const& _node) override { return forwardVisit(_node); }
+	bool visit(Block const& _node) override { return forwardVisit(_node); }
+	bool visit(PlaceholderStatement const& _node) override { return forwardVisit(_node); }
+	bool visit(IfStatement const& _node) override { return forwardVisit(_node); }
+	bool visit(TryCatchClause const& _node) override { return forwardVisit(_node); }
+	bool visit(TryStatement const& _node) override { return forwardVisit(_node); }
+	bool visit(WhileStatement const& _node) override { return forwardVisit(_node); }
+	bool visit(ForStatement const& _node) override { return forwardVisit(_node); }
+	bool visit(Continue const& _node) override { return forwardVisit(_node); }
+	bool visit(InlineAssembly const& _node) override { return forwardVisit(_node); }
+	bool visit(Break const& _node) override { return forwardVisit(_node); }
+	bool visit(Return const& _node) override { return forwardVisit(_node); }
+	bool visit(Throw const& _node) override { return forwardVisit(_node); }
+	bool visit(EmitStatement const& _node) override { return forwardVisit(_node); }
+	bool visit(RevertStatement const& _node) override { return forwardVisit(_node); }
+	bool visit(VariableDeclarationStatement const& _node) override { return forwardVisit(_node); }
+	bool visit(ExpressionStatement const& _node) override { return forwardVisit(_node); }
+	bool visit(Conditional const& _node) override { return forwardVisit(_node); }
+	bool visit(Assignment const& _node) override { return forwardVisit(_node); }
+	bool visit(TupleExpression const& _node) override { return forwardVisit(_node); }
+	bool visit(UnaryOperation const& _node) override { return forwardVisit(_node); }
+	bool visit(BinaryOperation const& _node) override { return forwardVisit(_node); }
+	bool visit(FunctionCall const& _node) override { return forwardVisit(_node); }
+	bool visit(FunctionCallOptions const& _node) override { return forwardVisit(_node); }
+	bool visit(NewExpression const& _node) override { return forwardVisit(_node); }
+	bool visit(MemberAccess const& _node) override { return forwardVisit(_node); }
+	bool visit(IndexAccess const& _node) override { return forwardVisit(_node); }
+	bool visit(IndexRangeAccess const& _node) override { return forwardVisit(_node); }
+	bool visit(Identifier const& _node) override { return forwardVisit(_node); }
+	bool visit(ElementaryTypeNameExpression const& _node) override { return forwardVisit(_node); }
+	bool visit(Literal const& _node) override { return forwardVisit(_node); }
+	bool visit(StructuredDocumentation const& _node) override { return forwardVisit(_node); }
+
+	void endVisit(SourceUnit const& _node) override { forwardEndVisit(_node); }
+	void endVisit(PragmaDirective const& _node) override { forwardEndVisit(_node); }
+	void endVisit(ImportDirective const& _node) override { forwardEndVisit(_node); }
+	void endVisit(ContractDefinition const& _node) override { forwardEndVisit(_node); }
+	void endVisit(IdentifierPath const& _node) override { forwardEndVisit(_node); }
+	void endVisit(InheritanceSpecifier const& _node) override { forwardEndVisit(_node); }
+	void endVisit(StructDefinition const& _node) override { forwardEndVisit(_node); }
+	void endVisit(UsingForDirective const& _node) override { forwardEndVisit(_node); }
+	void endVisit(UserDefinedValueTypeDefinition const& _node) override { forwardEndVisit(_node); }
+	void endVisit(EnumDefinition const& _node) override { forwardEndVisit(_node); }
+	void endVisit(EnumValue const& _node) override { forwardEndVisit(_node); }
+	void endVisit(ParameterList const& _node) override { forwardEndVisit(_node); }
+	void endVisit(OverrideSpecifier const& _node) override { forwardEndVisit(_node); }
+	void endVisit(FunctionDefinition const& _node) override { forwardEndVisit(_node); }
+	void endVisit(VariableDeclaration const& _node) override { forwardEndVisit(_node); }
+	void endVisit(ModifierDefinition const& _node) override { forwardEndVisit(_node); }
+	void endVisit(ModifierInvocation const& _node) override { forwardEndVisit(_node); }
+	void endVisit(EventDefinition const& _node) override { forwardEndVisit(_node); }
+	void endVisit(ErrorDefinition const& _node) override { forwardEndVisit(_node); }
+	void endVisit(ElementaryTypeName const& _node) override { forwardEndVisit(_node); }
+	void endVisit(UserDefinedTypeName const& _node) override { forwardEndVisit(_node); }
+	void endVisit(FunctionTypeName const& _node) override { forwardEndVisit(_node); }
+	void endVisit(Mapping const& _node) override { forwardEndVisit(_node); }
+	void endVisit(ArrayTypeName const& _node) override { forwardEndVisit(_node); }
+	void endVisit(Block const& _node) override { forwardEndVisit(_node); }
+	void endVisit(PlaceholderStatement const& _node) override { forwardEndVisit(_node); }
+	void endVisit(IfStatement const& _node) override { forwardEndVisit(_node); }
+	void endVisit(TryCatchClause const& _node) override { forwardEndVisit(_node); }
+	void endVisit(TryStatement const& _node) override { forwardEndVisit(_node); }
+	void endVisit(WhileStatement const& _node) override { forwardEndVisit(_node); }
+	void endVisit(ForStatement const& _node) override { forwardEndVisit(_node); }
+	void endVisit(Continue const& _node) override { forwardEndVisit(_node); }
+	void endVisit(InlineAssembly const& _node) override { forwardEndVisit(_node); }
+	void endVisit(Break const& _node) override { forwardEndVisit(_node); }
+	void endVisit(Return const& _node) override { forwardEndVisit(_node); }
+	void endVisit(Throw const& _node) override { forwardEndVisit(_node); }
+	void endVisit(EmitStatement const& _node) override { forwardEndVisit(_node); }
+	void endVisit(RevertStatement const& _node) override { forwardEndVisit(_node); }
+	void endVisit(VariableDeclarationStatement const& _node) override { forwardEndVisit(_node); }
+	void endVisit(ExpressionStatement const& _node) override { forwardEndVisit(_node); }
+	void endVisit(Conditional const& _node) override { forwardEndVisit(_node); }
+	void endVisit(Assignment const& _node) override { forwardEndVisit(_node); }
+	void endVisit(TupleExpression const& _node) override { forwardEndVisit(_node); }
+	void endVisit(UnaryOperation const& _node) override { forwardEndVisit(_node); }
+	void endVisit(BinaryOperation const& _node) override { forwardEndVisit(_node); }
+	void endVisit(FunctionCall const& _node) override { forwardEndVisit(_node); }
+	void endVisit(FunctionCallOptions const& _node) override { forwardEndVisit(_node); }
+	void endVisit(NewExpression const& _node) override { forwardEndVisit(_node); }
+	void endVisit(MemberAccess const& _node) override { forwardEndVisit(_node); }
+	void endVisit(IndexAccess const& _node) override { forwardEndVisit(_node); }
+	void endVisit(IndexRangeAccess const& _node) override { forwardEndVisit(_node); }
+	void endVisit(Identifier const& _node) override { forwardEndVisit(_node); }
+	void endVisit(ElementaryTypeNameExpression const& _node) override { forwardEndVisit(_node); }
+	void endVisit(Literal const& _node) override { forwardEndVisit(_node); }
+	void endVisit(StructuredDocumentation const& _node) override { forwardEndVisit(_node); }
+
+private:
+	struct SubVisitor
+	{
+		ASTConstVisitor* visitor = nullptr;
+		/// Root of the subtree the visitor is currently skipping, if any.
+		ASTNode const* skippedSubtree = nullptr;
+	};
+
+	template<typename NodeType>
+	bool forwardVisit(NodeType const& _node)
+	{
+		bool descend = false;
+		for (SubVisitor& subVisitor: m_visitors)
+			if (!subVisitor.skippedSubtree)
+			{
+				if (subVisitor.visitor->visit(_node))
+					descend = true;
+				else
+					subVisitor.skippedSubtree = &_node;
+			}
+		return descend;
+	}
+
+	template<typename NodeType>
+	void forwardEndVisit(NodeType const& _node)
+	{
+		for (SubVisitor& subVisitor: m_visitors)
+			if (subVisitor.skippedSubtree == &_node)
+			{
+				subVisitor.skippedSubtree = nullptr;
+				subVisitor.visitor->endVisit(_node);
+			}
+			else if (!subVisitor.skippedSubtree)
+				subVisitor.visitor->endVisit(_node);
+	}
+
+	std::vector<SubVisitor> m_visitors;
+};
+
 }
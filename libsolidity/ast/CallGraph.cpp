@@ -20,6 +20,13 @@
 
 using namespace solidity::frontend;
 
+std::set<CallGraph::Node, CallGraph::CompareByID> const& CallGraph::callers(Node const& _callee) const
+{
+	static std::set<Node, CompareByID> const emptySet;
+	auto it = reverseEdges.find(_callee);
+	return it == reverseEdges.end() ? emptySet : it->second;
+}
+
 bool CallGraph::CompareByID::operator()(Node const& _lhs, Node const& _rhs) const
 {
 	if (_lhs.index() != _rhs.index())
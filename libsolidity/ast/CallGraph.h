@@ -61,6 +61,15 @@ struct CallGraph
 	/// any calls.
 	std::map<Node, std::set<Node, CompareByID>, CompareByID> edges;
 
+	/// Reverse graph edges, leading from the callee to each of its callers.
+	/// Maintained by FunctionCallGraphBuilder alongside @a edges; contains a key only
+	/// for nodes that actually appear as callees.
+	std::map<Node, std::set<Node, CompareByID>, CompareByID> reverseEdges;
+
+	/// @returns the callers of @a _callee, i.e. the corresponding entry of @a reverseEdges,
+	/// or an empty set if the node is never called.
+	std::set<Node, CompareByID> const& callers(Node const& _callee) const;
+
 	/// Contracts that need to be compiled before this one can be compiled.
 	/// The value is the ast node that created the dependency.
 	std::map<ContractDefinition const*, ASTNode const*, ASTCompareByID<ContractDefinition>> bytecodeDependency;
@@ -35,6 +35,7 @@ std::unique_ptr<ArrayType> TypeProvider::m_bytesMemory;
 std::unique_ptr<ArrayType> TypeProvider::m_bytesCalldata;
 std::unique_ptr<ArrayType> TypeProvider::m_stringStorage;
 std::unique_ptr<ArrayType> TypeProvider::m_stringMemory;
+std::unique_ptr<ArrayType> TypeProvider::m_stringCalldata;
 
 TupleType const TypeProvider::m_emptyTuple{};
 AddressType const TypeProvider::m_payableAddress{StateMutability::Payable};
@@ -182,6 +183,7 @@ void TypeProvider::reset()
 	clearCache(m_bytesCalldata);
 	clearCache(m_stringStorage);
 	clearCache(m_stringMemory);
+	clearCache(m_stringCalldata);
 	clearCache(m_emptyTuple);
 	clearCache(m_payableAddress);
 	clearCache(m_address);
@@ -189,11 +191,30 @@ void TypeProvider::reset()
 	clearCaches(instance().m_uintM);
 	clearCaches(instance().m_bytesM);
 	clearCaches(instance().m_magics);
+	// These survive the reset because the shared global magic variable
+	// declarations reference them, but their caches may refer to cleared types.
+	clearCaches(instance().m_globalFunctionTypes);
 
 	instance().m_generalTypes.clear();
 	instance().m_stringLiteralTypes.clear();
 	instance().m_ufixedMxN.clear();
 	instance().m_fixedMxN.clear();
+	instance().m_functionTypesFromDefinitions.clear();
+	instance().m_functionTypesFromNodes.clear();
+	instance().m_rationalNumberTypes.clear();
+	instance().m_arrayTypes.clear();
+	instance().m_arraySliceTypes.clear();
+	instance().m_contractTypes.clear();
+	instance().m_enumTypes.clear();
+	instance().m_moduleTypes.clear();
+	instance().m_typeTypes.clear();
+	instance().m_structTypes.clear();
+	instance().m_modifierTypes.clear();
+	instance().m_metaTypes.clear();
+	instance().m_mappingTypes.clear();
+	instance().m_userDefinedValueTypes.clear();
+	instance().m_tupleTypes.clear();
+	instance().m_referenceTypeCopies.clear();
 }
 
 template <typename T, typename... Args>
@@ -203,6 +224,15 @@ inline T const* TypeProvider::createAndGet(Args&& ... _args)
 	return static_cast<T const*>(instance().m_generalTypes.back().get());
 }
 
+template <typename T, typename Key, typename... Args>
+inline T const* TypeProvider::createAndMemoize(std::map<Key, std::unique_ptr<T>>& _map, Key const& _key, Args&& ... _args)
+{
+	auto it = _map.find(_key);
+	if (it == _map.end())
+		it = _map.emplace(_key, std::make_unique<T>(std::forward<Args>(_args)...)).first;
+	return it->second.get();
+}
+
 Type const* TypeProvider::fromElementaryTypeName(ElementaryTypeNameToken const& _type, std::optional<StateMutability> _stateMutability)
 {
 	solAssert(
@@ -338,6 +368,13 @@ ArrayType const* TypeProvider::stringMemory()
 	return m_stringMemory.get();
 }
 
+ArrayType const* TypeProvider::stringCalldata()
+{
+	if (!m_stringCalldata)
+		m_stringCalldata = std::make_unique<ArrayType>(DataLocation::CallData, true);
+	return m_stringCalldata.get();
+}
+
 Type const* TypeProvider::forLiteral(Literal const& _literal)
 {
 	switch (_literal.token())
@@ -403,7 +440,8 @@ TupleType const* TypeProvider::tuple(std::vector<Type const*> members)
 	if (members.empty())
 		return &m_emptyTuple;
 
-	return createAndGet<TupleType>(std::move(members));
+	std::vector<Type const*> key = members;
+	return createAndMemoize(instance().m_tupleTypes, key, std::move(members));
 }
 
 ReferenceType const* TypeProvider::withLocation(ReferenceType const* _type, DataLocation _location, bool _isPointer)
@@ -411,33 +449,36 @@ ReferenceType const* TypeProvider::withLocation(ReferenceType const* _type, Data
 	if (_type->location() == _location && _type->isPointer() == _isPointer)
 		return _type;
 
-	instance().m_generalTypes.emplace_back(_type->copyForLocation(_location, _isPointer));
-	return static_cast<ReferenceType const*>(instance().m_generalTypes.back().get());
+	auto key = std::make_tuple(_type, _location, _isPointer);
+	auto it = instance().m_referenceTypeCopies.find(key);
+	if (it == instance().m_referenceTypeCopies.end())
+		it = instance().m_referenceTypeCopies.emplace(key, _type->copyForLocation(_location, _isPointer)).first;
+	return it->second.get();
 }
 
 FunctionType const* TypeProvider::function(FunctionDefinition const& _function, FunctionType::Kind _kind)
 {
-	return createAndGet<FunctionType>(_function, _kind);
+	return createAndMemoize(instance().m_functionTypesFromDefinitions, std::make_pair(&_function, _kind), _function, _kind);
 }
 
 FunctionType const* TypeProvider::function(VariableDeclaration const& _varDecl)
 {
-	return createAndGet<FunctionType>(_varDecl);
+	return createAndMemoize(instance().m_functionTypesFromNodes, static_cast<ASTNode const*>(&_varDecl), _varDecl);
 }
 
 FunctionType const* TypeProvider::function(EventDefinition const& _def)
 {
-	return createAndGet<FunctionType>(_def);
+	return createAndMemoize(instance().m_functionTypesFromNodes, static_cast<ASTNode const*>(&_def), _def);
 }
 
 FunctionType const* TypeProvider::function(ErrorDefinition const& _def)
 {
-	return createAndGet<FunctionType>(_def);
+	return createAndMemoize(instance().m_functionTypesFromNodes, static_cast<ASTNode const*>(&_def), _def);
 }
 
 FunctionType const* TypeProvider::function(FunctionTypeName const& _typeName)
 {
-	return createAndGet<FunctionType>(_typeName);
+	return createAndMemoize(instance().m_functionTypesFromNodes, static_cast<ASTNode const*>(&_typeName), _typeName);
 }
 
 FunctionType const* TypeProvider::function(
@@ -459,6 +500,26 @@ FunctionType const* TypeProvider::function(
 	);
 }
 
+FunctionType const* TypeProvider::globalFunction(
+	strings const& _parameterTypes,
+	strings const& _returnParameterTypes,
+	FunctionType::Kind _kind,
+	StateMutability _stateMutability,
+	FunctionType::Options _options
+)
+{
+	// Can only use this constructor for "arbitraryParameters".
+	solAssert(!_options.valueSet && !_options.gasSet && !_options.saltSet && !_options.hasBoundFirstArgument);
+	instance().m_globalFunctionTypes.emplace_back(std::make_unique<FunctionType>(
+		_parameterTypes,
+		_returnParameterTypes,
+		_kind,
+		_stateMutability,
+		std::move(_options)
+	));
+	return instance().m_globalFunctionTypes.back().get();
+}
+
 FunctionType const* TypeProvider::function(
 	TypePointers const& _parameterTypes,
 	TypePointers const& _returnParameterTypes,
@@ -484,7 +545,7 @@ FunctionType const* TypeProvider::function(
 
 RationalNumberType const* TypeProvider::rationalNumber(rational const& _value, Type const* _compatibleBytesType)
 {
-	return createAndGet<RationalNumberType>(_value, _compatibleBytesType);
+	return createAndMemoize(instance().m_rationalNumberTypes, std::make_pair(_value, _compatibleBytesType), _value, _compatibleBytesType);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, bool _isString)
@@ -495,6 +556,8 @@ ArrayType const* TypeProvider::array(DataLocation _location, bool _isString)
 			return stringStorage();
 		if (_location == DataLocation::Memory)
 			return stringMemory();
+		solAssert(_location == DataLocation::CallData, "");
+		return stringCalldata();
 	}
 	else
 	{
@@ -502,53 +565,54 @@ ArrayType const* TypeProvider::array(DataLocation _location, bool _isString)
 			return bytesStorage();
 		if (_location == DataLocation::Memory)
 			return bytesMemory();
+		solAssert(_location == DataLocation::CallData, "");
+		return bytesCalldata();
 	}
-	return createAndGet<ArrayType>(_location, _isString);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, Type const* _baseType)
 {
-	return createAndGet<ArrayType>(_location, _baseType);
+	return createAndMemoize(instance().m_arrayTypes, std::make_tuple(_location, _baseType, std::optional<u256>{}), _location, _baseType);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, Type const* _baseType, u256 const& _length)
 {
-	return createAndGet<ArrayType>(_location, _baseType, _length);
+	return createAndMemoize(instance().m_arrayTypes, std::make_tuple(_location, _baseType, std::optional<u256>{_length}), _location, _baseType, _length);
 }
 
 ArraySliceType const* TypeProvider::arraySlice(ArrayType const& _arrayType)
 {
-	return createAndGet<ArraySliceType>(_arrayType);
+	return createAndMemoize(instance().m_arraySliceTypes, &_arrayType, _arrayType);
 }
 
 ContractType const* TypeProvider::contract(ContractDefinition const& _contractDef, bool _isSuper)
 {
-	return createAndGet<ContractType>(_contractDef, _isSuper);
+	return createAndMemoize(instance().m_contractTypes, std::make_pair(&_contractDef, _isSuper), _contractDef, _isSuper);
 }
 
 EnumType const* TypeProvider::enumType(EnumDefinition const& _enumDef)
 {
-	return createAndGet<EnumType>(_enumDef);
+	return createAndMemoize(instance().m_enumTypes, &_enumDef, _enumDef);
 }
 
 ModuleType const* TypeProvider::module(SourceUnit const& _source)
 {
-	return createAndGet<ModuleType>(_source);
+	return createAndMemoize(instance().m_moduleTypes, &_source, _source);
 }
 
 TypeType const* TypeProvider::typeType(Type const* _actualType)
 {
-	return createAndGet<TypeType>(_actualType);
+	return createAndMemoize(instance().m_typeTypes, _actualType, _actualType);
 }
 
 StructType const* TypeProvider::structType(StructDefinition const& _struct, DataLocation _location)
 {
-	return createAndGet<StructType>(_struct, _location);
+	return createAndMemoize(instance().m_structTypes, std::make_pair(&_struct, _location), _struct, _location);
 }
 
 ModifierType const* TypeProvider::modifier(ModifierDefinition const& _def)
 {
-	return createAndGet<ModifierType>(_def);
+	return createAndMemoize(instance().m_modifierTypes, &_def, _def);
 }
 
 MagicType const* TypeProvider::magic(MagicType::Kind _kind)
@@ -567,15 +631,16 @@ MagicType const* TypeProvider::meta(Type const* _type)
 		),
 		"Only enum, contracts or integer types supported for now."
 	);
-	return createAndGet<MagicType>(_type);
+	return createAndMemoize(instance().m_metaTypes, _type, _type);
 }
 
 MappingType const* TypeProvider::mapping(Type const* _keyType, ASTString _keyName, Type const* _valueType, ASTString _valueName)
 {
-	return createAndGet<MappingType>(_keyType, _keyName, _valueType, _valueName);
+	auto key = std::make_tuple(_keyType, _keyName, _valueType, _valueName);
+	return createAndMemoize(instance().m_mappingTypes, key, _keyType, std::move(_keyName), _valueType, std::move(_valueName));
 }
 
 UserDefinedValueType const* TypeProvider::userDefinedValueType(UserDefinedValueTypeDefinition const& _definition)
 {
-	return createAndGet<UserDefinedValueType>(_definition);
+	return createAndMemoize(instance().m_userDefinedValueTypes, &_definition, _definition);
 }
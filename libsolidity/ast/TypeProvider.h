@@ -24,7 +24,9 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 namespace solidity::frontend
 {
@@ -35,6 +37,10 @@ namespace solidity::frontend
  * This is the Solidity Compiler's type provider. Use it to request for types. The caller does
  * <b>not</b> own the types.
  *
+ * Factory functions return the same type object for repeated requests with the same arguments,
+ * so the pointers they hand out are stable and two requests for the same type can be compared
+ * by pointer.
+ *
  * It is not recommended to explicitly instantiate types unless you really know what and why
  * you are doing it.
  */
@@ -71,6 +77,7 @@ public:
 	static ArrayType const* bytesCalldata();
 	static ArrayType const* stringStorage();
 	static ArrayType const* stringMemory();
+	static ArrayType const* stringCalldata();
 
 	/// Constructor for a byte array ("bytes") and string.
 	static ArrayType const* array(DataLocation _location, bool _isString = false);
@@ -153,6 +160,18 @@ public:
 		FunctionType::Options _options = {}
 	);
 
+	/// Same as the factory above, but the returned type is kept alive across reset() -
+	/// only its caches are cleared - so that it can be referenced from objects shared
+	/// between compilations. Must only be used for the types of the global magic
+	/// variables, whose parameter and return types all have static storage themselves.
+	static FunctionType const* globalFunction(
+		strings const& _parameterTypes,
+		strings const& _returnParameterTypes,
+		FunctionType::Kind _kind = FunctionType::Kind::Internal,
+		StateMutability _stateMutability = StateMutability::NonPayable,
+		FunctionType::Options _options = {}
+	);
+
 	/// @returns a highly customized FunctionType, use with care.
 	static FunctionType const* function(
 		TypePointers const& _parameterTypes,
@@ -210,6 +229,13 @@ private:
 	template <typename T, typename... Args>
 	static inline T const* createAndGet(Args&& ... _args);
 
+	/// Looks up the type identified by @a _key in @a _map and creates it from @a _args and
+	/// inserts it first if it is not present yet. The key has to uniquely determine all
+	/// observable state of the constructed type, so that repeated requests with the same
+	/// arguments always yield the same type object.
+	template <typename T, typename Key, typename... Args>
+	static inline T const* createAndMemoize(std::map<Key, std::unique_ptr<T>>& _map, Key const& _key, Args&& ... _args);
+
 	static BoolType const m_boolean;
 	static InaccessibleDynamicType const m_inaccessibleDynamic;
 
@@ -219,6 +245,7 @@ private:
 	static std::unique_ptr<ArrayType> m_bytesCalldata;
 	static std::unique_ptr<ArrayType> m_stringStorage;
 	static std::unique_ptr<ArrayType> m_stringMemory;
+	static std::unique_ptr<ArrayType> m_stringCalldata;
 
 	static TupleType const m_emptyTuple;
 	static AddressType const m_payableAddress;
@@ -231,7 +258,34 @@ private:
 	std::map<std::pair<unsigned, unsigned>, std::unique_ptr<FixedPointType>> m_ufixedMxN{};
 	std::map<std::pair<unsigned, unsigned>, std::unique_ptr<FixedPointType>> m_fixedMxN{};
 	std::map<std::string, std::unique_ptr<StringLiteralType>> m_stringLiteralTypes{};
+
+	/// Memoization maps for the factory functions, keyed by their arguments. Using the
+	/// arguments instead of @ref Type::identifier as keys keeps apart types that compare
+	/// equal but carry different metadata, e.g. function types pointing to different
+	/// declarations that share a signature.
+	std::map<std::pair<FunctionDefinition const*, FunctionType::Kind>, std::unique_ptr<FunctionType>> m_functionTypesFromDefinitions{};
+	std::map<ASTNode const*, std::unique_ptr<FunctionType>> m_functionTypesFromNodes{};
+	std::map<std::pair<rational, Type const*>, std::unique_ptr<RationalNumberType>> m_rationalNumberTypes{};
+	std::map<std::tuple<DataLocation, Type const*, std::optional<u256>>, std::unique_ptr<ArrayType>> m_arrayTypes{};
+	std::map<ArrayType const*, std::unique_ptr<ArraySliceType>> m_arraySliceTypes{};
+	std::map<std::pair<ContractDefinition const*, bool>, std::unique_ptr<ContractType>> m_contractTypes{};
+	std::map<EnumDefinition const*, std::unique_ptr<EnumType>> m_enumTypes{};
+	std::map<SourceUnit const*, std::unique_ptr<ModuleType>> m_moduleTypes{};
+	std::map<Type const*, std::unique_ptr<TypeType>> m_typeTypes{};
+	std::map<std::pair<StructDefinition const*, DataLocation>, std::unique_ptr<StructType>> m_structTypes{};
+	std::map<ModifierDefinition const*, std::unique_ptr<ModifierType>> m_modifierTypes{};
+	std::map<Type const*, std::unique_ptr<MagicType>> m_metaTypes{};
+	std::map<std::tuple<Type const*, ASTString, Type const*, ASTString>, std::unique_ptr<MappingType>> m_mappingTypes{};
+	std::map<UserDefinedValueTypeDefinition const*, std::unique_ptr<UserDefinedValueType>> m_userDefinedValueTypes{};
+	std::map<std::vector<Type const*>, std::unique_ptr<TupleType>> m_tupleTypes{};
+	std::map<std::tuple<ReferenceType const*, DataLocation, bool>, std::unique_ptr<ReferenceType>> m_referenceTypeCopies{};
+
+	/// Holds the types that cannot be memoized by construction arguments, e.g. custom-built
+	/// function types.
 	std::vector<std::unique_ptr<Type>> m_generalTypes{};
+	/// Types created through globalFunction(). Kept alive across reset(), which only
+	/// clears their caches, since the shared global context references them.
+	std::vector<std::unique_ptr<FunctionType>> m_globalFunctionTypes{};
 };
 
 }
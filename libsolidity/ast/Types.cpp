@@ -136,6 +136,7 @@ void Type::clearCache() const
 	m_members.clear();
 	m_stackItems.reset();
 	m_stackSize.reset();
+	m_identifier.reset();
 }
 
 void StorageOffsets::computeOffsets(TypePointers const& _types)
@@ -270,15 +271,19 @@ std::string Type::escapeIdentifier(std::string const& _identifier)
 	return ret;
 }
 
-std::string Type::identifier() const
+std::string const& Type::identifier() const
 {
-	std::string ret = escapeIdentifier(richIdentifier());
-	solAssert(ret.find_first_of("0123456789") != 0, "Identifier cannot start with a number.");
-	solAssert(
-		ret.find_first_not_of("0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMONPQRSTUVWXYZ_$") == std::string::npos,
-		"Identifier contains invalid characters."
-	);
-	return ret;
+	if (!m_identifier)
+	{
+		std::string ret = escapeIdentifier(richIdentifier());
+		solAssert(ret.find_first_of("0123456789") != 0, "Identifier cannot start with a number.");
+		solAssert(
+			ret.find_first_not_of("0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMONPQRSTUVWXYZ_$") == std::string::npos,
+			"Identifier contains invalid characters."
+		);
+		m_identifier = std::move(ret);
+	}
+	return *m_identifier;
 }
 
 Type const* Type::commonType(Type const* _a, Type const* _b)
@@ -3598,6 +3603,9 @@ bool FunctionType::isBareCall() const
 
 std::string FunctionType::externalSignature() const
 {
+	if (m_externalSignature)
+		return *m_externalSignature;
+
 	solAssert(m_declaration != nullptr, "External signature of function needs declaration");
 	solAssert(!m_declaration->name().empty(), "Fallback function has no signature.");
 	switch (kind())
@@ -3631,12 +3639,15 @@ std::string FunctionType::externalSignature() const
 			typeName += " storage";
 		return typeName;
 	});
-	return m_declaration->name() + "(" + boost::algorithm::join(typeStrings, ",") + ")";
+	m_externalSignature = m_declaration->name() + "(" + boost::algorithm::join(typeStrings, ",") + ")";
+	return *m_externalSignature;
 }
 
 u256 FunctionType::externalIdentifier() const
 {
-	return util::selectorFromSignatureU32(externalSignature());
+	if (!m_externalIdentifier)
+		m_externalIdentifier = util::selectorFromSignatureU32(externalSignature());
+	return *m_externalIdentifier;
 }
 
 std::string FunctionType::externalIdentifierHex() const
@@ -3644,6 +3655,14 @@ std::string FunctionType::externalIdentifierHex() const
 	return util::selectorFromSignatureH32(externalSignature()).hex();
 }
 
+void FunctionType::clearCache() const
+{
+	Type::clearCache();
+
+	m_externalSignature.reset();
+	m_externalIdentifier.reset();
+}
+
 bool FunctionType::isPure() const
 {
 	// TODO: replace this with m_stateMutability == StateMutability::Pure once
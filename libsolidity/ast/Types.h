@@ -210,7 +210,8 @@ public:
 	/// only if they have the same identifier.
 	/// The identifier should start with "t_".
 	/// Will not contain any character which would be invalid as an identifier.
-	std::string identifier() const;
+	/// The result is computed on first use and cached on the type object.
+	std::string const& identifier() const;
 
 	/// More complex identifier strings use "parentheses", where $_ is interpreted as
 	/// "opening parenthesis", _$ as "closing parenthesis", _$_ as "comma" and any $ that
@@ -432,6 +433,8 @@ protected:
 	mutable std::map<ASTNode const*, std::unique_ptr<MemberList>> m_members;
 	mutable std::optional<std::vector<std::tuple<std::string, Type const*>>> m_stackItems;
 	mutable std::optional<size_t> m_stackSize;
+	/// Escaped identifier, will be lazy-initialized.
+	mutable std::optional<std::string> m_identifier;
 };
 
 /**
@@ -1520,6 +1523,8 @@ public:
 	/// @param _inLibrary if true, uses DelegateCall as location.
 	FunctionTypePointer asExternallyCallableFunction(bool _inLibrary) const;
 
+	void clearCache() const override;
+
 protected:
 	std::vector<std::tuple<std::string, Type const*>> makeStackItems() const override;
 private:
@@ -1533,6 +1538,10 @@ private:
 	StateMutability m_stateMutability = StateMutability::NonPayable;
 	Declaration const* m_declaration = nullptr;
 	Options const m_options;
+	/// Caches for the external signature and its selector, see externalSignature()
+	/// and externalIdentifier().
+	mutable std::optional<std::string> m_externalSignature;
+	mutable std::optional<u256> m_externalIdentifier;
 };
 
 /**
@@ -304,7 +304,6 @@ void ArrayUtils::copyArrayToMemory(ArrayType const& _sourceType, bool _padToWord
 		!_sourceType.baseType()->isDynamicallySized(),
 		"Nested dynamic arrays not implemented here."
 	);
-	CompilerUtils utils(m_context);
 
 	if (_sourceType.location() == DataLocation::CallData)
 	{
@@ -323,8 +322,31 @@ void ArrayUtils::copyArrayToMemory(ArrayType const& _sourceType, bool _padToWord
 		routine += "target := add(target, len)\n";
 		m_context.appendInlineAssembly("{" + routine + "}", {"target", "source", "len"});
 		m_context << Instruction::POP << Instruction::POP;
+		return;
 	}
-	else if (_sourceType.location() == DataLocation::Memory)
+
+	// The copy loops are substantial, so each distinct routine is emitted only once per
+	// assembly as a low-level function and called, analogous to copyArrayToStorage().
+	Type const* sourceType = &_sourceType;
+	m_context.callLowLevelFunction(
+		"$copyArrayToMemory_" + _sourceType.identifier() + (_padToWordBoundaries ? "_padded" : ""),
+		2,
+		1,
+		[=](CompilerContext& _context)
+		{
+			ArrayUtils(_context).copyArrayToMemoryInner(
+				dynamic_cast<ArrayType const&>(*sourceType),
+				_padToWordBoundaries
+			);
+		}
+	);
+}
+
+void ArrayUtils::copyArrayToMemoryInner(ArrayType const& _sourceType, bool _padToWordBoundaries) const
+{
+	CompilerUtils utils(m_context);
+
+	if (_sourceType.location() == DataLocation::Memory)
 	{
 		retrieveLength(_sourceType);
 		// stack: target source length
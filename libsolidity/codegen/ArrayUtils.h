@@ -108,6 +108,13 @@ public:
 	void accessCallDataArrayElement(ArrayType const& _arrayType, bool _doBoundsCheck = true) const;
 
 private:
+	/// Appends the copy loop used by @a copyArrayToMemory for memory and storage arrays.
+	/// It is emitted once per assembly as a low-level function; the trivial calldata
+	/// case stays inline in copyArrayToMemory.
+	/// Stack pre: memory_offset source_item
+	/// Stack post: memory_offest + length(padded)
+	void copyArrayToMemoryInner(ArrayType const& _sourceType, bool _padToWordBoundaries) const;
+
 	/// Adds the given number of bytes to a storage byte offset counter and also increments
 	/// the storage offset if adding this number again would increase the counter over 32.
 	/// @param byteOffsetPosition the stack offset of the storage byte offset
@@ -37,10 +37,15 @@ namespace solidity::frontend
 class Compiler
 {
 public:
-	Compiler(langutil::EVMVersion _evmVersion, RevertStrings _revertStrings, OptimiserSettings _optimiserSettings):
+	Compiler(
+		langutil::EVMVersion _evmVersion,
+		RevertStrings _revertStrings,
+		OptimiserSettings _optimiserSettings,
+		std::shared_ptr<LowLevelFunctionCache> _lowLevelFunctionCache = {}
+	):
 		m_optimiserSettings(std::move(_optimiserSettings)),
-		m_runtimeContext(_evmVersion, _revertStrings),
-		m_context(_evmVersion, _revertStrings, &m_runtimeContext)
+		m_runtimeContext(_evmVersion, _revertStrings, nullptr, _lowLevelFunctionCache),
+		m_context(_evmVersion, _revertStrings, &m_runtimeContext, std::move(_lowLevelFunctionCache))
 	{ }
 
 	/// Compiles a contract.
@@ -142,6 +142,10 @@ void CompilerContext::callYulFunction(
 	unsigned _outArgs
 )
 {
+	if (m_lowLevelFunctionRecording)
+		// The pushed tag refers to the Yul utility code appended to this assembly and
+		// cannot be remapped when the recorded items are spliced into another one.
+		m_lowLevelFunctionRecording->valid = false;
 	m_externallyUsedYulFunctions.insert(_name);
 	auto const retTag = pushNewTag();
 	CompilerUtils(*this).moveIntoStack(_inArgs);
@@ -163,10 +167,11 @@ evmasm::AssemblyItem CompilerContext::lowLevelFunctionTag(
 		evmasm::AssemblyItem tag = newTag().pushTag();
 		m_lowLevelFunctions.insert(make_pair(_name, tag));
 		m_lowLevelFunctionGenerationQueue.push(make_tuple(_name, _inArgs, _outArgs, _generator));
-		return tag;
+		it = m_lowLevelFunctions.find(_name);
 	}
-	else
-		return it->second;
+	if (m_lowLevelFunctionRecording)
+		m_lowLevelFunctionRecording->dependencyTags.emplace(static_cast<size_t>(it->second.data()), _name);
+	return it->second;
 }
 
 void CompilerContext::appendMissingLowLevelFunctions()
@@ -180,13 +185,130 @@ void CompilerContext::appendMissingLowLevelFunctions()
 		tie(name, inArgs, outArgs, generator) = m_lowLevelFunctionGenerationQueue.front();
 		m_lowLevelFunctionGenerationQueue.pop();
 
+		if (replayCachedLowLevelFunction(name, inArgs, outArgs))
+			continue;
+
+		if (m_lowLevelFunctionCache)
+			m_lowLevelFunctionRecording = LowLevelFunctionRecording{
+				m_asm->items().size(),
+				m_asm->usedTags(),
+				{},
+				true
+			};
 		setStackOffset(static_cast<int>(inArgs) + 1);
 		*this << m_lowLevelFunctions.at(name).tag();
 		generator(*this);
 		CompilerUtils(*this).moveToStackTop(outArgs);
 		appendJump(evmasm::AssemblyItem::JumpType::OutOfFunction);
 		solAssert(stackHeight() == outArgs, "Invalid stack height in low-level function " + name + ".");
+		finishLowLevelFunctionRecording(name, inArgs, outArgs);
+	}
+}
+
+bool CompilerContext::replayCachedLowLevelFunction(std::string const& _name, unsigned _inArgs, unsigned _outArgs)
+{
+	if (!m_lowLevelFunctionCache)
+		return false;
+	LowLevelFunctionCache::Entry const* entry = m_lowLevelFunctionCache->find(_name);
+	if (!entry || entry->inArgs != _inArgs || entry->outArgs != _outArgs)
+		return false;
+
+	// Determine the functions that have to be spliced in: the requested one plus any
+	// cached dependency without a tag in this assembly. Dependencies that already have
+	// a tag are either generated already or still in the generation queue.
+	std::vector<std::pair<std::string, LowLevelFunctionCache::Entry const*>> toSplice;
+	std::set<std::string> visited;
+	std::function<bool(std::string const&)> collect = [&](std::string const& _function) -> bool
+	{
+		if (!visited.insert(_function).second)
+			return true;
+		LowLevelFunctionCache::Entry const* cached = m_lowLevelFunctionCache->find(_function);
+		if (!cached)
+			return false;
+		for (auto const& [tagId, dependency]: cached->dependencyTags)
+			if (dependency != _function && !m_lowLevelFunctions.count(dependency))
+				if (!collect(dependency))
+					return false;
+		toSplice.emplace_back(_function, cached);
+		return true;
+	};
+	if (!collect(_name))
+		return false;
+
+	for (auto const& [function, cached]: toSplice)
+		if (!m_lowLevelFunctions.count(function))
+			m_lowLevelFunctions.insert({function, m_asm->newTag().pushTag()});
+
+	for (auto const& [function, cached]: toSplice)
+	{
+		std::map<size_t, size_t> tagMap{
+			{cached->entryTag, static_cast<size_t>(m_lowLevelFunctions.at(function).data())}
+		};
+		for (auto const& [tagId, dependency]: cached->dependencyTags)
+			tagMap.emplace(tagId, static_cast<size_t>(m_lowLevelFunctions.at(dependency).data()));
+		for (evmasm::AssemblyItem item: cached->items)
+		{
+			if (item.type() == evmasm::Tag || item.type() == evmasm::PushTag)
+			{
+				auto [it, inserted] = tagMap.try_emplace(static_cast<size_t>(item.data()), 0);
+				if (inserted)
+				{
+					solAssert(static_cast<unsigned>(it->first) >= cached->firstLocalTag, "");
+					it->second = static_cast<size_t>(m_asm->newTag().data());
+				}
+				item.setData(it->second);
+			}
+			// The items are appended directly since their recorded stack adjustments do
+			// not include the manual adjustments made during generation and would throw
+			// off the deposit tracking.
+			m_asm->items().emplace_back(std::move(item));
+		}
 	}
+	setStackOffset(static_cast<int>(_outArgs));
+	return true;
+}
+
+void CompilerContext::finishLowLevelFunctionRecording(std::string const& _name, unsigned _inArgs, unsigned _outArgs)
+{
+	if (!m_lowLevelFunctionCache)
+		return;
+	solAssert(m_lowLevelFunctionRecording.has_value(), "");
+	LowLevelFunctionRecording recording = std::move(*m_lowLevelFunctionRecording);
+	m_lowLevelFunctionRecording.reset();
+	if (!recording.valid || m_lowLevelFunctionCache->find(_name))
+		return;
+
+	LowLevelFunctionCache::Entry entry{
+		_inArgs,
+		_outArgs,
+		{m_asm->items().begin() + static_cast<ptrdiff_t>(recording.firstItem), m_asm->items().end()},
+		recording.firstLocalTag,
+		static_cast<size_t>(m_lowLevelFunctions.at(_name).data()),
+		std::move(recording.dependencyTags)
+	};
+	for (evmasm::AssemblyItem const& item: entry.items)
+		switch (item.type())
+		{
+		case evmasm::Operation:
+		case evmasm::Push:
+			break;
+		case evmasm::Tag:
+		case evmasm::PushTag:
+		{
+			auto [subId, tagId] = item.splitForeignPushTag();
+			if (subId != std::numeric_limits<size_t>::max())
+				return;
+			if (tagId != entry.entryTag && !entry.dependencyTags.count(tagId) && tagId < entry.firstLocalTag)
+				// Reference to a tag of the surrounding assembly, e.g. a function
+				// entry label.
+				return;
+			break;
+		}
+		default:
+			// Data, subassembly and immutable references cannot be remapped.
+			return;
+		}
+	m_lowLevelFunctionCache->add(_name, std::move(entry));
 }
 
 void CompilerContext::appendYulUtilityFunctions(OptimiserSettings const& _optimiserSettings)
@@ -27,6 +27,7 @@
 #include <libsolidity/ast/ASTForward.h>
 #include <libsolidity/ast/Types.h>
 #include <libsolidity/codegen/ABIFunctions.h>
+#include <libsolidity/codegen/LowLevelFunctionCache.h>
 
 #include <libsolidity/interface/DebugSettings.h>
 #include <libsolidity/interface/OptimiserSettings.h>
@@ -63,13 +64,15 @@ public:
 	explicit CompilerContext(
 		langutil::EVMVersion _evmVersion,
 		RevertStrings _revertStrings,
-		CompilerContext* _runtimeContext = nullptr
+		CompilerContext* _runtimeContext = nullptr,
+		std::shared_ptr<LowLevelFunctionCache> _lowLevelFunctionCache = {}
 	):
 		m_asm(std::make_shared<evmasm::Assembly>(_evmVersion, _runtimeContext != nullptr, std::string{})),
 		m_evmVersion(_evmVersion),
 		m_revertStrings(_revertStrings),
 		m_reservedMemory{0},
 		m_runtimeContext(_runtimeContext),
+		m_lowLevelFunctionCache(std::move(_lowLevelFunctionCache)),
 		m_abiFunctions(m_evmVersion, m_revertStrings, m_yulFunctionCollector),
 		m_yulUtilFunctions(m_evmVersion, m_revertStrings, m_yulFunctionCollector)
 	{
@@ -314,6 +317,16 @@ private:
 	/// Updates source location set in the assembly.
 	void updateSourceLocation();
 
+	/// Splices the cached code of the low-level function @a _name and of all low-level
+	/// functions it transitively depends on into the assembly, renumbering their tags.
+	/// @returns false without modifying the assembly if the code of any required
+	/// function is not cached.
+	bool replayCachedLowLevelFunction(std::string const& _name, unsigned _inArgs, unsigned _outArgs);
+	/// Finishes the recording started in appendMissingLowLevelFunctions() and stores the
+	/// generated code in the cache unless it references something that would not remain
+	/// valid when spliced into another assembly.
+	void finishLowLevelFunctionRecording(std::string const& _name, unsigned _inArgs, unsigned _outArgs);
+
 	/**
 	 * Helper class that manages function labels and ensures that referenced functions are
 	 * compiled in a specific order.
@@ -378,6 +391,25 @@ private:
 	size_t m_runtimeSub = std::numeric_limits<size_t>::max();
 	/// An index of low-level function labels by name.
 	std::map<std::string, evmasm::AssemblyItem> m_lowLevelFunctions;
+	/// Cache of compiled low-level functions shared between the contracts of a
+	/// compilation run. May be unset, in which case generated code is never reused.
+	std::shared_ptr<LowLevelFunctionCache> m_lowLevelFunctionCache;
+	/// State tracked while the code of a single low-level function is generated for
+	/// the cache.
+	struct LowLevelFunctionRecording
+	{
+		/// Index of the first recorded assembly item.
+		size_t firstItem = 0;
+		/// First tag id created during generation.
+		unsigned firstLocalTag = 0;
+		/// Tags of other low-level functions requested during generation.
+		std::map<size_t, std::string> dependencyTags;
+		/// Cleared if the code references something that cannot be remapped to
+		/// another assembly, e.g. the tag of a Yul utility function.
+		bool valid = true;
+	};
+	/// Recording of the low-level function currently being generated, if any.
+	std::optional<LowLevelFunctionRecording> m_lowLevelFunctionRecording;
 	/// Collector for yul functions.
 	MultiUseYulFunctionCollector m_yulFunctionCollector;
 	/// Set of externally used yul functions.
@@ -0,0 +1,36 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Cache of compiled low-level functions shared between the contracts of a compilation run.
+ */
+
+#include <libsolidity/codegen/LowLevelFunctionCache.h>
+
+using namespace solidity;
+using namespace solidity::frontend;
+
+void LowLevelFunctionCache::add(std::string const& _name, Entry _entry)
+{
+	m_entries.try_emplace(_name, std::move(_entry));
+}
+
+LowLevelFunctionCache::Entry const* LowLevelFunctionCache::find(std::string const& _name) const
+{
+	auto it = m_entries.find(_name);
+	return it == m_entries.end() ? nullptr : &it->second;
+}
@@ -0,0 +1,75 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Cache of compiled low-level functions shared between the contracts of a compilation run.
+ */
+
+#pragma once
+
+#include <libevmasm/AssemblyItem.h>
+
+#include <map>
+#include <string>
+
+namespace solidity::frontend
+{
+
+/**
+ * Cache of the assembly generated for low-level functions, shared between all contracts
+ * compiled in a single CompilerStack run of the legacy pipeline. The function names
+ * encode the involved types completely, so a routine generated for one contract can be
+ * spliced into the assembly of any other contract compiled with the same settings.
+ *
+ * An entry stores the recorded assembly items together with a classification of the
+ * tags they use: the function's own entry tag, tags referring to other low-level
+ * functions and tags that are local to the recorded code. On reuse, local tags are
+ * renumbered in the target assembly and the other tags are redirected to the target's
+ * corresponding low-level function tags. Routines whose code references anything that
+ * cannot be remapped this way are not cached.
+ */
+class LowLevelFunctionCache
+{
+public:
+	struct Entry
+	{
+		unsigned inArgs = 0;
+		unsigned outArgs = 0;
+		/// Recorded assembly items, starting with the entry tag and ending with the
+		/// jump out of the function.
+		evmasm::AssemblyItems items;
+		/// First tag id created while the function was generated. Tags with this id or
+		/// a higher one are local to the recorded code and renumbered on reuse.
+		unsigned firstLocalTag = 0;
+		/// Tag id of the function's own entry tag.
+		size_t entryTag = 0;
+		/// Tag ids that refer to other low-level functions, by name.
+		std::map<size_t, std::string> dependencyTags;
+	};
+
+	/// Stores @a _entry as the code of the low-level function @a _name unless an entry
+	/// for it exists already.
+	void add(std::string const& _name, Entry _entry);
+
+	/// @returns the cached entry for @a _name or nullptr if there is none.
+	Entry const* find(std::string const& _name) const;
+
+private:
+	std::map<std::string, Entry> m_entries;
+};
+
+}
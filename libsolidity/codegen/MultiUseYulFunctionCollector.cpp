@@ -26,26 +26,56 @@
 #include <libsolutil/Whiskers.h>
 #include <libsolutil/StringUtils.h>
 
+#include <algorithm>
+
 using namespace solidity;
 using namespace solidity::frontend;
 using namespace solidity::util;
 
 std::string MultiUseYulFunctionCollector::requestedFunctions()
 {
+	solAssert(m_creationStack.empty(), "");
 	std::string result = std::move(m_code);
 	m_code.clear();
 	m_requestedFunctions.clear();
+	m_dependencies.clear();
+	m_contractSpecificFunctions.clear();
 	return result;
 }
 
+void MultiUseYulFunctionCollector::markCurrentFunctionContractSpecific()
+{
+	solAssert(!m_creationStack.empty(), "");
+	m_contractSpecificFunctions.insert(m_creationStack.back());
+}
+
+void MultiUseYulFunctionCollector::recordRequest(std::string const& _name)
+{
+	if (m_creationStack.empty() || m_creationStack.back() == _name)
+		return;
+	std::vector<std::string>& dependencies = m_dependencies[m_creationStack.back()];
+	if (std::find(dependencies.begin(), dependencies.end(), _name) == dependencies.end())
+		dependencies.emplace_back(_name);
+}
+
 std::string MultiUseYulFunctionCollector::createFunction(std::string const& _name, std::function<std::string()> const& _creator)
 {
+	recordRequest(_name);
 	if (!m_requestedFunctions.count(_name))
 	{
+		if (m_pregeneratedFunctionLookup && m_pregeneratedFunctionLookup(_name, *this))
+		{
+			solAssert(m_requestedFunctions.count(_name), "");
+			return _name;
+		}
 		m_requestedFunctions.insert(_name);
+		m_creationStack.emplace_back(_name);
 		std::string fun = _creator();
+		m_creationStack.pop_back();
 		solAssert(!fun.empty(), "");
 		solAssert(fun.find("function " + _name + "(") != std::string::npos, "Function not properly named.");
+		if (m_functionCreatedCallback)
+			m_functionCreatedCallback(_name, fun, m_dependencies[_name], m_contractSpecificFunctions.count(_name) > 0);
 		m_code += std::move(fun);
 	}
 	return _name;
@@ -57,15 +87,23 @@ std::string MultiUseYulFunctionCollector::createFunction(
 )
 {
 	solAssert(!_name.empty(), "");
+	recordRequest(_name);
 	if (!m_requestedFunctions.count(_name))
 	{
+		if (m_pregeneratedFunctionLookup && m_pregeneratedFunctionLookup(_name, *this))
+		{
+			solAssert(m_requestedFunctions.count(_name), "");
+			return _name;
+		}
 		m_requestedFunctions.insert(_name);
+		m_creationStack.emplace_back(_name);
 		std::vector<std::string> arguments;
 		std::vector<std::string> returnParameters;
 		std::string body = _creator(arguments, returnParameters);
+		m_creationStack.pop_back();
 		solAssert(!body.empty(), "");
 
-		m_code += Whiskers(R"(
+		std::string fun = Whiskers(R"(
 			function <functionName>(<args>)<?+retParams> -> <retParams></+retParams> {
 				<body>
 			}
@@ -75,6 +113,17 @@ std::string MultiUseYulFunctionCollector::createFunction(
 		("retParams", joinHumanReadable(returnParameters))
 		("body", body)
 		.render();
+		if (m_functionCreatedCallback)
+			m_functionCreatedCallback(_name, fun, m_dependencies[_name], m_contractSpecificFunctions.count(_name) > 0);
+		m_code += std::move(fun);
 	}
 	return _name;
 }
+
+void MultiUseYulFunctionCollector::insertPregeneratedFunction(std::string const& _name, std::string const& _code)
+{
+	solAssert(!m_requestedFunctions.count(_name), "");
+	recordRequest(_name);
+	m_requestedFunctions.insert(_name);
+	m_code += _code;
+}
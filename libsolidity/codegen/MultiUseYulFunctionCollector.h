@@ -26,6 +26,7 @@
 #include <map>
 #include <string>
 #include <set>
+#include <vector>
 
 namespace solidity::frontend
 {
@@ -37,6 +38,18 @@ namespace solidity::frontend
 class MultiUseYulFunctionCollector
 {
 public:
+	/// Callback invoked for every newly created function with its name, its code, the
+	/// names of the functions it requested while being created and whether it was marked
+	/// as specific to the contract being compiled.
+	using FunctionCreatedCallback =
+		std::function<void(std::string const&, std::string const&, std::vector<std::string> const&, bool)>;
+
+	/// Callback consulted for requested functions that have not been created yet. If it
+	/// adds the function (e.g. by copying cached code via insertPregeneratedFunction()),
+	/// it returns true and the creator is not run.
+	using PregeneratedFunctionLookup =
+		std::function<bool(std::string const&, MultiUseYulFunctionCollector&)>;
+
 	/// Helper function that uses @a _creator to create a function and add it to
 	/// @a m_requestedFunctions if it has not been created yet and returns @a _name in both
 	/// cases.
@@ -47,6 +60,10 @@ public:
 		std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
 	);
 
+	/// Adds an already generated function, e.g. one reused from another contract via the
+	/// function cache. The caller is responsible for also adding its dependencies.
+	void insertPregeneratedFunction(std::string const& _name, std::string const& _code);
+
 	/// @returns concatenation of all generated functions in the order in which they were
 	/// generated.
 	/// Clears the internal list, i.e. calling it again will result in an
@@ -56,9 +73,28 @@ public:
 	/// @returns true IFF a function with the specified name has already been collected.
 	bool contains(std::string const& _name) const { return m_requestedFunctions.count(_name) > 0; }
 
+	void setFunctionCreatedCallback(FunctionCreatedCallback _callback) { m_functionCreatedCallback = std::move(_callback); }
+	void setPregeneratedFunctionLookup(PregeneratedFunctionLookup _lookup) { m_pregeneratedFunctionLookup = std::move(_lookup); }
+
+	/// Marks the function currently being created as specific to the contract being
+	/// compiled, i.e. as unsuitable for reuse by name in other contracts. Must be called
+	/// from within a creator.
+	void markCurrentFunctionContractSpecific();
+
 private:
+	/// Records that @a _name was requested by the function currently being created, if any.
+	void recordRequest(std::string const& _name);
+
 	std::set<std::string> m_requestedFunctions;
 	std::string m_code;
+	/// Stack of functions currently being created, innermost last.
+	std::vector<std::string> m_creationStack;
+	/// For each function, the other functions it requested while being created, in request order.
+	std::map<std::string, std::vector<std::string>> m_dependencies;
+	/// Functions marked via markCurrentFunctionContractSpecific().
+	std::set<std::string> m_contractSpecificFunctions;
+	FunctionCreatedCallback m_functionCreatedCallback;
+	PregeneratedFunctionLookup m_pregeneratedFunctionLookup;
 };
 
 }
@@ -31,6 +31,10 @@ namespace solidity::frontend
 
 class IRGenerationContext;
 
+/// Whether the code currently being generated is part of the creation or the deployed
+/// object of a contract.
+enum class ExecutionContext { Creation, Deployed };
+
 /**
  * Structure that describes arity and co-arity of a Yul function, i.e. the number of its inputs and outputs.
  */
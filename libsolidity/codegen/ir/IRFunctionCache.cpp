@@ -0,0 +1,96 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Cache of generated Yul functions shared between the contracts of a compilation run.
+ */
+
+#include <libsolidity/codegen/ir/IRFunctionCache.h>
+
+#include <libsolidity/ast/AST.h>
+#include <libsolidity/codegen/MultiUseYulFunctionCollector.h>
+
+#include <functional>
+
+using namespace solidity;
+using namespace solidity::frontend;
+
+void IRFunctionCache::registerYulFunction(
+	std::string const& _name,
+	std::string const& _code,
+	std::vector<std::string> const& _dependencies,
+	bool _contractSpecific
+)
+{
+	auto [it, inserted] = m_yulFunctions.try_emplace(_name, YulFunction{_code, _dependencies, true, _contractSpecific});
+	if (!inserted)
+	{
+		if (it->second.code != _code)
+			// The same name was generated with different code, i.e. the creator depends on
+			// the contract being compiled. Such functions must never be reused.
+			it->second.reusable = false;
+		if (_contractSpecific)
+			it->second.contractSpecific = true;
+	}
+}
+
+void IRFunctionCache::add(FunctionDefinition const& _function, ExecutionContext _executionContext, Entry _entry)
+{
+	m_entries.insert_or_assign({_function.id(), _executionContext}, std::move(_entry));
+}
+
+IRFunctionCache::Entry const* IRFunctionCache::find(
+	FunctionDefinition const& _function,
+	ExecutionContext _executionContext
+) const
+{
+	auto it = m_entries.find({_function.id(), _executionContext});
+	return it == m_entries.end() ? nullptr : &it->second;
+}
+
+bool IRFunctionCache::populateCollector(
+	std::string const& _name,
+	MultiUseYulFunctionCollector& _collector,
+	bool _excludeContractSpecific
+) const
+{
+	std::set<std::string> visited;
+	// Functions to insert, dependencies before dependents to mirror the order in which
+	// they would have been appended during generation.
+	std::vector<std::string> missing;
+	std::function<bool(std::string const&)> collect = [&](std::string const& _function) -> bool
+	{
+		if (visited.count(_function) || _collector.contains(_function))
+			return true;
+		visited.insert(_function);
+		auto it = m_yulFunctions.find(_function);
+		if (it == m_yulFunctions.end() || !it->second.reusable)
+			return false;
+		if (_excludeContractSpecific && it->second.contractSpecific)
+			return false;
+		for (std::string const& dependency: it->second.dependencies)
+			if (!collect(dependency))
+				return false;
+		missing.emplace_back(_function);
+		return true;
+	};
+	if (!collect(_name))
+		return false;
+	for (std::string const& function: missing)
+		_collector.insertPregeneratedFunction(function, m_yulFunctions.at(function).code);
+	return true;
+}
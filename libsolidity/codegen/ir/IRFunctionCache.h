@@ -0,0 +1,131 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Cache of generated Yul functions shared between the contracts of a compilation run.
+ */
+
+#pragma once
+
+#include <libsolidity/ast/ASTForward.h>
+#include <libsolidity/codegen/ir/Common.h>
+
+#include <libsolutil/Numeric.h>
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace solidity::frontend
+{
+
+class MultiUseYulFunctionCollector;
+
+/**
+ * Cache of generated Yul functions that is shared between the IR generators of all
+ * contracts compiled in a single CompilerStack run. Without it, every function a
+ * contract inherits is regenerated from the AST once per derived contract.
+ *
+ * The cache works at two levels. Every function added to a function collector is
+ * registered here together with the names of the functions it requested, so that the
+ * code of utility functions can be copied into the collector of another contract. On
+ * top of that, for each Solidity function whose generated code was observed not to
+ * depend on the most derived contract, an Entry records the side effects generation
+ * had on the IRGenerationContext so that they can be replayed on reuse.
+ *
+ * The reuse of registered Yul functions relies on function names uniquely determining
+ * the generated code. Functions that are generated differently for different contracts
+ * under the same name (which IRGenerationContext detects via its context-dependence
+ * tracking) are marked as non-reusable when the mismatch is seen.
+ */
+class IRFunctionCache
+{
+public:
+	/// Side effects that generating a function had on the IRGenerationContext and that
+	/// have to be replayed when the cached code is reused for another contract.
+	struct Entry
+	{
+		/// Name of the generated Yul function.
+		std::string yulFunctionName;
+		/// Solidity functions whose generation was queued.
+		std::vector<FunctionDefinition const*> enqueuedFunctions;
+		/// Functions added to the internal dispatch.
+		std::vector<FunctionDefinition const*> internalDispatchFunctions;
+		/// Arities for which a call through the internal dispatch was seen.
+		std::vector<YulArity> internalDispatchArities;
+		/// Source names referenced by emitted source location comments.
+		std::set<std::string> usedSources;
+		/// Contracts whose creation objects are referenced by the code.
+		std::vector<ContractDefinition const*> subObjects;
+		/// Storage locations of the state variables the generated code accesses. The code
+		/// can only be reused if the contract being compiled assigns the same locations.
+		std::map<VariableDeclaration const*, std::pair<u256, unsigned>> storageLocations;
+		/// Whether memory-unsafe inline assembly was seen.
+		bool memoryUnsafeAssembly = false;
+	};
+
+	/// Registers the code of a generated Yul function together with the names of the
+	/// functions it requested. Called by the function collector for every new function.
+	/// @param _contractSpecific whether the function was marked as specific to the
+	/// contract it was generated for, which excludes it from reuse by name.
+	void registerYulFunction(
+		std::string const& _name,
+		std::string const& _code,
+		std::vector<std::string> const& _dependencies,
+		bool _contractSpecific
+	);
+
+	/// Stores the recorded side effects of generating @a _function.
+	void add(FunctionDefinition const& _function, ExecutionContext _executionContext, Entry _entry);
+
+	/// @returns the cached entry for @a _function or nullptr if there is none.
+	Entry const* find(FunctionDefinition const& _function, ExecutionContext _executionContext) const;
+
+	/// Copies the Yul function @a _name and all functions it transitively depends on into
+	/// @a _collector, skipping functions the collector already contains.
+	/// @param _excludeContractSpecific if true, functions registered as contract-specific
+	/// also count as not reusable. Reuse purely by name is only sound for functions whose
+	/// generation had no side effects on the IRGenerationContext that would have to be
+	/// replayed, i.e. for the utility and ABI coder functions.
+	/// @returns false without modifying the collector if any required function is
+	/// unknown or not reusable.
+	bool populateCollector(
+		std::string const& _name,
+		MultiUseYulFunctionCollector& _collector,
+		bool _excludeContractSpecific = false
+	) const;
+
+private:
+	struct YulFunction
+	{
+		std::string code;
+		/// Names of the functions requested during creation, in request order.
+		std::vector<std::string> dependencies;
+		/// Cleared if the same name was later generated with different code.
+		bool reusable = true;
+		/// Set if the function was marked as specific to the contract it was generated for.
+		bool contractSpecific = false;
+	};
+
+	std::map<std::string, YulFunction> m_yulFunctions;
+	std::map<std::pair<int64_t, ExecutionContext>, Entry> m_entries;
+};
+
+}
@@ -41,6 +41,8 @@ std::string IRGenerationContext::enqueueFunctionForCodeGeneration(FunctionDefini
 {
 	std::string name = IRNames::function(_function);
 
+	if (m_functionCacheRecording)
+		m_functionCacheRecording->enqueuedFunctions.emplace_back(&_function);
 	if (!m_functions.contains(name))
 		m_functionGenerationQueue.push_back(&_function);
 
@@ -59,6 +61,10 @@ FunctionDefinition const* IRGenerationContext::dequeueFunctionForCodeGeneration(
 ContractDefinition const& IRGenerationContext::mostDerivedContract() const
 {
 	solAssert(m_mostDerivedContract, "Most derived contract requested but not set.");
+	// Anything derived from the most derived contract (virtual function resolution,
+	// internal function IDs, ...) makes the generated code contract-specific.
+	if (m_functionCacheRecording)
+		m_recordingContextDependent = true;
 	return *m_mostDerivedContract;
 }
 
@@ -104,6 +110,9 @@ size_t IRGenerationContext::immutableMemoryOffset(VariableDeclaration const& _va
 		m_immutableVariables.count(&_variable),
 		"Unknown immutable variable: " + _variable.name()
 	);
+	// Offsets depend on the registration order of the compiled contract's immutables.
+	if (m_functionCacheRecording)
+		m_recordingContextDependent = true;
 	return m_immutableVariables.at(&_variable);
 }
 
@@ -154,6 +163,8 @@ void IRGenerationContext::addToInternalDispatch(FunctionDefinition const& _funct
 
 	YulArity arity = YulArity::fromType(*functionType);
 	DispatchQueue& dispatchQueue = m_internalDispatchMap[arity];
+	if (m_functionCacheRecording)
+		m_functionCacheRecording->internalDispatchFunctions.emplace_back(&_function);
 	if (ranges::find(dispatchQueue, &_function) == ranges::end(dispatchQueue))
 	{
 		dispatchQueue.push_back(&_function);
@@ -164,9 +175,65 @@ void IRGenerationContext::addToInternalDispatch(FunctionDefinition const& _funct
 
 void IRGenerationContext::internalFunctionCalledThroughDispatch(YulArity const& _arity)
 {
+	if (m_functionCacheRecording)
+		m_functionCacheRecording->internalDispatchArities.emplace_back(_arity);
 	m_internalDispatchMap.try_emplace(_arity);
 }
 
+void IRGenerationContext::startFunctionBodyRecording()
+{
+	if (!m_functionCache)
+		return;
+	solAssert(!m_functionCacheRecording.has_value(), "Recursive function generation.");
+	m_functionCacheRecording.emplace();
+	m_recordingContextDependent = false;
+}
+
+void IRGenerationContext::finishFunctionBodyRecording(FunctionDefinition const& _function, std::string _yulFunctionName)
+{
+	if (!m_functionCache)
+		return;
+	solAssert(m_functionCacheRecording.has_value(), "");
+	if (!m_recordingContextDependent)
+	{
+		m_functionCacheRecording->yulFunctionName = std::move(_yulFunctionName);
+		m_functionCache->add(_function, m_executionContext, std::move(*m_functionCacheRecording));
+	}
+	m_functionCacheRecording.reset();
+}
+
+bool IRGenerationContext::replayCachedFunction(FunctionDefinition const& _function)
+{
+	if (!m_functionCache)
+		return false;
+	IRFunctionCache::Entry const* entry = m_functionCache->find(_function, m_executionContext);
+	if (!entry)
+		return false;
+	if (m_functions.contains(entry->yulFunctionName))
+		// Already generated or replayed for this contract.
+		return true;
+	// The cached code is only valid if the state variables it accesses are stored at
+	// the same locations in the contract currently being compiled.
+	for (auto const& [variable, location]: entry->storageLocations)
+		if (!isStateVariable(*variable) || m_stateVariables.at(variable) != location)
+			return false;
+	if (!m_functionCache->populateCollector(entry->yulFunctionName, m_functions))
+		return false;
+	for (auto const* function: entry->enqueuedFunctions)
+		enqueueFunctionForCodeGeneration(*function);
+	for (auto const* function: entry->internalDispatchFunctions)
+		addToInternalDispatch(*function);
+	for (YulArity const& arity: entry->internalDispatchArities)
+		internalFunctionCalledThroughDispatch(arity);
+	for (std::string const& sourceName: entry->usedSources)
+		markSourceUsed(sourceName);
+	for (auto const* contract: entry->subObjects)
+		m_subObjects.insert(contract);
+	if (entry->memoryUnsafeAssembly)
+		m_memoryUnsafeInlineAssemblySeen = true;
+	return true;
+}
+
 YulUtilFunctions IRGenerationContext::utils()
 {
 	return YulUtilFunctions(m_evmVersion, m_revertStrings, m_functions);
@@ -27,6 +27,7 @@
 
 #include <libsolidity/codegen/MultiUseYulFunctionCollector.h>
 #include <libsolidity/codegen/ir/Common.h>
+#include <libsolidity/codegen/ir/IRFunctionCache.h>
 
 #include <liblangutil/CharStreamProvider.h>
 #include <liblangutil/DebugInfoSelection.h>
@@ -34,6 +35,7 @@
 
 #include <libsolutil/Common.h>
 
+#include <optional>
 #include <set>
 #include <string>
 #include <memory>
@@ -53,7 +55,7 @@ using InternalDispatchMap = std::map<YulArity, DispatchQueue>;
 class IRGenerationContext
 {
 public:
-	enum class ExecutionContext { Creation, Deployed };
+	using ExecutionContext = frontend::ExecutionContext;
 
 	IRGenerationContext(
 		langutil::EVMVersion _evmVersion,
@@ -61,15 +63,41 @@ public:
 		RevertStrings _revertStrings,
 		std::map<std::string, unsigned> _sourceIndices,
 		langutil::DebugInfoSelection const& _debugInfoSelection,
-		langutil::CharStreamProvider const* _soliditySourceProvider
+		langutil::CharStreamProvider const* _soliditySourceProvider,
+		std::shared_ptr<IRFunctionCache> _functionCache = {}
 	):
 		m_evmVersion(_evmVersion),
 		m_executionContext(_executionContext),
 		m_revertStrings(_revertStrings),
 		m_sourceIndices(std::move(_sourceIndices)),
 		m_debugInfoSelection(_debugInfoSelection),
-		m_soliditySourceProvider(_soliditySourceProvider)
-	{}
+		m_soliditySourceProvider(_soliditySourceProvider),
+		m_functionCache(std::move(_functionCache))
+	{
+		if (m_functionCache)
+		{
+			m_functions.setFunctionCreatedCallback(
+				[cache = m_functionCache](
+					std::string const& _name,
+					std::string const& _code,
+					std::vector<std::string> const& _dependencies,
+					bool _contractSpecific
+				)
+				{
+					cache->registerYulFunction(_name, _code, _dependencies, _contractSpecific);
+				}
+			);
+			// Reusing cached code purely by name is only sound for functions whose
+			// generation had no side effects on this context, so functions marked as
+			// contract-specific are excluded and only reused via replayCachedFunction().
+			m_functions.setPregeneratedFunctionLookup(
+				[cache = m_functionCache](std::string const& _name, MultiUseYulFunctionCollector& _collector)
+				{
+					return cache->populateCollector(_name, _collector, true /* _excludeContractSpecific */);
+				}
+			);
+		}
+	}
 
 	MultiUseYulFunctionCollector& functionCollector() { return m_functions; }
 
@@ -111,7 +139,10 @@ public:
 	std::pair<u256, unsigned> storageLocationOfStateVariable(VariableDeclaration const& _varDecl) const
 	{
 		solAssert(isStateVariable(_varDecl), "");
-		return m_stateVariables.at(&_varDecl);
+		std::pair<u256, unsigned> location = m_stateVariables.at(&_varDecl);
+		if (m_functionCacheRecording)
+			m_functionCacheRecording->storageLocations.emplace(&_varDecl, location);
+		return location;
 	}
 
 	std::string newYulVariable();
@@ -142,13 +173,29 @@ public:
 
 	RevertStrings revertStrings() const { return m_revertStrings; }
 
-	std::set<ContractDefinition const*, ASTNode::CompareByID>& subObjectsCreated() { return m_subObjects; }
+	std::set<ContractDefinition const*, ASTNode::CompareByID> const& subObjectsCreated() const { return m_subObjects; }
+	void addSubObject(ContractDefinition const* _contract)
+	{
+		if (m_functionCacheRecording)
+			m_functionCacheRecording->subObjects.emplace_back(_contract);
+		m_subObjects.insert(_contract);
+	}
 
 	bool memoryUnsafeInlineAssemblySeen() const { return m_memoryUnsafeInlineAssemblySeen; }
-	void setMemoryUnsafeInlineAssemblySeen() { m_memoryUnsafeInlineAssemblySeen = true; }
+	void setMemoryUnsafeInlineAssemblySeen()
+	{
+		if (m_functionCacheRecording)
+			m_functionCacheRecording->memoryUnsafeAssembly = true;
+		m_memoryUnsafeInlineAssemblySeen = true;
+	}
 
 	std::map<std::string, unsigned> const& sourceIndices() const { return m_sourceIndices; }
-	void markSourceUsed(std::string const& _name) { m_usedSourceNames.insert(_name); }
+	void markSourceUsed(std::string const& _name)
+	{
+		if (m_functionCacheRecording)
+			m_functionCacheRecording->usedSources.insert(_name);
+		m_usedSourceNames.insert(_name);
+	}
 	std::set<std::string> const& usedSourceNames() const { return m_usedSourceNames; }
 
 	bool immutableRegistered(VariableDeclaration const& _varDecl) const { return m_immutableVariables.count(&_varDecl); }
@@ -156,6 +203,20 @@ public:
 	langutil::DebugInfoSelection debugInfoSelection() const { return m_debugInfoSelection; }
 	langutil::CharStreamProvider const* soliditySourceProvider() const { return m_soliditySourceProvider; }
 
+	std::shared_ptr<IRFunctionCache> const& functionCache() const { return m_functionCache; }
+
+	/// Starts recording the side effects of generating a single function for the
+	/// function cache. No-op if no cache is attached.
+	void startFunctionBodyRecording();
+	/// Finishes the recording started by startFunctionBodyRecording() and stores the
+	/// entry in the cache unless data specific to the most derived contract was
+	/// consulted in between.
+	void finishFunctionBodyRecording(FunctionDefinition const& _function, std::string _yulFunctionName);
+	/// Tries to reuse cached code for @a _function, copying the code into the function
+	/// collector and replaying the recorded side effects.
+	/// @returns true if the cached code was used (or was already present).
+	bool replayCachedFunction(FunctionDefinition const& _function);
+
 private:
 	langutil::EVMVersion m_evmVersion;
 	ExecutionContext m_executionContext;
@@ -198,6 +259,16 @@ private:
 
 	langutil::DebugInfoSelection m_debugInfoSelection = {};
 	langutil::CharStreamProvider const* m_soliditySourceProvider = nullptr;
+
+	/// Cache of generated functions shared between the contracts of a compilation run.
+	/// May be unset, in which case generated code is never reused.
+	std::shared_ptr<IRFunctionCache> m_functionCache;
+	/// Entry currently being recorded for the function cache, if any. Mutable since
+	/// const accessors have to be able to record the data they hand out.
+	mutable std::optional<IRFunctionCache::Entry> m_functionCacheRecording;
+	/// Set when data specific to the most derived contract was queried while recording,
+	/// which makes the generated code unsuitable for reuse.
+	mutable bool m_recordingContextDependent = false;
 };
 
 }
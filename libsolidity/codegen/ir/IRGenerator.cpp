@@ -33,6 +33,8 @@
 #include <libyul/YulStack.h>
 #include <libyul/Utilities.h>
 
+#include <libevmasm/GasMeter.h>
+
 #include <libsolutil/Algorithms.h>
 #include <libsolutil/CommonData.h>
 #include <libsolutil/StringUtils.h>
@@ -40,6 +42,7 @@
 
 #include <json/json.h>
 
+#include <functional>
 #include <sstream>
 #include <variant>
 
@@ -258,6 +261,7 @@ InternalDispatchMap IRGenerator::generateInternalDispatchFunctions(ContractDefin
 	{
 		std::string funName = IRNames::internalDispatch(arity);
 		m_context.functionCollector().createFunction(funName, [&]() {
+			m_context.functionCollector().markCurrentFunctionContractSpecific();
 			Whiskers templ(R"(
 				<sourceLocationComment>
 				function <functionName>(fun<?+in>, <in></+in>) <?+out>-> <out></+out> {
@@ -317,7 +321,10 @@ InternalDispatchMap IRGenerator::generateInternalDispatchFunctions(ContractDefin
 std::string IRGenerator::generateFunction(FunctionDefinition const& _function)
 {
 	std::string functionName = IRNames::function(_function);
+	if (m_context.replayCachedFunction(_function))
+		return functionName;
 	return m_context.functionCollector().createFunction(functionName, [&]() {
+		m_context.functionCollector().markCurrentFunctionContractSpecific();
 		m_context.resetLocalVariables();
 		Whiskers t(R"(
 			<astIDComment><sourceLocationComment>
@@ -332,10 +339,14 @@ std::string IRGenerator::generateFunction(FunctionDefinition const& _function)
 			t("astIDComment", "/// @ast-id " + std::to_string(_function.id()) + "\n");
 		else
 			t("astIDComment", "");
+		// The most derived contract is fetched before the recording starts since the
+		// trailing location comment does not make the code contract-specific.
+		SourceLocation contractLocation = m_context.mostDerivedContract().location();
+		m_context.startFunctionBodyRecording();
 		t("sourceLocationComment", dispenseLocationComment(_function));
 		t(
 			"contractSourceLocationComment",
-			dispenseLocationComment(m_context.mostDerivedContract())
+			::dispenseLocationComment(contractLocation, m_context)
 		);
 
 		t("functionName", functionName);
@@ -377,7 +388,9 @@ std::string IRGenerator::generateFunction(FunctionDefinition const& _function)
 			// Now generate the actual inner function.
 			generateFunctionWithModifierInner(_function);
 		}
-		return t.render();
+		std::string code = t.render();
+		m_context.finishFunctionBodyRecording(_function, functionName);
+		return code;
 	});
 }
 
@@ -389,6 +402,7 @@ std::string IRGenerator::generateModifier(
 {
 	std::string functionName = IRNames::modifierInvocation(_modifierInvocation);
 	return m_context.functionCollector().createFunction(functionName, [&]() {
+		m_context.functionCollector().markCurrentFunctionContractSpecific();
 		m_context.resetLocalVariables();
 		Whiskers t(R"(
 			<astIDComment><sourceLocationComment>
@@ -481,6 +495,7 @@ std::string IRGenerator::generateFunctionWithModifierInner(FunctionDefinition co
 {
 	std::string functionName = IRNames::functionWithModifierInner(_function);
 	return m_context.functionCollector().createFunction(functionName, [&]() {
+		m_context.functionCollector().markCurrentFunctionContractSpecific();
 		m_context.resetLocalVariables();
 		Whiskers t(R"(
 			<sourceLocationComment>
@@ -521,6 +536,7 @@ std::string IRGenerator::generateGetter(VariableDeclaration const& _varDecl)
 {
 	std::string functionName = IRNames::function(_varDecl);
 	return m_context.functionCollector().createFunction(functionName, [&]() {
+		m_context.functionCollector().markCurrentFunctionContractSpecific();
 		Type const* type = _varDecl.annotation().type;
 
 		solAssert(_varDecl.isStateVariable(), "");
@@ -714,6 +730,7 @@ std::string IRGenerator::generateExternalFunction(ContractDefinition const& _con
 {
 	std::string functionName = IRNames::externalFunctionABIWrapper(_functionType.declaration());
 	return m_context.functionCollector().createFunction(functionName, [&](std::vector<std::string>&, std::vector<std::string>&) -> std::string {
+		m_context.functionCollector().markCurrentFunctionContractSpecific();
 		Whiskers t(R"X(
 			<callValueCheck>
 			<?+params>let <params> := </+params> <abiDecode>(4, calldatasize())
@@ -849,6 +866,7 @@ void IRGenerator::generateConstructors(ContractDefinition const& _contract)
 
 		m_context.resetLocalVariables();
 		m_context.functionCollector().createFunction(IRNames::constructor(*contract), [&]() {
+			m_context.functionCollector().markCurrentFunctionContractSpecific();
 			Whiskers t(R"(
 				<astIDComment><sourceLocationComment>
 				function <functionName>(<params><comma><baseParams>) {
@@ -980,24 +998,16 @@ std::string IRGenerator::callValueCheck()
 std::string IRGenerator::dispatchRoutine(ContractDefinition const& _contract)
 {
 	Whiskers t(R"X(
-		<?+cases>if iszero(lt(calldatasize(), 4))
+		<?+dispatch>if iszero(lt(calldatasize(), 4))
 		{
 			let selector := <shr224>(calldataload(0))
-			switch selector
-			<#cases>
-			case <functionSelector>
-			{
-				// <functionName>
-				<delegatecallCheck>
-				<externalFunction>()
-			}
-			</cases>
-			default {}
-		}</+cases>
+			<dispatch>
+		}</+dispatch>
 		<?+receiveEther>if iszero(calldatasize()) { <receiveEther> }</+receiveEther>
 		<fallback>
 	)X");
 	t("shr224", m_utils.shiftRightFunction(224));
+	// interfaceFunctions is ordered by selector, so the slices taken below are sorted ranges.
 	std::vector<std::map<std::string, std::string>> functions;
 	for (auto const& function: _contract.interfaceFunctions())
 	{
@@ -1022,7 +1032,56 @@ std::string IRGenerator::dispatchRoutine(ContractDefinition const& _contract)
 
 		templ["externalFunction"] = generateExternalFunction(_contract, *type);
 	}
-	t("cases", functions);
+
+	// A flat switch is lowered to a linear sequence of comparisons, so for many
+	// functions it pays off to narrow the selector range with a binary search
+	// first. Whether a range is worth splitting uses the same cost model as the
+	// legacy selector in ContractCompiler::appendInternalSelector: each split
+	// costs roughly 17 bytes of code and saves half of the remaining
+	// comparisons per call, so it is only profitable for frequently executed
+	// contracts with enough functions.
+	auto shouldSplitDispatch = [&](size_t _numCases) -> bool {
+		if (_numCases <= 4)
+			return false;
+		size_t runs = m_optimiserSettings.expectedExecutionsPerDeployment;
+		if (runs > (17 * evmasm::GasCosts::createDataGas) / 6)
+			return true;
+		return runs * 6 * (_numCases - 4) > 17 * evmasm::GasCosts::createDataGas;
+	};
+	std::function<std::string(size_t, size_t)> generateDispatch = [&](size_t _begin, size_t _end) -> std::string {
+		if (!shouldSplitDispatch(_end - _begin))
+		{
+			Whiskers leaf(R"X(
+				switch selector
+				<#cases>
+				case <functionSelector>
+				{
+					// <functionName>
+					<delegatecallCheck>
+					<externalFunction>()
+				}
+				</cases>
+				default {}
+			)X");
+			leaf("cases", std::vector<std::map<std::string, std::string>>(
+				functions.begin() + static_cast<ptrdiff_t>(_begin),
+				functions.begin() + static_cast<ptrdiff_t>(_end)
+			));
+			return leaf.render();
+		}
+		size_t pivotIndex = (_begin + _end) / 2;
+		Whiskers node(R"X(
+			switch lt(selector, <pivotSelector>)
+			case 0 { <greaterOrEqual> }
+			default { <less> }
+		)X");
+		node("pivotSelector", functions.at(pivotIndex).at("functionSelector"));
+		node("greaterOrEqual", generateDispatch(pivotIndex, _end));
+		node("less", generateDispatch(_begin, pivotIndex));
+		return node.render();
+	};
+	t("dispatch", functions.empty() ? "" : generateDispatch(0, functions.size()));
+
 	FunctionDefinition const* etherReceiver = _contract.receiveFunction();
 	if (etherReceiver)
 	{
@@ -1096,7 +1155,8 @@ void IRGenerator::resetContext(ContractDefinition const& _contract, ExecutionCon
 		m_context.revertStrings(),
 		m_context.sourceIndices(),
 		m_context.debugInfoSelection(),
-		m_context.soliditySourceProvider()
+		m_context.soliditySourceProvider(),
+		m_context.functionCache()
 	);
 	m_context = std::move(newContext);
 
@@ -53,7 +53,8 @@ public:
 		std::map<std::string, unsigned> _sourceIndices,
 		langutil::DebugInfoSelection const& _debugInfoSelection,
 		langutil::CharStreamProvider const* _soliditySourceProvider,
-		OptimiserSettings& _optimiserSettings
+		OptimiserSettings& _optimiserSettings,
+		std::shared_ptr<IRFunctionCache> _functionCache = {}
 	):
 		m_evmVersion(_evmVersion),
 		m_eofVersion(_eofVersion),
@@ -63,7 +64,8 @@ public:
 			_revertStrings,
 			std::move(_sourceIndices),
 			_debugInfoSelection,
-			_soliditySourceProvider
+			_soliditySourceProvider,
+			std::move(_functionCache)
 		),
 		m_utils(_evmVersion, m_context.revertStrings(), m_context.functionCollector()),
 		m_optimiserSettings(_optimiserSettings)
@@ -33,6 +33,13 @@ class ErrorReporter;
 namespace solidity::frontend::experimental
 {
 
+/// Entry point of the analysis phase of experimental Solidity.
+///
+/// Note for the upcoming stage framework: once analysis runs actual stages, their
+/// per-node results should be memoized keyed by a content hash of the node, so that
+/// recompilations and multi-contract compiles only re-analyze nodes that changed.
+/// Designing stages as pure node-to-annotation maps from the start keeps that possible;
+/// stages that need global context should declare it explicitly as part of the cache key.
 class Analysis
 {
 public:
@@ -47,11 +47,11 @@ std::pair<bool, ArraySlicePredicate::SliceData const&> ArraySlicePredicate::crea
 	smt::SymbolicIntVariable iVar{TypeProvider::uint256(), TypeProvider::uint256(), "i_" + tupleName, _context};
 
 	std::vector<SortPointer> domain{sort, sort, startVar.sort(), endVar.sort()};
-	auto sliceSort = std::make_shared<FunctionSort>(domain, SortProvider::boolSort);
+	auto sliceSort = SortProvider::functionSort(domain, SortProvider::boolSort);
 	Predicate const& slice = *Predicate::create(sliceSort, "array_slice_" + tupleName, PredicateType::Custom, _context);
 
 	domain.emplace_back(iVar.sort());
-	auto predSort = std::make_shared<FunctionSort>(domain, SortProvider::boolSort);
+	auto predSort = SortProvider::functionSort(domain, SortProvider::boolSort);
 	Predicate const& header = *Predicate::create(predSort, "array_slice_header_" + tupleName, PredicateType::Custom, _context);
 	Predicate const& loop = *Predicate::create(predSort, "array_slice_loop_" + tupleName, PredicateType::Custom, _context);
 
@@ -74,8 +74,10 @@ CHC::CHC(
 	solAssert(!_settings.printQuery || _settings.solvers == smtutil::SMTSolverChoice::SMTLIB2(), "Only SMTLib2 solver can be enabled to print queries");
 }
 
-void CHC::analyze(SourceUnit const& _source)
+void CHC::analyze(SourceUnit const& _source, std::map<ASTNode const*, std::set<VerificationTargetType>, smt::EncodingContext::IdCompare> _solvedTargets)
 {
+	m_solvedTargets = std::move(_solvedTargets);
+
 	// At this point every enabled solver is available.
 	if (!m_settings.solvers.eld && !m_settings.solvers.smtlib2 && !m_settings.solvers.z3)
 	{
@@ -1251,10 +1253,18 @@ void CHC::resetSourceAnalysis()
 	if (m_settings.solvers.z3)
 	{
 #ifdef HAVE_Z3
-		// z3::fixedpoint does not have a reset mechanism, so we need to create another.
-		m_interface = std::make_unique<Z3CHCInterface>(m_settings.timeout);
-		auto z3Interface = dynamic_cast<Z3CHCInterface const*>(m_interface.get());
+		// Reuse the warm z3 context of a previous analysis if there is one; only the rule
+		// system has to be rebuilt, since z3::fixedpoint cannot retract rules.
+		auto z3Interface = dynamic_cast<Z3CHCInterface*>(m_interface.get());
+		if (z3Interface)
+			z3Interface->reset();
+		else
+		{
+			m_interface = std::make_unique<Z3CHCInterface>(m_settings.timeout);
+			z3Interface = dynamic_cast<Z3CHCInterface*>(m_interface.get());
+		}
 		solAssert(z3Interface, "");
+		z3Interface->setCounterexampleGeneration(!m_settings.noCounterexamples);
 		m_context.setSolver(z3Interface->z3Interface());
 #else
 		solAssert(false);
@@ -1896,6 +1906,10 @@ std::tuple<CheckResult, smtutil::Expression, CHCSolverInterface::CexGraph> CHC::
 	{
 	case CheckResult::SATISFIABLE:
 	{
+		// If no counterexample will be reported, the incomplete-counterexample
+		// re-query below is pointless, so the verdict is returned right away.
+		if (m_settings.noCounterexamples)
+			break;
 	// We still need the ifdef because of Z3CHCInterface.
 		if (m_settings.solvers.z3)
 		{
@@ -1944,6 +1958,9 @@ void CHC::verificationTargetEncountered(
 	if (!m_settings.targets.has(_type))
 		return;
 
+	if (m_solvedTargets.count(_errorNode) && m_solvedTargets.at(_errorNode).count(_type))
+		return;
+
 	if (!(m_currentContract || m_currentFunction))
 		return;
 
@@ -2033,13 +2050,100 @@ void CHC::checkVerificationTargets()
 	}
 
 	std::set<unsigned> checkedErrorIds;
-	for (auto const& [targetId, placeholders]: targetEntryPoints)
+	auto* smtLibInterface = dynamic_cast<CHCSmtLib2Interface*>(m_interface.get());
+	if (smtLibInterface && targetEntryPoints.size() > 1)
+	{
+		// With an external Horn solver each target's query is an independent, self-contained
+		// SMT-LIB2 document once it has been encoded, so the solving can be parallelized.
+		// Encoding mutates the rule system and stays sequential; the results are processed
+		// in the original target order to keep the reports deterministic.
+		std::vector<std::string> queries;
+		std::vector<std::string> errorPredicateNames;
+		for (auto const& [targetId, placeholders]: targetEntryPoints)
+		{
+			auto const& target = m_verificationTargets.at(targetId);
+			createErrorBlock();
+			for (auto const& placeholder: placeholders)
+				connectBlocks(
+					placeholder.fromPredicate,
+					error(),
+					placeholder.constraints && placeholder.errorExpression == target.errorId
+				);
+			std::string query = smtLibInterface->dumpQuery(error());
+			if (m_settings.printQuery)
+				m_errorReporter.info(
+					2339_error,
+					"CHC: Requested query:\n" + query
+				);
+			queries.push_back(std::move(query));
+			errorPredicateNames.push_back(error().name);
+		}
+
+		auto results = smtLibInterface->parallelQuery(queries);
+
+		size_t index = 0;
+		for (auto const& [targetId, placeholders]: targetEntryPoints)
+		{
+			auto const& target = m_verificationTargets.at(targetId);
+			auto [errorType, errorReporterId] = targetDescription(target);
+			auto const& [result, invariant, model] = results.at(index);
+			if (result == CheckResult::ERROR)
+				m_errorReporter.warning(1218_error, target.errorNode->location(), "CHC: Error trying to invoke SMT solver.");
+			processCheckResult(
+				target,
+				errorReporterId,
+				errorType + " happens here.",
+				errorType + " might happen here.",
+				result,
+				invariant,
+				model,
+				errorPredicateNames.at(index)
+			);
+			checkedErrorIds.insert(target.errorId);
+			++index;
+		}
+	}
+	else
 	{
-		auto const& target = m_verificationTargets.at(targetId);
-		auto [errorType, errorReporterId] = targetDescription(target);
+		bool cheapPassDone = false;
+#ifdef HAVE_Z3
+		// With the timeout ladder, all targets are first queried with a small fraction
+		// of the configured budget and only the ones the solver gives up on are retried
+		// with the full budget. Most targets are solved within the cheap pass and it
+		// also warms up Spacer's lemma store for the retries.
+		if (m_settings.timeoutLadder)
+			if (auto* z3Interface = dynamic_cast<Z3CHCInterface*>(m_interface.get()))
+			{
+				z3Interface->setQueryBudgetDivisor(16);
+				for (auto const& [targetId, placeholders]: targetEntryPoints)
+				{
+					auto const& target = m_verificationTargets.at(targetId);
+					auto [errorType, errorReporterId] = targetDescription(target);
+					// The empty "unknown" message keeps targets the solver gives up on
+					// unreported; they are decided by the retry below.
+					checkAndReportTarget(target, placeholders, errorReporterId, errorType + " happens here.", "");
+				}
+				z3Interface->setQueryBudgetDivisor(1);
+				cheapPassDone = true;
+			}
+#endif
+		for (auto const& [targetId, placeholders]: targetEntryPoints)
+		{
+			auto const& target = m_verificationTargets.at(targetId);
+			if (
+				cheapPassDone &&
+				m_safeTargets.count(target.errorNode) &&
+				m_safeTargets.at(target.errorNode).count(target)
+			)
+			{
+				checkedErrorIds.insert(target.errorId);
+				continue;
+			}
+			auto [errorType, errorReporterId] = targetDescription(target);
 
-		checkAndReportTarget(target, placeholders, errorReporterId, errorType + " happens here.", errorType + " might happen here.");
-		checkedErrorIds.insert(target.errorId);
+			checkAndReportTarget(target, placeholders, errorReporterId, errorType + " happens here.", errorType + " might happen here.");
+			checkedErrorIds.insert(target.errorId);
+		}
 	}
 
 	auto toReport = m_unsafeTargets;
@@ -2166,24 +2270,46 @@ void CHC::checkAndReportTarget(
 			error(),
 			placeholder.constraints && placeholder.errorExpression == _target.errorId
 		);
+	auto [result, invariant, model] = query(error(), _target.errorNode->location());
+	processCheckResult(_target, _errorReporterId, std::move(_satMsg), std::move(_unknownMsg), result, invariant, model, error().name);
+}
+
+void CHC::processCheckResult(
+	CHCVerificationTarget const& _target,
+	ErrorId _errorReporterId,
+	std::string _satMsg,
+	std::string _unknownMsg,
+	CheckResult _result,
+	smtutil::Expression const& _invariant,
+	CHCSolverInterface::CexGraph const& _model,
+	std::string const& _errorPredicateName
+)
+{
+	if (m_unsafeTargets.count(_target.errorNode) && m_unsafeTargets.at(_target.errorNode).count(_target.type))
+		return;
+
 	auto const& location = _target.errorNode->location();
-	auto [result, invariant, model] = query(error(), location);
-	if (result == CheckResult::UNSATISFIABLE)
+	if (_result == CheckResult::UNSATISFIABLE)
 	{
 		m_safeTargets[_target.errorNode].insert(_target);
-		std::set<Predicate const*> predicates;
-		for (auto const* pred: m_interfaces | ranges::views::values)
-			predicates.insert(pred);
-		for (auto const* pred: m_nondetInterfaces | ranges::views::values)
-			predicates.insert(pred);
-		std::map<Predicate const*, std::set<std::string>> invariants = collectInvariants(invariant, predicates, m_settings.invariants);
-		for (auto pred: invariants | ranges::views::keys)
-			m_invariants[pred] += std::move(invariants.at(pred));
+		// Walking the inductive invariant proof is only worth it if invariants
+		// were requested to be reported.
+		if (!m_settings.invariants.invariants.empty())
+		{
+			std::set<Predicate const*> predicates;
+			for (auto const* pred: m_interfaces | ranges::views::values)
+				predicates.insert(pred);
+			for (auto const* pred: m_nondetInterfaces | ranges::views::values)
+				predicates.insert(pred);
+			std::map<Predicate const*, std::set<std::string>> invariants = collectInvariants(_invariant, predicates, m_settings.invariants);
+			for (auto pred: invariants | ranges::views::keys)
+				m_invariants[pred] += std::move(invariants.at(pred));
+		}
 	}
-	else if (result == CheckResult::SATISFIABLE)
+	else if (_result == CheckResult::SATISFIABLE)
 	{
 		solAssert(!_satMsg.empty(), "");
-		auto cex = generateCounterexample(model, error().name);
+		auto cex = generateCounterexample(_model, _errorPredicateName);
 		if (cex)
 			m_unsafeTargets[_target.errorNode][_target.type] = {
 				_errorReporterId,
@@ -64,7 +64,9 @@ public:
 		langutil::CharStreamProvider const& _charStreamProvider
 	);
 
-	void analyze(SourceUnit const& _sources);
+	/// @param _solvedTargets targets that have already been proved safe,
+	/// for example by the pre-analysis; no queries are created for them.
+	void analyze(SourceUnit const& _sources, std::map<ASTNode const*, std::set<VerificationTargetType>, smt::EncodingContext::IdCompare> _solvedTargets = {});
 
 	struct CHCVerificationTarget: VerificationTarget
 	{
@@ -299,6 +301,19 @@ private:
 		std::string _satMsg,
 		std::string _unknownMsg = ""
 	);
+	/// Records the outcome of a solved verification target, i.e. marks the target safe,
+	/// unsafe with a counterexample or unproved. Factored out of checkAndReportTarget so
+	/// that it can also process results of queries that were solved in parallel.
+	void processCheckResult(
+		CHCVerificationTarget const& _target,
+		langutil::ErrorId _errorReporterId,
+		std::string _satMsg,
+		std::string _unknownMsg,
+		smtutil::CheckResult _result,
+		smtutil::Expression const& _invariant,
+		smtutil::CHCSolverInterface::CexGraph const& _model,
+		std::string const& _errorPredicateName
+	);
 
 	std::pair<std::string, langutil::ErrorId> targetDescription(CHCVerificationTarget const& _target);
 
@@ -419,6 +434,8 @@ private:
 	std::map<ASTNode const*, std::vector<unsigned>, smt::EncodingContext::IdCompare> m_functionTargetIds;
 	/// Helper mapping unique IDs to actual verification targets.
 	std::map<unsigned, CHCVerificationTarget> m_verificationTargets;
+	/// Targets that were proved safe before the encoding and are not checked again.
+	std::map<ASTNode const*, std::set<VerificationTargetType>, smt::EncodingContext::IdCompare> m_solvedTargets;
 
 	/// Targets proved safe.
 	std::map<ASTNode const*, std::set<CHCVerificationTarget>, smt::EncodingContext::IdCompare> m_safeTargets;
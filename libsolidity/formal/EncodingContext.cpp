@@ -62,9 +62,35 @@ bool EncodingContext::createVariable(frontend::VariableDeclaration const& _varDe
 	auto const& type = _varDecl.type();
 	auto result = newSymbolicVariable(*type, _varDecl.name() + "_" + std::to_string(_varDecl.id()), *this);
 	m_variables.emplace(&_varDecl, result.second);
+	m_variableDeclarations.emplace(result.second.get(), &_varDecl);
+	m_variableIndices = m_variableIndices.set(&_varDecl, result.second->index());
 	return result.first;
 }
 
+void EncodingContext::restoreVariableIndices(VariableIndices const& _indices)
+{
+	// Collect first since setIndex feeds back into m_variableIndices.
+	std::vector<std::pair<frontend::VariableDeclaration const*, unsigned>> toRestore;
+	_indices.visitDifference(m_variableIndices, [&](
+		frontend::VariableDeclaration const* _decl,
+		unsigned const* _snapshotIndex,
+		unsigned const*
+	) {
+		// Variables created after the snapshot was taken keep their current index.
+		if (_snapshotIndex)
+			toRestore.emplace_back(_decl, *_snapshotIndex);
+	});
+	for (auto const& [decl, index]: toRestore)
+		m_variables.at(decl)->setIndex(index);
+}
+
+void EncodingContext::variableIndexChanged(SymbolicVariable const& _variable, unsigned _newIndex)
+{
+	auto it = m_variableDeclarations.find(&_variable);
+	if (it != m_variableDeclarations.end())
+		m_variableIndices = m_variableIndices.set(it->second, _newIndex);
+}
+
 bool EncodingContext::knownVariable(frontend::VariableDeclaration const& _varDecl)
 {
 	return m_variables.count(&_varDecl);
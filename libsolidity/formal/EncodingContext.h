@@ -23,7 +23,10 @@
 
 #include <libsmtutil/SolverInterface.h>
 
+#include <libsolutil/PersistentMap.h>
+
 #include <map>
+#include <unordered_map>
 
 namespace solidity::frontend::smt
 {
@@ -96,6 +99,17 @@ public:
 	///Resets all variables.
 	void resetAllVariables();
 
+	/// Snapshot of the current SSA indices of all program variables. Taking and
+	/// copying a snapshot is O(1); all snapshots share structure.
+	using VariableIndices = util::PersistentMap<frontend::VariableDeclaration const*, unsigned, IdCompare>;
+	VariableIndices variableIndices() const { return m_variableIndices; }
+	/// Restores the SSA indices of the program variables to @a _indices.
+	/// Linear in the number of variables whose index changed since the snapshot was
+	/// taken, not in the number of known variables.
+	void restoreVariableIndices(VariableIndices const& _indices);
+	/// Called by the symbolic variables whenever their SSA index changes.
+	void variableIndexChanged(SymbolicVariable const& _variable, unsigned _newIndex);
+
 	/// Allocates a new index for the declaration, updates the current
 	/// index to this value and returns the expression.
 	smtutil::Expression newValue(frontend::VariableDeclaration const& _decl);
@@ -158,6 +172,13 @@ private:
 	/// Symbolic variables.
 	std::map<frontend::VariableDeclaration const*, std::shared_ptr<SymbolicVariable>, IdCompare> m_variables;
 
+	/// Current SSA indices of the program variables, kept in sync by
+	/// variableIndexChanged() and handed out as O(1) snapshots.
+	VariableIndices m_variableIndices;
+	/// Maps the symbolic program variables back to their declarations; used to filter
+	/// index changes of expressions and global symbols out of m_variableIndices.
+	std::unordered_map<SymbolicVariable const*, frontend::VariableDeclaration const*> m_variableDeclarations;
+
 	/// Symbolic expressions.
 	std::map<frontend::Expression const*, std::shared_ptr<SymbolicVariable>, IdCompare> m_expressions;
 
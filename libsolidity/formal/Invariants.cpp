@@ -45,6 +45,9 @@ std::map<Predicate const*, std::set<std::string>> collectInvariants(
 	if (_invariantsSetting.has(InvariantType::Reentrancy))
 		targets.insert("nondet_interface_");
 
+	if (targets.empty())
+		return {};
+
 	std::map<std::string, std::pair<smtutil::Expression, smtutil::Expression>> equalities;
 	// Collect equalities where one of the sides is a predicate we're interested in.
 	util::BreadthFirstSearch<smtutil::Expression const*>{{&_proof}}.run([&](auto&& _expr, auto&& _addChild) {
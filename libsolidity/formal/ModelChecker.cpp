@@ -17,6 +17,9 @@
 // SPDX-License-Identifier: GPL-3.0
 
 #include <libsolidity/formal/ModelChecker.h>
+
+#include <libsolidity/formal/TargetPruner.h>
+
 #ifdef HAVE_Z3
 #include <libsmtutil/Z3Interface.h>
 #endif
@@ -121,10 +124,13 @@ void ModelChecker::analyze(SourceUnit const& _source)
 	if (m_settings.engine.none())
 		return;
 
-	if (m_settings.engine.chc)
-		m_chc.analyze(_source);
+	// Discharge targets provable by cheap interval reasoning over the AST
+	// before any of the engines encodes them.
+	std::map<ASTNode const*, std::set<VerificationTargetType>, smt::EncodingContext::IdCompare> solvedTargets =
+		smt::TargetPruner::run(_source);
 
-	std::map<ASTNode const*, std::set<VerificationTargetType>, smt::EncodingContext::IdCompare> solvedTargets;
+	if (m_settings.engine.chc)
+		m_chc.analyze(_source, solvedTargets);
 
 	for (auto const& [node, targets]: m_chc.safeTargets())
 		for (auto const& target: targets)
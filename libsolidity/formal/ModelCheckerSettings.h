@@ -169,6 +169,11 @@ struct ModelCheckerSettings
 	ModelCheckerEngine engine = ModelCheckerEngine::None();
 	ModelCheckerExtCalls externalCalls = {};
 	ModelCheckerInvariants invariants = ModelCheckerInvariants::Default();
+	/// If enabled, unsafe targets are reported with their verdict only and no
+	/// counterexample trace is reconstructed from the solver proof. This skips
+	/// the second, unoptimized solver run that is otherwise needed to obtain a
+	/// complete trace, which speeds up batch runs that only gate on safety.
+	bool noCounterexamples = false;
 	bool printQuery = false;
 	bool showProvedSafe = false;
 	bool showUnproved = false;
@@ -176,6 +181,11 @@ struct ModelCheckerSettings
 	smtutil::SMTSolverChoice solvers = smtutil::SMTSolverChoice::Z3();
 	ModelCheckerTargets targets = ModelCheckerTargets::Default();
 	std::optional<unsigned> timeout;
+	/// If enabled, every verification target is first queried with a small fraction
+	/// of the configured budget (timeout or resource limit) and only the targets the
+	/// solver gives up on are retried with the full budget.
+	/// Currently only used by the CHC engine with z3.
+	bool timeoutLadder = false;
 
 	bool operator!=(ModelCheckerSettings const& _other) const noexcept { return !(*this == _other); }
 	bool operator==(ModelCheckerSettings const& _other) const noexcept
@@ -187,13 +197,15 @@ struct ModelCheckerSettings
 			engine == _other.engine &&
 			externalCalls.mode == _other.externalCalls.mode &&
 			invariants == _other.invariants &&
+			noCounterexamples == _other.noCounterexamples &&
 			printQuery == _other.printQuery &&
 			showProvedSafe == _other.showProvedSafe &&
 			showUnproved == _other.showUnproved &&
 			showUnsupported == _other.showUnsupported &&
 			solvers == _other.solvers &&
 			targets == _other.targets &&
-			timeout == _other.timeout;
+			timeout == _other.timeout &&
+			timeoutLadder == _other.timeoutLadder;
 	}
 };
 
@@ -29,7 +29,7 @@ namespace solidity::frontend::smt
 
 SortPointer interfaceSort(ContractDefinition const& _contract, SymbolicState& _state)
 {
-	return std::make_shared<FunctionSort>(
+	return SortProvider::functionSort(
 		std::vector<SortPointer>{_state.thisAddressSort(), _state.abiSort(), _state.cryptoSort(), _state.stateSort()} + stateSorts(_contract),
 		SortProvider::boolSort
 	);
@@ -39,7 +39,7 @@ SortPointer nondetInterfaceSort(ContractDefinition const& _contract, SymbolicSta
 {
 	auto varSorts = stateSorts(_contract);
 	std::vector<SortPointer> stateSort{_state.stateSort()};
-	return std::make_shared<FunctionSort>(
+	return SortProvider::functionSort(
 		std::vector<SortPointer>{_state.errorFlagSort(), _state.thisAddressSort(), _state.abiSort(), _state.cryptoSort()} +
 			stateSort +
 			varSorts +
@@ -56,7 +56,7 @@ SortPointer constructorSort(ContractDefinition const& _contract, SymbolicState&
 
 	auto varSorts = stateSorts(_contract);
 	std::vector<SortPointer> stateSort{_state.stateSort()};
-	return std::make_shared<FunctionSort>(
+	return SortProvider::functionSort(
 		std::vector<SortPointer>{_state.errorFlagSort(), _state.thisAddressSort(), _state.abiSort(), _state.cryptoSort(), _state.txSort(), _state.stateSort(), _state.stateSort()} + varSorts + varSorts,
 		SortProvider::boolSort
 	);
@@ -68,7 +68,7 @@ SortPointer functionSort(FunctionDefinition const& _function, ContractDefinition
 	auto varSorts = _contract ? stateSorts(*_contract) : std::vector<SortPointer>{};
 	auto inputSorts = applyMap(_function.parameters(), smtSort);
 	auto outputSorts = applyMap(_function.returnParameters(), smtSort);
-	return std::make_shared<FunctionSort>(
+	return SortProvider::functionSort(
 		std::vector<SortPointer>{_state.errorFlagSort(), _state.thisAddressSort(), _state.abiSort(), _state.cryptoSort(), _state.txSort(), _state.stateSort()} +
 			varSorts +
 			inputSorts +
@@ -86,7 +86,7 @@ SortPointer functionBodySort(FunctionDefinition const& _function, ContractDefini
 	solAssert(fSort, "");
 
 	auto smtSort = [](auto _var) { return smt::smtSortAbstractFunction(*_var->type()); };
-	return std::make_shared<FunctionSort>(
+	return SortProvider::functionSort(
 		fSort->domain + applyMap(SMTEncoder::localVariablesIncludingModifiers(_function, _contract), smtSort),
 		SortProvider::boolSort
 	);
@@ -94,7 +94,7 @@ SortPointer functionBodySort(FunctionDefinition const& _function, ContractDefini
 
 SortPointer arity0FunctionSort()
 {
-	return std::make_shared<FunctionSort>(
+	return SortProvider::functionSort(
 		std::vector<SortPointer>(),
 		SortProvider::boolSort
 	);
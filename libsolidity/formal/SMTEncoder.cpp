@@ -2459,19 +2459,25 @@ Type const* SMTEncoder::typeWithoutPointer(Type const* _type)
 
 void SMTEncoder::mergeVariables(smtutil::Expression const& _condition, VariableIndices const& _indicesEndTrue, VariableIndices const& _indicesEndFalse)
 {
-	for (auto const& entry: _indicesEndTrue)
-	{
-		VariableDeclaration const* var = entry.first;
-		auto trueIndex = entry.second;
-		if (_indicesEndFalse.count(var) && _indicesEndFalse.at(var) != trueIndex)
-		{
-			m_context.addAssertion(m_context.newValue(*var) == smtutil::Expression::ite(
-				_condition,
-				valueAtIndex(*var, trueIndex),
-				valueAtIndex(*var, _indicesEndFalse.at(var)))
-			);
-		}
-	}
+	// Only the variables assigned in one of the branches differ between the
+	// snapshots; everything else is shared structure and skipped.
+	std::vector<std::tuple<VariableDeclaration const*, unsigned, unsigned>> divergent;
+	_indicesEndTrue.visitDifference(_indicesEndFalse, [&](
+		VariableDeclaration const* _var,
+		unsigned const* _trueIndex,
+		unsigned const* _falseIndex
+	) {
+		// A variable missing on one side was created in the other branch only
+		// and keeps its index, as before.
+		if (_trueIndex && _falseIndex)
+			divergent.emplace_back(_var, *_trueIndex, *_falseIndex);
+	});
+	for (auto const& [var, trueIndex, falseIndex]: divergent)
+		m_context.addAssertion(m_context.newValue(*var) == smtutil::Expression::ite(
+			_condition,
+			valueAtIndex(*var, trueIndex),
+			valueAtIndex(*var, falseIndex))
+		);
 }
 
 smtutil::Expression SMTEncoder::currentValue(VariableDeclaration const& _decl) const
@@ -2638,16 +2644,12 @@ ContractDefinition const* SMTEncoder::currentScopeContract()
 
 SMTEncoder::VariableIndices SMTEncoder::copyVariableIndices()
 {
-	VariableIndices indices;
-	for (auto const& var: m_context.variables())
-		indices.emplace(var.first, var.second->index());
-	return indices;
+	return m_context.variableIndices();
 }
 
 void SMTEncoder::resetVariableIndices(VariableIndices const& _indices)
 {
-	for (auto const& var: _indices)
-		m_context.variable(*var.first)->setIndex(var.second);
+	m_context.restoreVariableIndices(_indices);
 }
 
 void SMTEncoder::clearIndices(ContractDefinition const* _contract, FunctionDefinition const* _function)
@@ -303,8 +303,9 @@ protected:
 	/// Handles assignment of an expression to a tuple of variables.
 	void expressionToTupleAssignment(std::vector<std::shared_ptr<VariableDeclaration>> const& _variables, Expression const& _rhs);
 
-	/// Maps a variable to an SSA index.
-	using VariableIndices = std::unordered_map<VariableDeclaration const*, unsigned>;
+	/// Maps a variable to an SSA index. Snapshots share structure, so copying
+	/// the indices at a branch point is O(1).
+	using VariableIndices = smt::EncodingContext::VariableIndices;
 
 	/// Visits the branch given by the statement, pushes and pops the current path conditions.
 	/// @param _condition if present, asserts that this condition is true within the branch.
@@ -375,9 +376,11 @@ protected:
 	/// Add to the solver: the given expression implied by the current path conditions
 	void addPathImpliedExpression(smtutil::Expression const& _e);
 
-	/// Copy the SSA indices of m_variables.
+	/// Copy the SSA indices of m_variables. O(1), the copy shares structure
+	/// with the live indices.
 	VariableIndices copyVariableIndices();
-	/// Resets the variable indices.
+	/// Resets the variable indices. Only touches the variables whose index
+	/// changed since the copy was taken.
 	void resetVariableIndices(VariableIndices const& _indices);
 	/// Used when starting a new block.
 	virtual void clearIndices(ContractDefinition const* _contract, FunctionDefinition const* _function = nullptr);
@@ -63,7 +63,7 @@ SortPointer smtSort(frontend::Type const& _type)
 			returnSort = SortProvider::uintSort;
 		else
 			returnSort = smtSort(*returnTypes.front());
-		return std::make_shared<FunctionSort>(parameterSorts, returnSort);
+		return SortProvider::functionSort(std::move(parameterSorts), std::move(returnSort));
 	}
 	case Kind::Array:
 	{
@@ -72,13 +72,13 @@ SortPointer smtSort(frontend::Type const& _type)
 		{
 			auto mapType = dynamic_cast<frontend::MappingType const*>(&_type);
 			solAssert(mapType, "");
-			array = std::make_shared<ArraySort>(smtSortAbstractFunction(*mapType->keyType()), smtSortAbstractFunction(*mapType->valueType()));
+			array = SortProvider::arraySort(smtSortAbstractFunction(*mapType->keyType()), smtSortAbstractFunction(*mapType->valueType()));
 		}
 		else if (isStringLiteral(_type))
 		{
 			auto stringLitType = dynamic_cast<frontend::StringLiteralType const*>(&_type);
 			solAssert(stringLitType, "");
-			array = std::make_shared<ArraySort>(SortProvider::uintSort, SortProvider::uintSort);
+			array = SortProvider::arraySort(SortProvider::uintSort, SortProvider::uintSort);
 		}
 		else
 		{
@@ -91,7 +91,7 @@ SortPointer smtSort(frontend::Type const& _type)
 				solAssert(false, "");
 
 			solAssert(arrayType, "");
-			array = std::make_shared<ArraySort>(SortProvider::uintSort, smtSortAbstractFunction(*arrayType->baseType()));
+			array = SortProvider::arraySort(SortProvider::uintSort, smtSortAbstractFunction(*arrayType->baseType()));
 		}
 
 		std::string tupleName;
@@ -127,7 +127,7 @@ SortPointer smtSort(frontend::Type const& _type)
 
 		tupleName += "_tuple";
 
-		return std::make_shared<TupleSort>(
+		return SortProvider::tupleSort(
 			tupleName,
 			std::vector<std::string>{tupleName + "_accessor_array", tupleName + "_accessor_length"},
 			std::vector<SortPointer>{array, SortProvider::uintSort}
@@ -160,7 +160,7 @@ SortPointer smtSort(frontend::Type const& _type)
 		else
 			solAssert(false, "");
 
-		return std::make_shared<TupleSort>(tupleName, members, sorts);
+		return SortProvider::tupleSort(tupleName, std::move(members), std::move(sorts));
 	}
 	default:
 		// Abstract case.
@@ -483,7 +483,7 @@ smtutil::Expression zeroValue(frontend::Type const* _type)
 		{
 			auto tupleSort = std::dynamic_pointer_cast<TupleSort>(smtSort(*_type));
 			solAssert(tupleSort, "");
-			auto sortSort = std::make_shared<SortSort>(tupleSort->components.front());
+			auto sortSort = SortProvider::sortSort(tupleSort->components.front());
 
 			std::optional<smtutil::Expression> zeroArray;
 			auto length = bigint(0);
@@ -500,7 +500,7 @@ smtutil::Expression zeroValue(frontend::Type const* _type)
 
 			solAssert(zeroArray, "");
 			return smtutil::Expression::tuple_constructor(
-				smtutil::Expression(std::make_shared<SortSort>(tupleSort), tupleSort->name),
+				smtutil::Expression(SortProvider::sortSort(tupleSort), tupleSort->name),
 				std::vector<smtutil::Expression>{*zeroArray, length}
 			);
 
@@ -510,7 +510,7 @@ smtutil::Expression zeroValue(frontend::Type const* _type)
 			auto const* structType = dynamic_cast<StructType const*>(_type);
 			auto structSort = std::dynamic_pointer_cast<TupleSort>(smtSort(*_type));
 			return smtutil::Expression::tuple_constructor(
-				smtutil::Expression(std::make_shared<SortSort>(structSort), structSort->name),
+				smtutil::Expression(SortProvider::sortSort(structSort), structSort->name),
 				applyMap(
 					structType->structDefinition().members(),
 					[](auto var) { return zeroValue(var->type()); }
@@ -87,18 +87,21 @@ std::string SymbolicVariable::uniqueSymbol(unsigned _index) const
 smtutil::Expression SymbolicVariable::resetIndex()
 {
 	m_ssa->resetIndex();
+	m_context.variableIndexChanged(*this, m_ssa->index());
 	return currentValue();
 }
 
 smtutil::Expression SymbolicVariable::setIndex(unsigned _index)
 {
 	m_ssa->setIndex(_index);
+	m_context.variableIndexChanged(*this, m_ssa->index());
 	return currentValue();
 }
 
 smtutil::Expression SymbolicVariable::increaseIndex()
 {
 	++(*m_ssa);
+	m_context.variableIndexChanged(*this, m_ssa->index());
 	return currentValue();
 }
 
@@ -198,6 +201,7 @@ smtutil::Expression SymbolicFunctionVariable::setIndex(unsigned _index)
 smtutil::Expression SymbolicFunctionVariable::increaseIndex()
 {
 	++(*m_ssa);
+	m_context.variableIndexChanged(*this, m_ssa->index());
 	resetDeclaration();
 	m_abstract.increaseIndex();
 	return m_abstract.currentValue();
@@ -304,7 +308,7 @@ SymbolicArrayVariable::SymbolicArrayVariable(
 ):
 	SymbolicVariable(std::move(_sort), std::move(_uniqueName), _context),
 	m_pair(
-		std::make_shared<TupleSort>(
+		SortProvider::tupleSort(
 			"array_length_pair",
 			std::vector<std::string>{"array", "length"},
 			std::vector<SortPointer>{m_sort, SortProvider::uintSort}
@@ -0,0 +1,274 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolidity/formal/TargetPruner.h>
+
+#include <libsolidity/ast/AST.h>
+#include <libsolidity/ast/Types.h>
+
+#include <algorithm>
+
+using namespace solidity;
+using namespace solidity::langutil;
+using namespace solidity::frontend;
+using namespace solidity::frontend::smt;
+
+std::map<ASTNode const*, std::set<VerificationTargetType>, EncodingContext::IdCompare> TargetPruner::run(SourceUnit const& _source)
+{
+	TargetPruner pruner;
+	_source.accept(pruner);
+	return std::move(pruner.m_safeTargets);
+}
+
+void TargetPruner::endVisit(Literal const& _literal)
+{
+	if (_literal.token() == Token::TrueLiteral)
+		m_intervals[&_literal] = {1, 1};
+	else if (_literal.token() == Token::FalseLiteral)
+		m_intervals[&_literal] = {0, 0};
+	else if (auto const* rational = dynamic_cast<RationalNumberType const*>(_literal.annotation().type))
+		if (!rational->isFractional())
+		{
+			bigint value = rational->value().numerator();
+			m_intervals[&_literal] = {value, value};
+		}
+}
+
+void TargetPruner::endVisit(Identifier const& _identifier)
+{
+	// Non-constant variables implicitly get the full range of their type
+	// via intervalOf, which is sound without tracking assignments.
+	auto const* varDecl = dynamic_cast<VariableDeclaration const*>(_identifier.annotation().referencedDeclaration);
+	if (!varDecl || !varDecl->isConstant() || !varDecl->value())
+		return;
+	if (auto const* rational = dynamic_cast<RationalNumberType const*>(varDecl->value()->annotation().type))
+		if (!rational->isFractional())
+		{
+			bigint value = rational->value().numerator();
+			m_intervals[&_identifier] = {value, value};
+		}
+}
+
+void TargetPruner::endVisit(TupleExpression const& _tuple)
+{
+	if (_tuple.isInlineArray() || _tuple.components().size() != 1 || !_tuple.components().front())
+		return;
+	if (auto it = m_intervals.find(_tuple.components().front().get()); it != m_intervals.end())
+		m_intervals[&_tuple] = it->second;
+}
+
+void TargetPruner::endVisit(UnaryOperation const& _op)
+{
+	// Constant-folded expressions already carry their value in the type.
+	if (dynamic_cast<RationalNumberType const*>(_op.annotation().type))
+		return;
+
+	if (_op.getOperator() == Token::Not)
+	{
+		if (auto sub = intervalOf(_op.subExpression()); sub && sub->min == sub->max)
+			m_intervals[&_op] = {1 - sub->max, 1 - sub->min};
+		return;
+	}
+
+	if (_op.getOperator() != Token::Sub)
+		return;
+	auto sub = intervalOf(_op.subExpression());
+	auto bounds = typeInterval(_op.annotation().type);
+	if (!sub || !bounds)
+		return;
+
+	Interval negated{-sub->max, -sub->min};
+	if (negated.min >= bounds->min)
+		markSafe(_op, VerificationTargetType::Underflow);
+	if (negated.max <= bounds->max)
+		markSafe(_op, VerificationTargetType::Overflow);
+	if (negated.min >= bounds->min && negated.max <= bounds->max)
+		m_intervals[&_op] = negated;
+}
+
+void TargetPruner::endVisit(BinaryOperation const& _op)
+{
+	// Compile-time constant subexpressions are already folded by the type system.
+	if (auto const* rational = dynamic_cast<RationalNumberType const*>(_op.annotation().type))
+	{
+		if (!rational->isFractional())
+		{
+			bigint value = rational->value().numerator();
+			m_intervals[&_op] = {value, value};
+		}
+		return;
+	}
+
+	Token op = _op.getOperator();
+	auto left = intervalOf(_op.leftExpression());
+	auto right = intervalOf(_op.rightExpression());
+	if (!left || !right)
+		return;
+
+	if (TokenTraits::isCompareOp(op) || op == Token::And || op == Token::Or)
+	{
+		std::optional<bool> result;
+		switch (op)
+		{
+		case Token::LessThan:
+			if (left->max < right->min) result = true;
+			else if (left->min >= right->max) result = false;
+			break;
+		case Token::LessThanOrEqual:
+			if (left->max <= right->min) result = true;
+			else if (left->min > right->max) result = false;
+			break;
+		case Token::GreaterThan:
+			if (left->min > right->max) result = true;
+			else if (left->max <= right->min) result = false;
+			break;
+		case Token::GreaterThanOrEqual:
+			if (left->min >= right->max) result = true;
+			else if (left->max < right->min) result = false;
+			break;
+		case Token::Equal:
+			if (left->min == left->max && right->min == right->max && left->min == right->min) result = true;
+			else if (left->max < right->min || left->min > right->max) result = false;
+			break;
+		case Token::NotEqual:
+			if (left->max < right->min || left->min > right->max) result = true;
+			else if (left->min == left->max && right->min == right->max && left->min == right->min) result = false;
+			break;
+		case Token::And:
+			if (left->min == 1 && right->min == 1) result = true;
+			else if (left->max == 0 || right->max == 0) result = false;
+			break;
+		case Token::Or:
+			if (left->min == 1 || right->min == 1) result = true;
+			else if (left->max == 0 && right->max == 0) result = false;
+			break;
+		default:
+			break;
+		}
+		if (result)
+			m_intervals[&_op] = {*result ? 1 : 0, *result ? 1 : 0};
+		return;
+	}
+
+	if (!TokenTraits::isArithmeticOp(op))
+		return;
+
+	bool divisorNonZero = right->min > 0 || right->max < 0;
+	if ((op == Token::Div || op == Token::Mod) && divisorNonZero)
+		markSafe(_op, VerificationTargetType::DivByZero);
+
+	std::optional<Interval> result;
+	switch (op)
+	{
+	case Token::Add:
+		result = Interval{left->min + right->min, left->max + right->max};
+		break;
+	case Token::Sub:
+		result = Interval{left->min - right->max, left->max - right->min};
+		break;
+	case Token::Mul:
+	{
+		auto products = {
+			left->min * right->min,
+			left->min * right->max,
+			left->max * right->min,
+			left->max * right->max
+		};
+		result = Interval{std::min(products), std::max(products)};
+		break;
+	}
+	case Token::Div:
+		if (divisorNonZero)
+		{
+			// Truncating division is monotonic in the dividend and, on a
+			// sign-constant divisor range, bounded by the corner quotients.
+			auto quotients = {
+				left->min / right->min,
+				left->min / right->max,
+				left->max / right->min,
+				left->max / right->max
+			};
+			result = Interval{std::min(quotients), std::max(quotients)};
+		}
+		break;
+	case Token::Mod:
+		if (divisorNonZero)
+		{
+			// The result has the sign of the dividend and magnitude below |divisor|.
+			bigint bound = std::max(abs(right->min), abs(right->max)) - 1;
+			result = Interval{left->min < 0 ? bigint(-bound) : bigint(0), bound};
+		}
+		break;
+	default:
+		// Exponentiation and shifts are not worth the trouble here.
+		break;
+	}
+	if (!result)
+		return;
+
+	auto bounds = typeInterval(_op.annotation().commonType);
+	if (!bounds)
+		return;
+	if (result->min >= bounds->min)
+		markSafe(_op, VerificationTargetType::Underflow);
+	if (result->max <= bounds->max)
+		markSafe(_op, VerificationTargetType::Overflow);
+	// Outside the type range the value depends on checked/unchecked semantics,
+	// so only ranges that cannot wrap are propagated upwards.
+	if (result->min >= bounds->min && result->max <= bounds->max)
+		m_intervals[&_op] = *result;
+}
+
+void TargetPruner::endVisit(FunctionCall const& _funCall)
+{
+	auto const* functionType = dynamic_cast<FunctionType const*>(_funCall.expression().annotation().type);
+	if (!functionType || functionType->kind() != FunctionType::Kind::Assert)
+		return;
+	solAssert(_funCall.arguments().size() == 1, "");
+	if (auto condition = intervalOf(*_funCall.arguments().front()))
+		if (condition->min == 1)
+			markSafe(_funCall, VerificationTargetType::Assert);
+}
+
+std::optional<TargetPruner::Interval> TargetPruner::intervalOf(Expression const& _expr) const
+{
+	if (auto it = m_intervals.find(&_expr); it != m_intervals.end())
+		return it->second;
+	return typeInterval(_expr.annotation().type);
+}
+
+std::optional<TargetPruner::Interval> TargetPruner::typeInterval(frontend::Type const* _type)
+{
+	if (auto const* intType = dynamic_cast<IntegerType const*>(_type))
+		return Interval{intType->minValue(), intType->maxValue()};
+	if (auto const* rational = dynamic_cast<RationalNumberType const*>(_type))
+	{
+		if (rational->isFractional())
+			return std::nullopt;
+		bigint value = rational->value().numerator();
+		return Interval{value, value};
+	}
+	if (dynamic_cast<BoolType const*>(_type))
+		return Interval{0, 1};
+	return std::nullopt;
+}
+
+void TargetPruner::markSafe(ASTNode const& _node, VerificationTargetType _type)
+{
+	m_safeTargets[&_node].insert(_type);
+}
@@ -0,0 +1,82 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#pragma once
+
+#include <libsolidity/formal/EncodingContext.h>
+#include <libsolidity/formal/ModelCheckerSettings.h>
+
+#include <libsolidity/ast/ASTVisitor.h>
+
+#include <libsolutil/Numeric.h>
+
+#include <map>
+#include <optional>
+#include <set>
+
+namespace solidity::frontend::smt
+{
+
+/**
+ * Cheap flow-insensitive interval analysis over the typed AST that discharges
+ * verification targets provable from type bounds and compile-time constants
+ * alone, so that the solver-backed engines never encode queries for them.
+ * The analysis is purely bottom-up: leaves contribute either their exact
+ * constant value or the full range of their type, which makes every derived
+ * interval a sound over-approximation regardless of control flow.
+ */
+class TargetPruner: private ASTConstVisitor
+{
+public:
+	/// Analyzes @a _source and @returns the verification targets that are
+	/// provably safe, keyed by AST node and target type in the same way the
+	/// engines share solved targets.
+	static std::map<ASTNode const*, std::set<VerificationTargetType>, EncodingContext::IdCompare> run(SourceUnit const& _source);
+
+private:
+	/// Inclusive range of values an expression can evaluate to.
+	/// Booleans are represented as 0 (false) and 1 (true).
+	struct Interval
+	{
+		bigint min;
+		bigint max;
+	};
+
+	void endVisit(Literal const& _literal) override;
+	void endVisit(Identifier const& _identifier) override;
+	void endVisit(TupleExpression const& _tuple) override;
+	void endVisit(UnaryOperation const& _op) override;
+	void endVisit(BinaryOperation const& _op) override;
+	void endVisit(FunctionCall const& _funCall) override;
+
+	/// @returns the interval computed for @a _expr, falling back to the full
+	/// range of its type, or nullopt if the type has no known finite bounds.
+	std::optional<Interval> intervalOf(Expression const& _expr) const;
+	/// @returns the full value range of @a _type if it is finite.
+	static std::optional<Interval> typeInterval(frontend::Type const* _type);
+
+	/// Records that the target of @a _type at @a _node cannot fail.
+	void markSafe(ASTNode const& _node, VerificationTargetType _type);
+
+	/// Intervals of the subexpressions known to be tighter than their type range.
+	std::map<Expression const*, Interval, EncodingContext::IdCompare> m_intervals;
+	/// Targets proved safe so far.
+	std::map<ASTNode const*, std::set<VerificationTargetType>, EncodingContext::IdCompare> m_safeTargets;
+};
+
+}
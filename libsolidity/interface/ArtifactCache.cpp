@@ -0,0 +1,94 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Content-addressed on-disk cache for standard JSON compiler outputs.
+ */
+
+#include <libsolidity/interface/ArtifactCache.h>
+#include <libsolidity/interface/Version.h>
+
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/JSON.h>
+#include <libsolutil/Keccak256.h>
+
+#include <fstream>
+
+using namespace std::string_literals;
+using namespace solidity;
+using namespace solidity::frontend;
+using namespace solidity::util;
+
+ArtifactCache::ArtifactCache(boost::filesystem::path _directory):
+	m_directory(std::move(_directory))
+{
+	boost::system::error_code ignored;
+	boost::filesystem::create_directories(m_directory, ignored);
+}
+
+h256 ArtifactCache::computeKey(Json::Value const& _input)
+{
+	return keccak256(VersionStringStrict + "\0"s + jsonCompactPrint(_input));
+}
+
+std::optional<Json::Value> ArtifactCache::lookup(h256 const& _key) const
+{
+	boost::filesystem::path path = entryPath(_key);
+	boost::system::error_code errorCode;
+	if (!boost::filesystem::is_regular_file(path, errorCode))
+		return std::nullopt;
+	try
+	{
+		Json::Value output;
+		if (jsonParseStrict(readFileAsString(path), output) && output.isObject())
+			return output;
+	}
+	catch (...)
+	{
+		// A corrupted or unreadable entry counts as a cache miss.
+	}
+	return std::nullopt;
+}
+
+void ArtifactCache::store(h256 const& _key, Json::Value const& _output) const
+{
+	boost::filesystem::path path = entryPath(_key);
+	boost::filesystem::path temporaryPath = path;
+	temporaryPath += ".tmp";
+	try
+	{
+		{
+			std::ofstream file(temporaryPath.string(), std::ios::trunc | std::ios::binary);
+			file << jsonCompactPrint(_output);
+			if (!file)
+				return;
+		}
+		// Renaming makes the entry visible atomically so that concurrent
+		// compiler processes never observe partially written files.
+		boost::system::error_code ignored;
+		boost::filesystem::rename(temporaryPath, path, ignored);
+	}
+	catch (...)
+	{
+		// Failing to store an entry only costs a future recompilation.
+	}
+}
+
+boost::filesystem::path ArtifactCache::entryPath(h256 const& _key) const
+{
+	return m_directory / (_key.hex() + ".json");
+}
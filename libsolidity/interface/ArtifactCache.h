@@ -0,0 +1,66 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Content-addressed on-disk cache for standard JSON compiler outputs.
+ */
+
+#pragma once
+
+#include <libsolutil/FixedHash.h>
+
+#include <json/json.h>
+
+#include <boost/filesystem.hpp>
+
+#include <optional>
+
+namespace solidity::frontend
+{
+
+/**
+ * Content-addressed on-disk cache for standard JSON compiler outputs.
+ *
+ * Entries are keyed by the hash of the full standard JSON input (which covers the source
+ * contents, all compiler settings and the targeted EVM version) combined with the compiler
+ * version, so a cache directory can be shared between runs and between different compiler
+ * binaries - upgrading the compiler invalidates all entries automatically.
+ */
+class ArtifactCache
+{
+public:
+	/// Creates the cache rooted at @a _directory, creating the directory if necessary.
+	explicit ArtifactCache(boost::filesystem::path _directory);
+
+	/// @returns the key identifying the output for @a _input under the current compiler version.
+	static util::h256 computeKey(Json::Value const& _input);
+
+	/// @returns the cached output for @a _key or nullopt if no valid entry exists.
+	std::optional<Json::Value> lookup(util::h256 const& _key) const;
+
+	/// Stores @a _output as the result for @a _key.
+	/// Failures (e.g. an unwritable cache directory) are silently ignored -
+	/// the cache is strictly an optimization.
+	void store(util::h256 const& _key, Json::Value const& _output) const;
+
+private:
+	boost::filesystem::path entryPath(util::h256 const& _key) const;
+
+	boost::filesystem::path m_directory;
+};
+
+}
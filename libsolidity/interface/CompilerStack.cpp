@@ -45,11 +45,14 @@
 #include <libsolidity/analysis/ImmutableValidator.h>
 
 #include <libsolidity/ast/AST.h>
+#include <libsolidity/ast/ASTUtils.h>
+#include <libsolidity/ast/ASTVisitor.h>
 #include <libsolidity/ast/TypeProvider.h>
 #include <libsolidity/ast/ASTJsonImporter.h>
 #include <libsolidity/codegen/Compiler.h>
 #include <libsolidity/formal/ModelChecker.h>
 #include <libsolidity/interface/ABI.h>
+#include <libsolidity/interface/ArtifactCache.h>
 #include <libsolidity/interface/Natspec.h>
 #include <libsolidity/interface/GasEstimator.h>
 #include <libsolidity/interface/StorageLayout.h>
@@ -76,6 +79,7 @@
 #include <liblangutil/SourceReferenceFormatter.h>
 
 
+#include <libsolutil/Common.h>
 #include <libsolutil/SwarmHash.h>
 #include <libsolutil/IpfsHash.h>
 #include <libsolutil/JSON.h>
@@ -91,10 +95,12 @@
 
 #include <fmt/format.h>
 
+#include <atomic>
 #include <utility>
 #include <map>
 #include <limits>
 #include <string>
+#include <thread>
 
 using namespace solidity;
 using namespace solidity::langutil;
@@ -103,6 +109,44 @@ using namespace solidity::stdlib;
 using namespace solidity::yul;
 using namespace std::string_literals;
 
+namespace
+{
+
+/// Process-wide cache of contract interface outputs (ABI and Natspec), keyed by a hash of all
+/// sources and the requested component. These outputs are deterministic and independent of the
+/// compiler settings, so long-lived processes can reuse them across compilations. The entries
+/// are small and never evicted.
+class InterfaceOutputCache
+{
+public:
+	static InterfaceOutputCache& instance()
+	{
+		static InterfaceOutputCache cache;
+		return cache;
+	}
+
+	std::optional<Json::Value> lookup(util::h256 const& _key)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto it = m_entries.find(_key);
+		if (it == m_entries.end())
+			return std::nullopt;
+		return it->second;
+	}
+
+	void store(util::h256 const& _key, Json::Value const& _value)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_entries[_key] = _value;
+	}
+
+private:
+	std::mutex m_mutex;
+	std::map<util::h256, Json::Value> m_entries;
+};
+
+}
+
 using solidity::util::errinfo_comment;
 
 static int g_compilerStackCounts = 0;
@@ -135,13 +179,17 @@ void CompilerStack::createAndAssignCallGraphs()
 			ContractDefinitionAnnotation& annotation =
 				m_contracts.at(contract->fullyQualifiedName()).contract->annotation();
 
+			// Both graphs mostly reach the same function bodies, so share the body
+			// summaries between the two builds to avoid traversing them twice.
+			FunctionCallGraphBuilder::BodySummaries bodySummaries;
 			annotation.creationCallGraph = std::make_unique<CallGraph>(
-				FunctionCallGraphBuilder::buildCreationGraph(*contract)
+				FunctionCallGraphBuilder::buildCreationGraph(*contract, &bodySummaries)
 			);
 			annotation.deployedCallGraph = std::make_unique<CallGraph>(
 				FunctionCallGraphBuilder::buildDeployedGraph(
 					*contract,
-					**annotation.creationCallGraph
+					**annotation.creationCallGraph,
+					&bodySummaries
 				)
 			);
 
@@ -227,6 +275,13 @@ void CompilerStack::setViaIR(bool _viaIR)
 	m_viaIR = _viaIR;
 }
 
+void CompilerStack::setEagerNatspecAnalysis(bool _eager)
+{
+	if (m_stackState >= ParsedAndImported)
+		solThrow(CompilerError, "Must set natspec analysis mode before parsing.");
+	m_eagerNatspecAnalysis = _eager;
+}
+
 void CompilerStack::setEVMVersion(langutil::EVMVersion _version)
 {
 	if (m_stackState >= ParsedAndImported)
@@ -310,6 +365,8 @@ void CompilerStack::addSMTLib2Response(h256 const& _hash, std::string const& _re
 void CompilerStack::reset(bool _keepSettings)
 {
 	m_stackState = Empty;
+	// Destroying the ASTs held by the sources returns their arenas to m_astArenaPool,
+	// which is kept across resets so that the next compilation reuses the memory.
 	m_sources.clear();
 	m_smtlib2Responses.clear();
 	m_unhandledSMTLib2Queries.clear();
@@ -321,6 +378,9 @@ void CompilerStack::reset(bool _keepSettings)
 		m_evmVersion = langutil::EVMVersion();
 		m_modelCheckerSettings = ModelCheckerSettings{};
 		m_generateIR = false;
+		m_generateIROptimized = true;
+		m_eagerNatspecAnalysis = true;
+		m_compilationJobs = 1;
 		m_revertStrings = RevertStrings::Default;
 		m_optimiserSettings = OptimiserSettings::minimal();
 		m_metadataLiteralSources = false;
@@ -328,10 +388,18 @@ void CompilerStack::reset(bool _keepSettings)
 		m_metadataHash = MetadataHash::IPFS;
 		m_stopAfter = State::CompilationSuccessful;
 	}
+	m_docStringAnalysisDone = false;
 	m_experimentalAnalysis.reset();
 	m_globalContext.reset();
 	m_sourceOrder.clear();
 	m_contracts.clear();
+	m_irFunctionCache.reset();
+	m_lowLevelFunctionCache.reset();
+	m_sourcesHash.reset();
+	for (std::optional<Json::Value>& settings: m_metadataSettingsCache)
+		settings.reset();
+	// The cached values point into the TypeProvider, which is reset below.
+	m_constantEvaluatorCache.clear();
 	m_errorReporter.clear();
 	TypeProvider::reset();
 }
@@ -342,36 +410,127 @@ void CompilerStack::setSources(StringMap _sources)
 		solThrow(CompilerError, "Cannot change sources once set.");
 	if (m_stackState != Empty)
 		solThrow(CompilerError, "Must set sources before parsing.");
-	for (auto source: _sources)
+	for (auto& source: _sources)
 		m_sources[source.first].charStream = std::make_unique<CharStream>(/*content*/std::move(source.second), /*name*/source.first);
 	m_stackState = SourcesSet;
 }
 
+void CompilerStack::setSources(std::map<std::string, std::shared_ptr<CharStream>> _sources)
+{
+	if (m_stackState == SourcesSet)
+		solThrow(CompilerError, "Cannot change sources once set.");
+	if (m_stackState != Empty)
+		solThrow(CompilerError, "Must set sources before parsing.");
+	for (auto& source: _sources)
+		m_sources[source.first].charStream = std::move(source.second);
+	m_stackState = SourcesSet;
+}
+
 bool CompilerStack::parse()
 {
 	if (m_stackState != SourcesSet)
 		solThrow(CompilerError, "Must call parse only after the SourcesSet state.");
+	m_cancellationToken.throwIfCancelled();
 	m_errorReporter.clear();
 
 	if (SemVerVersion{std::string(VersionString)}.isPrerelease())
 		m_errorReporter.warning(3805_error, "This is a pre-release compiler version, please do not use it in production.");
 
-	Parser parser{m_errorReporter, m_evmVersion};
-
 	std::vector<std::string> sourcesToParse;
 	for (auto const& s: m_sources)
 		sourcesToParse.push_back(s.first);
 
-	for (size_t i = 0; i < sourcesToParse.size(); ++i)
+	// Number of node IDs consumed by the sources parsed so far. Each source is parsed by its
+	// own parser numbering its nodes from one, so the IDs have to be shifted afterwards to
+	// stay unique for the whole compilation run. Shifting the nodes of each source in parse
+	// order by the IDs the previous sources consumed yields exactly the IDs a single parser
+	// shared by all sources would have assigned.
+	int64_t usedNodeIDs = 0;
+
+	// Sources can import sources that are not known yet, so parsing proceeds in waves:
+	// All currently known unparsed sources are parsed concurrently and the imports
+	// discovered in them are resolved sequentially, forming the next wave.
+	for (size_t waveStart = 0; waveStart < sourcesToParse.size();)
 	{
-		std::string const& path = sourcesToParse[i];
-		Source& source = m_sources[path];
-		source.ast = parser.parse(*source.charStream);
-		if (!source.ast)
-			solAssert(Error::containsErrors(m_errorReporter.errors()), "Parser returned null but did not report error.");
+		size_t waveSize = sourcesToParse.size() - waveStart;
+		ShardedErrorReporter waveErrors{m_errorReporter, waveSize};
+		std::vector<int64_t> consumedNodeIDs(waveSize);
+		// Imports of this wave that have to be loaded through the read callback,
+		// grouped by the source that first requested them.
+		std::vector<std::vector<std::pair<ImportDirective const*, std::string>>> waveImports;
+		std::set<std::string> scheduledImports;
+
+		auto parseSource = [&](size_t _index) {
+			Parser parser{waveErrors.reporter(_index), m_evmVersion, &m_astArenaPool};
+			Source& source = m_sources.at(sourcesToParse[waveStart + _index]);
+			source.ast = parser.parse(*source.charStream);
+			consumedNodeIDs[_index] = parser.maxUsedNodeID();
+		};
+
+		unsigned jobs = std::min<unsigned>(m_compilationJobs, static_cast<unsigned>(waveSize));
+		if (jobs <= 1)
+			for (size_t index = 0; index < waveSize; ++index)
+				parseSource(index);
 		else
 		{
+			std::atomic<size_t> nextSource{0};
+			std::mutex exceptionMutex;
+			std::exception_ptr workerException;
+
+			auto work = [&]() {
+				while (true)
+				{
+					size_t index = nextSource.fetch_add(1);
+					if (index >= waveSize)
+						break;
+					try
+					{
+						parseSource(index);
+					}
+					catch (...)
+					{
+						std::lock_guard<std::mutex> lock(exceptionMutex);
+						if (!workerException)
+							workerException = std::current_exception();
+						// Let the remaining workers drain the queue without starting new sources.
+						nextSource.store(waveSize);
+						break;
+					}
+				}
+			};
+
+			std::vector<std::thread> threads;
+			for (unsigned i = 1; i < jobs; ++i)
+				threads.emplace_back(work);
+			work();
+			for (std::thread& thread: threads)
+				thread.join();
+
+			if (workerException)
+				std::rethrow_exception(workerException);
+		}
+
+		// Merge the results in parse order. Imports appended to @a sourcesToParse here are
+		// parsed in the next wave.
+		waveErrors.merge();
+		for (size_t index = 0; index < waveSize; ++index)
+		{
+			// Take a copy, since resolving imports can grow @a sourcesToParse.
+			std::string const path = sourcesToParse[waveStart + index];
+			Source& source = m_sources[path];
+			if (source.ast && usedNodeIDs != 0)
+				shiftNodeIDs(*source.ast, usedNodeIDs);
+			// IDs assigned while parsing a source count as consumed even if the parse failed,
+			// so that the IDs of the remaining sources do not depend on the failure.
+			usedNodeIDs += consumedNodeIDs[index];
+			if (!source.ast)
+			{
+				solAssert(Error::containsErrors(waveErrors.errors(index)), "Parser returned null but did not report error.");
+				continue;
+			}
+
 			source.ast->annotation().path = path;
+			waveImports.emplace_back();
 
 			for (auto const& import: ASTNode::filteredNodes<ImportDirective>(source.ast->nodes()))
 			{
@@ -393,17 +552,59 @@ bool CompilerStack::parse()
 					import->path(),
 					path
 				), path);
+
+				if (m_stopAfter >= ParsedAndImported)
+				{
+					std::string const& importPath = *import->annotation().absolutePath;
+					if (!m_sources.count(importPath) && scheduledImports.insert(importPath).second)
+						waveImports.back().emplace_back(import, importPath);
+				}
 			}
+		}
 
-			if (m_stopAfter >= ParsedAndImported)
-				for (auto const& newSource: loadMissingSources(*source.ast))
+		if (m_stopAfter >= ParsedAndImported)
+		{
+			// Issue all callback reads of the wave at once, so that the latency of
+			// callbacks that fetch sources from disk or network overlaps.
+			std::vector<std::string> importPaths;
+			for (auto const& imports: waveImports)
+				for (auto const& importAndPath: imports)
+					importPaths.push_back(importAndPath.second);
+			std::vector<ReadCallback::Result> results = readSourceFiles(importPaths);
+
+			try
+			{
+				size_t resultIndex = 0;
+				for (auto const& imports: waveImports)
 				{
-					std::string const& newPath = newSource.first;
-					std::string const& newContents = newSource.second;
-					m_sources[newPath].charStream = std::make_shared<CharStream>(newContents, newPath);
-					sourcesToParse.push_back(newPath);
+					StringMap newSources;
+					for (auto const& [import, importPath]: imports)
+					{
+						ReadCallback::Result& result = results[resultIndex++];
+						if (result.success)
+							newSources[importPath] = std::move(result.responseOrErrorMessage);
+						else
+							m_errorReporter.parserError(
+								6275_error,
+								import->location(),
+								std::string("Source \"" + importPath + "\" not found: " + result.responseOrErrorMessage)
+							);
+					}
+					for (auto& newSource: newSources)
+					{
+						std::string const& newPath = newSource.first;
+						m_sources[newPath].charStream = std::make_shared<CharStream>(std::move(newSource.second), newPath);
+						sourcesToParse.push_back(newPath);
+					}
 				}
+			}
+			catch (FatalError const&)
+			{
+				solAssert(m_errorReporter.hasErrors(), "");
+			}
 		}
+
+		waveStart += waveSize;
 	}
 
 	if (Error::containsErrors(m_errorReporter.errors()))
@@ -441,6 +642,7 @@ bool CompilerStack::analyze()
 {
 	if (m_stackState != ParsedAndImported)
 		solThrow(CompilerError, "Must call analyze only after parsing was successful.");
+	m_cancellationToken.throwIfCancelled();
 
 	if (!resolveImports())
 		return false;
@@ -513,7 +715,7 @@ bool CompilerStack::analyzeLegacy(bool _noErrorsSoFar)
 {
 	bool noErrors = _noErrorsSoFar;
 
-	DeclarationTypeChecker declarationTypeChecker(m_errorReporter, m_evmVersion);
+	DeclarationTypeChecker declarationTypeChecker(m_errorReporter, m_evmVersion, &m_constantEvaluatorCache);
 	for (Source const* source: m_sourceOrder)
 		if (source->ast && !declarationTypeChecker.check(*source->ast))
 			return false;
@@ -537,6 +739,8 @@ bool CompilerStack::analyzeLegacy(bool _noErrorsSoFar)
 	// Now we run full type checks that go down to the expression level. This
 	// cannot be done earlier, because we need cross-contract types and information
 	// about whether a contract is abstract for the `new` expression.
+	m_cancellationToken.throwIfCancelled();
+
 	// This populates the `type` annotation for all expressions.
 	//
 	// Note: this does not resolve overloaded functions. In order to do that, types of arguments are needed,
@@ -548,21 +752,49 @@ bool CompilerStack::analyzeLegacy(bool _noErrorsSoFar)
 
 	if (noErrors)
 	{
-		// Requires ContractLevelChecker and TypeChecker
-		DocStringAnalyser docStringAnalyser(m_errorReporter);
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !docStringAnalyser.analyseDocStrings(*source->ast))
-				noErrors = false;
-	}
+		if (m_eagerNatspecAnalysis)
+		{
+			// The docstring analysis (requires ContractLevelChecker and TypeChecker) and the
+			// checks that can only be done when all types of all AST nodes are known are
+			// independent of each other, so they share a single AST traversal. Each pass uses
+			// its own error list to keep the diagnostics in the order the former separate
+			// traversals produced, and the post type check diagnostics are dropped if the
+			// docstring analysis failed, as before.
+			ErrorList docStringErrors;
+			ErrorReporter docStringErrorReporter(docStringErrors);
+			DocStringAnalyser docStringAnalyser(docStringErrorReporter);
+
+			ErrorList postTypeErrors;
+			ErrorReporter postTypeErrorReporter(postTypeErrors);
+			PostTypeChecker postTypeChecker(postTypeErrorReporter);
 
-	if (noErrors)
-	{
-		// Checks that can only be done when all types of all AST nodes are known.
-		PostTypeChecker postTypeChecker(m_errorReporter);
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !postTypeChecker.check(*source->ast))
-				noErrors = false;
-		if (!postTypeChecker.finalize())
+			{
+				ScopeGuard mergeErrors([&]() {
+					m_errorReporter.append(docStringErrors);
+					if (!Error::containsErrors(docStringErrors))
+						m_errorReporter.append(postTypeErrors);
+				});
+				CombinedASTConstVisitor combinedVisitor({&docStringAnalyser, &postTypeChecker});
+				for (Source const* source: m_sourceOrder)
+					if (source->ast)
+						source->ast->accept(combinedVisitor);
+				postTypeChecker.finalize();
+			}
+
+			m_docStringAnalysisDone = true;
+		}
+		else
+		{
+			// The docstring analysis only matters for natspec outputs and was deferred;
+			// it runs on demand via ensureDocStringAnalysis() instead.
+			PostTypeChecker postTypeChecker(m_errorReporter);
+			for (Source const* source: m_sourceOrder)
+				if (source->ast)
+					postTypeChecker.check(*source->ast);
+			postTypeChecker.finalize();
+		}
+
+		if (Error::containsErrors(m_errorReporter.errors()))
 			noErrors = false;
 	}
 
@@ -602,7 +834,7 @@ bool CompilerStack::analyzeLegacy(bool _noErrorsSoFar)
 			ControlFlowRevertPruner pruner(cfg);
 			pruner.run();
 
-			ControlFlowAnalyzer controlFlowAnalyzer(cfg, m_errorReporter);
+			ControlFlowAnalyzer controlFlowAnalyzer(cfg, m_errorReporter, m_compilationJobs);
 			if (!controlFlowAnalyzer.run())
 				noErrors = false;
 		}
@@ -610,22 +842,35 @@ bool CompilerStack::analyzeLegacy(bool _noErrorsSoFar)
 
 	if (noErrors)
 	{
-		// Checks for common mistakes. Only generates warnings.
-		StaticAnalyzer staticAnalyzer(m_errorReporter);
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !staticAnalyzer.analyze(*source->ast))
-				noErrors = false;
-	}
+		// The checks for common mistakes (which only generate warnings) and the state
+		// mutability checks for every function both only read the typed AST, so they
+		// share a single traversal in the same way as the docstring analysis and the
+		// post type checks above.
+		ErrorList staticAnalysisErrors;
+		ErrorReporter staticAnalysisErrorReporter(staticAnalysisErrors);
+		StaticAnalyzer staticAnalyzer(staticAnalysisErrorReporter, &m_constantEvaluatorCache);
 
-	if (noErrors)
-	{
-		// Check for state mutability in every function.
 		std::vector<ASTPointer<ASTNode>> ast;
 		for (Source const* source: m_sourceOrder)
 			if (source->ast)
 				ast.push_back(source->ast);
+		ErrorList viewPureErrors;
+		ErrorReporter viewPureErrorReporter(viewPureErrors);
+		ViewPureChecker viewPureChecker(ast, viewPureErrorReporter);
 
-		if (!ViewPureChecker(ast, m_errorReporter).check())
+		{
+			ScopeGuard mergeErrors([&]() {
+				m_errorReporter.append(staticAnalysisErrors);
+				if (!Error::containsErrors(staticAnalysisErrors))
+					m_errorReporter.append(viewPureErrors);
+			});
+			CombinedASTConstVisitor combinedVisitor({&staticAnalyzer, &viewPureChecker});
+			for (Source const* source: m_sourceOrder)
+				if (source->ast)
+					source->ast->accept(combinedVisitor);
+		}
+
+		if (Error::containsErrors(m_errorReporter.errors()))
 			noErrors = false;
 	}
 
@@ -714,58 +959,64 @@ bool CompilerStack::compile(State _stopAfter)
 	// Only compile contracts individually which have been requested.
 	std::map<ContractDefinition const*, std::shared_ptr<Compiler const>> otherCompilers;
 
+	std::vector<ContractDefinition const*> requestedContracts;
 	for (Source const* source: m_sourceOrder)
 		for (ASTPointer<ASTNode> const& node: source->ast->nodes())
 			if (auto contract = dynamic_cast<ContractDefinition const*>(node.get()))
 				if (isRequestedContract(*contract))
-				{
-					try
-					{
-						if (m_viaIR || m_generateIR)
-							generateIR(*contract);
-						if (m_generateEvmBytecode)
-						{
-							if (m_viaIR)
-								generateEVMFromIR(*contract);
-							else
-							{
-								if (m_experimentalAnalysis)
-									solThrow(CompilerError, "Legacy codegen after experimental analysis is unsupported.");
-								compileContract(*contract, otherCompilers);
-							}
-						}
-					}
-					catch (Error const& _error)
-					{
-						if (_error.type() != Error::Type::CodeGenerationError)
-							throw;
-						m_errorReporter.error(_error.errorId(), _error.type(), SourceLocation(), _error.what());
-						return false;
-					}
-					catch (UnimplementedFeatureError const& _unimplementedError)
-					{
-						if (
-							SourceLocation const* sourceLocation =
-							boost::get_error_info<langutil::errinfo_sourceLocation>(_unimplementedError)
-						)
-						{
-							std::string const* comment = _unimplementedError.comment();
-							m_errorReporter.error(
-								1834_error,
-								Error::Type::CodeGenerationError,
-								*sourceLocation,
-								fmt::format(
-									"Unimplemented feature error {} in {}",
-									(comment && !comment->empty()) ? ": " + *comment : "",
-									_unimplementedError.lineInfo()
-								)
-							);
-							return false;
-						}
-						else
-							throw;
-					}
-				}
+					requestedContracts.push_back(contract);
+
+	try
+	{
+		// IR generation and the legacy pipeline walk the (shared) Solidity AST and
+		// therefore have to run sequentially.
+		for (ContractDefinition const* contract: requestedContracts)
+		{
+			m_cancellationToken.throwIfCancelled();
+			if (m_viaIR || m_generateIR)
+				generateIR(*contract);
+			if (m_generateEvmBytecode && !m_viaIR)
+			{
+				if (m_experimentalAnalysis)
+					solThrow(CompilerError, "Legacy codegen after experimental analysis is unsupported.");
+				compileContract(*contract, otherCompilers);
+			}
+		}
+		// Translating the optimized IR of each contract to EVM assembly only works on
+		// contract-local data, so the contracts can be assembled concurrently.
+		if (m_viaIR && m_generateEvmBytecode)
+			generateEVMFromIRParallel(requestedContracts);
+	}
+	catch (Error const& _error)
+	{
+		if (_error.type() != Error::Type::CodeGenerationError)
+			throw;
+		m_errorReporter.error(_error.errorId(), _error.type(), SourceLocation(), _error.what());
+		return false;
+	}
+	catch (UnimplementedFeatureError const& _unimplementedError)
+	{
+		if (
+			SourceLocation const* sourceLocation =
+			boost::get_error_info<langutil::errinfo_sourceLocation>(_unimplementedError)
+		)
+		{
+			std::string const* comment = _unimplementedError.comment();
+			m_errorReporter.error(
+				1834_error,
+				Error::Type::CodeGenerationError,
+				*sourceLocation,
+				fmt::format(
+					"Unimplemented feature error {} in {}",
+					(comment && !comment->empty()) ? ": " + *comment : "",
+					_unimplementedError.lineInfo()
+				)
+			);
+			return false;
+		}
+		else
+			throw;
+	}
 	m_stackState = CompilationSuccessful;
 	this->link();
 	return true;
@@ -950,6 +1201,31 @@ Json::Value const& CompilerStack::yulIROptimizedAst(std::string const& _contract
 	return contract(_contractName).yulIROptimizedAst;
 }
 
+Json::Value CompilerStack::yulCFGJson(std::string const& _contractName) const
+{
+	if (m_stackState != CompilationSuccessful)
+		solThrow(CompilerError, "Compilation was not successful.");
+
+	Contract const& currentContract = contract(_contractName);
+	if (currentContract.yulIROptimized.empty())
+		return Json::Value();
+	if (currentContract.yulStack)
+		return currentContract.yulStack->cfgJson();
+
+	// The parsed IR kept from IR generation is freed once bytecode has been generated
+	// from it, so for this opt-in debug output we re-parse the printed optimized IR.
+	yul::YulStack stack(
+		m_evmVersion,
+		m_eofVersion,
+		yul::YulStack::Language::StrictAssembly,
+		m_optimiserSettings,
+		m_debugInfoSelection
+	);
+	bool yulAnalysisSuccessful = stack.parseAndAnalyze("", currentContract.yulIROptimized);
+	solAssert(yulAnalysisSuccessful, "Re-analysis of optimized IR failed.");
+	return stack.cfgJson();
+}
+
 evmasm::LinkerObject const& CompilerStack::object(std::string const& _contractName) const
 {
 	if (m_stackState != CompilationSuccessful)
@@ -1016,6 +1292,54 @@ Json::Value const& CompilerStack::contractABI(std::string const& _contractName)
 	return contractABI(contract(_contractName));
 }
 
+util::h256 CompilerStack::sourcesHash() const
+{
+	if (!m_sourcesHash)
+	{
+		// The interface outputs can change between compiler versions, so the version is part
+		// of the hash.
+		std::string data = VersionStringStrict;
+		for (auto const& [sourceName, source]: m_sources)
+		{
+			data += '\0';
+			data += sourceName;
+			data += '\0';
+			data += source.charStream->source();
+		}
+		m_sourcesHash = util::keccak256(data);
+	}
+	return *m_sourcesHash;
+}
+
+Json::Value CompilerStack::interfaceOutput(
+	Contract const& _contract,
+	std::string const& _component,
+	std::function<Json::Value()> const& _generate
+) const
+{
+	std::string keyData = sourcesHash().hex();
+	keyData += '\0';
+	keyData += _contract.contract->fullyQualifiedName();
+	keyData += '\0';
+	keyData += _component;
+	util::h256 key = util::keccak256(keyData);
+
+	if (std::optional<Json::Value> cached = InterfaceOutputCache::instance().lookup(key))
+		return std::move(*cached);
+	if (m_artifactCache)
+		if (std::optional<Json::Value> cached = m_artifactCache->lookup(key))
+		{
+			InterfaceOutputCache::instance().store(key, *cached);
+			return std::move(*cached);
+		}
+
+	Json::Value generated = _generate();
+	InterfaceOutputCache::instance().store(key, generated);
+	if (m_artifactCache)
+		m_artifactCache->store(key, generated);
+	return generated;
+}
+
 Json::Value const& CompilerStack::contractABI(Contract const& _contract) const
 {
 	if (m_stackState < AnalysisSuccessful)
@@ -1023,7 +1347,9 @@ Json::Value const& CompilerStack::contractABI(Contract const& _contract) const
 
 	solAssert(_contract.contract, "");
 
-	return _contract.abi.init([&]{ return ABI::generate(*_contract.contract); });
+	return _contract.abi.init([&]{
+		return interfaceOutput(_contract, "abi", [&]{ return ABI::generate(*_contract.contract); });
+	});
 }
 
 Json::Value const& CompilerStack::storageLayout(std::string const& _contractName) const
@@ -1041,7 +1367,43 @@ Json::Value const& CompilerStack::storageLayout(Contract const& _contract) const
 
 	solAssert(_contract.contract, "");
 
-	return _contract.storageLayout.init([&]{ return StorageLayout().generate(*_contract.contract); });
+	return _contract.storageLayout.init([&]{ return StorageLayout::toJson(storageLayoutData(_contract)); });
+}
+
+StorageLayoutData const& CompilerStack::storageLayoutData(std::string const& _contractName) const
+{
+	if (m_stackState < AnalysisSuccessful)
+		solThrow(CompilerError, "Analysis was not successful.");
+
+	return storageLayoutData(contract(_contractName));
+}
+
+StorageLayoutData const& CompilerStack::storageLayoutData(Contract const& _contract) const
+{
+	if (m_stackState < AnalysisSuccessful)
+		solThrow(CompilerError, "Analysis was not successful.");
+
+	solAssert(_contract.contract, "");
+
+	return _contract.storageLayoutData.init([&]{ return StorageLayout().generateData(*_contract.contract); });
+}
+
+void CompilerStack::ensureDocStringAnalysis() const
+{
+	if (m_docStringAnalysisDone)
+		return;
+	solAssert(m_stackState >= AnalysisSuccessful, "");
+
+	// The analysis was deferred via setEagerNatspecAnalysis(false) because no natspec
+	// output was known to be needed upfront. Any diagnostics it produces (e.g. an
+	// unresolvable @inheritdoc reference) are reported now.
+	auto& self = const_cast<CompilerStack&>(*this);
+	self.m_docStringAnalysisDone = true;
+
+	DocStringAnalyser docStringAnalyser(self.m_errorReporter);
+	for (Source const* source: m_sourceOrder)
+		if (source->ast)
+			docStringAnalyser.analyseDocStrings(*source->ast);
 }
 
 Json::Value const& CompilerStack::natspecUser(std::string const& _contractName) const
@@ -1059,7 +1421,11 @@ Json::Value const& CompilerStack::natspecUser(Contract const& _contract) const
 
 	solAssert(_contract.contract, "");
 
-	return _contract.userDocumentation.init([&]{ return Natspec::userDocumentation(*_contract.contract); });
+	ensureDocStringAnalysis();
+
+	return _contract.userDocumentation.init([&]{
+		return interfaceOutput(_contract, "userdoc", [&]{ return Natspec::userDocumentation(*_contract.contract); });
+	});
 }
 
 Json::Value const& CompilerStack::natspecDev(std::string const& _contractName) const
@@ -1077,7 +1443,11 @@ Json::Value const& CompilerStack::natspecDev(Contract const& _contract) const
 
 	solAssert(_contract.contract, "");
 
-	return _contract.devDocumentation.init([&]{ return Natspec::devDocumentation(*_contract.contract); });
+	ensureDocStringAnalysis();
+
+	return _contract.devDocumentation.init([&]{
+		return interfaceOutput(_contract, "devdoc", [&]{ return Natspec::devDocumentation(*_contract.contract); });
+	});
 }
 
 Json::Value CompilerStack::interfaceSymbols(std::string const& _contractName) const
@@ -1110,12 +1480,44 @@ Json::Value CompilerStack::interfaceSymbols(std::string const& _contractName) co
 	return interfaceSymbols;
 }
 
+util::h256 CompilerStack::interfaceHash(std::string const& _contractName) const
+{
+	if (m_stackState < AnalysisSuccessful)
+		solThrow(CompilerError, "Analysis was not successful.");
+
+	Contract const& currentContract = contract(_contractName);
+	if (!currentContract.interfaceHash)
+	{
+		// The serialization covers exactly what other contracts can observe. Function
+		// bodies, natspec, metadata and bytecode are deliberately left out, so the hash
+		// does not change when only an implementation is edited.
+		std::string preimage;
+		preimage += util::jsonCompactPrint(contractABI(currentContract));
+		preimage += '\0';
+		preimage += util::jsonCompactPrint(storageLayout(currentContract));
+		preimage += '\0';
+		preimage += util::jsonCompactPrint(interfaceSymbols(_contractName));
+		currentContract.interfaceHash = util::keccak256(preimage);
+	}
+	return *currentContract.interfaceHash;
+}
+
 bytes CompilerStack::cborMetadata(std::string const& _contractName, bool _forIR) const
 {
 	if (m_stackState < AnalysisSuccessful)
 		solThrow(CompilerError, "Analysis was not successful.");
 
-	return createCBORMetadata(contract(_contractName), _forIR);
+	return cborMetadata(contract(_contractName), _forIR);
+}
+
+bytes CompilerStack::cborMetadata(Contract const& _contract, bool _forIR) const
+{
+	// Only the metadata of the selected pipeline is cached. The other variant can only be
+	// requested explicitly and is not worth an extra slot in the Contract object.
+	if (_forIR != m_viaIR)
+		return createCBORMetadata(_contract, _forIR);
+
+	return _contract.cborMetadata.init([&]{ return createCBORMetadata(_contract, _forIR); });
 }
 
 std::string const& CompilerStack::metadata(Contract const& _contract) const
@@ -1192,42 +1594,85 @@ std::string const& CompilerStack::Source::ipfsUrl() const
 	return ipfsUrlCached;
 }
 
-StringMap CompilerStack::loadMissingSources(SourceUnit const& _ast)
+Json::Value const& CompilerStack::Source::metadataEntry(bool _literalSources) const
 {
-	solAssert(m_stackState < ParsedAndImported, "");
-	StringMap newSources;
-	try
+	if (metadataEntryCached.isNull())
 	{
-		for (auto const& node: _ast.nodes())
-			if (ImportDirective const* import = dynamic_cast<ImportDirective*>(node.get()))
-			{
-				std::string const& importPath = *import->annotation().absolutePath;
+		solAssert(charStream, "Character stream not available");
+		Json::Value entry{Json::objectValue};
+		entry["keccak256"] = "0x" + util::toHex(keccak256().asBytes());
+		if (std::optional<std::string> licenseString = ast->licenseString())
+			entry["license"] = *licenseString;
+		if (_literalSources)
+			entry["content"] = charStream->source();
+		else
+		{
+			entry["urls"] = Json::arrayValue;
+			entry["urls"].append("bzz-raw://" + util::toHex(swarmHash().asBytes()));
+			entry["urls"].append(ipfsUrl());
+		}
+		metadataEntryCached = std::move(entry);
+	}
+	return metadataEntryCached;
+}
 
-				if (m_sources.count(importPath) || newSources.count(importPath))
-					continue;
+std::vector<ReadCallback::Result> CompilerStack::readSourceFiles(std::vector<std::string> const& _paths)
+{
+	solAssert(m_stackState < ParsedAndImported, "");
+	std::vector<ReadCallback::Result> results(
+		_paths.size(),
+		ReadCallback::Result{false, std::string("File not supplied initially.")}
+	);
+	if (!m_readFile || _paths.empty())
+		return results;
 
-				ReadCallback::Result result{false, std::string("File not supplied initially.")};
-				if (m_readFile)
-					result = m_readFile(ReadCallback::kindString(ReadCallback::Kind::ReadFile), importPath);
+	auto readFile = [&](size_t _index) {
+		results[_index] = m_readFile(ReadCallback::kindString(ReadCallback::Kind::ReadFile), _paths[_index]);
+	};
 
-				if (result.success)
-					newSources[importPath] = result.responseOrErrorMessage;
-				else
+	unsigned jobs = std::min<unsigned>(m_compilationJobs, static_cast<unsigned>(_paths.size()));
+	if (jobs <= 1)
+		for (size_t index = 0; index < _paths.size(); ++index)
+			readFile(index);
+	else
+	{
+		std::atomic<size_t> nextPath{0};
+		std::mutex exceptionMutex;
+		std::exception_ptr workerException;
+
+		auto work = [&]() {
+			while (true)
+			{
+				size_t index = nextPath.fetch_add(1);
+				if (index >= _paths.size())
+					break;
+				try
 				{
-					m_errorReporter.parserError(
-						6275_error,
-						import->location(),
-						std::string("Source \"" + importPath + "\" not found: " + result.responseOrErrorMessage)
-					);
-					continue;
+					readFile(index);
+				}
+				catch (...)
+				{
+					std::lock_guard<std::mutex> lock(exceptionMutex);
+					if (!workerException)
+						workerException = std::current_exception();
+					// Let the remaining workers drain the queue without starting new reads.
+					nextPath.store(_paths.size());
+					break;
 				}
 			}
+		};
+
+		std::vector<std::thread> threads;
+		for (unsigned i = 1; i < jobs; ++i)
+			threads.emplace_back(work);
+		work();
+		for (std::thread& thread: threads)
+			thread.join();
+
+		if (workerException)
+			std::rethrow_exception(workerException);
 	}
-	catch (FatalError const&)
-	{
-		solAssert(m_errorReporter.hasErrors(), "");
-	}
-	return newSources;
+	return results;
 }
 
 std::string CompilerStack::applyRemapping(std::string const& _path, std::string const& _context)
@@ -1385,6 +1830,9 @@ void CompilerStack::assembleYul(
 		solAssert(false, "Assembly exception for deployed bytecode");
 	}
 
+	// The warnings below may be reported from code generation worker threads.
+	std::lock_guard<std::mutex> errorReporterLock(m_errorReporterMutex);
+
 	// Throw a warning if EIP-170 limits are exceeded:
 	//   If contract creation returns data with length greater than 0x6000 (2^14 + 2^13) bytes,
 	//   contract creation fails with an out of gas error.
@@ -1442,11 +1890,13 @@ void CompilerStack::compileContract(
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
 
-	std::shared_ptr<Compiler> compiler = std::make_shared<Compiler>(m_evmVersion, m_revertStrings, m_optimiserSettings);
+	if (!m_lowLevelFunctionCache)
+		m_lowLevelFunctionCache = std::make_shared<LowLevelFunctionCache>();
+	std::shared_ptr<Compiler> compiler = std::make_shared<Compiler>(m_evmVersion, m_revertStrings, m_optimiserSettings, m_lowLevelFunctionCache);
 	compiledContract.compiler = compiler;
 
 	solAssert(!m_viaIR, "");
-	bytes cborEncodedMetadata = createCBORMetadata(compiledContract, /* _forIR */ false);
+	bytes cborEncodedMetadata = cborMetadata(compiledContract, /* _forIR */ false);
 
 	try
 	{
@@ -1493,6 +1943,8 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 	for (auto const& pair: m_contracts)
 		otherYulSources.emplace(pair.second.contract, pair.second.yulIR);
 
+	if (!m_irFunctionCache)
+		m_irFunctionCache = std::make_shared<IRFunctionCache>();
 	IRGenerator generator(
 		m_evmVersion,
 		m_eofVersion,
@@ -1500,33 +1952,41 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 		sourceIndices(),
 		m_debugInfoSelection,
 		this,
-		m_optimiserSettings
+		m_optimiserSettings,
+		m_irFunctionCache
 	);
 	compiledContract.yulIR = generator.run(
 		_contract,
-		createCBORMetadata(compiledContract, /* _forIR */ true),
+		cborMetadata(compiledContract, /* _forIR */ true),
 		otherYulSources
 	);
 
-	yul::YulStack stack(
+	auto stack = std::make_shared<yul::YulStack>(
 		m_evmVersion,
 		m_eofVersion,
 		yul::YulStack::Language::StrictAssembly,
 		m_optimiserSettings,
 		m_debugInfoSelection
 	);
-	bool yulAnalysisSuccessful = stack.parseAndAnalyze("", compiledContract.yulIR);
+	stack->setCancellationToken(m_cancellationToken);
+	bool yulAnalysisSuccessful = stack->parseAndAnalyze("", compiledContract.yulIR);
 	solAssert(
 		yulAnalysisSuccessful,
 		compiledContract.yulIR + "\n\n"
 		"Invalid IR generated:\n" +
-		langutil::SourceReferenceFormatter::formatErrorInformation(stack.errors(), stack) + "\n"
+		langutil::SourceReferenceFormatter::formatErrorInformation(stack->errors(), *stack) + "\n"
 	);
 
-	compiledContract.yulIRAst = stack.astJson();
-	stack.optimize();
-	compiledContract.yulIROptimized = stack.print(this);
-	compiledContract.yulIROptimizedAst = stack.astJson();
+	compiledContract.yulIRAst = stack->astJson();
+	if (m_generateIROptimized || (m_viaIR && m_generateEvmBytecode))
+	{
+		stack->optimize();
+		compiledContract.yulIROptimized = stack->print(this);
+		compiledContract.yulIROptimizedAst = stack->astJson();
+		// Keep the optimized AST so that bytecode generation does not have to re-parse
+		// the printed IR.
+		compiledContract.yulStack = std::move(stack);
+	}
 }
 
 void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
@@ -1541,25 +2001,65 @@ void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
 	if (!compiledContract.object.bytecode.empty())
 		return;
 
-	// Re-parse the Yul IR in EVM dialect
-	yul::YulStack stack(
-		m_evmVersion,
-		m_eofVersion,
-		yul::YulStack::Language::StrictAssembly,
-		m_optimiserSettings,
-		m_debugInfoSelection
-	);
-	bool analysisSuccessful = stack.parseAndAnalyze("", compiledContract.yulIROptimized);
-	solAssert(analysisSuccessful);
-
-	//cout << yul::AsmPrinter{}(*stack.parserResult()->code) << endl;
+	// Reuse the parsed and optimized Yul IR from IR generation - re-parsing the
+	// printed IR would only reproduce the same AST.
+	solAssert(compiledContract.yulStack, "");
+	yul::YulStack& stack = *compiledContract.yulStack;
 
 	std::string deployedName = IRNames::deployedObject(_contract);
 	solAssert(!deployedName.empty(), "");
 	tie(compiledContract.evmAssembly, compiledContract.evmRuntimeAssembly) = stack.assembleEVMWithDeployed(deployedName);
+	compiledContract.yulStack.reset();
 	assembleYul(_contract, compiledContract.evmAssembly, compiledContract.evmRuntimeAssembly);
 }
 
+void CompilerStack::generateEVMFromIRParallel(std::vector<ContractDefinition const*> const& _contracts)
+{
+	unsigned jobs = std::min<unsigned>(m_compilationJobs, static_cast<unsigned>(_contracts.size()));
+	if (jobs <= 1)
+	{
+		for (ContractDefinition const* contract: _contracts)
+			generateEVMFromIR(*contract);
+		return;
+	}
+
+	std::atomic<size_t> nextContract{0};
+	std::mutex exceptionMutex;
+	std::exception_ptr workerException;
+
+	auto work = [&]() {
+		while (true)
+		{
+			size_t index = nextContract.fetch_add(1);
+			if (index >= _contracts.size())
+				break;
+			try
+			{
+				generateEVMFromIR(*_contracts[index]);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(exceptionMutex);
+				if (!workerException)
+					workerException = std::current_exception();
+				// Let the remaining workers drain the queue without starting new contracts.
+				nextContract.store(_contracts.size());
+				break;
+			}
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (unsigned i = 1; i < jobs; ++i)
+		threads.emplace_back(work);
+	work();
+	for (std::thread& thread: threads)
+		thread.join();
+
+	if (workerException)
+		std::rethrow_exception(workerException);
+}
+
 CompilerStack::Contract const& CompilerStack::contract(std::string const& _contractName) const
 {
 	solAssert(m_stackState >= AnalysisSuccessful, "");
@@ -1629,32 +2129,41 @@ std::string CompilerStack::createMetadata(Contract const& _contract, bool _forIR
 		if (!referencedSources.count(s.first))
 			continue;
 
-		solAssert(s.second.charStream, "Character stream not available");
-		meta["sources"][s.first]["keccak256"] = "0x" + util::toHex(s.second.keccak256().asBytes());
-		if (std::optional<std::string> licenseString = s.second.ast->licenseString())
-			meta["sources"][s.first]["license"] = *licenseString;
-		if (m_metadataLiteralSources)
-			meta["sources"][s.first]["content"] = s.second.charStream->source();
-		else
-		{
-			meta["sources"][s.first]["urls"] = Json::arrayValue;
-			meta["sources"][s.first]["urls"].append("bzz-raw://" + util::toHex(s.second.swarmHash().asBytes()));
-			meta["sources"][s.first]["urls"].append(s.second.ipfsUrl());
-		}
+		meta["sources"][s.first] = s.second.metadataEntry(m_metadataLiteralSources);
 	}
 
+	// The settings section only depends on the compilation settings and is the same
+	// for every contract, except for the compilation target filled in below.
+	std::optional<Json::Value>& cachedSettings = m_metadataSettingsCache[_forIR ? 1 : 0];
+	if (!cachedSettings)
+		cachedSettings = createMetadataSettings(_forIR);
+	meta["settings"] = *cachedSettings;
+	meta["settings"]["compilationTarget"][_contract.contract->sourceUnitName()] =
+		*_contract.contract->annotation().canonicalName;
+
+	meta["output"]["abi"] = contractABI(_contract);
+	meta["output"]["userdoc"] = natspecUser(_contract);
+	meta["output"]["devdoc"] = natspecDev(_contract);
+
+	return util::jsonCompactPrint(meta);
+}
+
+Json::Value CompilerStack::createMetadataSettings(bool _forIR) const
+{
+	Json::Value settings{Json::objectValue};
+
 	static_assert(sizeof(m_optimiserSettings.expectedExecutionsPerDeployment) <= sizeof(Json::LargestUInt), "Invalid word size.");
 	solAssert(static_cast<Json::LargestUInt>(m_optimiserSettings.expectedExecutionsPerDeployment) < std::numeric_limits<Json::LargestUInt>::max(), "");
-	meta["settings"]["optimizer"]["runs"] = Json::Value(Json::LargestUInt(m_optimiserSettings.expectedExecutionsPerDeployment));
+	settings["optimizer"]["runs"] = Json::Value(Json::LargestUInt(m_optimiserSettings.expectedExecutionsPerDeployment));
 
 	/// Backwards compatibility: If set to one of the default settings, do not provide details.
 	OptimiserSettings settingsWithoutRuns = m_optimiserSettings;
 	// reset to default
 	settingsWithoutRuns.expectedExecutionsPerDeployment = OptimiserSettings::minimal().expectedExecutionsPerDeployment;
 	if (settingsWithoutRuns == OptimiserSettings::minimal())
-		meta["settings"]["optimizer"]["enabled"] = false;
+		settings["optimizer"]["enabled"] = false;
 	else if (settingsWithoutRuns == OptimiserSettings::standard())
-		meta["settings"]["optimizer"]["enabled"] = true;
+		settings["optimizer"]["enabled"] = true;
 	else
 	{
 		Json::Value details{Json::objectValue};
@@ -1690,45 +2199,39 @@ std::string CompilerStack::createMetadata(Contract const& _contract, bool _forIR
 			solAssert(m_optimiserSettings.yulOptimiserCleanupSteps == OptimiserSettings::DefaultYulOptimiserCleanupSteps);
 		}
 
-		meta["settings"]["optimizer"]["details"] = std::move(details);
+		settings["optimizer"]["details"] = std::move(details);
 	}
 
 	if (m_revertStrings != RevertStrings::Default)
-		meta["settings"]["debug"]["revertStrings"] = revertStringsToString(m_revertStrings);
+		settings["debug"]["revertStrings"] = revertStringsToString(m_revertStrings);
 
 	if (m_metadataFormat == MetadataFormat::NoMetadata)
-		meta["settings"]["metadata"]["appendCBOR"] = false;
+		settings["metadata"]["appendCBOR"] = false;
 
 	if (m_metadataLiteralSources)
-		meta["settings"]["metadata"]["useLiteralContent"] = true;
+		settings["metadata"]["useLiteralContent"] = true;
 
 	static std::vector<std::string> hashes{"ipfs", "bzzr1", "none"};
-	meta["settings"]["metadata"]["bytecodeHash"] = hashes.at(unsigned(m_metadataHash));
+	settings["metadata"]["bytecodeHash"] = hashes.at(unsigned(m_metadataHash));
 
 	if (_forIR)
-		meta["settings"]["viaIR"] = _forIR;
-	meta["settings"]["evmVersion"] = m_evmVersion.name();
+		settings["viaIR"] = _forIR;
+	settings["evmVersion"] = m_evmVersion.name();
 	if (m_eofVersion.has_value())
-		meta["settings"]["eofVersion"] = *m_eofVersion;
-	meta["settings"]["compilationTarget"][_contract.contract->sourceUnitName()] =
-		*_contract.contract->annotation().canonicalName;
+		settings["eofVersion"] = *m_eofVersion;
 
-	meta["settings"]["remappings"] = Json::arrayValue;
+	settings["remappings"] = Json::arrayValue;
 	std::set<std::string> remappings;
 	for (auto const& r: m_importRemapper.remappings())
 		remappings.insert(r.context + ":" + r.prefix + "=" + r.target);
 	for (auto const& r: remappings)
-		meta["settings"]["remappings"].append(r);
+		settings["remappings"].append(r);
 
-	meta["settings"]["libraries"] = Json::objectValue;
+	settings["libraries"] = Json::objectValue;
 	for (auto const& library: m_libraries)
-		meta["settings"]["libraries"][library.first] = "0x" + util::toHex(library.second.asBytes());
-
-	meta["output"]["abi"] = contractABI(_contract);
-	meta["output"]["userdoc"] = natspecUser(_contract);
-	meta["output"]["devdoc"] = natspecDev(_contract);
+		settings["libraries"][library.first] = "0x" + util::toHex(library.second.asBytes());
 
-	return util::jsonCompactPrint(meta);
+	return settings;
 }
 
 class MetadataCBOREncoder
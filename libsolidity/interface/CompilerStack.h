@@ -24,9 +24,11 @@
 
 #pragma once
 
+#include <libsolidity/analysis/ConstantEvaluator.h>
 #include <libsolidity/analysis/FunctionCallGraph.h>
 #include <libsolidity/interface/ReadFile.h>
 #include <libsolidity/interface/ImportRemapper.h>
+#include <libsolidity/interface/StorageLayout.h>
 #include <libsolidity/interface/OptimiserSettings.h>
 #include <libsolidity/interface/Version.h>
 #include <libsolidity/interface/DebugSettings.h>
@@ -44,14 +46,19 @@
 #include <libevmasm/AbstractAssemblyStack.h>
 #include <libevmasm/LinkerObject.h>
 
+#include <libsolutil/Arena.h>
+#include <libsolutil/CancellationToken.h>
 #include <libsolutil/Common.h>
 #include <libsolutil/FixedHash.h>
 #include <libsolutil/LazyInit.h>
 
 #include <json/json.h>
 
+#include <algorithm>
+#include <array>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <set>
 #include <string>
@@ -70,6 +77,11 @@ class AssemblyItem;
 using AssemblyItems = std::vector<AssemblyItem>;
 }
 
+namespace solidity::yul
+{
+class YulStack;
+}
+
 namespace solidity::frontend
 {
 
@@ -78,8 +90,11 @@ class ASTNode;
 class ContractDefinition;
 class FunctionDefinition;
 class SourceUnit;
+class ArtifactCache;
 class Compiler;
 class GlobalContext;
+class IRFunctionCache;
+class LowLevelFunctionCache;
 class Natspec;
 class DeclarationContainer;
 namespace experimental
@@ -169,6 +184,28 @@ public:
 	/// Must be set before parsing.
 	void setViaIR(bool _viaIR);
 
+	/// Sets the number of worker threads used for compilation.
+	/// Parsing and IR-based backend code generation make use of multiple jobs; a value of 1
+	/// (the default) compiles strictly sequentially. Must be set before parsing.
+	void setCompilationJobs(unsigned _jobs) { m_compilationJobs = std::max(1u, _jobs); }
+
+	/// Defers the natspec docstring analysis (the resolution of ``@inheritdoc`` references)
+	/// until a natspec output is requested, instead of running it as part of analysis.
+	/// Diagnostics of the deferred pass are reported when it eventually runs, so with
+	/// deferral enabled they only show up if userdoc, devdoc or metadata is generated.
+	/// Must be set before parsing.
+	void setEagerNatspecAnalysis(bool _eager);
+
+	/// Sets the token used to cooperatively abandon a superseded compilation, e.g. from a
+	/// language server or a build service. The phases poll the token and throw
+	/// util::CompilationCancelled once cancellation has been requested, which propagates
+	/// to the caller. A cancelled stack is in an indeterminate state and has to be reset
+	/// before being used again.
+	void setCancellationToken(util::CancellationToken _cancellationToken)
+	{
+		m_cancellationToken = std::move(_cancellationToken);
+	}
+
 	/// Set the EVM version used before running compile.
 	/// When called without an argument it will revert to the default version.
 	/// Must be set before parsing.
@@ -196,6 +233,12 @@ public:
 	/// Enable generation of Yul IR code.
 	void enableIRGeneration(bool _enable = true) { m_generateIR = _enable; }
 
+	/// Enable running the Yul optimiser on the generated IR. This is enabled by default,
+	/// but can be disabled to skip the optimiser when only the unoptimized IR outputs
+	/// are requested. It is ignored when bytecode is generated via IR, since that
+	/// always requires the optimised code.
+	void enableIROptimization(bool _enable = true) { m_generateIROptimized = _enable; }
+
 	/// @arg _metadataLiteralSources When true, store sources as literals in the contract metadata.
 	/// Must be set before parsing.
 	void useMetadataLiteralSources(bool _metadataLiteralSources);
@@ -211,6 +254,11 @@ public:
 	/// Sets the sources. Must be set before parsing.
 	void setSources(StringMap _sources);
 
+	/// Sets the sources to already existing character streams, allowing them to be reused
+	/// across stack resets. Token streams attached to them by an earlier scan are then
+	/// replayed instead of re-lexing the source text. Must be set before parsing.
+	void setSources(std::map<std::string, std::shared_ptr<langutil::CharStream>> _sources);
+
 	/// Adds a response to an SMTLib2 query (identified by the hash of the query input).
 	/// Must be set before parsing.
 	void addSMTLib2Response(util::h256 const& _hash, std::string const& _response);
@@ -278,6 +326,10 @@ public:
 	/// @returns the optimized IR representation of a contract AST in JSON format.
 	Json::Value const& yulIROptimizedAst(std::string const& _contractName) const;
 
+	/// @returns a JSON representation of the control flow graph and the stack layouts
+	/// that code generation uses for the optimized IR of a contract.
+	Json::Value yulCFGJson(std::string const& _contractName) const;
+
 	/// @returns the assembled object for a contract.
 	virtual evmasm::LinkerObject const& object(std::string const& _contractName) const override;
 
@@ -320,6 +372,11 @@ public:
 	/// Prerequisite: Successful call to parse or compile.
 	Json::Value const& storageLayout(std::string const& _contractName) const;
 
+	/// @returns the storage layout of the contract in its native representation, which
+	/// tools can query directly without going through the JSON output.
+	/// Prerequisite: Successful call to parse or compile.
+	StorageLayoutData const& storageLayoutData(std::string const& _contractName) const;
+
 	/// @returns a JSON representing the contract's user documentation.
 	/// Prerequisite: Successful call to parse or compile.
 	Json::Value const& natspecUser(std::string const& _contractName) const;
@@ -331,6 +388,13 @@ public:
 	/// @returns a JSON object with the three members ``methods``, ``events``, ``errors``. Each is a map, mapping identifiers (hashes) to function names.
 	Json::Value interfaceSymbols(std::string const& _contractName) const;
 
+	/// @returns a hash of everything other contracts can depend on in this contract:
+	/// the ABI, the storage layout and the selector sets. The hash is stable across
+	/// edits that only change function bodies, so build tools can compare it between
+	/// compilations and skip recompiling dependents when it is unchanged.
+	/// Prerequisite: Successful analysis.
+	util::h256 interfaceHash(std::string const& _contractName) const;
+
 	/// @returns the Contract Metadata matching the pipeline selected using the viaIR setting.
 	std::string const& metadata(std::string const& _contractName) const { return metadata(contract(_contractName)); }
 
@@ -348,6 +412,11 @@ public:
 	/// Changes the format of the metadata appended at the end of the bytecode.
 	void setMetadataFormat(MetadataFormat _metadataFormat) { m_metadataFormat = _metadataFormat; }
 
+	/// Attaches an on-disk artifact cache used to persist per-contract interface outputs
+	/// (ABI and Natspec) between compiler runs. The cache is not owned and has to outlive
+	/// the compiler stack.
+	void setArtifactCache(ArtifactCache const* _artifactCache) { m_artifactCache = _artifactCache; }
+
 	static MetadataFormat defaultMetadataFormat()
 	{
 		return VersionIsRelease ? MetadataFormat::WithReleaseVersionTag : MetadataFormat::WithPrereleaseVersionTag;
@@ -362,10 +431,14 @@ private:
 		util::h256 mutable keccak256HashCached;
 		util::h256 mutable swarmHashCached;
 		std::string mutable ipfsUrlCached;
+		Json::Value mutable metadataEntryCached;
 		void reset() { *this = Source(); }
 		util::h256 const& keccak256() const;
 		util::h256 const& swarmHash() const;
 		std::string const& ipfsUrl() const;
+		/// @returns the entry for this source in the ``sources`` section of the contract
+		/// metadata, computed on first use. @a _literalSources must not change between calls.
+		Json::Value const& metadataEntry(bool _literalSources) const;
 	};
 
 	/// The state per contract. Filled gradually during compilation.
@@ -379,10 +452,15 @@ private:
 		evmasm::LinkerObject runtimeObject; ///< Runtime object.
 		std::string yulIR; ///< Yul IR code.
 		std::string yulIROptimized; ///< Optimized Yul IR code.
+		/// Parsed and optimized Yul IR, kept so that bytecode generation can reuse the
+		/// in-memory AST instead of re-parsing @a yulIROptimized. Freed after assembly.
+		std::shared_ptr<yul::YulStack> yulStack;
 		Json::Value yulIRAst; ///< JSON AST of Yul IR code.
 		Json::Value yulIROptimizedAst; ///< JSON AST of optimized Yul IR code.
 		util::LazyInit<std::string const> metadata; ///< The metadata json that will be hashed into the chain.
+		util::LazyInit<bytes const> cborMetadata; ///< The CBOR-encoded metadata appended to the bytecode (for the selected pipeline).
 		util::LazyInit<Json::Value const> abi;
+		util::LazyInit<StorageLayoutData const> storageLayoutData;
 		util::LazyInit<Json::Value const> storageLayout;
 		util::LazyInit<Json::Value const> userDocumentation;
 		util::LazyInit<Json::Value const> devDocumentation;
@@ -390,15 +468,18 @@ private:
 		util::LazyInit<Json::Value const> runtimeGeneratedSources;
 		mutable std::optional<std::string const> sourceMapping;
 		mutable std::optional<std::string const> runtimeSourceMapping;
+		mutable std::optional<util::h256> interfaceHash;
 	};
 
 	void createAndAssignCallGraphs();
 	void findAndReportCyclicContractDependencies();
 
-	/// Loads the missing sources from @a _ast (named @a _path) using the callback
-	/// @a m_readFile
-	/// @returns the newly loaded sources.
-	StringMap loadMissingSources(SourceUnit const& _ast);
+	/// Reads the contents of the given paths using the callback @a m_readFile.
+	/// The reads are issued concurrently on up to m_compilationJobs worker threads,
+	/// overlapping the latency of callbacks that fetch sources from disk or network.
+	/// @returns the results in the order of @a _paths, with failure results for all
+	/// paths if no callback is set.
+	std::vector<ReadCallback::Result> readSourceFiles(std::vector<std::string> const& _paths);
 	std::string applyRemapping(std::string const& _path, std::string const& _context);
 	bool resolveImports();
 
@@ -422,6 +503,10 @@ private:
 	/// @returns false on error.
 	bool analyzeExperimental();
 
+	/// Runs the docstring analysis if it was deferred via setEagerNatspecAnalysis(false)
+	/// and has not run yet. Diagnostics it produces are appended to the error list.
+	void ensureDocStringAnalysis() const;
+
 	/// Assembles the contract.
 	/// This function should only be internally called by compileContract and generateEVMFromIR.
 	void assembleYul(
@@ -446,6 +531,10 @@ private:
 	/// Depends on output generated by generateIR.
 	void generateEVMFromIR(ContractDefinition const& _contract);
 
+	/// Generates EVM representations for the given contracts, using up to
+	/// m_compilationJobs worker threads. Depends on output generated by generateIR.
+	void generateEVMFromIRParallel(std::vector<ContractDefinition const*> const& _contracts);
+
 	/// Links all the known library addresses in the available objects. Any unknown
 	/// library will still be kept as an unlinked placeholder in the objects.
 	void link();
@@ -462,10 +551,35 @@ private:
 	/// @returns the metadata JSON as a compact string for the given contract.
 	std::string createMetadata(Contract const& _contract, bool _forIR) const;
 
+	/// @returns the ``settings`` section of the metadata without the per-contract
+	/// ``compilationTarget`` entry. Identical for all contracts of one compilation,
+	/// so the result is cached in @a m_metadataSettingsCache.
+	Json::Value createMetadataSettings(bool _forIR) const;
+
 	/// @returns the metadata CBOR for the given serialised metadata JSON.
 	/// @param _forIR If true, use the metadata for the IR codegen. Otherwise the one for EVM codegen.
 	bytes createCBORMetadata(Contract const& _contract, bool _forIR) const;
 
+	/// @returns the metadata CBOR for the given contract, creating and caching it in the Contract
+	/// object on first access if it matches the pipeline selected using the viaIR setting.
+	/// This avoids hashing the metadata more than once per contract.
+	bytes cborMetadata(Contract const& _contract, bool _forIR) const;
+
+	/// @returns a hash identifying the source texts of this compilation under the current
+	/// compiler version, computed on first use. Used as cache key for outputs that depend
+	/// on nothing but the sources.
+	util::h256 sourcesHash() const;
+
+	/// @returns the interface output @a _component (e.g. the ABI) for the given contract,
+	/// consulting the process-wide cache and the attached artifact cache before falling
+	/// back to @a _generate. Since the key is derived from the hash of all sources, any
+	/// source change invalidates the cached entries.
+	Json::Value interfaceOutput(
+		Contract const& _contract,
+		std::string const& _component,
+		std::function<Json::Value()> const& _generate
+	) const;
+
 	/// @returns the contract ABI as a JSON object.
 	/// This will generate the JSON object and store it in the Contract object if it is not present yet.
 	Json::Value const& contractABI(Contract const&) const;
@@ -474,6 +588,10 @@ private:
 	/// This will generate the JSON object and store it in the Contract object if it is not present yet.
 	Json::Value const& storageLayout(Contract const&) const;
 
+	/// @returns the native storage layout structure of the contract.
+	/// This will generate the structure and store it in the Contract object if it is not present yet.
+	StorageLayoutData const& storageLayoutData(Contract const&) const;
+
 	/// @returns the Natspec User documentation as a JSON object.
 	/// This will generate the JSON object and store it in the Contract object if it is not present yet.
 	Json::Value const& natspecUser(Contract const&) const;
@@ -504,6 +622,13 @@ private:
 	std::map<std::string, std::set<std::string>> m_requestedContractNames;
 	bool m_generateEvmBytecode = true;
 	bool m_generateIR = false;
+	bool m_generateIROptimized = true;
+	bool m_eagerNatspecAnalysis = true;
+	/// Whether the docstring analysis has run for the current sources, either eagerly
+	/// during analysis or on demand via ensureDocStringAnalysis().
+	bool m_docStringAnalysisDone = false;
+	unsigned m_compilationJobs = 1;
+	util::CancellationToken m_cancellationToken;
 	std::map<std::string, util::h160> m_libraries;
 	ImportRemapper m_importRemapper;
 	std::map<std::string const, Source> m_sources;
@@ -512,9 +637,32 @@ private:
 	std::shared_ptr<GlobalContext> m_globalContext;
 	std::vector<Source const*> m_sourceOrder;
 	std::map<std::string const, Contract> m_contracts;
+	/// Cache of generated Yul functions shared between the IR generators of all
+	/// contracts of one compilation. Created lazily by generateIR().
+	std::shared_ptr<IRFunctionCache> m_irFunctionCache;
+	/// Cache of compiled low-level functions shared between all contracts of one
+	/// compilation in the legacy pipeline. Created lazily by compileContract().
+	std::shared_ptr<LowLevelFunctionCache> m_lowLevelFunctionCache;
+	/// Memo table of folded constants shared between all analysis phases of one compilation,
+	/// so that each constant expression is evaluated at most once.
+	ConstantEvaluator::EvaluationCache m_constantEvaluatorCache;
+	/// On-disk cache for per-contract interface outputs, if attached. Not owned.
+	ArtifactCache const* m_artifactCache = nullptr;
+	/// Cached hash identifying the sources of this compilation. See sourcesHash().
+	mutable std::optional<util::h256> m_sourcesHash;
+	/// Cached ``settings`` section of the metadata, indexed by the ``viaIR`` flag.
+	/// See createMetadataSettings(). Cleared by reset().
+	mutable std::array<std::optional<Json::Value>, 2> m_metadataSettingsCache;
+	/// Pool of the arenas backing the AST nodes. Deliberately survives reset() so that
+	/// tearing down the ASTs returns their memory regions here and the next compilation
+	/// reuses them instead of re-faulting fresh pages, which matters for the repeated
+	/// rebuilds of the language server.
+	util::ArenaPool m_astArenaPool;
 
 	langutil::ErrorList m_errorList;
 	langutil::ErrorReporter m_errorReporter;
+	/// Serializes access to m_errorReporter from code generation worker threads.
+	std::mutex m_errorReporterMutex;
 	std::unique_ptr<experimental::Analysis> m_experimentalAnalysis;
 	bool m_metadataLiteralSources = false;
 	MetadataHash m_metadataHash = MetadataHash::IPFS;
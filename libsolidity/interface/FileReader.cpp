@@ -65,6 +65,7 @@ void FileReader::setBasePath(boost::filesystem::path const& _path)
 	}
 	else
 		m_basePath = normalizeCLIPathForVFS(_path);
+	m_canonicalAllowedPrefixes.reset();
 }
 
 void FileReader::addIncludePath(boost::filesystem::path const& _path)
@@ -72,17 +73,21 @@ void FileReader::addIncludePath(boost::filesystem::path const& _path)
 	solAssert(!m_basePath.empty(), "");
 	solAssert(!_path.empty(), "");
 	m_includePaths.push_back(normalizeCLIPathForVFS(_path));
+	m_canonicalAllowedPrefixes.reset();
 }
 
 void FileReader::allowDirectory(boost::filesystem::path _path)
 {
 	solAssert(!_path.empty(), "");
 	m_allowedDirectories.insert(std::move(_path));
+	m_canonicalAllowedPrefixes.reset();
 }
 
 void FileReader::addOrUpdateFile(boost::filesystem::path const& _path, SourceCode _source)
 {
-	m_sourceCodes[cliPathToSourceUnitName(_path)] = std::move(_source);
+	std::string sourceUnitName = cliPathToSourceUnitName(_path);
+	m_sourceUnitPaths[sourceUnitName] = normalizeCLIPathForVFS(_path);
+	m_sourceCodes[std::move(sourceUnitName)] = std::move(_source);
 }
 
 void FileReader::setStdin(SourceCode _source)
@@ -93,6 +98,11 @@ void FileReader::setStdin(SourceCode _source)
 void FileReader::setSourceUnits(StringMap _sources)
 {
 	m_sourceCodes = std::move(_sources);
+	for (auto it = m_sourceUnitPaths.begin(); it != m_sourceUnitPaths.end();)
+		if (m_sourceCodes.count(it->first) == 1)
+			++it;
+		else
+			it = m_sourceUnitPaths.erase(it);
 }
 
 ReadCallback::Result FileReader::readFile(std::string const& _kind, std::string const& _sourceUnitName)
@@ -111,7 +121,7 @@ ReadCallback::Result FileReader::readFile(std::string const& _kind, std::string
 
 		for (auto const& prefix: prefixes)
 		{
-			boost::filesystem::path canonicalPath = normalizeCLIPathForVFS(prefix / strippedSourceUnitName, SymlinkResolution::Enabled);
+			boost::filesystem::path canonicalPath = canonicalImportPath(prefix / strippedSourceUnitName);
 			if (boost::filesystem::exists(canonicalPath))
 				candidates.push_back(std::move(canonicalPath));
 		}
@@ -135,14 +145,21 @@ ReadCallback::Result FileReader::readFile(std::string const& _kind, std::string
 				"."
 			};
 
-		FileSystemPathSet allowedPaths =
-			m_allowedDirectories +
-			decltype(allowedPaths){m_basePath.empty() ? "." : m_basePath} +
-			m_includePaths;
+		{
+			// Canonicalizing the allowed directories resolves symlinks with one syscall per
+			// path component, so do it once instead of for every import.
+			std::lock_guard<std::mutex> lock(m_sourceCodesMutex);
+			if (!m_canonicalAllowedPrefixes)
+			{
+				m_canonicalAllowedPrefixes.emplace();
+				for (boost::filesystem::path const& allowedDir: allowedPaths())
+					m_canonicalAllowedPrefixes->push_back(normalizeCLIPathForVFS(allowedDir, SymlinkResolution::Enabled));
+			}
+		}
 
 		bool isAllowed = false;
-		for (boost::filesystem::path const& allowedDir: allowedPaths)
-			if (isPathPrefix(normalizeCLIPathForVFS(allowedDir, SymlinkResolution::Enabled), candidates[0]))
+		for (boost::filesystem::path const& allowedPrefix: *m_canonicalAllowedPrefixes)
+			if (isPathPrefix(allowedPrefix, candidates[0]))
 			{
 				isAllowed = true;
 				break;
@@ -152,7 +169,7 @@ ReadCallback::Result FileReader::readFile(std::string const& _kind, std::string
 			return ReadCallback::Result{
 				false,
 				"File outside of allowed directories. The following are allowed: " +
-				joinHumanReadable(allowedPaths | ranges::views::transform(pathToQuotedString), ", ") +
+				joinHumanReadable(allowedPaths() | ranges::views::transform(pathToQuotedString), ", ") +
 				"."
 			};
 
@@ -161,9 +178,13 @@ ReadCallback::Result FileReader::readFile(std::string const& _kind, std::string
 
 		// NOTE: we ignore the FileNotFound exception as we manually check above
 		auto contents = readFileAsString(candidates[0]);
-		solAssert(m_sourceCodes.count(_sourceUnitName) == 0, "");
-		m_sourceCodes[_sourceUnitName] = contents;
-		return ReadCallback::Result{true, contents};
+		{
+			std::lock_guard<std::mutex> lock(m_sourceCodesMutex);
+			solAssert(m_sourceCodes.count(_sourceUnitName) == 0, "");
+			m_sourceCodes[_sourceUnitName] = contents;
+			m_sourceUnitPaths[_sourceUnitName] = candidates[0];
+		}
+		return ReadCallback::Result{true, std::move(contents)};
 	}
 	catch (util::Exception const& _exception)
 	{
@@ -179,6 +200,40 @@ ReadCallback::Result FileReader::readFile(std::string const& _kind, std::string
 	}
 }
 
+FileReader::FileSystemPathSet FileReader::allowedPaths() const
+{
+	FileSystemPathSet allowedPaths =
+		m_allowedDirectories +
+		decltype(allowedPaths){m_basePath.empty() ? "." : m_basePath} +
+		m_includePaths;
+	return allowedPaths;
+}
+
+boost::filesystem::path FileReader::canonicalImportPath(boost::filesystem::path const& _path)
+{
+	boost::system::error_code errorCode;
+	{
+		std::lock_guard<std::mutex> lock(m_sourceCodesMutex);
+		auto it = m_canonicalPathCache.find(_path);
+		if (it != m_canonicalPathCache.end())
+		{
+			std::time_t modificationTime = boost::filesystem::last_write_time(it->second.canonicalPath, errorCode);
+			if (!errorCode && modificationTime == it->second.modificationTime)
+				return it->second.canonicalPath;
+			m_canonicalPathCache.erase(it);
+		}
+	}
+
+	boost::filesystem::path canonicalPath = normalizeCLIPathForVFS(_path, SymlinkResolution::Enabled);
+	std::time_t modificationTime = boost::filesystem::last_write_time(canonicalPath, errorCode);
+	if (!errorCode)
+	{
+		std::lock_guard<std::mutex> lock(m_sourceCodesMutex);
+		m_canonicalPathCache[_path] = CachedCanonicalPath{canonicalPath, modificationTime};
+	}
+	return canonicalPath;
+}
+
 std::string FileReader::cliPathToSourceUnitName(boost::filesystem::path const& _cliPath) const
 {
 	std::vector<boost::filesystem::path> prefixes = {m_basePath.empty() ? normalizeCLIPathForVFS(".") : m_basePath};
@@ -240,7 +295,20 @@ boost::filesystem::path FileReader::normalizeCLIPathForVFS(
 	// - Preserves case. Even if the filesystem is case-insensitive but case-preserving and the
 	//   case differs, the actual case from disk is NOT detected.
 
-	boost::filesystem::path canonicalWorkDir = boost::filesystem::weakly_canonical(boost::filesystem::current_path());
+	// Canonicalizing the working directory resolves symlinks with one syscall per path
+	// component. The result is cached per observed working directory - querying it is a
+	// single syscall and it rarely changes within a process.
+	static std::mutex canonicalWorkDirCacheMutex;
+	static std::map<boost::filesystem::path, boost::filesystem::path> canonicalWorkDirCache;
+	boost::filesystem::path workDir = boost::filesystem::current_path();
+	boost::filesystem::path canonicalWorkDir;
+	{
+		std::lock_guard<std::mutex> lock(canonicalWorkDirCacheMutex);
+		auto [it, inserted] = canonicalWorkDirCache.try_emplace(workDir);
+		if (inserted)
+			it->second = boost::filesystem::weakly_canonical(workDir);
+		canonicalWorkDir = it->second;
+	}
 
 	// NOTE: On UNIX systems the path returned from current_path() has symlinks resolved while on
 	// Windows it does not. To get consistent results we resolve them on all platforms.
@@ -22,7 +22,10 @@
 
 #include <boost/filesystem.hpp>
 
+#include <ctime>
 #include <map>
+#include <mutex>
+#include <optional>
 #include <set>
 
 namespace solidity::frontend
@@ -64,6 +67,11 @@ public:
 	/// @returns all sources by their internal source unit names.
 	StringMap const& sourceUnits() const noexcept { return m_sourceCodes; }
 
+	/// @returns the normalized filesystem paths of all source units that were loaded from
+	/// disk, either via @a addOrUpdateFile or the import callback. Source units without a
+	/// disk path, e.g. @a <stdin>, are not included.
+	PathMap const& sourceUnitPaths() const noexcept { return m_sourceUnitPaths; }
+
 	/// Resets all sources to the given map of source unit name to source codes.
 	/// Does not enforce @a allowedDirectories().
 	void setSourceUnits(StringMap _sources);
@@ -84,6 +92,7 @@ public:
 	/// @return Content of the loaded file or an error message. If the operation succeeds, a copy of
 	/// the content is retained in @a sourceUnits() under the key of @a _sourceUnitName. If the key
 	/// already exists, previous content is discarded.
+	/// May be called concurrently when the compiler is configured to use multiple jobs.
 	frontend::ReadCallback::Result readFile(std::string const& _kind, std::string const& _sourceUnitName);
 
 	frontend::ReadCallback::Callback reader()
@@ -147,6 +156,15 @@ public:
 	static bool isUNCPath(boost::filesystem::path const& _path);
 
 private:
+	/// @returns the set of directories imports are allowed to be loaded from: the allowed
+	/// directories plus base path (or the working directory) and the include paths.
+	FileSystemPathSet allowedPaths() const;
+
+	/// Normalizes @a _path with symlink resolution like @a normalizeCLIPathForVFS, caching
+	/// the result keyed by the unnormalized path. Cache entries are validated against the
+	/// modification time of the resolved file and recomputed when it changes or disappears.
+	boost::filesystem::path canonicalImportPath(boost::filesystem::path const& _path);
+
 	/// If @a _path starts with a number of .. segments, returns a path consisting only of those
 	/// segments (root name is not included). Otherwise returns an empty path. @a _path must be
 	/// absolute (or have slash as root).
@@ -166,6 +184,26 @@ private:
 
 	/// map of input files to source code strings
 	StringMap m_sourceCodes;
+
+	/// Filesystem paths of the source units in @a m_sourceCodes that came from disk.
+	PathMap m_sourceUnitPaths;
+
+	/// Symlink-resolved versions of @a allowedPaths() used for the allowed-directory check
+	/// of @a readFile. Computed lazily on the first import and invalidated whenever base
+	/// path, include paths or allowed directories change.
+	std::optional<std::vector<boost::filesystem::path>> m_canonicalAllowedPrefixes;
+
+	struct CachedCanonicalPath
+	{
+		boost::filesystem::path canonicalPath;
+		std::time_t modificationTime;
+	};
+	/// Cache for @a canonicalImportPath.
+	std::map<boost::filesystem::path, CachedCanonicalPath> m_canonicalPathCache;
+
+	/// Guards m_sourceCodes, m_sourceUnitPaths and m_canonicalPathCache against concurrent
+	/// readFile() calls.
+	std::mutex m_sourceCodesMutex;
 };
 
 }
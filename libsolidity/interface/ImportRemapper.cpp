@@ -19,6 +19,8 @@
 #include <libsolutil/CommonIO.h>
 #include <liblangutil/Exceptions.h>
 
+#include <tuple>
+
 namespace solidity::frontend
 {
 
@@ -27,11 +29,37 @@ void ImportRemapper::setRemappings(std::vector<Remapping> _remappings)
 	for (auto const& remapping: _remappings)
 		solAssert(!remapping.prefix.empty(), "");
 	m_remappings = std::move(_remappings);
+
+	// Compile the remappings into a prefix trie over their sanitized prefixes, so
+	// that a lookup only visits the remappings whose prefix matches the import path.
+	m_trie.assign(1, TrieNode{});
+	for (size_t index = 0; index < m_remappings.size(); ++index)
+	{
+		Remapping const& remapping = m_remappings[index];
+		size_t node = 0;
+		for (char component: util::sanitizePath(remapping.prefix))
+		{
+			auto child = m_trie[node].children.find(component);
+			if (child == m_trie[node].children.end())
+			{
+				size_t newNode = m_trie.size();
+				m_trie.emplace_back();
+				m_trie[node].children.emplace(component, newNode);
+				node = newNode;
+			}
+			else
+				node = child->second;
+		}
+		m_trie[node].entries.push_back({
+			util::sanitizePath(remapping.context),
+			util::sanitizePath(remapping.target),
+			index
+		});
+	}
 }
 
 SourceUnitName ImportRemapper::apply(ImportPath const& _path, std::string const& _context) const
 {
-	// Try to find the longest prefix match in all remappings that are active in the current context.
 	auto isPrefixOf = [](std::string const& _a, std::string const& _b)
 	{
 		if (_a.length() > _b.length())
@@ -39,33 +67,49 @@ SourceUnitName ImportRemapper::apply(ImportPath const& _path, std::string const&
 		return equal(_a.begin(), _a.end(), _b.begin());
 	};
 
+	// Walk the path through the trie and pick the best match among the remappings
+	// encountered, preferring a longer context, then a longer prefix and finally
+	// the remapping given last.
 	size_t longestPrefix = 0;
 	size_t longestContext = 0;
-	std::string bestMatchTarget;
+	size_t bestIndex = 0;
+	std::string const* bestMatchTarget = nullptr;
 
-	for (auto const& redir: m_remappings)
+	if (!m_trie.empty())
 	{
-		std::string context = util::sanitizePath(redir.context);
-		std::string prefix = util::sanitizePath(redir.prefix);
-
-		// Skip if current context is closer
-		if (context.length() < longestContext)
-			continue;
-		// Skip if redir.context is not a prefix of _context
-		if (!isPrefixOf(context, _context))
-			continue;
-		// Skip if we already have a closer prefix match.
-		if (prefix.length() < longestPrefix && context.length() == longestContext)
-			continue;
-		// Skip if the prefix does not match.
-		if (!isPrefixOf(prefix, _path))
-			continue;
-
-		longestContext = context.length();
-		longestPrefix = prefix.length();
-		bestMatchTarget = util::sanitizePath(redir.target);
+		size_t node = 0;
+		size_t depth = 0;
+		while (true)
+		{
+			for (TrieNode::Entry const& entry: m_trie[node].entries)
+			{
+				// Skip if entry.context is not a prefix of _context
+				if (!isPrefixOf(entry.context, _context))
+					continue;
+				// Skip if we already have a better match.
+				if (
+					bestMatchTarget &&
+					std::make_tuple(longestContext, longestPrefix, bestIndex) >
+					std::make_tuple(entry.context.length(), depth, entry.index)
+				)
+					continue;
+
+				longestContext = entry.context.length();
+				longestPrefix = depth;
+				bestIndex = entry.index;
+				bestMatchTarget = &entry.target;
+			}
+			if (depth >= _path.length())
+				break;
+			auto child = m_trie[node].children.find(_path[depth]);
+			if (child == m_trie[node].children.end())
+				break;
+			node = child->second;
+			++depth;
+		}
 	}
-	std::string path = bestMatchTarget;
+
+	std::string path = bestMatchTarget ? *bestMatchTarget : std::string{};
 	path.append(_path.begin() + static_cast<std::string::difference_type>(longestPrefix), _path.end());
 	return path;
 }
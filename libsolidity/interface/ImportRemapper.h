@@ -17,6 +17,7 @@
 // SPDX-License-Identifier: GPL-3.0
 #pragma once
 
+#include <map>
 #include <optional>
 #include <string>
 #include <vector>
@@ -49,7 +50,7 @@ public:
 		std::string target;
 	};
 
-	void clear() { m_remappings.clear(); }
+	void clear() { m_remappings.clear(); m_trie.clear(); }
 
 	void setRemappings(std::vector<Remapping> _remappings);
 	std::vector<Remapping> const& remappings() const noexcept { return m_remappings; }
@@ -63,9 +64,30 @@ public:
 	static std::optional<Remapping> parseRemapping(std::string_view _input);
 
 private:
+	/// Node of the prefix trie built over the sanitized remapping prefixes.
+	struct TrieNode
+	{
+		/// A remapping whose sanitized prefix ends at this node.
+		struct Entry
+		{
+			std::string context;
+			std::string target;
+			/// Position of the remapping in m_remappings, used for tie-breaking.
+			size_t index = 0;
+		};
+
+		std::map<char, size_t> children;
+		std::vector<Entry> entries;
+	};
+
 	/// list of path prefix remappings, e.g. mylibrary: github.com/ethereum = /usr/local/ethereum
 	/// "context:prefix=target"
 	std::vector<Remapping> m_remappings = {};
+
+	/// Prefix trie over the sanitized remapping prefixes, rebuilt by setRemappings,
+	/// with the root at index zero. Lets apply() visit only the remappings whose
+	/// prefix matches the import path instead of scanning all of them.
+	std::vector<TrieNode> m_trie = {};
 };
 
 }
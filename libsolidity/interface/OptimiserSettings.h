@@ -123,7 +123,8 @@ struct OptimiserSettings
 			optimizeStackAllocation == _other.optimizeStackAllocation &&
 			runYulOptimiser == _other.runYulOptimiser &&
 			yulOptimiserSteps == _other.yulOptimiserSteps &&
-			expectedExecutionsPerDeployment == _other.expectedExecutionsPerDeployment;
+			expectedExecutionsPerDeployment == _other.expectedExecutionsPerDeployment &&
+			stackLayoutGenerationBudget == _other.stackLayoutGenerationBudget;
 	}
 
 	bool operator!=(OptimiserSettings const& _other) const
@@ -165,6 +166,12 @@ struct OptimiserSettings
 	/// This specifies an estimate on how often each opcode in this assembly will be executed,
 	/// i.e. use a small value to optimise for size and a large value to optimise for runtime gas usage.
 	size_t expectedExecutionsPerDeployment = 200;
+	/// Upper bound on the number of stack shuffling steps spent per Yul function searching for
+	/// an optimal stack layout during code generation. Functions exceeding the budget fall back
+	/// to a cheap greedy layout for their remaining operations, which can require additional
+	/// shuffling at runtime, but speeds up compilation of very large machine-generated functions
+	/// considerably. A value of zero means no limit.
+	size_t stackLayoutGenerationBudget = 0;
 };
 
 }
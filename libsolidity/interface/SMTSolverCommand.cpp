@@ -21,7 +21,6 @@
 
 #include <libsolutil/CommonIO.h>
 #include <libsolutil/Exceptions.h>
-#include <libsolutil/Keccak256.h>
 #include <libsolutil/TemporaryDirectory.h>
 
 #include <boost/algorithm/string/join.hpp>
@@ -30,6 +29,10 @@
 #include <boost/filesystem/fstream.hpp>
 #include <boost/process.hpp>
 
+#include <chrono>
+#include <optional>
+#include <vector>
+
 using solidity::langutil::InternalCompilerError;
 using solidity::util::errinfo_comment;
 
@@ -37,8 +40,92 @@ using solidity::util::errinfo_comment;
 namespace solidity::frontend
 {
 
+namespace
+{
+
+/// @returns the command line arguments that make the given solver read SMT-LIB2 commands
+/// from its standard input until it exits, or nullopt if the solver is not known to
+/// support that mode. Solvers without such a mode are run once per query on a query file.
+std::optional<std::vector<std::string>> incrementalArguments(std::string const& _solverCmd)
+{
+	if (_solverCmd == "z3")
+		return std::vector<std::string>{"-smt2", "-in"};
+	if (_solverCmd == "cvc5" || _solverCmd == "cvc4")
+		return std::vector<std::string>{"--lang", "smt2", "--incremental"};
+	return std::nullopt;
+}
+
+}
+
+/**
+ * A long-lived solver process speaking SMT-LIB2 over its standard streams. Each query is
+ * wrapped into a push/pop scope, so consecutive queries reuse the warm process instead of
+ * paying the spawn and startup cost per check.
+ */
+class SMTSolverProcess
+{
+public:
+	SMTSolverProcess(boost::filesystem::path const& _binary, std::vector<std::string> const& _arguments):
+		m_child(
+			_binary,
+			boost::process::args(_arguments),
+			boost::process::std_out > m_output,
+			boost::process::std_in < m_input
+		)
+	{}
+
+	~SMTSolverProcess()
+	{
+		try
+		{
+			m_input << "(exit)" << std::endl;
+			m_input.pipe().close();
+			if (!m_child.wait_for(std::chrono::seconds(2)))
+				m_child.terminate();
+		}
+		catch (...)
+		{
+			try { m_child.terminate(); } catch (...) {}
+		}
+	}
+
+	bool running()
+	{
+		return m_child.running();
+	}
+
+	/// Sends @a _query to the solver in a fresh push/pop scope and @returns its output.
+	std::string query(std::string const& _query)
+	{
+		// The response has no terminator of its own, so an echoed sentinel marks its end.
+		// Some solvers echo the quotes of the string literal, some do not.
+		static std::string const sentinel = "@solc-query-done";
+		m_input << "(push 1)\n" << _query << "\n(pop 1)\n(echo \"" << sentinel << "\")" << std::endl;
+
+		std::vector<std::string> data;
+		std::string line;
+		while (std::getline(m_output, line))
+		{
+			if (!line.empty() && line.back() == '\r')
+				line.pop_back();
+			if (line == sentinel || line == "\"" + sentinel + "\"")
+				break;
+			if (!line.empty())
+				data.push_back(line);
+		}
+		return boost::join(data, "\n");
+	}
+
+private:
+	boost::process::opstream m_input;
+	boost::process::ipstream m_output;
+	boost::process::child m_child;
+};
+
 SMTSolverCommand::SMTSolverCommand(std::string _solverCmd) : m_solverCmd(_solverCmd) {}
 
+SMTSolverCommand::~SMTSolverCommand() = default;
+
 ReadCallback::Result SMTSolverCommand::solve(std::string const& _kind, std::string const& _query)
 {
 	try
@@ -46,12 +133,29 @@ ReadCallback::Result SMTSolverCommand::solve(std::string const& _kind, std::stri
 		if (_kind != ReadCallback::kindString(ReadCallback::Kind::SMTQuery))
 			solAssert(false, "SMTQuery callback used as callback kind " + _kind);
 
-		auto tempDir = solidity::util::TemporaryDirectory("smt");
-		util::h256 queryHash = util::keccak256(_query);
-		auto queryFileName = tempDir.path() / ("query_" + queryHash.hex() + ".smt2");
-
-		auto queryFile = boost::filesystem::ofstream(queryFileName);
-		queryFile << _query;
+		if (std::optional<std::vector<std::string>> arguments = incrementalArguments(m_solverCmd))
+		{
+			auto solverBin = boost::process::search_path(m_solverCmd);
+			if (solverBin.empty())
+				return ReadCallback::Result{false, m_solverCmd + " binary not found."};
+
+			std::lock_guard<std::mutex> lock(m_processMutex);
+			if (!m_process || !m_process->running())
+				m_process = std::make_unique<SMTSolverProcess>(solverBin, *arguments);
+			return ReadCallback::Result{true, m_process->query(_query)};
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_tempDirMutex);
+			if (!m_tempDir)
+				m_tempDir = std::make_unique<util::TemporaryDirectory>("smt");
+		}
+		auto queryFileName = m_tempDir->path() / ("query_" + std::to_string(m_queryCounter++) + ".smt2");
+
+		{
+			auto queryFile = boost::filesystem::ofstream(queryFileName);
+			queryFile << _query;
+		}
 
 		auto eldBin = boost::process::search_path(m_solverCmd);
 
@@ -73,6 +177,9 @@ ReadCallback::Result SMTSolverCommand::solve(std::string const& _kind, std::stri
 
 		eld.wait();
 
+		boost::system::error_code ignored;
+		boost::filesystem::remove(queryFileName, ignored);
+
 		return ReadCallback::Result{true, boost::join(data, "\n")};
 	}
 	catch (...)
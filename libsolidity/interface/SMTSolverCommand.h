@@ -19,16 +19,25 @@
 
 #include <libsolidity/interface/ReadFile.h>
 
+#include <libsolutil/TemporaryDirectory.h>
+
 #include <boost/filesystem.hpp>
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+
 namespace solidity::frontend
 {
 
+class SMTSolverProcess;
+
 /// SMTSolverCommand wraps an SMT solver called via its binary in the OS.
 class SMTSolverCommand
 {
 public:
 	SMTSolverCommand(std::string _solverCmd);
+	~SMTSolverCommand();
 
 	/// Calls an SMT solver with the given query.
 	frontend::ReadCallback::Result solve(std::string const& _kind, std::string const& _query);
@@ -41,6 +50,22 @@ public:
 private:
 	/// The name of the solver's binary.
 	std::string const m_solverCmd;
+	/// Long-lived solver process reused between queries, started lazily when the solver
+	/// supports reading SMT-LIB2 from its standard input. If the solver does not, every
+	/// query spawns a fresh process reading the query from a file.
+	std::unique_ptr<SMTSolverProcess> m_process;
+	/// Serializes access to @a m_process, since queries can be issued concurrently,
+	/// e.g. by portfolio solving.
+	std::mutex m_processMutex;
+	/// Scratch directory shared by all queries of solvers that can only read their
+	/// query from a file. Created lazily on the first such query and kept for the
+	/// lifetime of this object, so that consecutive queries do not create and tear
+	/// down a directory each.
+	std::unique_ptr<util::TemporaryDirectory> m_tempDir;
+	/// Guards the lazy creation of @a m_tempDir.
+	std::mutex m_tempDirMutex;
+	/// Distinguishes the query files of concurrent queries within @a m_tempDir.
+	std::atomic<unsigned> m_queryCounter{0};
 };
 
 }
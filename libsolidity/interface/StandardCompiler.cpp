@@ -37,12 +37,15 @@
 
 #include <libsolutil/JSON.h>
 #include <libsolutil/Keccak256.h>
+#include <libsolutil/Common.h>
 #include <libsolutil/CommonData.h>
 
 #include <boost/algorithm/string/predicate.hpp>
 
 #include <algorithm>
 #include <optional>
+#include <sstream>
+#include <string_view>
 
 using namespace solidity;
 using namespace solidity::yul;
@@ -164,11 +167,14 @@ std::map<std::string, std::set<std::string>> requestedContractNames(Json::Value
 }
 
 /// Returns true iff @a _hash (hex with 0x prefix) is the Keccak256 hash of the binary data in @a _content.
-bool hashMatchesContent(std::string const& _hash, std::string const& _content)
+bool hashMatchesContent(std::string const& _hash, std::string_view _content)
 {
 	try
 	{
-		return util::h256(_hash) == util::keccak256(_content);
+		return util::h256(_hash) == util::keccak256(util::bytesConstRef{
+			reinterpret_cast<unsigned char const*>(_content.data()),
+			_content.size()
+		});
 	}
 	catch (util::BadHexCharacter const&)
 	{
@@ -178,7 +184,7 @@ bool hashMatchesContent(std::string const& _hash, std::string const& _content)
 
 bool isArtifactRequested(Json::Value const& _outputSelection, std::string const& _artifact, bool _wildcardMatchesExperimental)
 {
-	static std::set<std::string> experimental{"ir", "irAst", "irOptimized", "irOptimizedAst"};
+	static std::set<std::string> experimental{"ir", "irAst", "irOptimized", "irOptimizedAst", "evm.cfg"};
 	for (auto const& selectedArtifactJson: _outputSelection)
 	{
 		std::string const& selectedArtifact = selectedArtifactJson.asString();
@@ -263,7 +269,7 @@ bool isBinaryRequested(Json::Value const& _outputSelection)
 	static std::vector<std::string> const outputsThatRequireBinaries = std::vector<std::string>{
 		"*",
 		"ir", "irAst", "irOptimized", "irOptimizedAst",
-		"evm.gasEstimates", "evm.legacyAssembly", "evm.assembly"
+		"evm.cfg", "evm.gasEstimates", "evm.legacyAssembly", "evm.assembly"
 	} + evmObjectComponents("bytecode") + evmObjectComponents("deployedBytecode");
 
 	for (auto const& fileRequests: _outputSelection)
@@ -274,6 +280,27 @@ bool isBinaryRequested(Json::Value const& _outputSelection)
 	return false;
 }
 
+/// @returns true if an output containing natspec documentation was requested. Binaries are
+/// not considered here even though generating them involves natspec (via the metadata hash
+/// appended to the bytecode) - check @a isBinaryRequested separately for that.
+bool isNatspecRequested(Json::Value const& _outputSelection)
+{
+	if (!_outputSelection.isObject())
+		return false;
+
+	static std::vector<std::string> const outputsThatRequireNatspec{
+		"*",
+		"metadata", "userdoc", "devdoc"
+	};
+
+	for (auto const& fileRequests: _outputSelection)
+		for (auto const& requests: fileRequests)
+			for (auto const& output: outputsThatRequireNatspec)
+				if (isArtifactRequested(requests, output, false))
+					return true;
+	return false;
+}
+
 /// @returns true if EVM bytecode was requested, i.e. we have to run the old code generator.
 bool isEvmBytecodeRequested(Json::Value const& _outputSelection)
 {
@@ -294,7 +321,7 @@ bool isEvmBytecodeRequested(Json::Value const& _outputSelection)
 }
 
 /// @returns true if any Yul IR was requested. Note that as an exception, '*' does not
-/// yet match "ir", "irAst", "irOptimized" or "irOptimizedAst"
+/// yet match "ir", "irAst", "irOptimized", "irOptimizedAst" or "evm.cfg"
 bool isIRRequested(Json::Value const& _outputSelection)
 {
 	if (!_outputSelection.isObject())
@@ -307,13 +334,130 @@ bool isIRRequested(Json::Value const& _outputSelection)
 					request == "ir" ||
 					request == "irAst" ||
 					request == "irOptimized" ||
-					request == "irOptimizedAst"
+					request == "irOptimizedAst" ||
+					request == "evm.cfg"
+				)
+					return true;
+
+	return false;
+}
+
+/// @returns true if an output derived from the optimized Yul IR was requested, i.e. the
+/// Yul optimiser has to run even if no bytecode is generated via IR. Like for
+/// @a isIRRequested, '*' does not match these outputs.
+bool isOptimizedIRRequested(Json::Value const& _outputSelection)
+{
+	if (!_outputSelection.isObject())
+		return false;
+
+	for (auto const& fileRequests: _outputSelection)
+		for (auto const& requests: fileRequests)
+			for (auto const& request: requests)
+				if (
+					request == "irOptimized" ||
+					request == "irOptimizedAst" ||
+					request == "evm.cfg"
 				)
 					return true;
 
 	return false;
 }
 
+/// Merges the output selections of several batch requests into a single selection
+/// that requests the union of all their artifacts.
+Json::Value mergeOutputSelections(std::vector<Json::Value> const& _selections)
+{
+	Json::Value merged = Json::objectValue;
+	for (Json::Value const& selection: _selections)
+	{
+		if (!selection.isObject())
+			continue;
+		for (std::string const& file: selection.getMemberNames())
+		{
+			if (!selection[file].isObject())
+				continue;
+			for (std::string const& contract: selection[file].getMemberNames())
+			{
+				Json::Value& artifacts = merged[file][contract];
+				if (!artifacts.isArray())
+					artifacts = Json::arrayValue;
+				for (auto const& artifact: selection[file][contract])
+				{
+					bool present = false;
+					for (auto const& existing: artifacts)
+						if (existing == artifact)
+						{
+							present = true;
+							break;
+						}
+					if (!present)
+						artifacts.append(artifact);
+				}
+			}
+		}
+	}
+	return merged;
+}
+
+/// Removes all artifacts from @a _output that are not covered by @a _selection.
+/// Used to derive per-request outputs from a compilation that was run with the
+/// union of the output selections of a batch.
+Json::Value pruneOutputByOutputSelection(Json::Value _output, Json::Value const& _selection)
+{
+	bool const wildcardMatchesExperimental = false;
+	if (_output.isMember("sources"))
+		for (std::string const& sourceName: _output["sources"].getMemberNames())
+			if (
+				_output["sources"][sourceName].isMember("ast") &&
+				!isArtifactRequested(_selection, sourceName, "", "ast", wildcardMatchesExperimental)
+			)
+				_output["sources"][sourceName].removeMember("ast");
+	if (_output.isMember("contracts"))
+	{
+		Json::Value prunedContracts = Json::objectValue;
+		for (std::string const& file: _output["contracts"].getMemberNames())
+			for (std::string const& name: _output["contracts"][file].getMemberNames())
+			{
+				Json::Value const& contractData = _output["contracts"][file][name];
+				Json::Value prunedData = Json::objectValue;
+				for (std::string const& artifact: contractData.getMemberNames())
+					if (artifact == "evm")
+					{
+						Json::Value evmData = Json::objectValue;
+						for (std::string const& evmArtifact: contractData["evm"].getMemberNames())
+							if (evmArtifact == "bytecode" || evmArtifact == "deployedBytecode")
+							{
+								Json::Value evmObject = Json::objectValue;
+								for (std::string const& element: contractData["evm"][evmArtifact].getMemberNames())
+									if (isArtifactRequested(
+										_selection,
+										file,
+										name,
+										"evm." + evmArtifact + "." + element,
+										wildcardMatchesExperimental
+									))
+										evmObject[element] = contractData["evm"][evmArtifact][element];
+								if (!evmObject.empty())
+									evmData[evmArtifact] = std::move(evmObject);
+							}
+							else if (isArtifactRequested(_selection, file, name, "evm." + evmArtifact, wildcardMatchesExperimental))
+								evmData[evmArtifact] = contractData["evm"][evmArtifact];
+						if (!evmData.empty())
+							prunedData["evm"] = std::move(evmData);
+					}
+					else if (isArtifactRequested(_selection, file, name, artifact, wildcardMatchesExperimental))
+						prunedData[artifact] = contractData[artifact];
+				if (!prunedData.empty())
+					prunedContracts[file][name] = std::move(prunedData);
+			}
+		if (prunedContracts.empty())
+			_output.removeMember("contracts");
+		else
+			_output["contracts"] = std::move(prunedContracts);
+	}
+	return _output;
+}
+
 Json::Value formatLinkReferences(std::map<size_t, std::string> const& linkReferences)
 {
 	Json::Value ret{Json::objectValue};
@@ -423,13 +567,13 @@ std::optional<Json::Value> checkAuxiliaryInputKeys(Json::Value const& _input)
 
 std::optional<Json::Value> checkSettingsKeys(Json::Value const& _input)
 {
-	static std::set<std::string> keys{"debug", "evmVersion", "libraries", "metadata", "modelChecker", "optimizer", "outputSelection", "remappings", "stopAfter", "viaIR"};
+	static std::set<std::string> keys{"debug", "evmVersion", "jobs", "libraries", "metadata", "modelChecker", "optimizer", "outputSelection", "remappings", "stopAfter", "viaIR"};
 	return checkKeys(_input, keys, "settings");
 }
 
 std::optional<Json::Value> checkModelCheckerSettingsKeys(Json::Value const& _input)
 {
-	static std::set<std::string> keys{"bmcLoopIterations", "contracts", "divModNoSlacks", "engine", "extCalls", "invariants", "printQuery", "showProvedSafe", "showUnproved", "showUnsupported", "solvers", "targets", "timeout"};
+	static std::set<std::string> keys{"bmcLoopIterations", "contracts", "divModNoSlacks", "engine", "extCalls", "invariants", "noCounterexamples", "printQuery", "showProvedSafe", "showUnproved", "showUnsupported", "solvers", "targets", "timeout", "timeoutLadder"};
 	return checkKeys(_input, keys, "modelChecker");
 }
 
@@ -665,7 +809,12 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 
 			if (sources[sourceName]["content"].isString())
 			{
-				std::string content = sources[sourceName]["content"].asString();
+				// Access the string inside the JSON value directly instead of
+				// copying it just for the hash check.
+				char const* contentBegin = nullptr;
+				char const* contentEnd = nullptr;
+				sources[sourceName]["content"].getString(&contentBegin, &contentEnd);
+				std::string_view content{contentBegin, static_cast<size_t>(contentEnd - contentBegin)};
 				if (!hash.empty() && !hashMatchesContent(hash, content))
 					ret.errors.append(formatError(
 						Error::Type::IOError,
@@ -673,7 +822,7 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 						"Mismatch between content and supplied hash for \"" + sourceName + "\""
 					));
 				else
-					ret.sources[sourceName] = content;
+					ret.sources[sourceName] = std::string(content);
 			}
 			else if (sources[sourceName]["urls"].isArray())
 			{
@@ -790,6 +939,13 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 		ret.viaIR = settings["viaIR"].asBool();
 	}
 
+	if (settings.isMember("jobs"))
+	{
+		if (!settings["jobs"].isUInt() || settings["jobs"].asUInt() == 0)
+			return formatFatalError(Error::Type::JSONError, "\"settings.jobs\" must be an unsigned integer greater than zero.");
+		ret.compilationJobs = settings["jobs"].asUInt();
+	}
+
 	if (settings.isMember("evmVersion"))
 	{
 		if (!settings["evmVersion"].isString())
@@ -1062,6 +1218,14 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 		ret.modelCheckerSettings.invariants = invariants;
 	}
 
+	if (modelCheckerSettings.isMember("noCounterexamples"))
+	{
+		auto const& noCounterexamples = modelCheckerSettings["noCounterexamples"];
+		if (!noCounterexamples.isBool())
+			return formatFatalError(Error::Type::JSONError, "settings.modelChecker.noCounterexamples must be a Boolean value.");
+		ret.modelCheckerSettings.noCounterexamples = noCounterexamples.asBool();
+	}
+
 	if (modelCheckerSettings.isMember("showProvedSafe"))
 	{
 		auto const& showProvedSafe = modelCheckerSettings["showProvedSafe"];
@@ -1144,6 +1308,13 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 		ret.modelCheckerSettings.timeout = modelCheckerSettings["timeout"].asUInt();
 	}
 
+	if (modelCheckerSettings.isMember("timeoutLadder"))
+	{
+		if (!modelCheckerSettings["timeoutLadder"].isBool())
+			return formatFatalError(Error::Type::JSONError, "settings.modelChecker.timeoutLadder must be a Boolean value.");
+		ret.modelCheckerSettings.timeoutLadder = modelCheckerSettings["timeoutLadder"].asBool();
+	}
+
 	return {std::move(ret)};
 }
 
@@ -1174,6 +1345,7 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 	for (auto const& smtLib2Response: _inputsAndSettings.smtLib2Responses)
 		compilerStack.addSMTLib2Response(smtLib2Response.first, smtLib2Response.second);
 	compilerStack.setViaIR(_inputsAndSettings.viaIR);
+	compilerStack.setCompilationJobs(_inputsAndSettings.compilationJobs);
 	compilerStack.setEVMVersion(_inputsAndSettings.evmVersion);
 	compilerStack.setRemappings(std::move(_inputsAndSettings.remappings));
 	compilerStack.setOptimiserSettings(std::move(_inputsAndSettings.optimiserSettings));
@@ -1186,14 +1358,26 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 	compilerStack.setMetadataHash(_inputsAndSettings.metadataHash);
 	compilerStack.setRequestedContractNames(requestedContractNames(_inputsAndSettings.outputSelection));
 	compilerStack.setModelCheckerSettings(_inputsAndSettings.modelCheckerSettings);
+	if (m_artifactCache)
+		compilerStack.setArtifactCache(&*m_artifactCache);
 
 	compilerStack.enableEvmBytecodeGeneration(isEvmBytecodeRequested(_inputsAndSettings.outputSelection));
 	compilerStack.enableIRGeneration(isIRRequested(_inputsAndSettings.outputSelection));
+	compilerStack.enableIROptimization(isOptimizedIRRequested(_inputsAndSettings.outputSelection));
 
 	Json::Value errors = std::move(_inputsAndSettings.errors);
 
 	bool const binariesRequested = isBinaryRequested(_inputsAndSettings.outputSelection);
 
+	// The natspec analysis may only be deferred if nothing can trigger it after the errors
+	// have been collected into the output - diagnostics produced while serializing the
+	// per-contract outputs would be lost. Binaries count as well since the metadata hash
+	// embedded in the bytecode includes the documentation.
+	compilerStack.setEagerNatspecAnalysis(
+		binariesRequested ||
+		isNatspecRequested(_inputsAndSettings.outputSelection)
+	);
+
 	try
 	{
 		if (_inputsAndSettings.language == "SolidityAST")
@@ -1385,6 +1569,8 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 			contractData["userdoc"] = compilerStack.natspecUser(contractName);
 		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "devdoc", wildcardMatchesExperimental))
 			contractData["devdoc"] = compilerStack.natspecDev(contractName);
+		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "selectors", wildcardMatchesExperimental))
+			contractData["selectors"] = compilerStack.interfaceSymbols(contractName);
 
 		// IR
 		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "ir", wildcardMatchesExperimental))
@@ -1404,6 +1590,8 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 			evmData["legacyAssembly"] = compilerStack.assemblyJSON(contractName);
 		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.methodIdentifiers", wildcardMatchesExperimental))
 			evmData["methodIdentifiers"] = compilerStack.interfaceSymbols(contractName)["methods"];
+		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.cfg", wildcardMatchesExperimental))
+			evmData["cfg"] = compilerStack.yulCFGJson(contractName);
 		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.gasEstimates", wildcardMatchesExperimental))
 			evmData["gasEstimates"] = compilerStack.gasEstimates(contractName);
 
@@ -1611,24 +1799,73 @@ Json::Value StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 }
 
 
+void StandardCompiler::setArtifactCacheDirectory(boost::filesystem::path const& _directory)
+{
+	m_artifactCache.emplace(_directory);
+	// The optimised Yul objects live in the same directory, distinguished by their file
+	// extension. Unlike the artifact cache they also serve hits across differing inputs
+	// that compile identical code.
+	yul::YulStack::setOptimisedObjectCacheDirectory(_directory.string());
+}
+
 Json::Value StandardCompiler::compile(Json::Value const& _input) noexcept
+{
+	return compileImpl(_input, nullptr);
+}
+
+Json::Value StandardCompiler::compileImpl(Json::Value const& _input, Json::Value* _inputToRelease) noexcept
 {
 	YulStringRepository::reset();
 
+	std::optional<util::h256> cacheKey;
+	if (m_artifactCache)
+	{
+		cacheKey = ArtifactCache::computeKey(_input);
+		if (std::optional<Json::Value> cached = m_artifactCache->lookup(*cacheKey))
+			return std::move(*cached);
+	}
+
+	// Outputs that depend on the import callback cannot be cached since the
+	// referenced files are not part of the input and may change between runs.
+	bool importCallbackUsed = false;
+	ReadCallback::Callback originalReadFile;
+	if (m_artifactCache && m_readFile)
+	{
+		originalReadFile = std::move(m_readFile);
+		m_readFile = [&importCallbackUsed, &originalReadFile](std::string const& _kind, std::string const& _path)
+		{
+			importCallbackUsed = true;
+			return originalReadFile(_kind, _path);
+		};
+	}
+	util::ScopeGuard restoreReadFile([&]() {
+		if (originalReadFile)
+			m_readFile = std::move(originalReadFile);
+	});
+
 	try
 	{
 		auto parsed = parseInput(_input);
+		// The input tree embeds all source texts; release it as soon as they have
+		// been copied out, so it does not add to the peak memory use of the
+		// compilation. Note that _input must not be used below this point.
+		if (_inputToRelease)
+			*_inputToRelease = Json::Value();
 		if (std::holds_alternative<Json::Value>(parsed))
 			return std::get<Json::Value>(std::move(parsed));
 		InputsAndSettings settings = std::get<InputsAndSettings>(std::move(parsed));
+		Json::Value output;
 		if (settings.language == "Solidity")
-			return compileSolidity(std::move(settings));
+			output = compileSolidity(std::move(settings));
 		else if (settings.language == "Yul")
-			return compileYul(std::move(settings));
+			output = compileYul(std::move(settings));
 		else if (settings.language == "SolidityAST")
-			return compileSolidity(std::move(settings));
+			output = compileSolidity(std::move(settings));
 		else
 			return formatFatalError(Error::Type::JSONError, "Only \"Solidity\", \"Yul\" or \"SolidityAST\" is supported as a language.");
+		if (m_artifactCache && cacheKey && !importCallbackUsed)
+			m_artifactCache->store(*cacheKey, output);
+		return output;
 	}
 	catch (Json::LogicError const& _exception)
 	{
@@ -1648,31 +1885,100 @@ Json::Value StandardCompiler::compile(Json::Value const& _input) noexcept
 	}
 }
 
+Json::Value StandardCompiler::compileBatch(Json::Value const& _batchInput) noexcept
+{
+	try
+	{
+		if (!_batchInput.isArray())
+			return formatFatalError(Error::Type::JSONError, "Batch input must be an array of standard JSON inputs.");
+
+		// Strips the output selection from a request so that requests over the same
+		// source set and settings compare equal and can share one compilation.
+		auto coreInputAndSelection = [](Json::Value _entry) -> std::pair<Json::Value, Json::Value>
+		{
+			Json::Value selection = Json::objectValue;
+			if (_entry.isObject() && _entry["settings"].isObject() && _entry["settings"].isMember("outputSelection"))
+			{
+				selection = _entry["settings"]["outputSelection"];
+				_entry["settings"].removeMember("outputSelection");
+			}
+			return {std::move(_entry), std::move(selection)};
+		};
+
+		Json::Value results = Json::arrayValue;
+		Json::ArrayIndex i = 0;
+		while (i < _batchInput.size())
+		{
+			auto [coreInput, selection] = coreInputAndSelection(_batchInput[i]);
+			std::vector<Json::Value> selections{std::move(selection)};
+			Json::ArrayIndex next = i + 1;
+			while (next < _batchInput.size())
+			{
+				auto [nextCoreInput, nextSelection] = coreInputAndSelection(_batchInput[next]);
+				if (nextCoreInput != coreInput)
+					break;
+				selections.emplace_back(std::move(nextSelection));
+				++next;
+			}
+			if (selections.size() == 1)
+				results.append(compile(_batchInput[i]));
+			else
+			{
+				Json::Value unionInput = std::move(coreInput);
+				unionInput["settings"]["outputSelection"] = mergeOutputSelections(selections);
+				Json::Value unionOutput = compileImpl(unionInput, &unionInput);
+				for (Json::Value const& requestedSelection: selections)
+					results.append(pruneOutputByOutputSelection(unionOutput, requestedSelection));
+			}
+			i = next;
+		}
+		return results;
+	}
+	catch (...)
+	{
+		return formatFatalError(
+			Error::Type::InternalCompilerError,
+			"Internal exception in StandardCompiler::compileBatch: " + boost::current_exception_diagnostic_information()
+		);
+	}
+}
+
 std::string StandardCompiler::compile(std::string const& _input) noexcept
+{
+	std::ostringstream outputStream;
+	compile(_input, outputStream);
+	return outputStream.str();
+}
+
+void StandardCompiler::compile(std::string const& _input, std::ostream& _outputStream) noexcept
 {
 	Json::Value input;
 	std::string errors;
 	try
 	{
 		if (!util::jsonParseStrict(_input, input, &errors))
-			return util::jsonPrint(formatFatalError(Error::Type::JSONError, errors), m_jsonPrintingFormat);
+		{
+			util::jsonPrint(formatFatalError(Error::Type::JSONError, errors), m_jsonPrintingFormat, _outputStream);
+			return;
+		}
 	}
 	catch (...)
 	{
-		return "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error parsing input JSON.\"}]}";
+		_outputStream << "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error parsing input JSON.\"}]}";
+		return;
 	}
 
 	// cout << "Input: " << input.toStyledString() << endl;
-	Json::Value output = compile(input);
+	Json::Value output = input.isArray() ? compileBatch(input) : compileImpl(input, &input);
 	// cout << "Output: " << output.toStyledString() << endl;
 
 	try
 	{
-		return util::jsonPrint(output, m_jsonPrintingFormat);
+		util::jsonPrint(output, m_jsonPrintingFormat, _outputStream);
 	}
 	catch (...)
 	{
-		return "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error writing output JSON.\"}]}";
+		_outputStream << "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error writing output JSON.\"}]}";
 	}
 }
 
@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <libsolidity/interface/ArtifactCache.h>
 #include <libsolidity/interface/CompilerStack.h>
 #include <libsolutil/JSON.h>
 
@@ -56,12 +57,31 @@ public:
 	{
 	}
 
+	/// Enables the on-disk artifact cache rooted at @a _directory. Subsequent calls to
+	/// compile will short-circuit for inputs whose output was already cached and store
+	/// the output of fresh compilations. Outputs that depend on the import callback
+	/// (i.e. on files outside of the input JSON) are never cached.
+	/// Also enables the on-disk cache of optimised Yul objects in the same directory,
+	/// which is shared between inputs that compile identical code.
+	void setArtifactCacheDirectory(boost::filesystem::path const& _directory);
+
 	/// Sets all input parameters according to @a _input which conforms to the standardized input
 	/// format, performs compilation and returns a standardized output.
 	Json::Value compile(Json::Value const& _input) noexcept;
+	/// Compiles a batch of standardized inputs and returns an array with one standardized
+	/// output per input. Consecutive inputs that differ only in their output selection are
+	/// compiled only once, with the union of the requested outputs, and each of them
+	/// receives only the artifacts it selected. Note that reported errors and warnings then
+	/// reflect the union of the batch's requested outputs.
+	Json::Value compileBatch(Json::Value const& _batchInput) noexcept;
 	/// Parses input as JSON and peforms the above processing steps, returning a serialized JSON
-	/// output. Parsing errors are returned as regular errors.
+	/// output. A top-level array is processed as a batch via compileBatch(). Parsing errors are
+	/// returned as regular errors.
 	std::string compile(std::string const& _input) noexcept;
+	/// Same as above, but serializes the output directly into the given stream. In compact
+	/// printing mode this avoids materializing the whole serialized output in memory, which
+	/// can reach several times the size of the artifacts for large projects.
+	void compile(std::string const& _input, std::ostream& _outputStream) noexcept;
 
 	static Json::Value formatFunctionDebugData(
 		std::map<std::string, evmasm::LinkerObject::FunctionDebugData> const& _debugInfo
@@ -88,12 +108,19 @@ private:
 		Json::Value outputSelection;
 		ModelCheckerSettings modelCheckerSettings = ModelCheckerSettings{};
 		bool viaIR = false;
+		unsigned compilationJobs = 1;
 	};
 
 	/// Parses the input json (and potentially invokes the read callback) and either returns
 	/// it in condensed form or an error as a json object.
 	std::variant<InputsAndSettings, Json::Value> parseInput(Json::Value const& _input);
 
+	/// Implementation of compile(). If @a _inputToRelease is given, it must point to the
+	/// storage of @a _input and is reset as soon as the input has been condensed into an
+	/// InputsAndSettings, so that the JSON tree, which embeds all source texts, does not
+	/// stay in memory during the compilation.
+	Json::Value compileImpl(Json::Value const& _input, Json::Value* _inputToRelease) noexcept;
+
 	std::map<std::string, Json::Value> parseAstFromInput(StringMap const& _sources);
 	Json::Value compileSolidity(InputsAndSettings _inputsAndSettings);
 	Json::Value compileYul(InputsAndSettings _inputsAndSettings);
@@ -101,6 +128,8 @@ private:
 	ReadCallback::Callback m_readFile;
 
 	util::JsonFormat m_jsonPrintingFormat;
+
+	std::optional<ArtifactCache> m_artifactCache;
 };
 
 }
@@ -24,91 +24,135 @@ using namespace solidity;
 using namespace solidity::frontend;
 
 Json::Value StorageLayout::generate(ContractDefinition const& _contractDef)
+{
+	return toJson(generateData(_contractDef));
+}
+
+StorageLayoutData StorageLayout::generateData(ContractDefinition const& _contractDef)
 {
 	solAssert(!m_contract, "");
 	m_contract = &_contractDef;
-	m_types.clear();
 
 	auto typeType = dynamic_cast<TypeType const*>(_contractDef.type());
 	solAssert(typeType, "");
 	auto contractType = dynamic_cast<ContractType const*>(typeType->actualType());
 	solAssert(contractType, "");
 
-	Json::Value variables(Json::arrayValue);
 	for (auto [var, slot, offset]: contractType->stateVariables())
-		variables.append(generate(*var, slot, offset));
+		m_data.storage.emplace_back(generateVariable(*var, slot, offset));
 
-	Json::Value layout;
-	layout["storage"] = std::move(variables);
-	layout["types"] = std::move(m_types);
-	return layout;
+	return std::move(m_data);
 }
 
-Json::Value StorageLayout::generate(VariableDeclaration const& _var, u256 const& _slot, unsigned _offset)
+StorageLayoutData::Variable StorageLayout::generateVariable(VariableDeclaration const& _var, u256 const& _slot, unsigned _offset)
 {
-	Json::Value varEntry;
 	Type const* varType = _var.type();
-
-	varEntry["label"] = _var.name();
-	varEntry["astId"] = static_cast<int>(_var.id());
-	varEntry["contract"] = m_contract->fullyQualifiedName();
-	varEntry["slot"] = _slot.str();
-	varEntry["offset"] = _offset;
-	varEntry["type"] = typeKeyName(varType);
-
-	generate(varType);
-
+	generateType(varType);
+
+	StorageLayoutData::Variable varEntry;
+	varEntry.label = _var.name();
+	varEntry.astId = _var.id();
+	varEntry.contract = m_contract->fullyQualifiedName();
+	varEntry.slot = _slot;
+	varEntry.offset = _offset;
+	varEntry.type = typeKeyName(varType);
 	return varEntry;
 }
 
-void StorageLayout::generate(Type const* _type)
+void StorageLayout::generateType(Type const* _type)
 {
-	if (m_types.isMember(typeKeyName(_type)))
+	if (m_data.types.count(typeKeyName(_type)))
 		return;
 
 	// Register it now to cut recursive visits.
-	Json::Value& typeInfo = m_types[typeKeyName(_type)];
-	typeInfo["label"] = _type->toString(true);
-	typeInfo["numberOfBytes"] = u256(_type->storageBytes() * _type->storageSize()).str();
+	StorageLayoutData::TypeInfo& typeInfo = m_data.types[typeKeyName(_type)];
+	typeInfo.label = _type->toString(true);
+	typeInfo.numberOfBytes = u256(_type->storageBytes() * _type->storageSize());
 
 	if (auto structType = dynamic_cast<StructType const*>(_type))
 	{
-		Json::Value members(Json::arrayValue);
+		std::vector<StorageLayoutData::Variable> members;
 		auto const& structDef = structType->structDefinition();
 		for (auto const& member: structDef.members())
 		{
 			auto const& offsets = structType->storageOffsetsOfMember(member->name());
-			members.append(generate(*member, offsets.first, offsets.second));
+			members.emplace_back(generateVariable(*member, offsets.first, offsets.second));
 		}
-		typeInfo["members"] = std::move(members);
-		typeInfo["encoding"] = "inplace";
+		typeInfo.members = std::move(members);
+		typeInfo.encoding = "inplace";
 	}
 	else if (auto mappingType = dynamic_cast<MappingType const*>(_type))
 	{
-		typeInfo["key"] = typeKeyName(mappingType->keyType());
-		typeInfo["value"] = typeKeyName(mappingType->valueType());
-		generate(mappingType->keyType());
-		generate(mappingType->valueType());
-		typeInfo["encoding"] = "mapping";
+		typeInfo.key = typeKeyName(mappingType->keyType());
+		typeInfo.value = typeKeyName(mappingType->valueType());
+		generateType(mappingType->keyType());
+		generateType(mappingType->valueType());
+		typeInfo.encoding = "mapping";
 	}
 	else if (auto arrayType = dynamic_cast<ArrayType const*>(_type))
 	{
 		if (arrayType->isByteArrayOrString())
-			typeInfo["encoding"] = "bytes";
+			typeInfo.encoding = "bytes";
 		else
 		{
-			typeInfo["base"] = typeKeyName(arrayType->baseType());
-			generate(arrayType->baseType());
-			typeInfo["encoding"] = arrayType->isDynamicallySized() ? "dynamic_array" : "inplace";
+			typeInfo.base = typeKeyName(arrayType->baseType());
+			generateType(arrayType->baseType());
+			typeInfo.encoding = arrayType->isDynamicallySized() ? "dynamic_array" : "inplace";
 		}
 	}
 	else
 	{
 		solAssert(_type->isValueType(), "");
-		typeInfo["encoding"] = "inplace";
+		typeInfo.encoding = "inplace";
 	}
 
-	solAssert(typeInfo.isMember("encoding"), "");
+	solAssert(!m_data.types.at(typeKeyName(_type)).encoding.empty(), "");
+}
+
+Json::Value StorageLayout::toJson(StorageLayoutData const& _layout)
+{
+	Json::Value variables(Json::arrayValue);
+	for (auto const& variable: _layout.storage)
+		variables.append(toJson(variable));
+
+	Json::Value types;
+	for (auto const& [key, info]: _layout.types)
+	{
+		Json::Value& typeInfo = types[key];
+		typeInfo["label"] = info.label;
+		typeInfo["numberOfBytes"] = info.numberOfBytes.str();
+		typeInfo["encoding"] = info.encoding;
+		if (info.members)
+		{
+			Json::Value members(Json::arrayValue);
+			for (auto const& member: *info.members)
+				members.append(toJson(member));
+			typeInfo["members"] = std::move(members);
+		}
+		if (info.key)
+			typeInfo["key"] = *info.key;
+		if (info.value)
+			typeInfo["value"] = *info.value;
+		if (info.base)
+			typeInfo["base"] = *info.base;
+	}
+
+	Json::Value layout;
+	layout["storage"] = std::move(variables);
+	layout["types"] = std::move(types);
+	return layout;
+}
+
+Json::Value StorageLayout::toJson(StorageLayoutData::Variable const& _variable)
+{
+	Json::Value varEntry;
+	varEntry["label"] = _variable.label;
+	varEntry["astId"] = static_cast<int>(_variable.astId);
+	varEntry["contract"] = _variable.contract;
+	varEntry["slot"] = _variable.slot.str();
+	varEntry["offset"] = _variable.offset;
+	varEntry["type"] = _variable.type;
+	return varEntry;
 }
 
 std::string StorageLayout::typeKeyName(Type const* _type)
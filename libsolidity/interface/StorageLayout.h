@@ -26,9 +26,46 @@
 
 #include <json/json.h>
 
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
 namespace solidity::frontend
 {
 
+/// Native representation of a contract's storage layout. Tools that only need slot and
+/// offset information can consume this directly; the JSON blob of the "storageLayout"
+/// output is produced from it on demand via @a StorageLayout::toJson.
+struct StorageLayoutData
+{
+	/// A state variable or struct member and its storage location.
+	struct Variable
+	{
+		std::string label;
+		int64_t astId = 0;
+		std::string contract; ///< Fully qualified name of the contract defining the variable.
+		u256 slot;
+		unsigned offset = 0;
+		std::string type; ///< Key into @a types.
+	};
+
+	/// Storage encoding information of a type, keyed in @a types by its identifier.
+	struct TypeInfo
+	{
+		std::string label;
+		u256 numberOfBytes;
+		std::string encoding; ///< "inplace", "mapping", "dynamic_array" or "bytes".
+		std::optional<std::vector<Variable>> members; ///< Set for struct types.
+		std::optional<std::string> key; ///< Key type of mappings.
+		std::optional<std::string> value; ///< Value type of mappings.
+		std::optional<std::string> base; ///< Base type of non-byte arrays.
+	};
+
+	std::vector<Variable> storage;
+	std::map<std::string, TypeInfo> types;
+};
+
 class StorageLayout
 {
 public:
@@ -37,17 +74,27 @@ public:
 	/// @return A JSON representation of the contract's storage layout.
 	Json::Value generate(ContractDefinition const& _contractDef);
 
+	/// Generates the storage layout of the contract in its native representation.
+	/// @param _contractDef The contract definition
+	StorageLayoutData generateData(ContractDefinition const& _contractDef);
+
+	/// @returns the JSON representation of @a _layout, i.e. the "storageLayout" output.
+	static Json::Value toJson(StorageLayoutData const& _layout);
+
 private:
-	/// Generates the JSON information for a variable and its storage location.
-	Json::Value generate(VariableDeclaration const& _var, u256 const& _slot, unsigned _offset);
+	/// Generates the layout information for a variable and its storage location.
+	StorageLayoutData::Variable generateVariable(VariableDeclaration const& _var, u256 const& _slot, unsigned _offset);
+
+	/// Generates the layout information for @param _type
+	void generateType(Type const* _type);
 
-	/// Generates the JSON information for @param _type
-	void generate(Type const* _type);
+	/// @returns the JSON representation of @a _variable.
+	static Json::Value toJson(StorageLayoutData::Variable const& _variable);
 
-	/// The key for the JSON object describing a type.
+	/// The key for the object describing a type.
 	std::string typeKeyName(Type const* _type);
 
-	Json::Value m_types;
+	StorageLayoutData m_data;
 
 	/// Current analyzed contract
 	ContractDefinition const* m_contract = nullptr;
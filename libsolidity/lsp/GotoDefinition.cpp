@@ -21,6 +21,8 @@
 #include <libsolidity/ast/AST.h>
 #include <libsolidity/ast/ASTUtils.h>
 
+#include <liblangutil/CharStream.h>
+
 #include <fmt/format.h>
 
 #include <memory>
@@ -35,9 +37,29 @@ void GotoDefinition::operator()(MessageID _id, Json::Value const& _args)
 {
 	auto const [sourceUnitName, lineColumn] = extractSourceUnitNameAndLineColumn(_args);
 
+	std::vector<SourceLocation> locations;
+	if (m_server.compilerStack().state() < CompilerStack::State::AnalysisSuccessful)
+	{
+		// No analyzed AST is available, e.g. because the sources currently fail to analyze
+		// or the server was just restarted. Answer from the symbol index of the last
+		// successful analysis instead.
+		if (fileRepository().sourceUnits().count(sourceUnitName))
+			if (std::optional<int> cursorBytePosition = CharStream::translateLineColumnToPosition(
+				fileRepository().sourceUnits().at(sourceUnitName),
+				lineColumn
+			))
+				if (std::optional<SourceLocation> location = m_server.symbolIndex().declarationLocationAt(sourceUnitName, *cursorBytePosition))
+					locations.emplace_back(std::move(*location));
+
+		Json::Value reply = Json::arrayValue;
+		for (SourceLocation const& location: locations)
+			reply.append(toJson(location));
+		client().reply(_id, reply);
+		return;
+	}
+
 	ASTNode const* sourceNode = m_server.astNodeAtSourceLocation(sourceUnitName, lineColumn);
 
-	std::vector<SourceLocation> locations;
 	if (auto const* expression = dynamic_cast<Expression const*>(sourceNode))
 	{
 		// Handles all expressions that can have one or more declaration annotation.
@@ -34,6 +34,7 @@
 #include <liblangutil/CharStream.h>
 
 #include <libsolutil/CommonIO.h>
+#include <libsolutil/Keccak256.h>
 #include <libsolutil/Visitor.h>
 #include <libsolutil/JSON.h>
 
@@ -128,6 +129,41 @@ Json::Value semanticTokensLegend()
 	return legend;
 }
 
+/// @returns the edits transforming the token array @a _previous into @a _current: at most
+/// one edit replacing the region between the common prefix and the common suffix of the
+/// two arrays, or no edit at all if they are identical.
+Json::Value semanticTokensEdits(Json::Value const& _previous, Json::Value const& _current)
+{
+	Json::ArrayIndex prefixLength = 0;
+	while (
+		prefixLength < _previous.size() &&
+		prefixLength < _current.size() &&
+		_previous[prefixLength] == _current[prefixLength]
+	)
+		++prefixLength;
+
+	Json::ArrayIndex suffixLength = 0;
+	while (
+		suffixLength < _previous.size() - prefixLength &&
+		suffixLength < _current.size() - prefixLength &&
+		_previous[_previous.size() - 1 - suffixLength] == _current[_current.size() - 1 - suffixLength]
+	)
+		++suffixLength;
+
+	Json::Value edits = Json::arrayValue;
+	if (prefixLength == _previous.size() && _previous.size() == _current.size())
+		return edits;
+
+	Json::Value edit = Json::objectValue;
+	edit["start"] = prefixLength;
+	edit["deleteCount"] = _previous.size() - prefixLength - suffixLength;
+	edit["data"] = Json::arrayValue;
+	for (Json::ArrayIndex i = prefixLength; i < _current.size() - suffixLength; ++i)
+		edit["data"].append(_current[i]);
+	edits.append(std::move(edit));
+	return edits;
+}
+
 }
 
 LanguageServer::LanguageServer(Transport& _transport):
@@ -148,6 +184,7 @@ LanguageServer::LanguageServer(Transport& _transport):
 		{"textDocument/rename", RenameSymbol(*this) },
 		{"textDocument/implementation", GotoDefinition(*this) },
 		{"textDocument/semanticTokens/full", std::bind(&LanguageServer::semanticTokensFull, this, _1, _2)},
+		{"textDocument/semanticTokens/full/delta", std::bind(&LanguageServer::semanticTokensFullDelta, this, _1, _2)},
 		{"workspace/didChangeConfiguration", std::bind(&LanguageServer::handleWorkspaceDidChangeConfiguration, this, _2)},
 	},
 	m_fileRepository("/" /* basePath */, {} /* no search paths */),
@@ -188,6 +225,8 @@ void LanguageServer::changeConfiguration(Json::Value const& _settings)
 	}
 
 	m_settingsObject = _settings;
+	// Changed settings can affect analysis results even for unchanged sources.
+	m_lastCompiledSourcesHash = util::h256{};
 	Json::Value jsonIncludePaths = _settings["include-paths"];
 
 	if (jsonIncludePaths)
@@ -211,6 +250,20 @@ void LanguageServer::changeConfiguration(Json::Value const& _settings)
 		if (typeFailureCount)
 			m_client.trace("Invalid JSON configuration passed. \"include-paths\" must be an array of strings.");
 	}
+
+	// The settings item "symbol-index-path" names a file the workspace symbol index is
+	// persisted to after each successful analysis and loaded from here, so that navigation
+	// requests can be answered from the last known state right after a restart.
+	if (Json::Value jsonSymbolIndexPath = _settings["symbol-index-path"])
+	{
+		if (jsonSymbolIndexPath.isString() && !jsonSymbolIndexPath.asString().empty())
+		{
+			m_symbolIndexPath = boost::filesystem::path(jsonSymbolIndexPath.asString());
+			m_symbolIndex.load(*m_symbolIndexPath);
+		}
+		else
+			m_client.trace("Invalid JSON configuration passed. \"symbol-index-path\" must be a non-empty string.");
+	}
 }
 
 std::vector<boost::filesystem::path> LanguageServer::allSolidityFilesFromProject() const
@@ -261,15 +314,71 @@ void LanguageServer::compile()
 			oldRepository.sourceUnits().at(oldRepository.uriToSourceUnitName(fileName))
 		);
 
-	// TODO: optimize! do not recompile if nothing has changed (file(s) not flagged dirty).
+	// Requests like hover or goto-definition trigger a compile as well; do not throw
+	// away and re-run the whole analysis when no source content has changed.
+	util::h256 sourcesHash = hashOfSources();
+	if (sourcesHash == m_lastCompiledSourcesHash && m_compilerStack.state() != CompilerStack::State::Empty)
+		return;
+	m_lastCompiledSourcesHash = sourcesHash;
 
 	m_compilerStack.reset(false);
-	m_compilerStack.setSources(m_fileRepository.sourceUnits());
+
+	// Reuse the character streams of files whose content did not change so that the token
+	// streams recorded by the previous run can be replayed instead of re-lexing the text.
+	std::map<std::string, std::shared_ptr<CharStream>> charStreams;
+	for (auto const& [sourceUnitName, content]: m_fileRepository.sourceUnits())
+	{
+		auto it = m_charStreams.find(sourceUnitName);
+		if (it != m_charStreams.end() && it->second->source() == content)
+			charStreams[sourceUnitName] = it->second;
+		else
+			charStreams[sourceUnitName] = std::make_shared<CharStream>(content, sourceUnitName);
+	}
+	m_charStreams = charStreams;
+	m_compilerStack.setSources(std::move(charStreams));
 	m_compilerStack.compile(CompilerStack::State::AnalysisSuccessful);
+
+	updateSymbolIndex();
+}
+
+void LanguageServer::updateSymbolIndex()
+{
+	// Keep the index of the last successful analysis when the current sources fail to
+	// analyze; it is what navigation requests fall back to in that situation.
+	if (m_compilerStack.state() < CompilerStack::State::AnalysisSuccessful)
+		return;
+
+	for (auto const& [sourceUnitName, content]: m_fileRepository.sourceUnits())
+		m_symbolIndex.update(sourceUnitName, util::keccak256(content), m_compilerStack.ast(sourceUnitName));
+	m_symbolIndex.prune(m_fileRepository.sourceUnits());
+
+	if (m_symbolIndexPath)
+		m_symbolIndex.save(*m_symbolIndexPath);
+}
+
+solidity::util::h256 LanguageServer::hashOfSources() const
+{
+	// Hash of hashes; this avoids concatenating whole source texts while still
+	// covering the set of source unit names and their contents.
+	solidity::bytes hashes;
+	for (auto const& [sourceUnitName, content]: m_fileRepository.sourceUnits())
+	{
+		hashes += util::keccak256(sourceUnitName).asBytes();
+		hashes += util::keccak256(content).asBytes();
+	}
+	return util::keccak256(hashes);
+}
+
+void LanguageServer::scheduleDiagnostics(std::string const& _focusedUri)
+{
+	m_diagnosticsPending = true;
+	if (!_focusedUri.empty())
+		m_focusedSourceUnit = m_fileRepository.uriToSourceUnitName(_focusedUri);
 }
 
 void LanguageServer::compileAndUpdateDiagnostics()
 {
+	m_diagnosticsPending = false;
 	compile();
 
 	// These are the source units we will sent diagnostics to the client for sure,
@@ -317,15 +426,22 @@ void LanguageServer::compileAndUpdateDiagnostics()
 	}
 
 	m_nonemptyDiagnostics.clear();
-	for (auto&& [sourceUnitName, diagnostics]: diagnosticsBySourceUnit)
+	auto publish = [&](std::string const& _sourceUnitName, Json::Value& _diagnostics)
 	{
 		Json::Value params;
-		params["uri"] = m_fileRepository.sourceUnitNameToUri(sourceUnitName);
-		if (!diagnostics.empty())
-			m_nonemptyDiagnostics.insert(sourceUnitName);
-		params["diagnostics"] = std::move(diagnostics);
+		params["uri"] = m_fileRepository.sourceUnitNameToUri(_sourceUnitName);
+		if (!_diagnostics.empty())
+			m_nonemptyDiagnostics.insert(_sourceUnitName);
+		params["diagnostics"] = std::move(_diagnostics);
 		m_client.notify("textDocument/publishDiagnostics", std::move(params));
-	}
+	};
+	// The file the client edited last is published first so that its squiggles update
+	// before the workspace-wide ones after a large rebuild.
+	if (auto focused = diagnosticsBySourceUnit.find(m_focusedSourceUnit); focused != diagnosticsBySourceUnit.end())
+		publish(focused->first, focused->second);
+	for (auto&& [sourceUnitName, diagnostics]: diagnosticsBySourceUnit)
+		if (sourceUnitName != m_focusedSourceUnit)
+			publish(sourceUnitName, diagnostics);
 }
 
 bool LanguageServer::run()
@@ -352,6 +468,11 @@ bool LanguageServer::run()
 			}
 			else
 				m_client.error({}, ErrorCode::ParseError, "\"method\" has to be a string.");
+
+			// Run a scheduled diagnostics rebuild only once the client has no further
+			// messages queued, so that notification bursts trigger a single rebuild.
+			if (m_diagnosticsPending && !m_client.messagePending())
+				compileAndUpdateDiagnostics();
 		}
 		catch (Json::Exception const&)
 		{
@@ -420,7 +541,7 @@ void LanguageServer::handleInitialize(MessageID _id, Json::Value const& _args)
 	replyArgs["capabilities"]["textDocumentSync"]["openClose"] = true;
 	replyArgs["capabilities"]["semanticTokensProvider"]["legend"] = semanticTokensLegend();
 	replyArgs["capabilities"]["semanticTokensProvider"]["range"] = false;
-	replyArgs["capabilities"]["semanticTokensProvider"]["full"] = true; // XOR requests.full.delta = true
+	replyArgs["capabilities"]["semanticTokensProvider"]["full"]["delta"] = true;
 	replyArgs["capabilities"]["renameProvider"] = true;
 	replyArgs["capabilities"]["hoverProvider"] = true;
 
@@ -441,15 +562,47 @@ void LanguageServer::semanticTokensFull(MessageID _id, Json::Value const& _args)
 
 	auto const sourceName = m_fileRepository.uriToSourceUnitName(uri.as<std::string>());
 	SourceUnit const& ast = m_compilerStack.ast(sourceName);
-	m_compilerStack.charStream(sourceName);
 	Json::Value data = SemanticTokensBuilder().build(ast, m_compilerStack.charStream(sourceName));
 
 	Json::Value reply = Json::objectValue;
 	reply["data"] = data;
+	reply["resultId"] = registerSemanticTokens(sourceName, std::move(data));
 
 	m_client.reply(_id, std::move(reply));
 }
 
+void LanguageServer::semanticTokensFullDelta(MessageID _id, Json::Value const& _args)
+{
+	auto uri = _args["textDocument"]["uri"];
+	std::string const previousResultId = _args["previousResultId"].asString();
+
+	compile();
+
+	auto const sourceName = m_fileRepository.uriToSourceUnitName(uri.as<std::string>());
+	SourceUnit const& ast = m_compilerStack.ast(sourceName);
+	Json::Value data = SemanticTokensBuilder().build(ast, m_compilerStack.charStream(sourceName));
+
+	Json::Value reply = Json::objectValue;
+	auto const previous = m_semanticTokens.find(sourceName);
+	if (previous != m_semanticTokens.end() && previous->second.resultId == previousResultId)
+		reply["edits"] = semanticTokensEdits(previous->second.data, data);
+	else
+		// The result the client refers to is not available anymore - fall back to a full
+		// response, as the protocol allows.
+		reply["data"] = data;
+	reply["resultId"] = registerSemanticTokens(sourceName, std::move(data));
+
+	m_client.reply(_id, std::move(reply));
+}
+
+std::string LanguageServer::registerSemanticTokens(std::string const& _sourceName, Json::Value _data)
+{
+	SemanticTokens& entry = m_semanticTokens[_sourceName];
+	entry.resultId = std::to_string(entry.nextResultId++);
+	entry.data = std::move(_data);
+	return entry.resultId;
+}
+
 void LanguageServer::handleWorkspaceDidChangeConfiguration(Json::Value const& _args)
 {
 	requireServerInitialized();
@@ -487,7 +640,7 @@ void LanguageServer::handleTextDocumentDidOpen(Json::Value const& _args)
 	std::string uri = _args["textDocument"]["uri"].asString();
 	m_openFiles.insert(uri);
 	m_fileRepository.setSourceByUri(uri, std::move(text));
-	compileAndUpdateDiagnostics();
+	scheduleDiagnostics(uri);
 }
 
 void LanguageServer::handleTextDocumentDidChange(Json::Value const& _args)
@@ -528,7 +681,7 @@ void LanguageServer::handleTextDocumentDidChange(Json::Value const& _args)
 		m_fileRepository.setSourceByUri(uri, std::move(text));
 	}
 
-	compileAndUpdateDiagnostics();
+	scheduleDiagnostics(uri);
 }
 
 void LanguageServer::handleTextDocumentDidClose(Json::Value const& _args)
@@ -543,8 +696,9 @@ void LanguageServer::handleTextDocumentDidClose(Json::Value const& _args)
 
 	std::string uri = _args["textDocument"]["uri"].asString();
 	m_openFiles.erase(uri);
+	m_semanticTokens.erase(m_fileRepository.uriToSourceUnitName(uri));
 
-	compileAndUpdateDiagnostics();
+	scheduleDiagnostics();
 }
 
 ASTNode const* LanguageServer::astNodeAtSourceLocation(std::string const& _sourceUnitName, LineColumn const& _filePos)
@@ -19,6 +19,7 @@
 
 #include <libsolidity/lsp/Transport.h>
 #include <libsolidity/lsp/FileRepository.h>
+#include <libsolidity/lsp/SymbolIndex.h>
 #include <libsolidity/interface/CompilerStack.h>
 #include <libsolidity/interface/FileReader.h>
 
@@ -80,6 +81,7 @@ public:
 	std::tuple<frontend::ASTNode const*, int> astNodeAndOffsetAtSourceLocation(std::string const& _sourceUnitName, langutil::LineColumn const& _filePos);
 	frontend::ASTNode const* astNodeAtSourceLocation(std::string const& _sourceUnitName, langutil::LineColumn const& _filePos);
 	frontend::CompilerStack const& compilerStack() const noexcept { return m_compilerStack; }
+	SymbolIndex const& symbolIndex() const noexcept { return m_symbolIndex; }
 
 private:
 	/// Checks if the server is initialized (to be used by messages that need it to be initialized).
@@ -95,13 +97,33 @@ private:
 	void handleRename(Json::Value const& _args);
 	void handleGotoDefinition(MessageID _id, Json::Value const& _args);
 	void semanticTokensFull(MessageID _id, Json::Value const& _args);
+	void semanticTokensFullDelta(MessageID _id, Json::Value const& _args);
+
+	/// Remembers @a _data as the semantic tokens last sent for @a _sourceName and
+	/// @returns the result identifier assigned to them.
+	std::string registerSemanticTokens(std::string const& _sourceName, Json::Value _data);
 
 	/// Invoked when the server user-supplied configuration changes (initiated by the client).
 	void changeConfiguration(Json::Value const&);
 
+	/// Requests a rebuild of the diagnostics without running it immediately. The rebuild
+	/// runs in the message loop once the client has no further messages queued, so bursts
+	/// of change notifications, e.g. while typing or after a branch switch, are coalesced
+	/// into a single recompilation.
+	/// @param _focusedUri if non-empty, the file whose diagnostics are published first.
+	void scheduleDiagnostics(std::string const& _focusedUri = {});
+
 	/// Compile everything until after analysis phase.
+	/// Re-uses the analysis results of the previous run if no source content changed.
 	void compile();
 
+	/// @returns a hash covering the names and contents of all current source units.
+	util::h256 hashOfSources() const;
+
+	/// Rebuilds the symbol index entries of source units whose content changed after a
+	/// successful analysis and persists the index if a path is configured.
+	void updateSymbolIndex();
+
 	std::vector<boost::filesystem::path> allSolidityFilesFromProject() const;
 
 	using MessageHandler = std::function<void(MessageID, Json::Value const&)>;
@@ -121,10 +143,37 @@ private:
 	std::set<std::string> m_openFiles;
 	/// Set of source unit names for which we sent diagnostics to the client in the last iteration.
 	std::set<std::string> m_nonemptyDiagnostics;
+	/// Whether a diagnostics rebuild was scheduled but has not run yet.
+	bool m_diagnosticsPending = false;
+	/// Source unit the client edited last; its diagnostics are published first.
+	std::string m_focusedSourceUnit;
 	FileRepository m_fileRepository;
 	FileLoadStrategy m_fileLoadStrategy = FileLoadStrategy::ProjectDirectory;
 
 	frontend::CompilerStack m_compilerStack;
+	/// Hash of the sources the compiler stack last ran on; used to skip redundant reruns.
+	util::h256 m_lastCompiledSourcesHash;
+	/// Character streams of the last compilation, reused for files whose content did not
+	/// change so that their recorded token streams can be replayed instead of re-lexing.
+	std::map<std::string, std::shared_ptr<langutil::CharStream>> m_charStreams;
+
+	/// Workspace-wide symbol index built from the last successful analysis; used to answer
+	/// navigation requests when no analyzed AST is available.
+	SymbolIndex m_symbolIndex;
+	/// File the symbol index is persisted to, if configured via "symbol-index-path".
+	std::optional<boost::filesystem::path> m_symbolIndexPath;
+
+	/// The semantic tokens last sent for a source unit, together with their result
+	/// identifier. Used to answer textDocument/semanticTokens/full/delta requests with the
+	/// changed portion of the token array only.
+	struct SemanticTokens
+	{
+		std::string resultId;
+		Json::Value data;
+		/// Counter the result identifiers for this source unit are drawn from.
+		size_t nextResultId = 1;
+	};
+	std::map<std::string, SemanticTokens> m_semanticTokens;
 
 	/// User-supplied custom configuration settings (such as EVM version).
 	Json::Value m_settingsObject;
@@ -20,6 +20,8 @@
 
 #include <libyul/AST.h>
 
+#include <liblangutil/CharStream.h>
+
 #include <fmt/format.h>
 
 #include <memory>
@@ -53,39 +55,55 @@ void RenameSymbol::operator()(MessageID _id, Json::Value const& _args)
 	std::string const newName = _args["newName"].asString();
 	std::string const uri = _args["textDocument"]["uri"].asString();
 
-	ASTNode const* sourceNode = m_server.astNodeAtSourceLocation(sourceUnitName, lineColumn);
-
 	m_symbolName = {};
 	m_declarationToRename = nullptr;
-	m_sourceUnits = { &m_server.compilerStack().ast(sourceUnitName) };
+	m_sourceUnits.clear();
 	m_locations.clear();
 
-	std::optional<int> cursorBytePosition = charStreamProvider()
-		.charStream(sourceUnitName)
-		.translateLineColumnToPosition(lineColumn);
-	solAssert(cursorBytePosition.has_value(), "Expected source pos");
-
-	extractNameAndDeclaration(*sourceNode, *cursorBytePosition);
-
-	// Find all source units using this symbol
-	for (auto const& [name, content]: fileRepository().sourceUnits())
+	if (m_server.compilerStack().state() < CompilerStack::State::AnalysisSuccessful)
 	{
-		auto const& sourceUnit = m_server.compilerStack().ast(name);
-		for (auto const* referencedSourceUnit: sourceUnit.referencedSourceUnits(true, util::convertContainer<std::set<SourceUnit const*>>(m_sourceUnits)))
-			if (*referencedSourceUnit->location().sourceName == sourceUnitName)
-			{
-				m_sourceUnits.insert(&sourceUnit);
-				break;
-			}
+		// No analyzed AST is available, e.g. because the sources currently fail to analyze
+		// or the server was just restarted. Collect the edit locations from the symbol
+		// index of the last successful analysis instead.
+		if (fileRepository().sourceUnits().count(sourceUnitName))
+			if (std::optional<int> cursorBytePosition = CharStream::translateLineColumnToPosition(
+				fileRepository().sourceUnits().at(sourceUnitName),
+				lineColumn
+			))
+				m_locations = m_server.symbolIndex().referencesAt(sourceUnitName, *cursorBytePosition);
 	}
+	else
+	{
+		ASTNode const* sourceNode = m_server.astNodeAtSourceLocation(sourceUnitName, lineColumn);
+		m_sourceUnits = { &m_server.compilerStack().ast(sourceUnitName) };
+
+		std::optional<int> cursorBytePosition = charStreamProvider()
+			.charStream(sourceUnitName)
+			.translateLineColumnToPosition(lineColumn);
+		solAssert(cursorBytePosition.has_value(), "Expected source pos");
 
-	// Origin source unit should always be checked
-	m_sourceUnits.insert(&m_declarationToRename->sourceUnit());
+		extractNameAndDeclaration(*sourceNode, *cursorBytePosition);
 
-	Visitor visitor(*this);
+		// Find all source units using this symbol
+		for (auto const& [name, content]: fileRepository().sourceUnits())
+		{
+			auto const& sourceUnit = m_server.compilerStack().ast(name);
+			for (auto const* referencedSourceUnit: sourceUnit.referencedSourceUnits(true, util::convertContainer<std::set<SourceUnit const*>>(m_sourceUnits)))
+				if (*referencedSourceUnit->location().sourceName == sourceUnitName)
+				{
+					m_sourceUnits.insert(&sourceUnit);
+					break;
+				}
+		}
 
-	for (auto const* sourceUnit: m_sourceUnits)
-		sourceUnit->accept(visitor);
+		// Origin source unit should always be checked
+		m_sourceUnits.insert(&m_declarationToRename->sourceUnit());
+
+		Visitor visitor(*this);
+
+		for (auto const* sourceUnit: m_sourceUnits)
+			sourceUnit->accept(visitor);
+	}
 
 	// Apply changes in reverse order (will iterate in reverse)
 	sort(m_locations.begin(), m_locations.end());
@@ -0,0 +1,232 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+#include <libsolidity/lsp/SymbolIndex.h>
+
+#include <libsolidity/ast/AST.h>
+#include <libsolidity/ast/ASTVisitor.h>
+
+#include <libsolutil/CommonData.h>
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/JSON.h>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <fstream>
+
+using namespace solidity;
+using namespace solidity::frontend;
+using namespace solidity::langutil;
+using namespace solidity::lsp;
+
+namespace
+{
+
+constexpr int indexFormatVersion = 1;
+
+/// Collects the declarations of one source unit and the name locations of all
+/// references together with the name location of the referenced declaration.
+class SymbolCollector: public ASTConstVisitor
+{
+public:
+	explicit SymbolCollector(SymbolIndex::SourceUnitIndex& _index): m_index(_index) {}
+
+	bool visitNode(ASTNode const& _node) override
+	{
+		if (auto const* declaration = dynamic_cast<Declaration const*>(&_node))
+			if (!declaration->name().empty() && declaration->nameLocation().isValid())
+				m_index.declarations.push_back({declaration->name(), declaration->nameLocation()});
+		return true;
+	}
+
+	void endVisit(Identifier const& _node) override
+	{
+		addReference(_node.location(), _node.annotation().referencedDeclaration);
+	}
+	void endVisit(MemberAccess const& _node) override
+	{
+		addReference(_node.memberLocation(), _node.annotation().referencedDeclaration);
+	}
+	void endVisit(IdentifierPath const& _node) override
+	{
+		// Only the last segment refers to the annotated declaration; the intermediate
+		// segments are covered by the declarations they resolve to themselves.
+		if (!_node.pathLocations().empty())
+			addReference(_node.pathLocations().back(), _node.annotation().referencedDeclaration);
+	}
+
+private:
+	void addReference(SourceLocation _location, Declaration const* _declaration)
+	{
+		if (_declaration && _location.isValid() && _declaration->nameLocation().isValid())
+			m_index.references.push_back({std::move(_location), _declaration->nameLocation()});
+	}
+
+	SymbolIndex::SourceUnitIndex& m_index;
+};
+
+}
+
+void SymbolIndex::update(std::string const& _sourceUnitName, util::h256 const& _contentHash, SourceUnit const& _ast)
+{
+	SourceUnitIndex& index = m_sourceUnits[_sourceUnitName];
+	if (index.contentHash == _contentHash)
+		return;
+
+	index = SourceUnitIndex{_contentHash, {}, {}};
+	SymbolCollector collector(index);
+	_ast.accept(collector);
+}
+
+void SymbolIndex::prune(std::map<std::string, std::string> const& _sourceUnits)
+{
+	for (auto it = m_sourceUnits.begin(); it != m_sourceUnits.end();)
+		if (_sourceUnits.count(it->first))
+			++it;
+		else
+			it = m_sourceUnits.erase(it);
+}
+
+std::optional<SourceLocation> SymbolIndex::declarationLocationAt(std::string const& _sourceUnitName, int _offset) const
+{
+	auto it = m_sourceUnits.find(_sourceUnitName);
+	if (it == m_sourceUnits.end())
+		return std::nullopt;
+
+	for (Reference const& reference: it->second.references)
+		if (reference.location.containsOffset(_offset))
+			return reference.declaration;
+
+	for (Declaration const& declaration: it->second.declarations)
+		if (declaration.nameLocation.containsOffset(_offset))
+			return declaration.nameLocation;
+
+	return std::nullopt;
+}
+
+std::vector<SourceLocation> SymbolIndex::referencesAt(std::string const& _sourceUnitName, int _offset) const
+{
+	std::optional<SourceLocation> target = declarationLocationAt(_sourceUnitName, _offset);
+	if (!target || !target->sourceName)
+		return {};
+
+	std::vector<SourceLocation> locations{*target};
+	for (auto const& [unitName, index]: m_sourceUnits)
+		for (Reference const& reference: index.references)
+			if (
+				reference.declaration.start == target->start &&
+				reference.declaration.end == target->end &&
+				reference.declaration.sourceName &&
+				*reference.declaration.sourceName == *target->sourceName
+			)
+				locations.push_back(reference.location);
+	return locations;
+}
+
+bool SymbolIndex::load(boost::filesystem::path const& _path)
+{
+	m_sourceUnits.clear();
+
+	if (!boost::filesystem::exists(_path))
+		return false;
+
+	Json::Value root;
+	try
+	{
+		if (!util::jsonParseStrict(util::readFileAsString(_path), root))
+			return false;
+	}
+	catch (...)
+	{
+		return false;
+	}
+
+	if (!root.isObject() || root["version"] != indexFormatVersion || !root["sources"].isObject())
+		return false;
+
+	// The same source name occurs many times; share one string per name.
+	std::map<std::string, std::shared_ptr<std::string const>> sourceNames;
+	auto sourceName = [&](std::string const& _name) {
+		auto& name = sourceNames[_name];
+		if (!name)
+			name = std::make_shared<std::string const>(_name);
+		return name;
+	};
+
+	for (std::string const& unitName: root["sources"].getMemberNames())
+	{
+		Json::Value const& unit = root["sources"][unitName];
+		if (!unit.isObject())
+			return false;
+
+		SourceUnitIndex& index = m_sourceUnits[unitName];
+		index.contentHash = util::h256(unit["hash"].asString());
+		for (Json::Value const& declaration: unit["declarations"])
+			index.declarations.push_back({
+				declaration["name"].asString(),
+				SourceLocation{declaration["start"].asInt(), declaration["end"].asInt(), sourceName(unitName)}
+			});
+		for (Json::Value const& reference: unit["references"])
+			index.references.push_back({
+				SourceLocation{reference["start"].asInt(), reference["end"].asInt(), sourceName(unitName)},
+				SourceLocation{
+					reference["targetStart"].asInt(),
+					reference["targetEnd"].asInt(),
+					sourceName(reference["targetSource"].asString())
+				}
+			});
+	}
+
+	return true;
+}
+
+void SymbolIndex::save(boost::filesystem::path const& _path) const
+{
+	Json::Value root{Json::objectValue};
+	root["version"] = indexFormatVersion;
+	root["sources"] = Json::objectValue;
+
+	for (auto const& [unitName, index]: m_sourceUnits)
+	{
+		Json::Value unit{Json::objectValue};
+		unit["hash"] = index.contentHash.hex();
+		unit["declarations"] = Json::arrayValue;
+		for (Declaration const& declaration: index.declarations)
+		{
+			Json::Value entry{Json::objectValue};
+			entry["name"] = declaration.name;
+			entry["start"] = declaration.nameLocation.start;
+			entry["end"] = declaration.nameLocation.end;
+			unit["declarations"].append(std::move(entry));
+		}
+		unit["references"] = Json::arrayValue;
+		for (Reference const& reference: index.references)
+		{
+			Json::Value entry{Json::objectValue};
+			entry["start"] = reference.location.start;
+			entry["end"] = reference.location.end;
+			entry["targetSource"] = reference.declaration.sourceName ? *reference.declaration.sourceName : "";
+			entry["targetStart"] = reference.declaration.start;
+			entry["targetEnd"] = reference.declaration.end;
+			unit["references"].append(std::move(entry));
+		}
+		root["sources"][unitName] = std::move(unit);
+	}
+
+	std::ofstream output(_path.string(), std::ios::trunc | std::ios::binary);
+	output << util::jsonCompactPrint(root);
+}
@@ -0,0 +1,95 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+#pragma once
+
+#include <libsolidity/ast/ASTForward.h>
+
+#include <liblangutil/SourceLocation.h>
+
+#include <libsolutil/FixedHash.h>
+
+#include <boost/filesystem/path.hpp>
+
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace solidity::lsp
+{
+
+/**
+ * Workspace-wide symbol index used to answer navigation requests.
+ *
+ * Stores, per source unit, the name locations of the declarations defined in it
+ * and every reference (identifier, member access, identifier path segment)
+ * together with the name location of the referenced declaration. The index is
+ * rebuilt per source unit from the analyzed AST whenever the unit's content
+ * changes and can be persisted to disk, so goto-definition and rename can still
+ * be answered when no analyzed AST is available - e.g. while the sources
+ * currently fail to analyze or right after a server restart.
+ */
+class SymbolIndex
+{
+public:
+	struct Reference
+	{
+		/// Exact location of the name token of the reference.
+		langutil::SourceLocation location;
+		/// Name location of the referenced declaration.
+		langutil::SourceLocation declaration;
+	};
+	struct Declaration
+	{
+		std::string name;
+		langutil::SourceLocation nameLocation;
+	};
+	struct SourceUnitIndex
+	{
+		/// Hash of the source content the entry was built from.
+		util::h256 contentHash;
+		std::vector<Declaration> declarations;
+		std::vector<Reference> references;
+	};
+
+	/// Rebuilds the entry for @a _sourceUnitName from @a _ast unless the stored entry
+	/// was already built from content hashing to @a _contentHash.
+	void update(std::string const& _sourceUnitName, util::h256 const& _contentHash, frontend::SourceUnit const& _ast);
+
+	/// Drops entries of source units that no longer exist in the workspace.
+	void prune(std::map<std::string, std::string> const& _sourceUnits);
+
+	/// @returns the name location of the declaration referenced at the given byte offset,
+	/// or the name location itself if the offset points at a declaration's name.
+	std::optional<langutil::SourceLocation> declarationLocationAt(std::string const& _sourceUnitName, int _offset) const;
+
+	/// @returns the name locations of the declaration at the given byte offset and of all
+	/// references to it across the whole index, suitable as rename edit ranges.
+	std::vector<langutil::SourceLocation> referencesAt(std::string const& _sourceUnitName, int _offset) const;
+
+	/// Loads the index from @a _path. @returns false if the file does not exist or does
+	/// not contain a compatible index; the index is left empty in that case.
+	bool load(boost::filesystem::path const& _path);
+	/// Writes the index to @a _path.
+	void save(boost::filesystem::path const& _path) const;
+
+private:
+	std::map<std::string, SourceUnitIndex> m_sourceUnits;
+};
+
+}
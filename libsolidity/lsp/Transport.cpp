@@ -154,6 +154,11 @@ bool IOStreamTransport::closed() const noexcept
 	return m_input.eof();
 }
 
+bool IOStreamTransport::messagePending() const noexcept
+{
+	return m_input.rdbuf()->in_avail() > 0;
+}
+
 std::string IOStreamTransport::readBytes(size_t _length)
 {
 	return util::readBytes(m_input, _length);
@@ -184,6 +189,17 @@ StdioTransport::StdioTransport()
 	// Attempt to change the modes of stdout from text to binary.
 	setmode(fileno(stdout), O_BINARY);
 	#endif
+	m_writerThread = std::thread(&StdioTransport::writerLoop, this);
+}
+
+StdioTransport::~StdioTransport()
+{
+	{
+		std::lock_guard lock(m_writeMutex);
+		m_done = true;
+	}
+	m_writeCondition.notify_one();
+	m_writerThread.join();
 }
 
 bool StdioTransport::closed() const noexcept
@@ -191,6 +207,11 @@ bool StdioTransport::closed() const noexcept
 	return feof(stdin);
 }
 
+bool StdioTransport::messagePending() const noexcept
+{
+	return std::cin.rdbuf()->in_avail() > 0;
+}
+
 std::string StdioTransport::readBytes(size_t _byteCount)
 {
 	std::string buffer;
@@ -212,12 +233,33 @@ std::string StdioTransport::getline()
 void StdioTransport::writeBytes(std::string_view _data)
 {
 	lspDebug(fmt::format("Sending: {}", _data));
-	auto const bytesWritten = fwrite(_data.data(), 1, _data.size(), stdout);
-	solAssert(bytesWritten == _data.size());
+	std::lock_guard lock(m_writeMutex);
+	m_pendingOutput += _data;
 }
 
 void StdioTransport::flushOutput()
 {
-	fflush(stdout);
+	m_writeCondition.notify_one();
+}
+
+void StdioTransport::writerLoop()
+{
+	while (true)
+	{
+		std::string output;
+		{
+			std::unique_lock lock(m_writeMutex);
+			m_writeCondition.wait(lock, [&]() { return m_done || !m_pendingOutput.empty(); });
+			if (m_pendingOutput.empty() && m_done)
+				break;
+			std::swap(output, m_pendingOutput);
+		}
+		auto const bytesWritten = fwrite(output.data(), 1, output.size(), stdout);
+		if (bytesWritten < output.size())
+			// The client closed the stream. Stop writing - the main loop will
+			// detect the closed connection via stdin.
+			break;
+		fflush(stdout);
+	}
 }
 // }}}
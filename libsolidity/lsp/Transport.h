@@ -21,12 +21,15 @@
 
 #include <json/value.h>
 
+#include <condition_variable>
 #include <functional>
 #include <iosfwd>
 #include <map>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <variant>
 
 namespace solidity::lsp
@@ -105,6 +108,11 @@ public:
 
 	virtual bool closed() const noexcept = 0;
 
+	/// @returns true if another message is already waiting to be received, i.e. a
+	/// subsequent receive() would not block. Used to coalesce bursts of notifications.
+	/// May conservatively return false when the state of the underlying stream is unknown.
+	virtual bool messagePending() const noexcept { return false; }
+
 	void trace(std::string _message, Json::Value _extra = Json::nullValue);
 
 	TraceValue traceValue() const noexcept { return m_logTrace; }
@@ -151,6 +159,7 @@ public:
 	IOStreamTransport(std::istream& _in, std::ostream& _out);
 
 	bool closed() const noexcept override;
+	bool messagePending() const noexcept override;
 
 protected:
 	std::string readBytes(size_t _byteCount) override;
@@ -165,19 +174,37 @@ private:
 
 /**
  * Standard I/O transport Layer utilizing stdin/stdout for communication.
+ *
+ * Output is written by a background thread so that the server does not block on slow
+ * client pipes. Messages produced while the writer is busy, e.g. the publishDiagnostics
+ * burst after a rebuild, accumulate in the buffer and are written out in one batch.
  */
 class StdioTransport: public Transport
 {
 public:
 	StdioTransport();
+	/// Drains any still pending output before shutting the writer thread down.
+	~StdioTransport() override;
 
 	bool closed() const noexcept override;
+	bool messagePending() const noexcept override;
 
 protected:
 	std::string readBytes(size_t _byteCount) override;
 	std::string getline() override;
 	void writeBytes(std::string_view _data) override;
 	void flushOutput() override;
+
+private:
+	/// Entry point of the writer thread.
+	void writerLoop();
+
+	std::mutex m_writeMutex;
+	std::condition_variable m_writeCondition;
+	/// Output not yet handed to the operating system, guarded by m_writeMutex.
+	std::string m_pendingOutput;
+	bool m_done = false;
+	std::thread m_writerThread;
 };
 
 }
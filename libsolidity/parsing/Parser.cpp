@@ -76,7 +76,14 @@ public:
 		solAssert(m_location.sourceName, "");
 		if (m_location.end < 0)
 			markEndPosition();
-		return std::make_shared<NodeType>(m_parser.nextID(), m_location, std::forward<Args>(_args)...);
+		// Allocating from the arena keeps the nodes of a source unit in contiguous
+		// memory, which analysis passes traversing the AST benefit from.
+		return std::allocate_shared<NodeType>(
+			util::ArenaAllocator<NodeType>(m_parser.m_astArena),
+			m_parser.nextID(),
+			m_location,
+			std::forward<Args>(_args)...
+		);
 	}
 
 	SourceLocation const& location() const noexcept { return m_location; }
@@ -93,6 +100,8 @@ ASTPointer<SourceUnit> Parser::parse(CharStream& _charStream)
 	{
 		m_recursionDepth = 0;
 		m_scanner = std::make_shared<Scanner>(_charStream);
+		m_astArena = m_astArenaPool ? m_astArenaPool->acquire() : std::make_shared<util::Arena>();
+		m_internedStrings.clear();
 		ASTNodeFactory nodeFactory(*this);
 		m_experimentalSolidityEnabledInCurrentSourceUnit = false;
 
@@ -2420,7 +2429,7 @@ ASTPointer<ASTString> Parser::expectIdentifierTokenOrAddress()
 	ASTPointer<ASTString> result;
 	if (m_scanner->currentToken() == Token::Address)
 	{
-		result = std::make_shared<ASTString>("address");
+		result = internString("address");
 		advance();
 	}
 	else
@@ -2433,11 +2442,19 @@ ASTPointer<ASTString> Parser::expectIdentifierTokenOrAddress()
 
 ASTPointer<ASTString> Parser::getLiteralAndAdvance()
 {
-	ASTPointer<ASTString> identifier = std::make_shared<ASTString>(m_scanner->currentLiteral());
+	ASTPointer<ASTString> identifier = internString(m_scanner->currentLiteral());
 	advance();
 	return identifier;
 }
 
+ASTPointer<ASTString> Parser::internString(std::string const& _string)
+{
+	auto it = m_internedStrings.find(_string);
+	if (it == m_internedStrings.end())
+		it = m_internedStrings.emplace(_string, std::make_shared<ASTString>(_string)).first;
+	return it->second;
+}
+
 bool Parser::isQuotedPath() const
 {
 	return m_scanner->currentToken() == Token::StringLiteral;
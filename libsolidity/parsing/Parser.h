@@ -26,6 +26,7 @@
 #include <libsolidity/ast/AST.h>
 #include <liblangutil/ParserBase.h>
 #include <liblangutil/EVMVersion.h>
+#include <libsolutil/Arena.h>
 
 namespace solidity::langutil
 {
@@ -38,16 +39,25 @@ namespace solidity::frontend
 class Parser: public langutil::ParserBase
 {
 public:
+	/// If @a _astArenaPool is given, the AST nodes of each parsed source unit are
+	/// allocated from a recycled arena of the pool rather than a fresh one, so that
+	/// repeated parse/teardown cycles reuse the same memory regions.
 	explicit Parser(
 		langutil::ErrorReporter& _errorReporter,
-		langutil::EVMVersion _evmVersion
+		langutil::EVMVersion _evmVersion,
+		util::ArenaPool* _astArenaPool = nullptr
 	):
 		ParserBase(_errorReporter),
-		m_evmVersion(_evmVersion)
+		m_evmVersion(_evmVersion),
+		m_astArenaPool(_astArenaPool)
 	{}
 
 	ASTPointer<SourceUnit> parse(langutil::CharStream& _charStream);
 
+	/// @returns the highest node ID assigned by this parser so far. Note that the parser can
+	/// assign IDs to look-ahead nodes that do not end up in the final AST.
+	int64_t maxUsedNodeID() const { return m_currentNodeID; }
+
 private:
 	class ASTNodeFactory;
 
@@ -216,6 +226,11 @@ private:
 	ASTPointer<ASTString> expectIdentifierToken();
 	ASTPointer<ASTString> expectIdentifierTokenOrAddress();
 	ASTPointer<ASTString> getLiteralAndAdvance();
+	/// @returns a shared string with the given content, reusing an existing instance if the
+	/// same content was interned before. Identifiers repeat a lot within a source unit, so
+	/// this deduplicates allocations and lets equal names share a single buffer.
+	/// The returned string must not be modified.
+	ASTPointer<ASTString> internString(std::string const& _string);
 	///@}
 
 	bool isQuotedPath() const;
@@ -229,6 +244,14 @@ private:
 	/// Flag that signifies whether '_' is parsed as a PlaceholderStatement or a regular identifier.
 	bool m_insideModifier = false;
 	langutil::EVMVersion m_evmVersion;
+	/// Arena all AST nodes of the current source unit are allocated from. The nodes
+	/// collectively keep it alive through their control blocks, so the memory is
+	/// released in one shot once the last node of the unit is gone.
+	std::shared_ptr<util::Arena> m_astArena;
+	/// Optional pool the arenas are acquired from and eventually returned to.
+	util::ArenaPool* m_astArenaPool = nullptr;
+	/// Interned strings of the current source unit, see internString().
+	std::map<ASTString, ASTPointer<ASTString>> m_internedStrings;
 	/// Counter for the next AST node ID
 	int64_t m_currentNodeID = 0;
 	/// Flag that indicates whether experimental mode is enabled in the current source unit
@@ -18,9 +18,11 @@
 #pragma once
 
 
+#include <deque>
 #include <functional>
-#include <list>
+#include <map>
 #include <set>
+#include <vector>
 
 namespace solidity::util
 {
@@ -52,11 +54,14 @@ public:
 	{
 		if (m_firstCycleVertex)
 			return m_firstCycleVertex;
-		if (m_processed.count(&_vertex))
-			return nullptr;
-		else if (m_processing.count(&_vertex))
-			return m_firstCycleVertex = &_vertex;
-		m_processing.insert(&_vertex);
+		auto [it, inserted] = m_visited.try_emplace(&_vertex, false);
+		if (!inserted)
+		{
+			if (it->second)
+				return nullptr;
+			else
+				return m_firstCycleVertex = &_vertex;
+		}
 
 		m_depth++;
 		m_visit(_vertex, *this, m_depth);
@@ -64,15 +69,15 @@ public:
 		if (m_firstCycleVertex && m_depth == 1)
 			m_firstCycleVertex = &_vertex;
 
-		m_processing.erase(&_vertex);
-		m_processed.insert(&_vertex);
+		it->second = true;
 		return m_firstCycleVertex;
 	}
 
 private:
 	Visitor m_visit;
-	std::set<V const*> m_processing;
-	std::set<V const*> m_processed;
+	/// All vertices seen so far. The mapped value is false while the vertex is still on the
+	/// current path and true once it has been fully processed.
+	std::map<V const*, bool> m_visited;
 	size_t m_depth = 0;
 	V const* m_firstCycleVertex = nullptr;
 };
@@ -121,8 +126,56 @@ struct BreadthFirstSearch
 		verticesToTraverse.clear();
 	}
 
-	std::list<V> verticesToTraverse;
+	std::deque<V> verticesToTraverse;
 	std::set<V> visited{};
 };
 
+/**
+ * Breadth first search for graphs whose vertices map to dense indices.
+ *
+ * Works like BreadthFirstSearch, but keeps the visited state in a bitset indexed by a
+ * user-supplied mapping instead of an ordered set, avoiding the allocation and O(log n)
+ * lookup per visit. Use it whenever the vertices carry a dense id, e.g. basic blocks
+ * numbered in creation order.
+ */
+template<typename V>
+struct IndexedBreadthFirstSearch
+{
+	/// Runs the breadth first search. The verticesToTraverse member of the struct needs to be initialized.
+	/// @param _indexOf is a callable mapping each vertex to its dense index; the bitset of visited
+	/// vertices grows on demand to the largest index encountered.
+	/// @param _forEachChild is a callable of the form [...](V const& _node, auto&& _addChild) { ... }
+	/// that is called for each visited node and is supposed to call _addChild(childNode) for every child
+	/// node of _node.
+	template<typename IndexOf, typename ForEachChild>
+	IndexedBreadthFirstSearch& run(IndexOf&& _indexOf, ForEachChild&& _forEachChild)
+	{
+		while (!verticesToTraverse.empty())
+		{
+			V v = std::move(verticesToTraverse.front());
+			verticesToTraverse.pop_front();
+
+			size_t index = _indexOf(v);
+			if (index >= visited.size())
+				visited.resize(index + 1, false);
+			if (visited[index])
+				continue;
+			visited[index] = true;
+
+			_forEachChild(v, [this](V _vertex) {
+				verticesToTraverse.emplace_back(std::move(_vertex));
+			});
+		}
+		return *this;
+	}
+	void abort()
+	{
+		verticesToTraverse.clear();
+	}
+
+	std::deque<V> verticesToTraverse;
+	/// Visited state indexed by the mapping passed to @a run.
+	std::vector<bool> visited{};
+};
+
 }
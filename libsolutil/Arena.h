@@ -0,0 +1,174 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Monotonic bump allocator and an STL-compatible allocator adaptor on top of it.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace solidity::util
+{
+
+/**
+ * Monotonic bump allocator. Carves allocations out of geometrically growing blocks
+ * of memory. Individual allocations cannot be freed - all memory is reclaimed at
+ * once when the arena is destroyed. Not thread-safe.
+ */
+class Arena
+{
+public:
+	Arena() = default;
+	Arena(Arena const&) = delete;
+	Arena& operator=(Arena const&) = delete;
+
+	void* allocate(std::size_t _size, std::size_t _alignment)
+	{
+		uintptr_t aligned = (reinterpret_cast<uintptr_t>(m_current) + _alignment - 1) & ~(uintptr_t(_alignment) - 1);
+		if (m_blocks.empty() || aligned + _size > reinterpret_cast<uintptr_t>(m_end))
+		{
+			std::size_t blockSize = std::max(m_nextBlockSize, _size + _alignment);
+			m_nextBlockSize = std::min(m_nextBlockSize * 2, maximumBlockSize);
+			m_blocks.push_back({std::make_unique<std::byte[]>(blockSize), blockSize});
+			m_current = m_blocks.back().memory.get();
+			m_end = m_current + blockSize;
+			aligned = (reinterpret_cast<uintptr_t>(m_current) + _alignment - 1) & ~(uintptr_t(_alignment) - 1);
+		}
+		m_current = reinterpret_cast<std::byte*>(aligned) + _size;
+		return reinterpret_cast<void*>(aligned);
+	}
+
+	/// Releases all allocations at once, keeping the most recently added (and largest)
+	/// block for reuse. Must only be called when no object allocated from the arena is
+	/// alive anymore.
+	void reset()
+	{
+		if (m_blocks.empty())
+			return;
+		m_blocks.erase(m_blocks.begin(), m_blocks.end() - 1);
+		m_current = m_blocks.back().memory.get();
+		m_end = m_current + m_blocks.back().size;
+	}
+
+private:
+	struct Block
+	{
+		std::unique_ptr<std::byte[]> memory;
+		std::size_t size = 0;
+	};
+
+	static constexpr std::size_t initialBlockSize = std::size_t(1) << 16;
+	static constexpr std::size_t maximumBlockSize = std::size_t(1) << 22;
+
+	std::vector<Block> m_blocks;
+	std::byte* m_current = nullptr;
+	std::byte* m_end = nullptr;
+	std::size_t m_nextBlockSize = initialBlockSize;
+};
+
+/**
+ * STL-compatible allocator that serves all allocations from an arena shared between
+ * its copies. Deallocation is a no-op; the backing memory lives as long as any
+ * allocator referencing the arena does. In particular, objects created via
+ * std::allocate_shared keep the arena alive through their control block.
+ */
+template<typename T>
+class ArenaAllocator
+{
+public:
+	using value_type = T;
+
+	explicit ArenaAllocator(std::shared_ptr<Arena> _arena): m_arena(std::move(_arena)) {}
+	template<typename U>
+	ArenaAllocator(ArenaAllocator<U> const& _other): m_arena(_other.arena()) {}
+
+	T* allocate(std::size_t _n)
+	{
+		return static_cast<T*>(m_arena->allocate(_n * sizeof(T), alignof(T)));
+	}
+	void deallocate(T*, std::size_t) noexcept
+	{
+		// Memory is reclaimed in bulk when the arena is destroyed.
+	}
+
+	std::shared_ptr<Arena> const& arena() const { return m_arena; }
+
+	template<typename U>
+	bool operator==(ArenaAllocator<U> const& _other) const { return m_arena == _other.arena(); }
+	template<typename U>
+	bool operator!=(ArenaAllocator<U> const& _other) const { return m_arena != _other.arena(); }
+
+private:
+	std::shared_ptr<Arena> m_arena;
+};
+
+/**
+ * Pool that recycles arenas across uses. Arenas handed out by acquire() return to the
+ * pool when their last reference dies, keeping their largest memory block for the next
+ * acquire() instead of freeing it. This avoids re-faulting the backing pages when
+ * similar structures are torn down and rebuilt repeatedly, e.g. on every incremental
+ * recompilation in the language server. Thread-safe; the arenas themselves are not.
+ */
+class ArenaPool
+{
+public:
+	/// @returns a fresh or recycled empty arena. Once the last shared_ptr to it - which
+	/// includes the references held by objects created from it via std::allocate_shared -
+	/// is gone, the arena is reset and returned to the pool rather than destroyed. The
+	/// pool itself can be destroyed before the arenas it handed out.
+	std::shared_ptr<Arena> acquire()
+	{
+		std::unique_ptr<Arena> arena;
+		{
+			std::lock_guard lock(m_state->mutex);
+			if (!m_state->freeArenas.empty())
+			{
+				arena = std::move(m_state->freeArenas.back());
+				m_state->freeArenas.pop_back();
+			}
+		}
+		if (!arena)
+			arena = std::make_unique<Arena>();
+		return std::shared_ptr<Arena>(
+			arena.release(),
+			[state = m_state](Arena* _arena) {
+				_arena->reset();
+				std::lock_guard lock(state->mutex);
+				state->freeArenas.emplace_back(_arena);
+			}
+		);
+	}
+
+private:
+	/// Shared with the deleters of the handed-out arenas so that returning an arena is
+	/// safe even after the pool itself is gone.
+	struct State
+	{
+		std::mutex mutex;
+		std::vector<std::unique_ptr<Arena>> freeArenas;
+	};
+	std::shared_ptr<State> m_state = std::make_shared<State>();
+};
+
+}
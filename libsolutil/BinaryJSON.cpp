@@ -0,0 +1,289 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/** @file BinaryJSON.cpp
+ *
+ * Compact, versioned binary serialization of JSON documents.
+ */
+
+#include <libsolutil/BinaryJSON.h>
+
+#include <cstdint>
+#include <cstring>
+
+namespace solidity::util
+{
+
+namespace
+{
+
+/// Magic header identifying the format, followed by a single version byte.
+/// The version has to be bumped on every incompatible change of the encoding.
+std::string const magic = "solc-bjson";
+uint8_t constexpr formatVersion = 1;
+
+/// One tag byte precedes every encoded value.
+enum class Tag: uint8_t
+{
+	Null = 0,
+	False = 1,
+	True = 2,
+	Int = 3, ///< Zigzag-encoded LEB128 integer.
+	UInt = 4, ///< LEB128 integer.
+	Double = 5, ///< 8 bytes, little-endian IEEE 754.
+	String = 6, ///< LEB128 length followed by the raw bytes.
+	Array = 7, ///< LEB128 element count followed by the encoded elements.
+	Object = 8, ///< LEB128 member count followed by encoded (key string, value) pairs.
+};
+
+/// Nesting depth limit applied while decoding so that malformed input cannot
+/// exhaust the stack. Matches the guard jsoncpp applies to text input.
+size_t constexpr maxDepth = 1000;
+
+void appendVarint(std::string& _out, uint64_t _value)
+{
+	while (_value > 0x7f)
+	{
+		_out += static_cast<char>(0x80 | (_value & 0x7f));
+		_value >>= 7;
+	}
+	_out += static_cast<char>(_value);
+}
+
+void appendString(std::string& _out, std::string const& _value)
+{
+	appendVarint(_out, _value.size());
+	_out += _value;
+}
+
+void encodeValue(std::string& _out, Json::Value const& _value)
+{
+	switch (_value.type())
+	{
+	case Json::nullValue:
+		_out += static_cast<char>(Tag::Null);
+		break;
+	case Json::booleanValue:
+		_out += static_cast<char>(_value.asBool() ? Tag::True : Tag::False);
+		break;
+	case Json::intValue:
+	{
+		_out += static_cast<char>(Tag::Int);
+		int64_t value = _value.asInt64();
+		appendVarint(_out, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+		break;
+	}
+	case Json::uintValue:
+		_out += static_cast<char>(Tag::UInt);
+		appendVarint(_out, _value.asUInt64());
+		break;
+	case Json::realValue:
+	{
+		_out += static_cast<char>(Tag::Double);
+		double value = _value.asDouble();
+		char buffer[sizeof(value)];
+		std::memcpy(buffer, &value, sizeof(value));
+		_out.append(buffer, sizeof(value));
+		break;
+	}
+	case Json::stringValue:
+		_out += static_cast<char>(Tag::String);
+		appendString(_out, _value.asString());
+		break;
+	case Json::arrayValue:
+		_out += static_cast<char>(Tag::Array);
+		appendVarint(_out, _value.size());
+		for (Json::Value const& element: _value)
+			encodeValue(_out, element);
+		break;
+	case Json::objectValue:
+		_out += static_cast<char>(Tag::Object);
+		appendVarint(_out, _value.size());
+		for (std::string const& key: _value.getMemberNames())
+		{
+			appendString(_out, key);
+			encodeValue(_out, _value[key]);
+		}
+		break;
+	}
+}
+
+/// Bounds-checked cursor over the encoded document. All read functions return false
+/// on truncated or otherwise malformed input and leave the output undefined.
+class Decoder
+{
+public:
+	Decoder(char const* _begin, char const* _end): m_position(_begin), m_end(_end) {}
+
+	bool atEnd() const { return m_position == m_end; }
+
+	bool readValue(Json::Value& _value, size_t _depth = 0)
+	{
+		if (_depth > maxDepth)
+			return false;
+
+		uint8_t tag;
+		if (!readByte(tag))
+			return false;
+
+		switch (static_cast<Tag>(tag))
+		{
+		case Tag::Null:
+			_value = Json::Value();
+			return true;
+		case Tag::False:
+			_value = false;
+			return true;
+		case Tag::True:
+			_value = true;
+			return true;
+		case Tag::Int:
+		{
+			uint64_t zigzag;
+			if (!readVarint(zigzag))
+				return false;
+			_value = static_cast<Json::Int64>((zigzag >> 1) ^ (0 - (zigzag & 1)));
+			return true;
+		}
+		case Tag::UInt:
+		{
+			uint64_t value;
+			if (!readVarint(value))
+				return false;
+			_value = static_cast<Json::UInt64>(value);
+			return true;
+		}
+		case Tag::Double:
+		{
+			double value;
+			if (m_end - m_position < static_cast<ptrdiff_t>(sizeof(value)))
+				return false;
+			std::memcpy(&value, m_position, sizeof(value));
+			m_position += sizeof(value);
+			_value = value;
+			return true;
+		}
+		case Tag::String:
+		{
+			std::string value;
+			if (!readString(value))
+				return false;
+			_value = std::move(value);
+			return true;
+		}
+		case Tag::Array:
+		{
+			uint64_t size;
+			if (!readVarint(size))
+				return false;
+			_value = Json::Value(Json::arrayValue);
+			for (uint64_t i = 0; i < size; ++i)
+			{
+				Json::Value element;
+				if (!readValue(element, _depth + 1))
+					return false;
+				_value.append(std::move(element));
+			}
+			return true;
+		}
+		case Tag::Object:
+		{
+			uint64_t size;
+			if (!readVarint(size))
+				return false;
+			_value = Json::Value(Json::objectValue);
+			for (uint64_t i = 0; i < size; ++i)
+			{
+				std::string key;
+				if (!readString(key))
+					return false;
+				if (!readValue(_value[key], _depth + 1))
+					return false;
+			}
+			return true;
+		}
+		}
+		return false;
+	}
+
+private:
+	bool readByte(uint8_t& _byte)
+	{
+		if (m_position == m_end)
+			return false;
+		_byte = static_cast<uint8_t>(*m_position++);
+		return true;
+	}
+
+	bool readVarint(uint64_t& _value)
+	{
+		_value = 0;
+		for (unsigned shift = 0; shift < 64; shift += 7)
+		{
+			uint8_t byte;
+			if (!readByte(byte))
+				return false;
+			_value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+			if (!(byte & 0x80))
+				return true;
+		}
+		return false;
+	}
+
+	bool readString(std::string& _value)
+	{
+		uint64_t size;
+		if (!readVarint(size))
+			return false;
+		if (m_end - m_position < static_cast<ptrdiff_t>(size))
+			return false;
+		_value.assign(m_position, size);
+		m_position += size;
+		return true;
+	}
+
+	char const* m_position;
+	char const* m_end;
+};
+
+}
+
+bool isBinaryJson(std::string const& _data)
+{
+	return _data.compare(0, magic.size(), magic) == 0;
+}
+
+std::string binaryJsonPrint(Json::Value const& _input)
+{
+	std::string out = magic;
+	out += static_cast<char>(formatVersion);
+	encodeValue(out, _input);
+	return out;
+}
+
+bool binaryJsonParse(std::string const& _input, Json::Value& _json)
+{
+	if (!isBinaryJson(_input) || _input.size() < magic.size() + 1)
+		return false;
+	if (static_cast<uint8_t>(_input[magic.size()]) != formatVersion)
+		return false;
+
+	Decoder decoder(_input.data() + magic.size() + 1, _input.data() + _input.size());
+	return decoder.readValue(_json) && decoder.atEnd();
+}
+
+}
@@ -0,0 +1,45 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/** @file BinaryJSON.h
+ *
+ * Compact, versioned binary serialization of JSON documents. Mainly used to store and
+ * re-import large AST exports without paying the cost of parsing JSON text.
+ */
+
+#pragma once
+
+#include <json/json.h>
+
+#include <string>
+
+namespace solidity::util
+{
+
+/// @returns true if @a _data starts with the magic header of the binary JSON format.
+/// Note that this does not validate the rest of the document.
+bool isBinaryJson(std::string const& _data);
+
+/// Serialises the JSON value @a _input into the binary format, including the magic header.
+std::string binaryJsonPrint(Json::Value const& _input);
+
+/// Parses a binary JSON document (@a _input) produced by binaryJsonPrint and writes the
+/// resulting JSON value to @a _json.
+/// @return true if the document was well-formed, false otherwise.
+bool binaryJsonParse(std::string const& _input, Json::Value& _json);
+
+}
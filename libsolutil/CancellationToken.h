@@ -0,0 +1,70 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Cooperative cancellation token polled by long-running compiler phases.
+ */
+
+#pragma once
+
+#include <libsolutil/Assertions.h>
+#include <libsolutil/Exceptions.h>
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+namespace solidity::util
+{
+
+/// Thrown by long-running compiler phases when the cancellation of the current
+/// compilation has been requested through a CancellationToken.
+DEV_SIMPLE_EXCEPTION(CompilationCancelled);
+
+/**
+ * Cooperative cancellation token. The code that wants to be able to abandon a
+ * compilation owns the flag, sets it from any thread and hands out tokens
+ * referring to it. The long-running loops of the compilation poll the token
+ * and throw CompilationCancelled once cancellation has been requested.
+ * A default-constructed token never reports cancellation, so that functions
+ * can take a token without forcing all their callers to provide one.
+ */
+class CancellationToken
+{
+public:
+	CancellationToken() = default;
+	explicit CancellationToken(std::shared_ptr<std::atomic<bool> const> _cancelled):
+		m_cancelled(std::move(_cancelled))
+	{}
+
+	bool cancellationRequested() const
+	{
+		return m_cancelled && m_cancelled->load(std::memory_order_relaxed);
+	}
+
+	/// @throws CompilationCancelled if cancellation has been requested.
+	void throwIfCancelled() const
+	{
+		if (cancellationRequested())
+			solThrow(CompilationCancelled, "Compilation cancelled.");
+	}
+
+private:
+	std::shared_ptr<std::atomic<bool> const> m_cancelled;
+};
+
+}
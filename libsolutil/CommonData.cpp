@@ -38,6 +38,70 @@ namespace
 static char const* upperHexChars = "0123456789ABCDEF";
 static char const* lowerHexChars = "0123456789abcdef";
 
+/// Table mapping each byte value to its two hex characters, so that bulk encoding can
+/// copy a whole duplet per input byte.
+struct HexDupletTable
+{
+	explicit HexDupletTable(char const* _hexChars)
+	{
+		for (unsigned value = 0; value < 256; ++value)
+		{
+			duplets[2 * value] = _hexChars[(value >> 4) & 0xf];
+			duplets[2 * value + 1] = _hexChars[value & 0xf];
+		}
+	}
+
+	char duplets[512];
+};
+
+/// Table mapping each character to its hex digit value or -1 for non-hex characters.
+struct HexValueTable
+{
+	HexValueTable()
+	{
+		for (int& value: values)
+			value = -1;
+		for (int digit = 0; digit < 16; ++digit)
+		{
+			values[static_cast<uint8_t>(lowerHexChars[digit])] = digit;
+			values[static_cast<uint8_t>(upperHexChars[digit])] = digit;
+		}
+	}
+
+	int values[256];
+};
+
+}
+
+void solidity::util::toHex(uint8_t const* _data, size_t _size, char* _out, HexCase _case)
+{
+	assertThrow(_case != HexCase::Mixed, BadHexCase, "Mixed case is not supported for bulk encoding.");
+
+	static HexDupletTable const lowerTable{lowerHexChars};
+	static HexDupletTable const upperTable{upperHexChars};
+	char const* duplets = (_case == HexCase::Upper ? upperTable : lowerTable).duplets;
+
+	for (size_t i = 0; i < _size; ++i)
+	{
+		_out[2 * i] = duplets[2 * size_t(_data[i])];
+		_out[2 * i + 1] = duplets[2 * size_t(_data[i]) + 1];
+	}
+}
+
+bool solidity::util::fromHex(char const* _data, size_t _size, uint8_t* _out)
+{
+	assertThrow(_size % 2 == 0, BadHexCharacter, "Bulk decoding requires an even number of characters.");
+
+	static HexValueTable const table;
+	int invalid = 0;
+	for (size_t i = 0; i < _size / 2; ++i)
+	{
+		int high = table.values[static_cast<uint8_t>(_data[2 * i])];
+		int low = table.values[static_cast<uint8_t>(_data[2 * i + 1])];
+		invalid |= high | low;
+		_out[i] = static_cast<uint8_t>(high * 16 + low);
+	}
+	return invalid >= 0;
 }
 
 std::string solidity::util::toHex(uint8_t _data, HexCase _case)
@@ -63,14 +127,19 @@ std::string solidity::util::toHex(bytes const& _data, HexPrefix _prefix, HexCase
 		ret[i++] = 'x';
 	}
 
+	if (_case != HexCase::Mixed)
+	{
+		toHex(_data.data(), _data.size(), &ret[i], _case);
+		return ret;
+	}
+
 	// Mixed case will be handled inside the loop.
-	char const* chars = _case == HexCase::Upper ? upperHexChars : lowerHexChars;
+	char const* chars = lowerHexChars;
 	size_t rix = _data.size() - 1;
 	for (uint8_t c: _data)
 	{
 		// switch hex case every four hexchars
-		if (_case == HexCase::Mixed)
-			chars = (rix-- & 2) == 0 ? lowerHexChars : upperHexChars;
+		chars = (rix-- & 2) == 0 ? lowerHexChars : upperHexChars;
 
 		ret[i++] = chars[(static_cast<size_t>(c) >> 4ul) & 0xfu];
 		ret[i++] = chars[c & 0xfu];
@@ -100,25 +169,23 @@ bytes solidity::util::fromHex(std::string const& _s, WhenError _throw)
 		return {};
 
 	unsigned s = (_s.size() >= 2 && _s[0] == '0' && _s[1] == 'x') ? 2 : 0;
-	std::vector<uint8_t> ret;
-	ret.reserve((_s.size() - s + 1) / 2);
+	std::vector<uint8_t> ret((_s.size() - s + 1) / 2);
 
+	size_t bytePos = 0;
 	if (_s.size() % 2)
 	{
 		int h = fromHex(_s[s++], _throw);
-		if (h != -1)
-			ret.push_back(static_cast<uint8_t>(h));
-		else
+		if (h == -1)
 			return bytes();
+		ret[bytePos++] = static_cast<uint8_t>(h);
 	}
-	for (unsigned i = s; i < _s.size(); i += 2)
+	if (!fromHex(_s.data() + s, _s.size() - s, ret.data() + bytePos))
 	{
-		int h = fromHex(_s[i], _throw);
-		int l = fromHex(_s[i + 1], _throw);
-		if (h != -1 && l != -1)
-			ret.push_back(static_cast<uint8_t>(h * 16 + l));
-		else
-			return bytes();
+		if (_throw == WhenError::Throw)
+			// Re-run the scalar conversion to report the offending character.
+			for (size_t i = s; i < _s.size(); ++i)
+				fromHex(_s[i], _throw);
+		return bytes();
 	}
 	return ret;
 }
@@ -410,6 +410,19 @@ std::string toHex(uint8_t _data, HexCase _case = HexCase::Lower);
 /// optionally with "0x" prefix and with uppercase hex letters.
 std::string toHex(bytes const& _data, HexPrefix _prefix = HexPrefix::DontAdd, HexCase _case = HexCase::Lower);
 
+/// Encodes @a _size bytes starting at @a _data as hex duplets into the caller-provided
+/// buffer at @a _out, which has to have room for 2 * @a _size characters.
+/// Translates whole bytes through a precomputed duplet table instead of assembling the
+/// output nibble by nibble, which is considerably faster for bulk data such as bytecode.
+/// Mixed case is not supported.
+void toHex(uint8_t const* _data, size_t _size, char* _out, HexCase _case = HexCase::Lower);
+
+/// Decodes @a _size hex characters (an even number) starting at @a _data into the
+/// caller-provided buffer at @a _out, which has to have room for @a _size / 2 bytes.
+/// @returns false if a character outside of [0-9a-fA-F] was encountered; the contents
+/// of the output buffer are unspecified in that case.
+bool fromHex(char const* _data, size_t _size, uint8_t* _out);
+
 /// Converts a (printable) ASCII hex character into the corresponding integer value.
 /// @example fromHex('A') == 10 && fromHex('f') == 15 && fromHex('5') == 5
 int fromHex(char _i, WhenError _throw);
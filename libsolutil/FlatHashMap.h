@@ -0,0 +1,602 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Open-addressing hash map and set with control byte metadata ("Swiss table" style),
+ * used for lookup-heavy containers on compiler hot paths.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace solidity::util
+{
+
+namespace detail
+{
+
+/// Finalizer applied to every hash value so that both the probe position and the
+/// control byte are well mixed even for weak hash functions, e.g. the identity
+/// hashes std::hash commonly returns for integers and pointers.
+inline size_t mixHash(uint64_t _x)
+{
+	_x ^= _x >> 33;
+	_x *= 0xff51afd7ed558ccdULL;
+	_x ^= _x >> 33;
+	_x *= 0xc4ceb9fe1a85ec53ULL;
+	_x ^= _x >> 33;
+	return static_cast<size_t>(_x);
+}
+
+}
+
+/// Default hash functor of FlatHashMap and FlatHashSet. Post-mixes std::hash and is
+/// transparent for string keys, so that a container keyed by std::string can be
+/// queried with a string_view or character literal without constructing a temporary
+/// string.
+template<typename T>
+struct FlatHash
+{
+	size_t operator()(T const& _value) const { return detail::mixHash(std::hash<T>{}(_value)); }
+};
+
+template<>
+struct FlatHash<std::string>
+{
+	using is_transparent = void;
+	size_t operator()(std::string_view _value) const { return detail::mixHash(std::hash<std::string_view>{}(_value)); }
+};
+
+template<typename A, typename B>
+struct FlatHash<std::pair<A, B>>
+{
+	size_t operator()(std::pair<A, B> const& _value) const
+	{
+		return detail::mixHash(FlatHash<A>{}(_value.first) * 0x9e3779b97f4a7c15ULL + FlatHash<B>{}(_value.second));
+	}
+};
+
+namespace detail
+{
+
+/// Open-addressing hash table underlying FlatHashMap and FlatHashSet.
+///
+/// Elements are stored in a flat power-of-two sized slot array accompanied by one
+/// control byte per slot that is either a sentinel (empty or deleted) or the lowest
+/// seven bits of the element's hash. A lookup walks the control bytes linearly from
+/// the position selected by the upper hash bits and only touches a slot when its
+/// control byte matches, so probing stays within a small contiguous region of memory
+/// and almost never compares keys that are not equal. The load factor is kept below
+/// 7/8, which bounds the probe lengths; erased slots become tombstones that are
+/// reclaimed on the next rehash.
+///
+/// Iteration order depends on the hash values and the insertion sequence. It is
+/// reproducible across runs for value-like keys, but not for pointer keys - callers
+/// that iterate and care about determinism have to sort or must not key by address.
+///
+/// @a Policy decides what a slot holds: a key/mapped pair for maps, just the key for
+/// sets. It also provides the mutable twin of the value type through which slots are
+/// constructed and moved, since e.g. std::pair<Key const, Mapped> itself cannot be
+/// move-assigned during a rehash.
+template<typename Policy, typename Hash, typename Equal>
+class FlatHashTable
+{
+public:
+	using key_type = typename Policy::key_type;
+	using value_type = typename Policy::value_type;
+	using size_type = size_t;
+
+private:
+	static uint8_t constexpr emptySlot = 0x80;
+	static uint8_t constexpr deletedSlot = 0xff;
+	static bool isFull(uint8_t _control) { return !(_control & 0x80); }
+
+	using MutableValue = typename Policy::mutable_value_type;
+
+	union Slot
+	{
+		Slot() {}
+		~Slot() {}
+		MutableValue mutableValue;
+		value_type value;
+	};
+
+	template<bool Const>
+	class IteratorBase
+	{
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = typename FlatHashTable::value_type;
+		using difference_type = std::ptrdiff_t;
+		using reference = std::conditional_t<Const, value_type const&, value_type&>;
+		using pointer = std::conditional_t<Const, value_type const*, value_type*>;
+
+		IteratorBase() = default;
+		/// Conversion from mutable to const iterator.
+		template<bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+		IteratorBase(IteratorBase<OtherConst> const& _other): m_control(_other.m_control), m_slot(_other.m_slot) {}
+
+		reference operator*() const { return m_slot->value; }
+		pointer operator->() const { return &m_slot->value; }
+		IteratorBase& operator++()
+		{
+			++m_control;
+			++m_slot;
+			skipEmpty();
+			return *this;
+		}
+		IteratorBase operator++(int)
+		{
+			IteratorBase original = *this;
+			++*this;
+			return original;
+		}
+		bool operator==(IteratorBase const& _other) const { return m_control == _other.m_control; }
+		bool operator!=(IteratorBase const& _other) const { return m_control != _other.m_control; }
+
+	private:
+		friend class FlatHashTable;
+		template<bool> friend class IteratorBase;
+
+		using SlotPointer = std::conditional_t<Const, Slot const*, Slot*>;
+
+		IteratorBase(uint8_t const* _control, SlotPointer _slot): m_control(_control), m_slot(_slot) {}
+
+		/// Advances to the next occupied slot, relying on the sentinel byte after the
+		/// control array to stop at the end of the table.
+		void skipEmpty()
+		{
+			while (*m_control & 0x80 && *m_control != sentinel)
+			{
+				++m_control;
+				++m_slot;
+			}
+		}
+
+		uint8_t const* m_control = nullptr;
+		SlotPointer m_slot = nullptr;
+	};
+
+	/// Terminator byte stored past the control array so that iterators need no
+	/// separate end pointer. Distinct from all other control values.
+	static uint8_t constexpr sentinel = 0xfd;
+
+public:
+	using iterator = IteratorBase<false>;
+	using const_iterator = IteratorBase<true>;
+
+	FlatHashTable() = default;
+	FlatHashTable(std::initializer_list<value_type> _values)
+	{
+		reserve(_values.size());
+		for (value_type const& value: _values)
+			insert(value);
+	}
+	FlatHashTable(FlatHashTable const& _other)
+	{
+		reserve(_other.m_size);
+		for (value_type const& value: _other)
+			insert(value);
+	}
+	FlatHashTable(FlatHashTable&& _other) noexcept { swap(_other); }
+	FlatHashTable& operator=(FlatHashTable const& _other)
+	{
+		if (&_other != this)
+		{
+			FlatHashTable copy(_other);
+			swap(copy);
+		}
+		return *this;
+	}
+	FlatHashTable& operator=(FlatHashTable&& _other) noexcept
+	{
+		swap(_other);
+		return *this;
+	}
+	~FlatHashTable()
+	{
+		destroyElements();
+		deallocate();
+	}
+
+	void swap(FlatHashTable& _other) noexcept
+	{
+		std::swap(m_control, _other.m_control);
+		std::swap(m_slots, _other.m_slots);
+		std::swap(m_capacity, _other.m_capacity);
+		std::swap(m_size, _other.m_size);
+		std::swap(m_used, _other.m_used);
+	}
+
+	bool empty() const { return m_size == 0; }
+	size_t size() const { return m_size; }
+
+	iterator begin()
+	{
+		iterator it{m_control, m_slots};
+		if (m_control)
+			it.skipEmpty();
+		return it;
+	}
+	const_iterator begin() const
+	{
+		const_iterator it{m_control, m_slots};
+		if (m_control)
+			it.skipEmpty();
+		return it;
+	}
+	iterator end() { return {m_control + m_capacity, m_slots + m_capacity}; }
+	const_iterator end() const { return {m_control + m_capacity, m_slots + m_capacity}; }
+
+	template<typename KeyLike>
+	iterator find(KeyLike const& _key)
+	{
+		size_t index = findIndex(_key, m_hash(_key));
+		return index == notFound ? end() : makeIterator(index);
+	}
+	template<typename KeyLike>
+	const_iterator find(KeyLike const& _key) const
+	{
+		size_t index = findIndex(_key, m_hash(_key));
+		return index == notFound ? end() : makeConstIterator(index);
+	}
+	template<typename KeyLike>
+	size_t count(KeyLike const& _key) const { return findIndex(_key, m_hash(_key)) == notFound ? 0 : 1; }
+	template<typename KeyLike>
+	bool contains(KeyLike const& _key) const { return findIndex(_key, m_hash(_key)) != notFound; }
+
+	std::pair<iterator, bool> insert(value_type const& _value)
+	{
+		auto [index, inserted] = findOrPrepareInsert(Policy::key(_value));
+		if (inserted)
+			new (&m_slots[index].mutableValue) typename Policy::mutable_value_type(_value);
+		return {makeIterator(index), inserted};
+	}
+	std::pair<iterator, bool> insert(value_type&& _value)
+	{
+		auto [index, inserted] = findOrPrepareInsert(Policy::key(_value));
+		if (inserted)
+			new (&m_slots[index].mutableValue) typename Policy::mutable_value_type(Policy::extract(std::move(_value)));
+		return {makeIterator(index), inserted};
+	}
+
+	iterator erase(iterator _position) { return erase(const_iterator(_position)); }
+	iterator erase(const_iterator _position)
+	{
+		size_t index = static_cast<size_t>(_position.m_control - m_control);
+		m_slots[index].mutableValue.~MutableValue();
+		m_control[index] = deletedSlot;
+		--m_size;
+		iterator next = makeIterator(index);
+		++next;
+		return next;
+	}
+	template<typename KeyLike>
+	size_t erase(KeyLike const& _key)
+	{
+		size_t index = findIndex(_key, m_hash(_key));
+		if (index == notFound)
+			return 0;
+		erase(makeConstIterator(index));
+		return 1;
+	}
+
+	void clear()
+	{
+		destroyElements();
+		if (m_control)
+			std::memset(m_control, emptySlot, m_capacity);
+		m_size = 0;
+		m_used = 0;
+	}
+
+	/// Ensures that @a _expectedSize elements fit without another rehash.
+	void reserve(size_t _expectedSize)
+	{
+		size_t required = minimumCapacity(_expectedSize);
+		if (required > m_capacity)
+			rehash(required);
+	}
+
+protected:
+	static size_t constexpr notFound = ~size_t(0);
+
+	/// @returns the slot index holding @a _key or @a notFound.
+	template<typename KeyLike>
+	size_t findIndex(KeyLike const& _key, size_t _hash) const
+	{
+		if (m_capacity == 0)
+			return notFound;
+		uint8_t control = _hash & 0x7f;
+		size_t mask = m_capacity - 1;
+		size_t index = (_hash >> 7) & mask;
+		while (true)
+		{
+			if (m_control[index] == control && m_equal(Policy::key(m_slots[index].value), _key))
+				return index;
+			if (m_control[index] == emptySlot)
+				return notFound;
+			index = (index + 1) & mask;
+		}
+	}
+
+	/// Finds @a _key or claims a slot for it, growing the table if necessary.
+	/// @returns the slot index and whether the slot is new, i.e. still unconstructed.
+	template<typename KeyLike>
+	std::pair<size_t, bool> findOrPrepareInsert(KeyLike const& _key)
+	{
+		size_t hash = m_hash(_key);
+		if (size_t index = findIndex(_key, hash); index != notFound)
+			return {index, false};
+		// Grow when the occupied slots (including tombstones) exceed 7/8 of the
+		// capacity. If most of them are tombstones, this rehashes at the same size.
+		if ((m_used + 1) * 8 > m_capacity * 7)
+			rehash(minimumCapacity(m_size + 1));
+		return {claimSlot(hash), true};
+	}
+
+	Slot& slot(size_t _index) { return m_slots[_index]; }
+	iterator makeIterator(size_t _index) { return {m_control + _index, m_slots + _index}; }
+	const_iterator makeConstIterator(size_t _index) const { return {m_control + _index, m_slots + _index}; }
+
+private:
+	/// Claims a slot for a key with hash @a _hash that is known to be absent.
+	/// Re-uses the first tombstone on the probe path, if any.
+	size_t claimSlot(size_t _hash)
+	{
+		size_t mask = m_capacity - 1;
+		size_t index = (_hash >> 7) & mask;
+		size_t firstDeleted = notFound;
+		while (m_control[index] != emptySlot)
+		{
+			if (m_control[index] == deletedSlot && firstDeleted == notFound)
+				firstDeleted = index;
+			index = (index + 1) & mask;
+		}
+		if (firstDeleted != notFound)
+			index = firstDeleted;
+		else
+			++m_used;
+		m_control[index] = _hash & 0x7f;
+		++m_size;
+		return index;
+	}
+
+	/// @returns the smallest valid capacity at which @a _elements stay below the
+	/// maximum load factor.
+	static size_t minimumCapacity(size_t _elements)
+	{
+		size_t capacity = 16;
+		while (_elements * 8 > capacity * 7)
+			capacity *= 2;
+		return capacity;
+	}
+
+	void rehash(size_t _newCapacity)
+	{
+		uint8_t* oldControl = m_control;
+		Slot* oldSlots = m_slots;
+		size_t oldCapacity = m_capacity;
+
+		m_control = static_cast<uint8_t*>(::operator new(_newCapacity + 1));
+		std::memset(m_control, emptySlot, _newCapacity);
+		m_control[_newCapacity] = sentinel;
+		m_slots = static_cast<Slot*>(::operator new(_newCapacity * sizeof(Slot), std::align_val_t(alignof(Slot))));
+		m_capacity = _newCapacity;
+		m_size = 0;
+		m_used = 0;
+
+		for (size_t index = 0; index < oldCapacity; ++index)
+			if (isFull(oldControl[index]))
+			{
+				size_t newIndex = claimSlot(m_hash(Policy::key(oldSlots[index].value)));
+				new (&m_slots[newIndex].mutableValue) MutableValue(std::move(oldSlots[index].mutableValue));
+				oldSlots[index].mutableValue.~MutableValue();
+			}
+
+		::operator delete(oldControl);
+		::operator delete(oldSlots, std::align_val_t(alignof(Slot)));
+	}
+
+	void destroyElements()
+	{
+		if (m_size > 0)
+			for (size_t index = 0; index < m_capacity; ++index)
+				if (isFull(m_control[index]))
+					m_slots[index].mutableValue.~MutableValue();
+	}
+
+	void deallocate()
+	{
+		::operator delete(m_control);
+		::operator delete(m_slots, std::align_val_t(alignof(Slot)));
+	}
+
+	uint8_t* m_control = nullptr;
+	Slot* m_slots = nullptr;
+	/// Always zero or a power of two, so the probe position can be masked instead
+	/// of taking the hash modulo the capacity.
+	size_t m_capacity = 0;
+	/// Number of elements.
+	size_t m_size = 0;
+	/// Number of slots that are not empty, i.e. elements plus tombstones.
+	size_t m_used = 0;
+	[[no_unique_address]] Hash m_hash{};
+	[[no_unique_address]] Equal m_equal{};
+};
+
+template<typename Key, typename Mapped>
+struct FlatMapPolicy
+{
+	using key_type = Key;
+	using value_type = std::pair<Key const, Mapped>;
+	using mutable_value_type = std::pair<Key, Mapped>;
+	static Key const& key(value_type const& _value) { return _value.first; }
+	static mutable_value_type extract(value_type&& _value)
+	{
+		return {std::move(const_cast<Key&>(_value.first)), std::move(_value.second)};
+	}
+};
+
+template<typename Key>
+struct FlatSetPolicy
+{
+	using key_type = Key;
+	using value_type = Key;
+	using mutable_value_type = Key;
+	static Key const& key(value_type const& _value) { return _value; }
+	static Key extract(value_type&& _value) { return std::move(_value); }
+};
+
+}
+
+/**
+ * Open-addressing hash map. A drop-in replacement for std::unordered_map with better
+ * locality and without per-element allocations; see detail::FlatHashTable for the
+ * layout and the caveat on iteration order. References and iterators are invalidated
+ * by rehashes, unlike with the node-based standard containers.
+ */
+template<typename Key, typename Mapped, typename Hash = FlatHash<Key>, typename Equal = std::equal_to<>>
+class FlatHashMap: public detail::FlatHashTable<detail::FlatMapPolicy<Key, Mapped>, Hash, Equal>
+{
+	using Base = detail::FlatHashTable<detail::FlatMapPolicy<Key, Mapped>, Hash, Equal>;
+
+public:
+	using mapped_type = Mapped;
+	using typename Base::iterator;
+	using typename Base::const_iterator;
+	using Base::Base;
+
+	Mapped& operator[](Key const& _key) { return try_emplace(_key).first->second; }
+	Mapped& operator[](Key&& _key) { return try_emplace(std::move(_key)).first->second; }
+
+	template<typename KeyLike>
+	Mapped& at(KeyLike const& _key)
+	{
+		iterator it = Base::find(_key);
+		if (it == Base::end())
+			throw std::out_of_range("FlatHashMap::at");
+		return it->second;
+	}
+	template<typename KeyLike>
+	Mapped const& at(KeyLike const& _key) const { return const_cast<FlatHashMap&>(*this).at(_key); }
+
+	template<typename... Args>
+	std::pair<iterator, bool> try_emplace(Key const& _key, Args&&... _args)
+	{
+		auto [index, inserted] = Base::findOrPrepareInsert(_key);
+		if (inserted)
+			new (&Base::slot(index).mutableValue) std::pair<Key, Mapped>(
+				std::piecewise_construct,
+				std::forward_as_tuple(_key),
+				std::forward_as_tuple(std::forward<Args>(_args)...)
+			);
+		return {Base::makeIterator(index), inserted};
+	}
+	template<typename... Args>
+	std::pair<iterator, bool> try_emplace(Key&& _key, Args&&... _args)
+	{
+		auto [index, inserted] = Base::findOrPrepareInsert(_key);
+		if (inserted)
+			new (&Base::slot(index).mutableValue) std::pair<Key, Mapped>(
+				std::piecewise_construct,
+				std::forward_as_tuple(std::move(_key)),
+				std::forward_as_tuple(std::forward<Args>(_args)...)
+			);
+		return {Base::makeIterator(index), inserted};
+	}
+	template<typename... Args>
+	std::pair<iterator, bool> emplace(Args&&... _args)
+	{
+		return this->insert(typename Base::value_type(std::forward<Args>(_args)...));
+	}
+	template<typename M>
+	std::pair<iterator, bool> insert_or_assign(Key const& _key, M&& _mapped)
+	{
+		auto [it, inserted] = try_emplace(_key, std::forward<M>(_mapped));
+		if (!inserted)
+			it->second = std::forward<M>(_mapped);
+		return {it, inserted};
+	}
+};
+
+/**
+ * Open-addressing hash set companion of FlatHashMap. As with std::set, elements are
+ * immutable, so both iterator types are const.
+ */
+template<typename Key, typename Hash = FlatHash<Key>, typename Equal = std::equal_to<>>
+class FlatHashSet: public detail::FlatHashTable<detail::FlatSetPolicy<Key>, Hash, Equal>
+{
+	using Base = detail::FlatHashTable<detail::FlatSetPolicy<Key>, Hash, Equal>;
+
+public:
+	using iterator = typename Base::const_iterator;
+	using const_iterator = typename Base::const_iterator;
+	using Base::Base;
+
+	const_iterator begin() const { return Base::begin(); }
+	const_iterator end() const { return Base::end(); }
+
+	std::pair<const_iterator, bool> insert(Key const& _key)
+	{
+		auto [iterator, inserted] = Base::insert(_key);
+		return {iterator, inserted};
+	}
+	std::pair<const_iterator, bool> insert(Key&& _key)
+	{
+		auto [iterator, inserted] = Base::insert(std::move(_key));
+		return {iterator, inserted};
+	}
+	template<typename... Args>
+	std::pair<const_iterator, bool> emplace(Args&&... _args)
+	{
+		return insert(Key(std::forward<Args>(_args)...));
+	}
+	template<typename KeyLike>
+	const_iterator find(KeyLike const& _key) const { return Base::find(_key); }
+};
+
+}
+
+namespace solidity::cxx20
+{
+
+/// Overload of the erase_if polyfill for the flat hash containers, mirroring C++20's
+/// std::erase_if for the unordered containers.
+template<typename Policy, typename Hash, typename Equal, typename Pred>
+size_t erase_if(solidity::util::detail::FlatHashTable<Policy, Hash, Equal>& _container, Pred _pred)
+{
+	size_t originalSize = _container.size();
+	for (auto it = _container.begin(); it != _container.end();)
+		if (_pred(*it))
+			it = _container.erase(it);
+		else
+			++it;
+	return originalSize - _container.size();
+}
+
+}
@@ -21,15 +21,30 @@
 #include <libsolutil/Keccak256.h>
 #include <libsolutil/FixedHash.h>
 
+#include <map>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 
 namespace solidity::util
 {
 
 /// @returns the ABI selector for a given function signature, as a FixedHash h32.
+/// Selectors of the same signatures are requested over and over during analysis and
+/// code generation, so the results are memoized in a process-wide cache.
 inline FixedHash<4> selectorFromSignatureH32(std::string const& _signature)
 {
-	return FixedHash<4>(util::keccak256(_signature), FixedHash<4>::AlignLeft);
+	static std::shared_mutex mutex;
+	static std::map<std::string, FixedHash<4>> cache;
+	{
+		std::shared_lock<std::shared_mutex> lock(mutex);
+		if (auto it = cache.find(_signature); it != cache.end())
+			return it->second;
+	}
+	FixedHash<4> selector(util::keccak256(_signature), FixedHash<4>::AlignLeft);
+	std::unique_lock<std::shared_mutex> lock(mutex);
+	cache.emplace(_signature, selector);
+	return selector;
 }
 
 /// @returns the ABI selector for a given function signature, as a 32 bit number.
@@ -162,34 +162,48 @@ bytes solidity::util::ipfsHash(std::string _data)
 
 	for (size_t chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++)
 	{
-		bytes chunkBytes = asBytes(
-			_data.substr(chunkIndex * maxChunkSize, std::min(maxChunkSize, _data.length() - chunkIndex * maxChunkSize))
-		);
-
-		bytes lengthAsVarint = varintEncoding(chunkBytes.size());
-
-		bytes protobufEncodedData;
+		size_t chunkSize = std::min(maxChunkSize, _data.length() - chunkIndex * maxChunkSize);
+		auto const* chunkData = reinterpret_cast<unsigned char const*>(_data.data()) + chunkIndex * maxChunkSize;
+
+		bytes lengthAsVarint = varintEncoding(chunkSize);
+
+		// Length of the protobuf-encoded node:
+		// Type: File, then the length-delimited data (only if non-empty),
+		// then the filesize as varint.
+		size_t protobufLength =
+			2 +
+			(chunkSize > 0 ? 1 + lengthAsVarint.size() + chunkSize : 0) +
+			1 + lengthAsVarint.size();
+		bytes protobufLengthAsVarint = varintEncoding(protobufLength);
+
+		// Hash the PBDag block by streaming its parts through the hasher instead
+		// of assembling it in memory first, so the chunk data is not copied
+		// around several times just to be hashed.
+		picosha2::hash256_one_by_one hasher;
+		auto feed = [&hasher](bytes const& _bytes) { hasher.process(_bytes.begin(), _bytes.end()); };
+		// Data: (length delimited bytes)
+		feed(bytes{0x0a} + protobufLengthAsVarint);
 		// Type: File
-		protobufEncodedData += bytes{0x08, 0x02};
-		if (!chunkBytes.empty())
+		feed(bytes{0x08, 0x02});
+		if (chunkSize > 0)
 		{
 			// Data (length delimited bytes)
-			protobufEncodedData += bytes{0x12};
-			protobufEncodedData += lengthAsVarint;
-			protobufEncodedData += chunkBytes;
+			feed(bytes{0x12} + lengthAsVarint);
+			hasher.process(chunkData, chunkData + chunkSize);
 		}
 		// filesize: length as varint
-		protobufEncodedData += bytes{0x18} + lengthAsVarint;
-
-		// PBDag:
-		// Data: (length delimited bytes)
-		bytes blockData = encodeByteArray(protobufEncodedData);
+		feed(bytes{0x18} + lengthAsVarint);
+		hasher.finish();
 
 		// Multihash: sha2-256, 256 bits
+		bytes hash{0x12, 0x20};
+		hash.resize(2 + 32);
+		hasher.get_hash_bytes(hash.begin() + 2, hash.end());
+
 		allChunks.emplace_back(
-			encodeHash(blockData),
-			chunkBytes.size(),
-			blockData.size()
+			std::move(hash),
+			chunkSize,
+			1 + protobufLengthAsVarint.size() + protobufLength
 		);
 	}
 
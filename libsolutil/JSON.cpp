@@ -138,6 +138,22 @@ std::string jsonPrint(Json::Value const& _input, JsonFormat const& _format)
 	return result;
 }
 
+void jsonPrint(Json::Value const& _input, JsonFormat const& _format, std::ostream& _stream)
+{
+	if (_format.format == JsonFormat::Pretty)
+		// Pretty printing needs to post-process the whole serialized string,
+		// so it cannot write incrementally.
+		_stream << jsonPrint(_input, _format);
+	else
+	{
+		std::map<std::string, Json::Value> settings;
+		settings["indentation"] = "";
+		StreamWriterBuilder writerBuilder(settings);
+		std::unique_ptr<Json::StreamWriter> writer(writerBuilder.newStreamWriter());
+		writer->write(_input, &_stream);
+	}
+}
+
 bool jsonParseStrict(std::string const& _input, Json::Value& _json, std::string* _errs /* = nullptr */)
 {
 	static StrictModeCharReaderBuilder readerBuilder;
@@ -25,6 +25,7 @@
 
 #include <json/json.h>
 
+#include <iosfwd>
 #include <string>
 #include <string_view>
 #include <optional>
@@ -62,6 +63,11 @@ std::string jsonCompactPrint(Json::Value const& _input);
 /// Serialise the JSON object (@a _input) using specified format (@a _format)
 std::string jsonPrint(Json::Value const& _input, JsonFormat const& _format);
 
+/// Serialise the JSON object (@a _input) using specified format (@a _format) directly into
+/// the given stream. In compact mode this writes incrementally, without materializing the
+/// whole serialized string in memory.
+void jsonPrint(Json::Value const& _input, JsonFormat const& _format, std::ostream& _stream);
+
 /// Parse a JSON string (@a _input) with enabled strict-mode and writes resulting JSON object to (@a _json)
 /// \param _input JSON input string
 /// \param _json [out] resulting JSON object
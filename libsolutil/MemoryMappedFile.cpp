@@ -0,0 +1,78 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/MemoryMappedFile.h>
+
+#include <libsolutil/Assertions.h>
+#include <libsolutil/CommonIO.h>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace solidity::util;
+
+MemoryMappedFile::MemoryMappedFile(boost::filesystem::path const& _path)
+{
+	assertThrow(boost::filesystem::exists(_path), FileNotFound, _path.string());
+	assertThrow(boost::filesystem::is_regular_file(_path), NotAFile, _path.string());
+
+#if !defined(_WIN32)
+	int fd = ::open(_path.string().c_str(), O_RDONLY);
+	// The file can disappear between the check above and the open().
+	assertThrow(fd >= 0, FileNotFound, _path.string());
+
+	struct stat fileInfo = {};
+	if (::fstat(fd, &fileInfo) != 0 || !S_ISREG(fileInfo.st_mode))
+	{
+		::close(fd);
+		assertThrow(false, NotAFile, _path.string());
+	}
+
+	// mmap() of zero bytes is not allowed; an empty view does not need a mapping anyway.
+	if (fileInfo.st_size > 0)
+	{
+		void* mapping = ::mmap(nullptr, static_cast<std::size_t>(fileInfo.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+		if (mapping != MAP_FAILED)
+		{
+			m_data = static_cast<char const*>(mapping);
+			m_size = static_cast<std::size_t>(fileInfo.st_size);
+			m_mapped = true;
+		}
+	}
+	::close(fd);
+	if (m_mapped || fileInfo.st_size == 0)
+		return;
+	// Fall through to the buffered path if the mapping failed, e.g. for special file systems.
+#endif
+
+	m_fallbackBuffer = readFileAsString(_path);
+	m_data = m_fallbackBuffer.data();
+	m_size = m_fallbackBuffer.size();
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+#if !defined(_WIN32)
+	if (m_mapped)
+		::munmap(const_cast<char*>(m_data), m_size);
+#endif
+}
@@ -0,0 +1,63 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#pragma once
+
+#include <boost/filesystem.hpp>
+
+#include <cstddef>
+#include <string_view>
+#include <string>
+
+namespace solidity::util
+{
+
+/**
+ * Read-only memory mapping of a regular file.
+ *
+ * On platforms without mmap() the file contents are read into an internal buffer instead,
+ * so @a view() is always valid for the lifetime of the object. The mapping is private and
+ * never written back to the file.
+ */
+class MemoryMappedFile
+{
+public:
+	/// Maps the given file into memory.
+	/// If the file doesn't exist, it will throw a FileNotFound exception.
+	/// If the file exists but is not a regular file, it will throw a NotAFile exception.
+	explicit MemoryMappedFile(boost::filesystem::path const& _path);
+	~MemoryMappedFile();
+
+	MemoryMappedFile(MemoryMappedFile const&) = delete;
+	MemoryMappedFile& operator=(MemoryMappedFile const&) = delete;
+	MemoryMappedFile(MemoryMappedFile&&) = delete;
+	MemoryMappedFile& operator=(MemoryMappedFile&&) = delete;
+
+	/// @returns a view of the file contents, valid for the lifetime of this object.
+	std::string_view view() const noexcept { return {m_data, m_size}; }
+
+private:
+	char const* m_data = "";
+	std::size_t m_size = 0;
+	/// Whether m_data points to an actual mapping that has to be released in the destructor.
+	bool m_mapped = false;
+	/// Holds the file contents on platforms where mmap() is not available.
+	std::string m_fallbackBuffer;
+};
+
+}
@@ -144,6 +144,44 @@ inline std::string toCompactHexWithPrefix(T _value)
 	return "0x" + util::toHex(toCompactBigEndian(_value, 1));
 }
 
+/// Overload that writes the digits into a fixed buffer back to front instead of going
+/// through a byte array and a separate hex conversion. Numbers fitting a machine word,
+/// by far the most common case e.g. when printing Yul, avoid multiprecision arithmetic
+/// entirely.
+inline std::string toCompactHexWithPrefix(u256 const& _value)
+{
+	static constexpr char hexDigits[] = "0123456789abcdef";
+	char buffer[66];
+	char* end = buffer + sizeof(buffer);
+	char* cursor = end;
+	if (_value <= std::numeric_limits<uint64_t>::max())
+	{
+		uint64_t value = static_cast<uint64_t>(_value);
+		do
+		{
+			*--cursor = hexDigits[value & 0xf];
+			value >>= 4;
+		}
+		while (value);
+	}
+	else
+	{
+		u256 value = _value;
+		do
+		{
+			*--cursor = hexDigits[static_cast<unsigned>(value & 0xf)];
+			value >>= 4;
+		}
+		while (value);
+	}
+	// The representation always consists of whole bytes, i.e. "0x00" for zero.
+	if ((end - cursor) % 2 != 0)
+		*--cursor = '0';
+	*--cursor = 'x';
+	*--cursor = '0';
+	return std::string(cursor, end);
+}
+
 /// Returns decimal representation for small numbers and hex for large numbers.
 inline std::string formatNumber(bigint const& _value)
 {
@@ -152,7 +190,8 @@ inline std::string formatNumber(bigint const& _value)
 	if (_value > 0x1000000)
 		return "0x" + util::toHex(toCompactBigEndian(_value, 1));
 	else
-		return _value.str();
+		// Small enough for the decimal representation to fit in a machine word.
+		return std::to_string(_value.convert_to<uint64_t>());
 }
 
 inline std::string formatNumber(u256 const& _value)
@@ -160,7 +199,8 @@ inline std::string formatNumber(u256 const& _value)
 	if (_value > 0x1000000)
 		return toCompactHexWithPrefix(_value);
 	else
-		return _value.str();
+		// Small enough for the decimal representation to fit in a machine word.
+		return std::to_string(static_cast<uint64_t>(_value));
 }
 
 
@@ -0,0 +1,215 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+
+namespace solidity::util
+{
+
+/**
+ * Persistent ordered map with structural sharing.
+ *
+ * Updates do not modify the map but return a new one that shares all unchanged
+ * nodes with the original, so keeping a snapshot of the map is O(1) and an
+ * update is O(log n). Internally a treap whose node priorities are derived
+ * from the key hash.
+ *
+ * @a TValue needs to be equality comparable for visitDifference().
+ */
+template<typename TKey, typename TValue, typename TCompare = std::less<TKey>>
+class PersistentMap
+{
+public:
+	PersistentMap() = default;
+
+	bool empty() const { return !m_root; }
+
+	/// @returns a pointer to the value stored for @a _key or nullptr if not present.
+	TValue const* find(TKey const& _key) const
+	{
+		Node const* node = m_root.get();
+		TCompare less{};
+		while (node)
+			if (less(_key, node->key))
+				node = node->left.get();
+			else if (less(node->key, _key))
+				node = node->right.get();
+			else
+				return &node->value;
+		return nullptr;
+	}
+
+	/// @returns a map that stores @a _value for @a _key. The original map is unchanged.
+	PersistentMap set(TKey const& _key, TValue _value) const
+	{
+		return PersistentMap{insert(m_root, _key, std::move(_value))};
+	}
+
+	/// Calls @a _visitor(key, left, right) in key order for every key whose associated
+	/// value differs between this map and @a _other. @a left and @a right point to the
+	/// value in this map and in @a _other respectively and are nullptr where the key
+	/// is absent. Subtrees shared between both maps are skipped, so the cost is
+	/// proportional to the amount of divergence rather than the size of the maps.
+	template<typename TVisitor>
+	void visitDifference(PersistentMap const& _other, TVisitor const& _visitor) const
+	{
+		difference(m_root, _other.m_root, _visitor);
+	}
+
+private:
+	struct Node
+	{
+		TKey key;
+		TValue value;
+		uint64_t priority = 0;
+		std::shared_ptr<Node const> left;
+		std::shared_ptr<Node const> right;
+	};
+	using NodePtr = std::shared_ptr<Node const>;
+
+	explicit PersistentMap(NodePtr _root): m_root(std::move(_root)) {}
+
+	static uint64_t priorityFor(TKey const& _key)
+	{
+		// Mix the bits of the hash so that similar keys still get unrelated priorities.
+		uint64_t x = uint64_t(std::hash<TKey>{}(_key)) + 0x9e3779b97f4a7c15;
+		x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9;
+		x = (x ^ (x >> 27)) * 0x94d049bb133111eb;
+		return x ^ (x >> 31);
+	}
+
+	static NodePtr insert(NodePtr const& _node, TKey const& _key, TValue _value)
+	{
+		if (!_node)
+			return std::make_shared<Node const>(Node{_key, std::move(_value), priorityFor(_key), nullptr, nullptr});
+		TCompare less{};
+		if (less(_key, _node->key))
+		{
+			NodePtr left = insert(_node->left, _key, std::move(_value));
+			if (left->priority > _node->priority)
+				// Rotate right to restore the heap property of the priorities.
+				return std::make_shared<Node const>(Node{
+					left->key, left->value, left->priority,
+					left->left,
+					std::make_shared<Node const>(Node{_node->key, _node->value, _node->priority, left->right, _node->right})
+				});
+			return std::make_shared<Node const>(Node{_node->key, _node->value, _node->priority, std::move(left), _node->right});
+		}
+		else if (less(_node->key, _key))
+		{
+			NodePtr right = insert(_node->right, _key, std::move(_value));
+			if (right->priority > _node->priority)
+				// Rotate left to restore the heap property of the priorities.
+				return std::make_shared<Node const>(Node{
+					right->key, right->value, right->priority,
+					std::make_shared<Node const>(Node{_node->key, _node->value, _node->priority, _node->left, right->left}),
+					right->right
+				});
+			return std::make_shared<Node const>(Node{_node->key, _node->value, _node->priority, _node->left, std::move(right)});
+		}
+		return std::make_shared<Node const>(Node{_node->key, std::move(_value), _node->priority, _node->left, _node->right});
+	}
+
+	/// Partitions @a _node into the nodes with keys smaller and greater than @a _key
+	/// and @returns a pointer to the value stored for @a _key itself, if any.
+	/// Only the nodes along the partition path are copied; the subtrees hanging off
+	/// it keep sharing structure with the original tree.
+	static TValue const* split(NodePtr const& _node, TKey const& _key, NodePtr& _less, NodePtr& _greater)
+	{
+		if (!_node)
+		{
+			_less = nullptr;
+			_greater = nullptr;
+			return nullptr;
+		}
+		TCompare less{};
+		if (less(_key, _node->key))
+		{
+			NodePtr lessOfLeft;
+			TValue const* at = split(_node->left, _key, _less, lessOfLeft);
+			_greater = std::make_shared<Node const>(Node{_node->key, _node->value, _node->priority, std::move(lessOfLeft), _node->right});
+			return at;
+		}
+		else if (less(_node->key, _key))
+		{
+			NodePtr greaterOfRight;
+			TValue const* at = split(_node->right, _key, greaterOfRight, _greater);
+			_less = std::make_shared<Node const>(Node{_node->key, _node->value, _node->priority, _node->left, std::move(greaterOfRight)});
+			return at;
+		}
+		_less = _node->left;
+		_greater = _node->right;
+		return &_node->value;
+	}
+
+	template<typename TVisitor>
+	static void visitAll(NodePtr const& _node, bool _presentInLeft, TVisitor const& _visitor)
+	{
+		if (!_node)
+			return;
+		visitAll(_node->left, _presentInLeft, _visitor);
+		_visitor(
+			_node->key,
+			_presentInLeft ? &_node->value : nullptr,
+			_presentInLeft ? nullptr : &_node->value
+		);
+		visitAll(_node->right, _presentInLeft, _visitor);
+	}
+
+	template<typename TVisitor>
+	static void difference(NodePtr const& _left, NodePtr const& _right, TVisitor const& _visitor)
+	{
+		if (_left == _right)
+			return;
+		if (!_left || !_right)
+		{
+			visitAll(_left, true, _visitor);
+			visitAll(_right, false, _visitor);
+			return;
+		}
+		TCompare less{};
+		if (!less(_left->key, _right->key) && !less(_right->key, _left->key))
+		{
+			difference(_left->left, _right->left, _visitor);
+			if (!(_left->value == _right->value))
+				_visitor(_left->key, &_left->value, &_right->value);
+			difference(_left->right, _right->right, _visitor);
+			return;
+		}
+		// The roots differ; partition the right tree around the left root's key and
+		// recurse into the halves.
+		NodePtr rightLess;
+		NodePtr rightGreater;
+		TValue const* rightValue = split(_right, _left->key, rightLess, rightGreater);
+		difference(_left->left, rightLess, _visitor);
+		if (!rightValue)
+			_visitor(_left->key, &_left->value, nullptr);
+		else if (!(_left->value == *rightValue))
+			_visitor(_left->key, &_left->value, rightValue);
+		difference(_left->right, rightGreater, _visitor);
+	}
+
+	NodePtr m_root;
+};
+
+}
@@ -24,6 +24,9 @@
 
 #include <libsolutil/UTF8.h>
 
+#include <cstdint>
+#include <cstring>
+
 namespace solidity::util
 {
 namespace
@@ -83,6 +86,20 @@ bool validateUTF8(unsigned char const* _input, size_t _length, size_t& _invalidP
 
 	for (; i < _length; i++)
 	{
+		// Multi-byte sequences are rare in practice, so skip over runs of ASCII
+		// bytes one word at a time. A word contains a non-ASCII byte exactly if
+		// one of its bytes has the most significant bit set.
+		while (i + sizeof(uint64_t) <= _length)
+		{
+			uint64_t word;
+			std::memcpy(&word, _input + i, sizeof(word));
+			if (word & 0x8080808080808080ULL)
+				break;
+			i += sizeof(word);
+		}
+		if (i >= _length)
+			break;
+
 		// Check for Unicode Chapter 3 Table 3-6 conformity.
 		if (_input[i] < 0x80)
 			continue;
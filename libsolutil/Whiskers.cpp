@@ -26,218 +26,341 @@
 
 #include <libsolutil/Assertions.h>
 
+#include <mutex>
 #include <regex>
 
 using namespace solidity::util;
 
-Whiskers::Whiskers(std::string _template):
-	m_template(std::move(_template))
+namespace solidity::util
 {
-	checkTemplateValid();
-}
 
-Whiskers& Whiskers::operator()(std::string _parameter, std::string _value)
+/**
+ * Parsed form of a Whiskers template. Running regexes over the template string is
+ * expensive and code generation instantiates the same templates over and over, so
+ * the template is parsed once into a tree of segments that rendering only walks.
+ */
+class WhiskersTemplate
 {
-	checkParameterValid(_parameter);
-	checkParameterUnknown(_parameter);
-	checkTemplateContainsTags(_parameter, {""});
-	m_parameters[std::move(_parameter)] = std::move(_value);
-	return *this;
+public:
+	struct Segment
+	{
+		enum class Kind { Literal, Parameter, List, Condition };
+		Kind kind = Kind::Literal;
+		/// Literal text for Kind::Literal, otherwise the name of the parameter
+		/// (without the '+' prefix for conditional value parameters).
+		std::string text;
+		/// Whether the condition checks non-emptiness of a value or list parameter ("<?+name>").
+		bool checksNonEmptiness = false;
+		/// Body of a list or the true branch of a condition.
+		std::vector<Segment> body;
+		/// False branch of a condition, empty if not given.
+		std::vector<Segment> elseBody;
+	};
+
+	/// Parses @a _source, throwing WhiskersError if it contains invalid or unclosed tags.
+	explicit WhiskersTemplate(std::string _source);
+
+	/// @returns the parsed form of @a _template, parsing and caching it on first use.
+	/// Thread-safe.
+	static std::shared_ptr<WhiskersTemplate const> compile(std::string _template);
+
+	std::string const& source() const { return m_source; }
+
+	std::string render(
+		Whiskers::Parameters const& _parameters,
+		Whiskers::Conditions const& _conditions,
+		Whiskers::StringListMap const& _listParameters
+	) const;
+
+	static std::string paramRegex() { return "[a-zA-Z0-9_$-]+"; }
+
+private:
+	static std::vector<Segment> parse(std::string const& _source);
+
+	void render(
+		std::vector<Segment> const& _segments,
+		Whiskers::Parameters const& _parameters,
+		Whiskers::Conditions const& _conditions,
+		Whiskers::StringListMap const& _listParameters,
+		std::string& _result
+	) const;
+
+	std::string m_source;
+	std::vector<Segment> m_segments;
+};
+
 }
 
-Whiskers& Whiskers::operator()(std::string _parameter, bool _value)
+namespace
 {
-	checkParameterValid(_parameter);
-	checkParameterUnknown(_parameter);
-	checkTemplateContainsTags(_parameter, {"?", "/"});
-	m_conditions[std::move(_parameter)] = _value;
-	return *this;
-}
 
-Whiskers& Whiskers::operator()(
-	std::string _listParameter,
-	std::vector<std::map<std::string, std::string>> _values
-)
+/// Joins the bindings with the map throwing an exception if two keys are equal.
+Whiskers::Parameters joinMaps(Whiskers::Parameters const& _a, Whiskers::StringMap const& _b)
 {
-	checkParameterValid(_listParameter);
-	checkParameterUnknown(_listParameter);
-	checkTemplateContainsTags(_listParameter, {"#", "/"});
-	for (auto const& element: _values)
-		for (auto const& val: element)
-			checkParameterValid(val.first);
-	m_listParameters[std::move(_listParameter)] = std::move(_values);
-	return *this;
+	Whiskers::Parameters ret;
+	for (size_t i = 0; i < _a.size(); ++i)
+		ret.append(_a.at(i).first, _a.at(i).second);
+	for (auto const& x: _b)
+	{
+		assertThrow(
+			!ret.contains(x.first),
+			WhiskersError,
+			"Parameter collision"
+		);
+		ret.append(x.first, x.second);
+	}
+	return ret;
 }
 
-std::string Whiskers::render() const
-{
-	return replace(m_template, m_parameters, m_conditions, m_listParameters);
 }
 
-void Whiskers::checkTemplateValid() const
+WhiskersTemplate::WhiskersTemplate(std::string _source):
+	m_source(std::move(_source))
 {
 	std::regex validTemplate("<[#?!\\/]\\+{0,1}[a-zA-Z0-9_$-]+(?:[^a-zA-Z0-9_$>-]|$)");
 	std::smatch match;
 	assertThrow(
-		!regex_search(m_template, match, validTemplate),
+		!regex_search(m_source, match, validTemplate),
 		WhiskersError,
 		"Template contains an invalid/unclosed tag " + match.str()
 	);
+	m_segments = parse(m_source);
 }
 
-void Whiskers::checkParameterValid(std::string const& _parameter) const
+std::shared_ptr<WhiskersTemplate const> WhiskersTemplate::compile(std::string _template)
 {
-	static std::regex validParam("^" + paramRegex() + "$");
-	assertThrow(
-		regex_match(_parameter, validParam),
-		WhiskersError,
-		"Parameter" + _parameter + " contains invalid characters."
-	);
+	static std::mutex cacheMutex;
+	static std::map<std::string, std::shared_ptr<WhiskersTemplate const>> cache;
+
+	std::lock_guard<std::mutex> lock(cacheMutex);
+	std::shared_ptr<WhiskersTemplate const>& compiled = cache[_template];
+	if (!compiled)
+		compiled = std::make_shared<WhiskersTemplate const>(std::move(_template));
+	return compiled;
 }
 
-void Whiskers::checkParameterUnknown(std::string const& _parameter) const
+std::vector<WhiskersTemplate::Segment> WhiskersTemplate::parse(std::string const& _source)
 {
-	assertThrow(
-		!m_parameters.count(_parameter),
-		WhiskersError,
-		_parameter + " already set as value parameter."
-	);
-	assertThrow(
-		!m_conditions.count(_parameter),
-		WhiskersError,
-		_parameter + " already set as condition parameter."
-	);
-	assertThrow(
-		!m_listParameters.count(_parameter),
-		WhiskersError,
-		_parameter + " already set as list parameter."
+	static std::regex const listOrTag(
+		"<(" + paramRegex() + ")>|"
+		"<#(" + paramRegex() + ")>((?:.|\\r|\\n)*?)</\\2>|"
+		"<\\?(\\+?" + paramRegex() + ")>((?:.|\\r|\\n)*?)(<!\\4>((?:.|\\r|\\n)*?))?</\\4>"
 	);
-}
 
-void Whiskers::checkTemplateContainsTags(std::string const& _parameter, std::vector<std::string> const& _prefixes) const
-{
-	for (auto const& prefix: _prefixes)
+	std::vector<Segment> segments;
+	auto appendLiteral = [&](std::string::const_iterator _begin, std::string::const_iterator _end)
 	{
-		std::string tag{"<" + prefix + _parameter + ">"};
-		assertThrow(
-			m_template.find(tag) != std::string::npos,
-			WhiskersError,
-			"Tag '" + tag + "' not found in template:\n" + m_template
-		);
-	}
-}
+		if (_begin != _end)
+		{
+			Segment literal;
+			literal.text.assign(_begin, _end);
+			segments.emplace_back(std::move(literal));
+		}
+	};
 
-namespace
-{
-template<class ReplaceCallback>
-std::string regex_replace(
-	std::string const& _source,
-	std::regex const& _pattern,
-	ReplaceCallback _replace,
-	std::regex_constants::match_flag_type _flags = std::regex_constants::match_default
-)
-{
-	std::sregex_iterator curMatch(_source.begin(), _source.end(), _pattern, _flags);
+	std::sregex_iterator curMatch(_source.begin(), _source.end(), listOrTag);
 	std::sregex_iterator matchEnd;
 	std::string::const_iterator lastMatchedPos(_source.cbegin());
-	std::string result;
 	while (curMatch != matchEnd)
 	{
-		result.append(curMatch->prefix().first, curMatch->prefix().second);
-		result.append(_replace(*curMatch));
-		lastMatchedPos = (*curMatch)[0].second;
+		std::smatch const& match = *curMatch;
+		appendLiteral(match.prefix().first, match.prefix().second);
+		Segment segment;
+		if (match[1].matched)
+		{
+			segment.kind = Segment::Kind::Parameter;
+			segment.text = match[1];
+		}
+		else if (match[2].matched)
+		{
+			segment.kind = Segment::Kind::List;
+			segment.text = match[2];
+			segment.body = parse(match[3]);
+		}
+		else
+		{
+			assertThrow(match[4].matched, WhiskersError, "");
+			segment.kind = Segment::Kind::Condition;
+			std::string conditionName = match[4];
+			segment.checksNonEmptiness = conditionName[0] == '+';
+			segment.text = segment.checksNonEmptiness ? conditionName.substr(1) : std::move(conditionName);
+			segment.body = parse(match[5]);
+			if (match[7].matched)
+				segment.elseBody = parse(match[7]);
+		}
+		segments.emplace_back(std::move(segment));
+		lastMatchedPos = match[0].second;
 		++curMatch;
 	}
-	result.append(lastMatchedPos, _source.cend());
-	return result;
+	appendLiteral(lastMatchedPos, _source.cend());
+	return segments;
 }
+
+std::string WhiskersTemplate::render(
+	Whiskers::Parameters const& _parameters,
+	Whiskers::Conditions const& _conditions,
+	Whiskers::StringListMap const& _listParameters
+) const
+{
+	std::string result;
+	render(m_segments, _parameters, _conditions, _listParameters, result);
+	return result;
 }
 
-std::string Whiskers::replace(
-	std::string const& _template,
-	StringMap const& _parameters,
-	std::map<std::string, bool> const& _conditions,
-	std::map<std::string, std::vector<StringMap>> const& _listParameters
-)
+void WhiskersTemplate::render(
+	std::vector<Segment> const& _segments,
+	Whiskers::Parameters const& _parameters,
+	Whiskers::Conditions const& _conditions,
+	Whiskers::StringListMap const& _listParameters,
+	std::string& _result
+) const
 {
-	static std::regex listOrTag(
-		"<(" + paramRegex() + ")>|"
-		"<#(" + paramRegex() + ")>((?:.|\\r|\\n)*?)</\\2>|"
-		"<\\?(\\+?" + paramRegex() + ")>((?:.|\\r|\\n)*?)(<!\\4>((?:.|\\r|\\n)*?))?</\\4>"
-	);
-	return regex_replace(_template, listOrTag, [&](std::match_results<std::string::const_iterator> _match) -> std::string
-	{
-		std::string tagName(_match[1]);
-		std::string listName(_match[2]);
-		std::string conditionName(_match[4]);
-		if (!tagName.empty())
+	for (Segment const& segment: _segments)
+		switch (segment.kind)
+		{
+		case Segment::Kind::Literal:
+			_result += segment.text;
+			break;
+		case Segment::Kind::Parameter:
 		{
+			std::string const* value = _parameters.find(segment.text);
 			assertThrow(
-				_parameters.count(tagName),
+				value,
 				WhiskersError,
-				"Value for tag " + tagName + " not provided.\n" +
+				"Value for tag " + segment.text + " not provided.\n" +
 				"Template:\n" +
-				_template
+				m_source
 			);
-			return _parameters.at(tagName);
+			_result += *value;
+			break;
 		}
-		else if (!listName.empty())
+		case Segment::Kind::List:
 		{
-			std::string templ(_match[3]);
 			assertThrow(
-				_listParameters.count(listName),
-				WhiskersError, "List parameter " + listName + " not set."
+				_listParameters.count(segment.text),
+				WhiskersError, "List parameter " + segment.text + " not set."
 			);
-			std::string replacement;
-			for (auto const& parameters: _listParameters.at(listName))
-				replacement += replace(templ, joinMaps(_parameters, parameters), _conditions);
-			return replacement;
+			// Lists cannot be nested, so no list parameters are passed on.
+			for (auto const& parameters: _listParameters.at(segment.text))
+				render(segment.body, joinMaps(_parameters, parameters), _conditions, {}, _result);
+			break;
 		}
-		else
+		case Segment::Kind::Condition:
 		{
-			assertThrow(!conditionName.empty(), WhiskersError, "");
 			bool conditionValue = false;
-			if (conditionName[0] == '+')
+			if (segment.checksNonEmptiness)
 			{
-				std::string tag = conditionName.substr(1);
-
-				if (_parameters.count(tag))
-					conditionValue = !_parameters.at(tag).empty();
-				else if (_listParameters.count(tag))
-					conditionValue = !_listParameters.at(tag).empty();
+				if (std::string const* value = _parameters.find(segment.text))
+					conditionValue = !value->empty();
+				else if (_listParameters.count(segment.text))
+					conditionValue = !_listParameters.at(segment.text).empty();
 				else
-					assertThrow(false, WhiskersError, "Tag " + tag + " used as condition but was not set.");
+					assertThrow(false, WhiskersError, "Tag " + segment.text + " used as condition but was not set.");
 			}
 			else
 			{
+				bool const* value = _conditions.find(segment.text);
 				assertThrow(
-					_conditions.count(conditionName),
-					WhiskersError, "Condition parameter " + conditionName + " not set."
+					value,
+					WhiskersError, "Condition parameter " + segment.text + " not set."
 				);
-				conditionValue = _conditions.at(conditionName);
+				conditionValue = *value;
 			}
-			return replace(
-				conditionValue ? _match[5] : _match[7],
+			render(
+				conditionValue ? segment.body : segment.elseBody,
 				_parameters,
 				_conditions,
-				_listParameters
+				_listParameters,
+				_result
 			);
+			break;
+		}
 		}
-	});
 }
 
-Whiskers::StringMap Whiskers::joinMaps(
-	Whiskers::StringMap const& _a,
-	Whiskers::StringMap const& _b
+Whiskers::Whiskers(std::string _template):
+	m_template(WhiskersTemplate::compile(std::move(_template)))
+{
+}
+
+Whiskers& Whiskers::operator()(std::string_view _parameter, std::string _value)
+{
+	checkParameterValid(_parameter);
+	checkParameterUnknown(_parameter);
+	checkTemplateContainsTags(_parameter, {""});
+	m_parameters.append(_parameter, std::move(_value));
+	return *this;
+}
+
+Whiskers& Whiskers::operator()(std::string_view _parameter, bool _value)
+{
+	checkParameterValid(_parameter);
+	checkParameterUnknown(_parameter);
+	checkTemplateContainsTags(_parameter, {"?", "/"});
+	m_conditions.append(_parameter, _value);
+	return *this;
+}
+
+Whiskers& Whiskers::operator()(
+	std::string_view _listParameter,
+	std::vector<std::map<std::string, std::string>> _values
 )
 {
-	Whiskers::StringMap ret = _a;
-	for (auto const& x: _b)
+	checkParameterValid(_listParameter);
+	checkParameterUnknown(_listParameter);
+	checkTemplateContainsTags(_listParameter, {"#", "/"});
+	for (auto const& element: _values)
+		for (auto const& val: element)
+			checkParameterValid(val.first);
+	m_listParameters[std::string(_listParameter)] = std::move(_values);
+	return *this;
+}
+
+std::string Whiskers::render() const
+{
+	return m_template->render(m_parameters, m_conditions, m_listParameters);
+}
+
+void Whiskers::checkParameterValid(std::string_view _parameter) const
+{
+	static std::regex validParam("^" + WhiskersTemplate::paramRegex() + "$");
+	assertThrow(
+		regex_match(_parameter.begin(), _parameter.end(), validParam),
+		WhiskersError,
+		"Parameter" + std::string(_parameter) + " contains invalid characters."
+	);
+}
+
+void Whiskers::checkParameterUnknown(std::string_view _parameter) const
+{
+	assertThrow(
+		!m_parameters.contains(_parameter),
+		WhiskersError,
+		std::string(_parameter) + " already set as value parameter."
+	);
+	assertThrow(
+		!m_conditions.contains(_parameter),
+		WhiskersError,
+		std::string(_parameter) + " already set as condition parameter."
+	);
+	assertThrow(
+		!m_listParameters.count(std::string(_parameter)),
+		WhiskersError,
+		std::string(_parameter) + " already set as list parameter."
+	);
+}
+
+void Whiskers::checkTemplateContainsTags(std::string_view _parameter, std::vector<std::string> const& _prefixes) const
+{
+	for (auto const& prefix: _prefixes)
+	{
+		std::string tag = "<" + prefix;
+		tag += _parameter;
+		tag += ">";
 		assertThrow(
-			ret.insert(x).second,
+			m_template->source().find(tag) != std::string::npos,
 			WhiskersError,
-			"Parameter collision"
+			"Tag '" + tag + "' not found in template:\n" + m_template->source()
 		);
-	return ret;
+	}
 }
-
@@ -26,7 +26,10 @@
 
 #include <libsolutil/Exceptions.h>
 
+#include <array>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <map>
 #include <vector>
 
@@ -35,6 +38,54 @@ namespace solidity::util
 
 DEV_SIMPLE_EXCEPTION(WhiskersError);
 
+/// Parsed form of a template string, see Whiskers. Defined in Whiskers.cpp.
+class WhiskersTemplate;
+
+/**
+ * Flat associative container for template parameter bindings. The first few bindings
+ * are stored inline, so that binding the handful of parameters of a typical template
+ * performs no heap allocation (short names stay within the small string optimization).
+ * Lookups scan linearly, which beats tree or hash lookups at these sizes.
+ */
+template<typename Value>
+class WhiskersParameterMap
+{
+public:
+	using Binding = std::pair<std::string, Value>;
+
+	Value const* find(std::string_view _name) const
+	{
+		for (size_t i = 0; i < m_size; ++i)
+			if (at(i).first == _name)
+				return &at(i).second;
+		return nullptr;
+	}
+
+	bool contains(std::string_view _name) const { return find(_name) != nullptr; }
+
+	/// Appends a binding. The name must not be bound yet.
+	void append(std::string_view _name, Value _value)
+	{
+		if (m_size < m_inline.size())
+			m_inline[m_size] = Binding{std::string(_name), std::move(_value)};
+		else
+			m_overflow.emplace_back(std::string(_name), std::move(_value));
+		++m_size;
+	}
+
+	Binding const& at(size_t _index) const
+	{
+		return _index < m_inline.size() ? m_inline[_index] : m_overflow[_index - m_inline.size()];
+	}
+
+	size_t size() const { return m_size; }
+
+private:
+	size_t m_size = 0;
+	std::array<Binding, 8> m_inline;
+	std::vector<Binding> m_overflow;
+};
+
 /**
  * Moustache-like templates.
  *
@@ -67,23 +118,29 @@ DEV_SIMPLE_EXCEPTION(WhiskersError);
  *    Works similar to a conditional parameter where the checked condition is
  *    that the string or list parameter called "name" is non-empty or contains
  *    no elements respectively.
+ *
+ * Template strings are parsed only once: the parsed representation is cached by
+ * template string identity, so constructing a Whiskers instance from an already
+ * seen template and rendering it only performs parameter substitution.
  */
 class Whiskers
 {
 public:
 	using StringMap = std::map<std::string, std::string>;
 	using StringListMap = std::map<std::string, std::vector<StringMap>>;
+	using Parameters = WhiskersParameterMap<std::string>;
+	using Conditions = WhiskersParameterMap<bool>;
 
 	explicit Whiskers(std::string _template = "");
 
 	/// Sets a single regular parameter, <paramName>.
-	Whiskers& operator()(std::string _parameter, std::string _value);
-	Whiskers& operator()(std::string _parameter, char const* _value) { return (*this)(_parameter, std::string{_value}); }
+	Whiskers& operator()(std::string_view _parameter, std::string _value);
+	Whiskers& operator()(std::string_view _parameter, char const* _value) { return (*this)(_parameter, std::string{_value}); }
 	/// Sets a condition parameter, <?paramName>...<!paramName>...</paramName>
-	Whiskers& operator()(std::string _parameter, bool _value);
+	Whiskers& operator()(std::string_view _parameter, bool _value);
 	/// Sets a list parameter, <#listName> </listName>.
 	Whiskers& operator()(
-		std::string _listParameter,
+		std::string_view _listParameter,
 		std::vector<StringMap> _values
 	);
 
@@ -91,32 +148,19 @@ public:
 
 private:
 	// Prevent implicit cast to bool
-	Whiskers& operator()(std::string _parameter, long long);
-	void checkTemplateValid() const;
-	void checkParameterValid(std::string const& _parameter) const;
-	void checkParameterUnknown(std::string const& _parameter) const;
+	Whiskers& operator()(std::string_view _parameter, long long);
+	void checkParameterValid(std::string_view _parameter) const;
+	void checkParameterUnknown(std::string_view _parameter) const;
 
-	/// Checks whether the string stored in `m_template` contains all the tags specified.
+	/// Checks whether the template string contains all the tags specified.
 	/// @param _parameter name of the parameter. This name is used to construct the tag(s).
 	/// @param _prefixes a vector of strings, where each element is used to compose the tag
 	///        like `"<" + element + _parameter + ">"`. Each element of _prefixes is used as a prefix of the tag name.
-	void checkTemplateContainsTags(std::string const& _parameter, std::vector<std::string> const& _prefixes) const;
-
-	static std::string replace(
-		std::string const& _template,
-		StringMap const& _parameters,
-		std::map<std::string, bool> const& _conditions,
-		StringListMap const& _listParameters = StringListMap()
-	);
-
-	static std::string paramRegex() { return "[a-zA-Z0-9_$-]+"; }
-
-	/// Joins the two maps throwing an exception if two keys are equal.
-	static StringMap joinMaps(StringMap const& _a, StringMap const& _b);
+	void checkTemplateContainsTags(std::string_view _parameter, std::vector<std::string> const& _prefixes) const;
 
-	std::string m_template;
-	StringMap m_parameters;
-	std::map<std::string, bool> m_conditions;
+	std::shared_ptr<WhiskersTemplate const> m_template;
+	Parameters m_parameters;
+	Conditions m_conditions;
 	StringListMap m_listParameters;
 };
 
@@ -64,15 +64,28 @@ std::shared_ptr<DebugData const> Parser::createDebugData() const
 	switch (m_useSourceLocationFrom)
 	{
 		case UseSourceLocationFrom::Scanner:
-			return DebugData::create(ParserBase::currentLocation(), ParserBase::currentLocation());
+			return allocateDebugData(DebugData{ParserBase::currentLocation(), ParserBase::currentLocation()});
 		case UseSourceLocationFrom::LocationOverride:
-			return DebugData::create(m_locationOverride, m_locationOverride);
+			// The override never changes during a parse, so all nodes can share one instance.
+			if (!m_overrideDebugData)
+				m_overrideDebugData = allocateDebugData(DebugData{m_locationOverride, m_locationOverride});
+			return m_overrideDebugData;
 		case UseSourceLocationFrom::Comments:
-			return DebugData::create(ParserBase::currentLocation(), m_locationFromComment, m_astIDFromComment);
+			return allocateDebugData(DebugData{ParserBase::currentLocation(), m_locationFromComment, m_astIDFromComment});
 	}
 	solAssert(false, "");
 }
 
+std::shared_ptr<DebugData const> Parser::allocateDebugData(DebugData _data) const
+{
+	if (!m_debugDataArena)
+		return std::make_shared<DebugData const>(std::move(_data));
+	return std::allocate_shared<DebugData>(
+		util::ArenaAllocator<DebugData>(m_debugDataArena),
+		std::move(_data)
+	);
+}
+
 void Parser::updateLocationEndFrom(
 	std::shared_ptr<DebugData const>& _debugData,
 	SourceLocation const& _location
@@ -87,7 +100,7 @@ void Parser::updateLocationEndFrom(
 			DebugData updatedDebugData = *_debugData;
 			updatedDebugData.nativeLocation.end = _location.end;
 			updatedDebugData.originLocation.end = _location.end;
-			_debugData = std::make_shared<DebugData const>(std::move(updatedDebugData));
+			_debugData = allocateDebugData(std::move(updatedDebugData));
 			break;
 		}
 		case UseSourceLocationFrom::LocationOverride:
@@ -97,7 +110,7 @@ void Parser::updateLocationEndFrom(
 		{
 			DebugData updatedDebugData = *_debugData;
 			updatedDebugData.nativeLocation.end = _location.end;
-			_debugData = std::make_shared<DebugData const>(std::move(updatedDebugData));
+			_debugData = allocateDebugData(std::move(updatedDebugData));
 			break;
 		}
 	}
@@ -118,10 +131,17 @@ std::unique_ptr<Block> Parser::parseInline(std::shared_ptr<Scanner> const& _scan
 	auto previousScannerKind = _scanner->scannerKind();
 	_scanner->setScannerMode(ScannerKind::Yul);
 	ScopeGuard resetScanner([&]{ _scanner->setScannerMode(previousScannerKind); });
+	// Standalone Yul sources, e.g. the IR of via-ir compilation, can be large. If the
+	// scanner is still at the start of its source, tokenize the source upfront so that
+	// parsing indexes the contiguous token array instead of interleaving with scanning.
+	// For inline assembly in the middle of a Solidity source this is a no-op.
+	_scanner->pretokenize();
 
 	try
 	{
 		m_scanner = _scanner;
+		m_debugDataArena = std::make_shared<util::Arena>();
+		m_overrideDebugData.reset();
 		if (m_useSourceLocationFrom == UseSourceLocationFrom::Comments)
 			fetchDebugDataFromComment();
 		return std::make_unique<Block>(parseBlock());
@@ -31,6 +31,8 @@
 #include <liblangutil/Scanner.h>
 #include <liblangutil/ParserBase.h>
 
+#include <libsolutil/Arena.h>
+
 #include <map>
 #include <memory>
 #include <variant>
@@ -120,6 +122,10 @@ protected:
 	/// Creates a DebugData object with the correct source location set.
 	std::shared_ptr<DebugData const> createDebugData() const;
 
+	/// Allocates @a _data from the arena of the current parse so that the debug data
+	/// of an AST ends up in contiguous memory.
+	std::shared_ptr<DebugData const> allocateDebugData(DebugData _data) const;
+
 	void updateLocationEndFrom(
 		std::shared_ptr<DebugData const>& _debugData,
 		langutil::SourceLocation const& _location
@@ -157,6 +163,12 @@ private:
 	Dialect const& m_dialect;
 
 	std::optional<std::map<unsigned, std::shared_ptr<std::string const>>> m_sourceNames;
+	/// Arena the debug data of the currently parsed AST is allocated from.
+	/// Kept alive by the debug data instances through their control blocks.
+	std::shared_ptr<util::Arena> m_debugDataArena;
+	/// In LocationOverride mode all nodes carry the same debug data, so a single
+	/// instance is created lazily and shared.
+	mutable std::shared_ptr<DebugData const> m_overrideDebugData;
 	langutil::SourceLocation m_locationOverride;
 	langutil::SourceLocation m_locationFromComment;
 	std::optional<int64_t> m_astIDFromComment;
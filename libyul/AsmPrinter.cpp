@@ -32,8 +32,6 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/replace.hpp>
 
-#include <range/v3/view/transform.hpp>
-
 #include <memory>
 #include <functional>
 
@@ -42,206 +40,356 @@ using namespace solidity::langutil;
 using namespace solidity::util;
 using namespace solidity::yul;
 
+template <class T>
+std::string AsmPrinter::printed(T const& _node)
+{
+	m_buffer.clear();
+	m_indent = 0;
+	print(_node);
+	return std::move(m_buffer);
+}
+
 std::string AsmPrinter::operator()(Literal const& _literal)
 {
-	std::string const locationComment = formatDebugData(_literal);
+	return printed(_literal);
+}
+
+std::string AsmPrinter::operator()(Identifier const& _identifier)
+{
+	return printed(_identifier);
+}
+
+std::string AsmPrinter::operator()(ExpressionStatement const& _statement)
+{
+	return printed(_statement);
+}
+
+std::string AsmPrinter::operator()(Assignment const& _assignment)
+{
+	return printed(_assignment);
+}
+
+std::string AsmPrinter::operator()(VariableDeclaration const& _variableDeclaration)
+{
+	return printed(_variableDeclaration);
+}
+
+std::string AsmPrinter::operator()(FunctionDefinition const& _functionDefinition)
+{
+	return printed(_functionDefinition);
+}
+
+std::string AsmPrinter::operator()(FunctionCall const& _functionCall)
+{
+	return printed(_functionCall);
+}
+
+std::string AsmPrinter::operator()(If const& _if)
+{
+	return printed(_if);
+}
+
+std::string AsmPrinter::operator()(Switch const& _switch)
+{
+	return printed(_switch);
+}
+
+std::string AsmPrinter::operator()(ForLoop const& _forLoop)
+{
+	return printed(_forLoop);
+}
+
+std::string AsmPrinter::operator()(Break const& _break)
+{
+	return printed(_break);
+}
+
+std::string AsmPrinter::operator()(Continue const& _continue)
+{
+	return printed(_continue);
+}
+
+// '_leave' and '__leave' is reserved in VisualStudio
+std::string AsmPrinter::operator()(Leave const& leave_)
+{
+	return printed(leave_);
+}
+
+std::string AsmPrinter::operator()(Block const& _block)
+{
+	return printed(_block);
+}
+
+void AsmPrinter::print(Literal const& _literal)
+{
+	printDebugData(_literal);
 
 	switch (_literal.kind)
 	{
 	case LiteralKind::Number:
 		yulAssert(isValidDecimal(_literal.value.str()) || isValidHex(_literal.value.str()), "Invalid number literal");
-		return locationComment + _literal.value.str() + appendTypeName(_literal.type);
+		m_buffer += _literal.value.str();
+		appendTypeName(_literal.type);
+		return;
 	case LiteralKind::Boolean:
 		yulAssert(_literal.value == "true"_yulstring || _literal.value == "false"_yulstring, "Invalid bool literal.");
-		return locationComment + ((_literal.value == "true"_yulstring) ? "true" : "false") + appendTypeName(_literal.type, true);
+		m_buffer += (_literal.value == "true"_yulstring) ? "true" : "false";
+		appendTypeName(_literal.type, true);
+		return;
 	case LiteralKind::String:
 		break;
 	}
 
-	return locationComment + escapeAndQuoteString(_literal.value.str()) + appendTypeName(_literal.type);
+	m_buffer += escapeAndQuoteString(_literal.value.str());
+	appendTypeName(_literal.type);
 }
 
-std::string AsmPrinter::operator()(Identifier const& _identifier)
+void AsmPrinter::print(Identifier const& _identifier)
 {
 	yulAssert(!_identifier.name.empty(), "Invalid identifier.");
-	return formatDebugData(_identifier) + _identifier.name.str();
+	printDebugData(_identifier);
+	m_buffer += _identifier.name.str();
 }
 
-std::string AsmPrinter::operator()(ExpressionStatement const& _statement)
+void AsmPrinter::print(ExpressionStatement const& _statement)
 {
-	std::string const locationComment = formatDebugData(_statement);
-
-	return locationComment + std::visit(*this, _statement.expression);
+	printDebugData(_statement);
+	print(_statement.expression);
 }
 
-std::string AsmPrinter::operator()(Assignment const& _assignment)
+void AsmPrinter::print(Assignment const& _assignment)
 {
-	std::string const locationComment = formatDebugData(_assignment);
+	printDebugData(_assignment);
 
 	yulAssert(_assignment.variableNames.size() >= 1, "");
-	std::string variables = (*this)(_assignment.variableNames.front());
+	print(_assignment.variableNames.front());
 	for (size_t i = 1; i < _assignment.variableNames.size(); ++i)
-		variables += ", " + (*this)(_assignment.variableNames[i]);
+	{
+		m_buffer += ", ";
+		print(_assignment.variableNames[i]);
+	}
 
-	return locationComment + variables + " := " + std::visit(*this, *_assignment.value);
+	m_buffer += " := ";
+	print(*_assignment.value);
 }
 
-std::string AsmPrinter::operator()(VariableDeclaration const& _variableDeclaration)
+void AsmPrinter::print(VariableDeclaration const& _variableDeclaration)
 {
-	std::string out = formatDebugData(_variableDeclaration);
+	printDebugData(_variableDeclaration);
 
-	out += "let ";
-	out += boost::algorithm::join(
-		_variableDeclaration.variables | ranges::views::transform(
-			[this](TypedName argument) { return formatTypedName(argument); }
-		),
-		", "
-	);
+	m_buffer += "let ";
+	printTypedNameList(_variableDeclaration.variables);
 	if (_variableDeclaration.value)
 	{
-		out += " := ";
-		out += std::visit(*this, *_variableDeclaration.value);
+		m_buffer += " := ";
+		print(*_variableDeclaration.value);
 	}
-	return out;
 }
 
-std::string AsmPrinter::operator()(FunctionDefinition const& _functionDefinition)
+void AsmPrinter::print(FunctionDefinition const& _functionDefinition)
 {
 	yulAssert(!_functionDefinition.name.empty(), "Invalid function name.");
 
-	std::string out = formatDebugData(_functionDefinition);
-	out += "function " + _functionDefinition.name.str() + "(";
-	out += boost::algorithm::join(
-		_functionDefinition.parameters | ranges::views::transform(
-			[this](TypedName argument) { return formatTypedName(argument); }
-		),
-		", "
-	);
-	out += ")";
+	printDebugData(_functionDefinition);
+	m_buffer += "function " + _functionDefinition.name.str() + "(";
+	printTypedNameList(_functionDefinition.parameters);
+	m_buffer += ")";
 	if (!_functionDefinition.returnVariables.empty())
 	{
-		out += " -> ";
-		out += boost::algorithm::join(
-			_functionDefinition.returnVariables | ranges::views::transform(
-				[this](TypedName argument) { return formatTypedName(argument); }
-			),
-			", "
-		);
+		m_buffer += " -> ";
+		printTypedNameList(_functionDefinition.returnVariables);
 	}
 
-	return out + "\n" + (*this)(_functionDefinition.body);
+	startLine();
+	print(_functionDefinition.body);
 }
 
-std::string AsmPrinter::operator()(FunctionCall const& _functionCall)
+void AsmPrinter::print(FunctionCall const& _functionCall)
 {
-	std::string const locationComment = formatDebugData(_functionCall);
-	std::string const functionName = (*this)(_functionCall.functionName);
-	return
-		locationComment +
-		functionName + "(" +
-		boost::algorithm::join(
-			_functionCall.arguments | ranges::views::transform([&](auto&& _node) { return std::visit(*this, _node); }),
-			", " ) +
-		")";
+	printDebugData(_functionCall);
+	print(_functionCall.functionName);
+	m_buffer += "(";
+	bool first = true;
+	for (auto const& argument: _functionCall.arguments)
+	{
+		if (!first)
+			m_buffer += ", ";
+		first = false;
+		print(argument);
+	}
+	m_buffer += ")";
 }
 
-std::string AsmPrinter::operator()(If const& _if)
+void AsmPrinter::print(If const& _if)
 {
 	yulAssert(_if.condition, "Invalid if condition.");
 
-	std::string out = formatDebugData(_if);
-	out += "if " + std::visit(*this, *_if.condition);
-
-	std::string body = (*this)(_if.body);
-	char delim = '\n';
-	if (body.find('\n') == std::string::npos)
-		delim = ' ';
-
-	return out + delim + body;
+	printDebugData(_if);
+	m_buffer += "if ";
+	print(*_if.condition);
+
+	size_t delimiterStart = m_buffer.size();
+	startLine();
+	size_t bodyStart = m_buffer.size();
+	print(_if.body);
+	// Use a space instead of a line break if the body fits on a single line.
+	if (m_buffer.find('\n', bodyStart) == std::string::npos)
+		m_buffer.replace(delimiterStart, bodyStart - delimiterStart, " ");
 }
 
-std::string AsmPrinter::operator()(Switch const& _switch)
+void AsmPrinter::print(Switch const& _switch)
 {
 	yulAssert(_switch.expression, "Invalid expression pointer.");
 
-	std::string out = formatDebugData(_switch);
-	out += "switch " + std::visit(*this, *_switch.expression);
+	printDebugData(_switch);
+	m_buffer += "switch ";
+	print(*_switch.expression);
 
 	for (auto const& _case: _switch.cases)
 	{
+		startLine();
 		if (!_case.value)
-			out += "\ndefault ";
+			m_buffer += "default ";
 		else
-			out += "\ncase " + (*this)(*_case.value) + " ";
-		out += (*this)(_case.body);
+		{
+			m_buffer += "case ";
+			print(*_case.value);
+			m_buffer += " ";
+		}
+		print(_case.body);
 	}
-	return out;
 }
 
-std::string AsmPrinter::operator()(ForLoop const& _forLoop)
+void AsmPrinter::print(ForLoop const& _forLoop)
 {
 	yulAssert(_forLoop.condition, "Invalid for loop condition.");
-	std::string const locationComment = formatDebugData(_forLoop);
-
-	std::string pre = (*this)(_forLoop.pre);
-	std::string condition = std::visit(*this, *_forLoop.condition);
-	std::string post = (*this)(_forLoop.post);
-
-	char delim = '\n';
+	printDebugData(_forLoop);
+
+	m_buffer += "for ";
+	size_t preStart = m_buffer.size();
+	print(_forLoop.pre);
+	size_t preEnd = m_buffer.size();
+	startLine();
+	size_t conditionStart = m_buffer.size();
+	print(*_forLoop.condition);
+	size_t conditionEnd = m_buffer.size();
+	startLine();
+	size_t postStart = m_buffer.size();
+	print(_forLoop.post);
+	size_t postEnd = m_buffer.size();
+
+	// Use spaces instead of line breaks if the loop header is short enough to
+	// fit on a single line. The sizes exclude indentation since a part that
+	// contains a line break disqualifies the header anyway.
 	if (
-		pre.size() + condition.size() + post.size() < 60 &&
-		pre.find('\n') == std::string::npos &&
-		post.find('\n') == std::string::npos
+		(preEnd - preStart) + (conditionEnd - conditionStart) + (postEnd - postStart) < 60 &&
+		m_buffer.find('\n', preStart) >= preEnd &&
+		m_buffer.find('\n', postStart) >= postEnd
 	)
-		delim = ' ';
-	return
-		locationComment +
-		("for " + std::move(pre) + delim + std::move(condition) + delim + std::move(post) + "\n") +
-		(*this)(_forLoop.body);
+	{
+		m_buffer.replace(conditionEnd, postStart - conditionEnd, " ");
+		m_buffer.replace(preEnd, conditionStart - preEnd, " ");
+	}
+
+	startLine();
+	print(_forLoop.body);
 }
 
-std::string AsmPrinter::operator()(Break const& _break)
+void AsmPrinter::print(Break const& _break)
 {
-	return formatDebugData(_break) + "break";
+	printDebugData(_break);
+	m_buffer += "break";
 }
 
-std::string AsmPrinter::operator()(Continue const& _continue)
+void AsmPrinter::print(Continue const& _continue)
 {
-	return formatDebugData(_continue) + "continue";
+	printDebugData(_continue);
+	m_buffer += "continue";
 }
 
-// '_leave' and '__leave' is reserved in VisualStudio
-std::string AsmPrinter::operator()(Leave const& leave_)
+void AsmPrinter::print(Leave const& _leave)
 {
-	return formatDebugData(leave_) + "leave";
+	printDebugData(_leave);
+	m_buffer += "leave";
 }
 
-std::string AsmPrinter::operator()(Block const& _block)
+void AsmPrinter::print(Block const& _block)
 {
-	std::string const locationComment = formatDebugData(_block);
+	printDebugData(_block);
 
 	if (_block.statements.empty())
-		return locationComment + "{ }";
-	std::string body = boost::algorithm::join(
-		_block.statements | ranges::views::transform([&](auto&& _node) { return std::visit(*this, _node); }),
-		"\n"
-	);
-	if (body.size() < 30 && body.find('\n') == std::string::npos)
-		return locationComment + "{ " + body + " }";
+	{
+		m_buffer += "{ }";
+		return;
+	}
+
+	m_buffer += "{";
+	size_t bodyStart = m_buffer.size();
+	++m_indent;
+	for (auto const& statement: _block.statements)
+	{
+		startLine();
+		print(statement);
+	}
+	--m_indent;
+
+	// A single short statement is kept on the same line as the braces. This is
+	// only known after printing the statement, but the rewrite is cheap since
+	// it moves less than 30 characters.
+	size_t statementStart = bodyStart + 1 + 4 * (m_indent + 1);
+	if (
+		_block.statements.size() == 1 &&
+		m_buffer.size() - statementStart < 30 &&
+		m_buffer.find('\n', statementStart) == std::string::npos
+	)
+	{
+		m_buffer.replace(bodyStart, statementStart - bodyStart, " ");
+		m_buffer += " }";
+	}
 	else
 	{
-		boost::replace_all(body, "\n", "\n    ");
-		return locationComment + "{\n    " + body + "\n}";
+		startLine();
+		m_buffer += "}";
 	}
 }
 
-std::string AsmPrinter::formatTypedName(TypedName _variable)
+void AsmPrinter::print(Expression const& _expression)
+{
+	std::visit([this](auto const& _node) { print(_node); }, _expression);
+}
+
+void AsmPrinter::print(Statement const& _statement)
+{
+	std::visit([this](auto const& _node) { print(_node); }, _statement);
+}
+
+void AsmPrinter::startLine()
+{
+	m_buffer += '\n';
+	m_buffer.append(4 * m_indent, ' ');
+}
+
+void AsmPrinter::printTypedName(TypedName const& _variable)
 {
 	yulAssert(!_variable.name.empty(), "Invalid variable name.");
-	return formatDebugData(_variable) + _variable.name.str() + appendTypeName(_variable.type);
+	printDebugData(_variable);
+	m_buffer += _variable.name.str();
+	appendTypeName(_variable.type);
+}
+
+void AsmPrinter::printTypedNameList(std::vector<TypedName> const& _names)
+{
+	bool first = true;
+	for (auto const& name: _names)
+	{
+		if (!first)
+			m_buffer += ", ";
+		first = false;
+		printTypedName(name);
+	}
 }
 
-std::string AsmPrinter::appendTypeName(YulString _type, bool _isBoolLiteral) const
+void AsmPrinter::appendTypeName(YulString _type, bool _isBoolLiteral)
 {
 	if (m_dialect && !_type.empty())
 	{
@@ -251,10 +399,11 @@ std::string AsmPrinter::appendTypeName(YulString _type, bool _isBoolLiteral) con
 			// Special case: If we have a bool type but empty default type, do not remove the type.
 			_type = {};
 	}
-	if (_type.empty())
-		return {};
-	else
-		return ":" + _type.str();
+	if (!_type.empty())
+	{
+		m_buffer += ":";
+		m_buffer += _type.str();
+	}
 }
 
 std::string AsmPrinter::formatSourceLocation(
@@ -305,10 +454,10 @@ std::string AsmPrinter::formatSourceLocation(
 	return sourceLocation + (solidityCodeSnippet.empty() ? "" : "  ") + solidityCodeSnippet;
 }
 
-std::string AsmPrinter::formatDebugData(std::shared_ptr<DebugData const> const& _debugData, bool _statement)
+void AsmPrinter::printDebugData(std::shared_ptr<DebugData const> const& _debugData, bool _statement)
 {
 	if (!_debugData || m_debugInfoSelection.none())
-		return "";
+		return;
 
 	std::vector<std::string> items;
 	if (auto id = _debugData->astID)
@@ -332,10 +481,13 @@ std::string AsmPrinter::formatDebugData(std::shared_ptr<DebugData const> const&
 
 	std::string commentBody = joinHumanReadable(items, " ");
 	if (commentBody.empty())
-		return "";
+		return;
+
+	if (_statement)
+	{
+		m_buffer += "/// " + commentBody;
+		startLine();
+	}
 	else
-		return
-			_statement ?
-			"/// " + commentBody + "\n" :
-			"/** " + commentBody + " */ ";
+		m_buffer += "/** " + commentBody + " */ ";
 }
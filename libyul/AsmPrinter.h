@@ -33,6 +33,7 @@
 #include <liblangutil/SourceLocation.h>
 
 #include <map>
+#include <vector>
 
 namespace solidity::yul
 {
@@ -42,6 +43,9 @@ struct Dialect;
  * Converts a parsed Yul AST into readable string representation.
  * Ignores source locations.
  * If a dialect is provided, the dialect's default type is omitted.
+ * The output is built in a single buffer instead of concatenating
+ * intermediate strings per node, so printing large ASTs stays linear
+ * in the size of the output.
  */
 class AsmPrinter
 {
@@ -91,14 +95,38 @@ public:
 	);
 
 private:
-	std::string formatTypedName(TypedName _variable);
-	std::string appendTypeName(YulString _type, bool _isBoolLiteral = false) const;
-	std::string formatDebugData(std::shared_ptr<DebugData const> const& _debugData, bool _statement);
+	/// The print functions append to m_buffer at the indentation depth
+	/// tracked in m_indent.
+	void print(Literal const& _literal);
+	void print(Identifier const& _identifier);
+	void print(ExpressionStatement const& _expr);
+	void print(Assignment const& _assignment);
+	void print(VariableDeclaration const& _variableDeclaration);
+	void print(FunctionDefinition const& _functionDefinition);
+	void print(FunctionCall const& _functionCall);
+	void print(If const& _if);
+	void print(Switch const& _switch);
+	void print(ForLoop const& _forLoop);
+	void print(Break const& _break);
+	void print(Continue const& _continue);
+	void print(Leave const& _leave);
+	void print(Block const& _block);
+	void print(Expression const& _expression);
+	void print(Statement const& _statement);
+	/// Prints @a _node into a fresh buffer and returns it.
 	template <class T>
-	std::string formatDebugData(T const& _node)
+	std::string printed(T const& _node);
+	/// Starts a new line in the buffer at the current indentation depth.
+	void startLine();
+	void printTypedName(TypedName const& _variable);
+	void printTypedNameList(std::vector<TypedName> const& _names);
+	void appendTypeName(YulString _type, bool _isBoolLiteral = false);
+	void printDebugData(std::shared_ptr<DebugData const> const& _debugData, bool _statement);
+	template <class T>
+	void printDebugData(T const& _node)
 	{
 		bool isExpression = std::is_constructible<Expression, T>::value;
-		return formatDebugData(_node.debugData, !isExpression);
+		printDebugData(_node.debugData, !isExpression);
 	}
 
 	Dialect const* const m_dialect = nullptr;
@@ -106,6 +134,8 @@ private:
 	langutil::SourceLocation m_lastLocation = {};
 	langutil::DebugInfoSelection m_debugInfoSelection = {};
 	langutil::CharStreamProvider const* m_soliditySourceProvider = nullptr;
+	std::string m_buffer;
+	size_t m_indent = 0;
 };
 
 }
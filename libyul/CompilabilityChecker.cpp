@@ -22,10 +22,17 @@
 
 #include <libyul/AsmAnalysis.h>
 #include <libyul/AsmAnalysisInfo.h>
+#include <libyul/AST.h>
+#include <libyul/Exceptions.h>
+
+#include <libyul/optimiser/ASTCopier.h>
+#include <libyul/optimiser/BlockHasher.h>
 
 #include <libyul/backends/evm/EVMCodeTransform.h>
 #include <libyul/backends/evm/NoOutputAssembly.h>
 
+#include <variant>
+
 using namespace solidity;
 using namespace solidity::yul;
 using namespace solidity::util;
@@ -70,3 +77,69 @@ CompilabilityChecker::CompilabilityChecker(
 		}
 	}
 }
+
+std::map<YulString, int> CachedCompilabilityChecker::stackDeficit(Object const& _object)
+{
+	yulAssert(
+		_object.code &&
+		!_object.code->statements.empty() &&
+		std::holds_alternative<Block>(_object.code->statements.front()),
+		"Need to run the function grouper before the cached compilability check."
+	);
+
+	// Assemble a copy of the object in which every function that was already checked in
+	// its current state is replaced by an empty stub with the same signature, so only the
+	// outermost block and the modified functions are compiled again. The stack errors of
+	// a function only depend on its own code, so the cached results stay valid.
+	Object partial;
+	partial.name = _object.name;
+	partial.subObjects = _object.subObjects;
+	partial.subIndexByName = _object.subIndexByName;
+	partial.code = std::make_shared<Block>();
+
+	ASTCopier copier;
+	std::map<YulString, uint64_t> recheckedHashes;
+	for (Statement const& statement: _object.code->statements)
+		if (auto const* function = std::get_if<FunctionDefinition>(&statement))
+		{
+			uint64_t codeHash = ASTHasher::run(*function);
+			auto cached = m_cache.find(function->name);
+			if (cached != m_cache.end() && cached->second.codeHash == codeHash)
+				partial.code->statements.emplace_back(FunctionDefinition{
+					function->debugData,
+					function->name,
+					function->parameters,
+					function->returnVariables,
+					Block{function->body.debugData, {}}
+				});
+			else
+			{
+				partial.code->statements.emplace_back(copier(*function));
+				recheckedHashes[function->name] = codeHash;
+			}
+		}
+		else
+			partial.code->statements.emplace_back(std::visit(copier, statement));
+
+	CompilabilityChecker checker(m_dialect, partial, m_optimizeStackAllocation);
+	for (auto const& [name, codeHash]: recheckedHashes)
+	{
+		auto deficit = checker.stackDeficit.find(name);
+		m_cache[name] = {codeHash, deficit == checker.stackDeficit.end() ? 0 : deficit->second};
+	}
+
+	std::map<YulString, int> result;
+	// The outermost block is always compiled again; its errors are reported under the
+	// empty name.
+	if (checker.stackDeficit.count(YulString{}))
+		result[YulString{}] = checker.stackDeficit.at(YulString{});
+	for (Statement const& statement: _object.code->statements)
+		if (auto const* function = std::get_if<FunctionDefinition>(&statement))
+		{
+			auto cached = m_cache.find(function->name);
+			yulAssert(cached != m_cache.end(), "");
+			if (cached->second.deficit != 0)
+				result[function->name] = cached->second.deficit;
+		}
+	return result;
+}
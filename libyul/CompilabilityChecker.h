@@ -25,6 +25,7 @@
 #include <libyul/ASTForward.h>
 #include <libyul/Object.h>
 
+#include <cstdint>
 #include <map>
 #include <memory>
 
@@ -49,4 +50,38 @@ struct CompilabilityChecker
 	std::map<YulString, int> stackDeficit;
 };
 
+/**
+ * Variant of the CompilabilityChecker for callers that check slightly modified versions
+ * of the same object over and over, like the stack compressor. Caches the stack deficit
+ * of each function keyed by a hash of the function's code, so that between two checks
+ * only the functions that were actually modified are compiled again. Unmodified
+ * functions are replaced by empty stubs with the same signature for the recompilation,
+ * so calls to them still resolve while their cached result stays valid.
+ *
+ * Prerequisites: Disambiguator, Function Grouper.
+ */
+class CachedCompilabilityChecker
+{
+public:
+	CachedCompilabilityChecker(Dialect const& _dialect, bool _optimizeStackAllocation):
+		m_dialect(_dialect), m_optimizeStackAllocation(_optimizeStackAllocation) {}
+
+	/// Checks the current state of @a _object.
+	/// @returns a map from function name to the largest stack difference found in that
+	/// function, equivalent to the stackDeficit member of the CompilabilityChecker.
+	std::map<YulString, int> stackDeficit(Object const& _object);
+
+private:
+	struct CacheEntry
+	{
+		uint64_t codeHash = 0;
+		/// Largest stack deficit of the function, zero if it is compilable.
+		int deficit = 0;
+	};
+
+	Dialect const& m_dialect;
+	bool m_optimizeStackAllocation = false;
+	std::map<YulString, CacheEntry> m_cache;
+};
+
 }
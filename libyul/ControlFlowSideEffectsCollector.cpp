@@ -21,6 +21,7 @@
 #include <libyul/AST.h>
 #include <libyul/Dialect.h>
 #include <libyul/FunctionReferenceResolver.h>
+#include <libyul/optimiser/BlockHasher.h>
 
 #include <libsolutil/Common.h>
 #include <libsolutil/CommonData.h>
@@ -237,6 +238,20 @@ std::map<YulString, ControlFlowSideEffects> ControlFlowSideEffectsCollector::fun
 	return result;
 }
 
+std::map<YulString, ControlFlowSideEffects> const& ControlFlowSideEffectsCache::functionSideEffectsNamed(
+	Dialect const& _dialect,
+	Block const& _ast
+)
+{
+	uint64_t fingerprint = ASTHasher::run(_ast);
+	if (m_fingerprint != fingerprint)
+	{
+		m_functionSideEffects = ControlFlowSideEffectsCollector{_dialect, _ast}.functionSideEffectsNamed();
+		m_fingerprint = fingerprint;
+	}
+	return m_functionSideEffects;
+}
+
 bool ControlFlowSideEffectsCollector::processFunction(FunctionDefinition const& _function)
 {
 	bool progress = false;
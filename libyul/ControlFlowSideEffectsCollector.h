@@ -135,5 +135,30 @@ private:
 	std::map<FunctionDefinition const*, std::set<FunctionCall const*>> m_functionCalls;
 };
 
+/**
+ * Cache for the result of the ControlFlowSideEffectsCollector, shared between optimiser
+ * steps via the OptimiserStepContext.
+ *
+ * The side effects are memoized together with a name-sensitive structural hash of the
+ * AST, so that consecutive steps that did not rewrite the code reuse them instead of
+ * rebuilding the control flow graph. Any rewrite changes the hash and thus invalidates
+ * the cache automatically.
+ */
+class ControlFlowSideEffectsCache
+{
+public:
+	/// @returns the control-flow side effects of all functions defined in @a _ast by
+	/// name, recomputing them only if the code changed since the last call.
+	/// Requires unique function names.
+	std::map<YulString, ControlFlowSideEffects> const& functionSideEffectsNamed(
+		Dialect const& _dialect,
+		Block const& _ast
+	);
+
+private:
+	std::optional<uint64_t> m_fingerprint;
+	std::map<YulString, ControlFlowSideEffects> m_functionSideEffects;
+};
+
 
 }
@@ -22,6 +22,8 @@
 #include <libyul/Dialect.h>
 #include <libyul/AST.h>
 
+#include <mutex>
+
 using namespace solidity::yul;
 using namespace solidity::langutil;
 
@@ -51,9 +53,13 @@ bool Dialect::validTypeForLiteral(LiteralKind _kind, YulString, YulString _type)
 
 Dialect const& Dialect::yulDeprecated()
 {
+	// The mutex makes the lazy construction safe for concurrent compilations. As with
+	// YulStringRepository, the reset callback still requires external synchronization.
+	static std::mutex mutex;
 	static std::unique_ptr<Dialect> dialect;
-	static YulStringRepository::ResetCallback callback{[&] { dialect.reset(); }};
+	static YulStringRepository::ResetCallback callback{[&] { std::lock_guard lock(mutex); dialect.reset(); }};
 
+	std::lock_guard lock(mutex);
 	if (!dialect)
 	{
 		// TODO will probably change, especially the list of types.
@@ -0,0 +1,753 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Compact, versioned binary serialization of Yul objects.
+ */
+
+#include <libyul/ObjectBinary.h>
+
+#include <libyul/AST.h>
+#include <libyul/Object.h>
+
+#include <cstdint>
+#include <map>
+#include <variant>
+#include <vector>
+
+using namespace solidity;
+using namespace solidity::yul;
+using namespace solidity::langutil;
+
+namespace
+{
+
+/// Magic header identifying the format, followed by a single version byte.
+/// The version has to be bumped on every incompatible change of the encoding.
+std::string const magic = "solc-yulbin";
+uint8_t constexpr formatVersion = 1;
+
+/// One tag byte precedes every object node.
+enum class NodeTag: uint8_t
+{
+	Object = 0,
+	Data = 1,
+};
+
+/// One tag byte precedes every statement.
+enum class StatementTag: uint8_t
+{
+	ExpressionStatement = 0,
+	Assignment = 1,
+	VariableDeclaration = 2,
+	FunctionDefinition = 3,
+	If = 4,
+	Switch = 5,
+	ForLoop = 6,
+	Break = 7,
+	Continue = 8,
+	Leave = 9,
+	Block = 10,
+};
+
+/// One tag byte precedes every expression.
+enum class ExpressionTag: uint8_t
+{
+	FunctionCall = 0,
+	Identifier = 1,
+	Literal = 2,
+};
+
+/// Nesting depth limit applied while decoding so that malformed input cannot
+/// exhaust the stack. Matches the guard used by the binary JSON decoder.
+size_t constexpr maxDepth = 1000;
+
+void appendVarint(std::string& _out, uint64_t _value)
+{
+	while (_value > 0x7f)
+	{
+		_out += static_cast<char>(0x80 | (_value & 0x7f));
+		_value >>= 7;
+	}
+	_out += static_cast<char>(_value);
+}
+
+void appendZigzag(std::string& _out, int64_t _value)
+{
+	appendVarint(_out, (static_cast<uint64_t>(_value) << 1) ^ static_cast<uint64_t>(_value >> 63));
+}
+
+/// Serializes an object tree into the binary format. The document consists of the
+/// magic header, a table of all distinct strings, a table of all distinct debug
+/// data entries and the encoded tree, which references both tables by index.
+/// The tables are filled while the tree is encoded into a separate buffer, so a
+/// single pass over the object suffices.
+class Encoder
+{
+public:
+	std::string serialize(Object const& _object)
+	{
+		encode(_object);
+
+		std::string out = magic;
+		out += static_cast<char>(formatVersion);
+		appendVarint(out, m_strings.size());
+		for (std::string const& string: m_strings)
+		{
+			appendVarint(out, string.size());
+			out += string;
+		}
+		appendVarint(out, m_debugDataCount);
+		out += m_debugDataTable;
+		out += m_body;
+		return out;
+	}
+
+private:
+	/// @returns the table index of @a _string, adding it to the table if necessary.
+	uint64_t stringIndex(std::string const& _string)
+	{
+		auto [it, inserted] = m_stringIndices.try_emplace(_string, m_strings.size());
+		if (inserted)
+			m_strings.emplace_back(_string);
+		return it->second;
+	}
+
+	/// @returns the reference value for @a _debugData: zero for a null pointer,
+	/// otherwise one plus the table index of the entry. Entries are deduplicated
+	/// by pointer identity, which the parser and the optimiser steps preserve.
+	uint64_t debugDataRef(std::shared_ptr<DebugData const> const& _debugData)
+	{
+		if (!_debugData)
+			return 0;
+		auto [it, inserted] = m_debugDataIndices.try_emplace(_debugData.get(), m_debugDataCount);
+		if (inserted)
+		{
+			encodeLocation(m_debugDataTable, _debugData->nativeLocation);
+			encodeLocation(m_debugDataTable, _debugData->originLocation);
+			m_debugDataTable += static_cast<char>(_debugData->astID.has_value() ? 1 : 0);
+			if (_debugData->astID)
+				appendZigzag(m_debugDataTable, *_debugData->astID);
+			++m_debugDataCount;
+		}
+		return it->second + 1;
+	}
+
+	void encodeLocation(std::string& _out, SourceLocation const& _location)
+	{
+		appendZigzag(_out, _location.start);
+		appendZigzag(_out, _location.end);
+		appendVarint(_out, _location.sourceName ? stringIndex(*_location.sourceName) + 1 : 0);
+	}
+
+	void encodeDebugData(std::shared_ptr<DebugData const> const& _debugData)
+	{
+		appendVarint(m_body, debugDataRef(_debugData));
+	}
+
+	void encodeString(YulString _string)
+	{
+		appendVarint(m_body, stringIndex(_string.str()));
+	}
+
+	void encode(Object const& _object)
+	{
+		m_body += static_cast<char>(NodeTag::Object);
+		encodeString(_object.name);
+		if (!_object.debugData)
+			m_body += static_cast<char>(0);
+		else if (!_object.debugData->sourceNames)
+			m_body += static_cast<char>(1);
+		else
+		{
+			m_body += static_cast<char>(2);
+			appendVarint(m_body, _object.debugData->sourceNames->size());
+			for (auto const& [sourceIndex, sourceName]: *_object.debugData->sourceNames)
+			{
+				appendVarint(m_body, sourceIndex);
+				appendVarint(m_body, stringIndex(*sourceName));
+			}
+		}
+		m_body += static_cast<char>(_object.code ? 1 : 0);
+		if (_object.code)
+			encode(*_object.code);
+		appendVarint(m_body, _object.subObjects.size());
+		for (std::shared_ptr<ObjectNode> const& subNode: _object.subObjects)
+			if (Object const* subObject = dynamic_cast<Object const*>(subNode.get()))
+				encode(*subObject);
+			else
+				encode(dynamic_cast<Data const&>(*subNode));
+	}
+
+	void encode(Data const& _data)
+	{
+		m_body += static_cast<char>(NodeTag::Data);
+		encodeString(_data.name);
+		// Data payloads are usually unique and can be large, so they are stored
+		// inline instead of going through the string table.
+		appendVarint(m_body, _data.data.size());
+		m_body += std::string(_data.data.begin(), _data.data.end());
+	}
+
+	void encode(Block const& _block)
+	{
+		encodeDebugData(_block.debugData);
+		appendVarint(m_body, _block.statements.size());
+		for (Statement const& statement: _block.statements)
+			encode(statement);
+	}
+
+	void encode(Statement const& _statement)
+	{
+		std::visit([this](auto const& _node) { encodeStatement(_node); }, _statement);
+	}
+
+	void encode(Expression const& _expression)
+	{
+		std::visit([this](auto const& _node) { encodeExpression(_node); }, _expression);
+	}
+
+	void encode(TypedName const& _name)
+	{
+		encodeDebugData(_name.debugData);
+		encodeString(_name.name);
+		encodeString(_name.type);
+	}
+
+	void encodeStatement(ExpressionStatement const& _statement)
+	{
+		m_body += static_cast<char>(StatementTag::ExpressionStatement);
+		encodeDebugData(_statement.debugData);
+		encode(_statement.expression);
+	}
+
+	void encodeStatement(Assignment const& _assignment)
+	{
+		m_body += static_cast<char>(StatementTag::Assignment);
+		encodeDebugData(_assignment.debugData);
+		appendVarint(m_body, _assignment.variableNames.size());
+		for (Identifier const& name: _assignment.variableNames)
+			encodeExpression(name);
+		encode(*_assignment.value);
+	}
+
+	void encodeStatement(VariableDeclaration const& _declaration)
+	{
+		m_body += static_cast<char>(StatementTag::VariableDeclaration);
+		encodeDebugData(_declaration.debugData);
+		appendVarint(m_body, _declaration.variables.size());
+		for (TypedName const& variable: _declaration.variables)
+			encode(variable);
+		m_body += static_cast<char>(_declaration.value ? 1 : 0);
+		if (_declaration.value)
+			encode(*_declaration.value);
+	}
+
+	void encodeStatement(FunctionDefinition const& _function)
+	{
+		m_body += static_cast<char>(StatementTag::FunctionDefinition);
+		encodeDebugData(_function.debugData);
+		encodeString(_function.name);
+		appendVarint(m_body, _function.parameters.size());
+		for (TypedName const& parameter: _function.parameters)
+			encode(parameter);
+		appendVarint(m_body, _function.returnVariables.size());
+		for (TypedName const& returnVariable: _function.returnVariables)
+			encode(returnVariable);
+		encode(_function.body);
+	}
+
+	void encodeStatement(If const& _if)
+	{
+		m_body += static_cast<char>(StatementTag::If);
+		encodeDebugData(_if.debugData);
+		encode(*_if.condition);
+		encode(_if.body);
+	}
+
+	void encodeStatement(Switch const& _switch)
+	{
+		m_body += static_cast<char>(StatementTag::Switch);
+		encodeDebugData(_switch.debugData);
+		encode(*_switch.expression);
+		appendVarint(m_body, _switch.cases.size());
+		for (Case const& case_: _switch.cases)
+		{
+			encodeDebugData(case_.debugData);
+			m_body += static_cast<char>(case_.value ? 1 : 0);
+			if (case_.value)
+				encodeExpression(*case_.value);
+			encode(case_.body);
+		}
+	}
+
+	void encodeStatement(ForLoop const& _forLoop)
+	{
+		m_body += static_cast<char>(StatementTag::ForLoop);
+		encodeDebugData(_forLoop.debugData);
+		encode(_forLoop.pre);
+		encode(*_forLoop.condition);
+		encode(_forLoop.post);
+		encode(_forLoop.body);
+	}
+
+	void encodeStatement(Break const& _break)
+	{
+		m_body += static_cast<char>(StatementTag::Break);
+		encodeDebugData(_break.debugData);
+	}
+
+	void encodeStatement(Continue const& _continue)
+	{
+		m_body += static_cast<char>(StatementTag::Continue);
+		encodeDebugData(_continue.debugData);
+	}
+
+	void encodeStatement(Leave const& _leave)
+	{
+		m_body += static_cast<char>(StatementTag::Leave);
+		encodeDebugData(_leave.debugData);
+	}
+
+	void encodeStatement(Block const& _block)
+	{
+		m_body += static_cast<char>(StatementTag::Block);
+		encode(_block);
+	}
+
+	void encodeExpression(FunctionCall const& _call)
+	{
+		m_body += static_cast<char>(ExpressionTag::FunctionCall);
+		encodeDebugData(_call.debugData);
+		encodeExpression(_call.functionName);
+		appendVarint(m_body, _call.arguments.size());
+		for (Expression const& argument: _call.arguments)
+			encode(argument);
+	}
+
+	void encodeExpression(Identifier const& _identifier)
+	{
+		m_body += static_cast<char>(ExpressionTag::Identifier);
+		encodeDebugData(_identifier.debugData);
+		encodeString(_identifier.name);
+	}
+
+	void encodeExpression(Literal const& _literal)
+	{
+		m_body += static_cast<char>(ExpressionTag::Literal);
+		encodeDebugData(_literal.debugData);
+		m_body += static_cast<char>(_literal.kind);
+		encodeString(_literal.value);
+		encodeString(_literal.type);
+	}
+
+	std::map<std::string, uint64_t> m_stringIndices;
+	std::vector<std::string> m_strings;
+	std::map<DebugData const*, uint64_t> m_debugDataIndices;
+	std::string m_debugDataTable;
+	uint64_t m_debugDataCount = 0;
+	std::string m_body;
+};
+
+/// Raised by the decoder on truncated or otherwise malformed input and turned
+/// into a null result by deserializeObject.
+struct MalformedInput {};
+
+/// Bounds-checked cursor over the encoded document. The string and debug data
+/// tables are decoded upfront; the tree is rebuilt in a single pass over the body.
+class Decoder
+{
+public:
+	Decoder(char const* _begin, char const* _end): m_position(_begin), m_end(_end) {}
+
+	std::shared_ptr<Object> decode()
+	{
+		uint64_t stringCount = readVarint();
+		for (uint64_t i = 0; i < stringCount; ++i)
+			m_strings.emplace_back(readString());
+		uint64_t debugDataCount = readVarint();
+		for (uint64_t i = 0; i < debugDataCount; ++i)
+		{
+			SourceLocation nativeLocation = readLocation();
+			SourceLocation originLocation = readLocation();
+			std::optional<int64_t> astID;
+			if (readByte() == 1)
+				astID = readZigzag();
+			m_debugData.emplace_back(DebugData::create(
+				std::move(nativeLocation),
+				std::move(originLocation),
+				astID
+			));
+		}
+
+		if (static_cast<NodeTag>(readByte()) != NodeTag::Object)
+			throw MalformedInput();
+		std::shared_ptr<Object> object = readObject(0);
+		if (m_position != m_end)
+			throw MalformedInput();
+		return object;
+	}
+
+private:
+	uint8_t readByte()
+	{
+		if (m_position == m_end)
+			throw MalformedInput();
+		return static_cast<uint8_t>(*m_position++);
+	}
+
+	uint64_t readVarint()
+	{
+		uint64_t value = 0;
+		for (unsigned shift = 0; shift < 64; shift += 7)
+		{
+			uint8_t byte = readByte();
+			value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+			if (!(byte & 0x80))
+				return value;
+		}
+		throw MalformedInput();
+	}
+
+	int64_t readZigzag()
+	{
+		uint64_t zigzag = readVarint();
+		return static_cast<int64_t>((zigzag >> 1) ^ (0 - (zigzag & 1)));
+	}
+
+	std::string readString()
+	{
+		uint64_t size = readVarint();
+		if (m_end - m_position < static_cast<ptrdiff_t>(size))
+			throw MalformedInput();
+		std::string value(m_position, size);
+		m_position += size;
+		return value;
+	}
+
+	std::string const& stringAt(uint64_t _index) const
+	{
+		if (_index >= m_strings.size())
+			throw MalformedInput();
+		return m_strings[_index];
+	}
+
+	YulString readYulString()
+	{
+		return YulString(stringAt(readVarint()));
+	}
+
+	std::shared_ptr<std::string const> sharedStringAt(uint64_t _index)
+	{
+		if (_index >= m_strings.size())
+			throw MalformedInput();
+		std::shared_ptr<std::string const>& cached = m_sharedStrings[_index];
+		if (!cached)
+			cached = std::make_shared<std::string const>(m_strings[_index]);
+		return cached;
+	}
+
+	SourceLocation readLocation()
+	{
+		SourceLocation location;
+		location.start = static_cast<int>(readZigzag());
+		location.end = static_cast<int>(readZigzag());
+		if (uint64_t sourceNameRef = readVarint())
+			location.sourceName = sharedStringAt(sourceNameRef - 1);
+		return location;
+	}
+
+	std::shared_ptr<DebugData const> readDebugData()
+	{
+		uint64_t reference = readVarint();
+		if (reference == 0)
+			return nullptr;
+		if (reference > m_debugData.size())
+			throw MalformedInput();
+		return m_debugData[reference - 1];
+	}
+
+	std::shared_ptr<Object> readObject(size_t _depth)
+	{
+		if (_depth > maxDepth)
+			throw MalformedInput();
+
+		std::shared_ptr<Object> object = std::make_shared<Object>();
+		object->name = readYulString();
+		switch (readByte())
+		{
+		case 0:
+			break;
+		case 1:
+			object->debugData = std::make_shared<ObjectDebugData>();
+			break;
+		case 2:
+		{
+			SourceNameMap sourceNames;
+			uint64_t count = readVarint();
+			for (uint64_t i = 0; i < count; ++i)
+			{
+				uint64_t sourceIndex = readVarint();
+				sourceNames[static_cast<unsigned>(sourceIndex)] = sharedStringAt(readVarint());
+			}
+			object->debugData = std::make_shared<ObjectDebugData>(ObjectDebugData{std::move(sourceNames)});
+			break;
+		}
+		default:
+			throw MalformedInput();
+		}
+		if (readByte() == 1)
+			object->code = std::make_shared<Block>(readBlock(_depth + 1));
+		uint64_t subObjectCount = readVarint();
+		for (uint64_t i = 0; i < subObjectCount; ++i)
+		{
+			std::shared_ptr<ObjectNode> subNode;
+			switch (static_cast<NodeTag>(readByte()))
+			{
+			case NodeTag::Object:
+				subNode = readObject(_depth + 1);
+				break;
+			case NodeTag::Data:
+			{
+				YulString name = readYulString();
+				uint64_t size = readVarint();
+				if (m_end - m_position < static_cast<ptrdiff_t>(size))
+					throw MalformedInput();
+				subNode = std::make_shared<Data>(name, bytes(m_position, m_position + size));
+				m_position += size;
+				break;
+			}
+			default:
+				throw MalformedInput();
+			}
+			object->subIndexByName[subNode->name] = object->subObjects.size();
+			object->subObjects.emplace_back(std::move(subNode));
+		}
+		return object;
+	}
+
+	Block readBlock(size_t _depth)
+	{
+		if (_depth > maxDepth)
+			throw MalformedInput();
+
+		Block block;
+		block.debugData = readDebugData();
+		uint64_t statementCount = readVarint();
+		for (uint64_t i = 0; i < statementCount; ++i)
+			block.statements.emplace_back(readStatement(_depth + 1));
+		return block;
+	}
+
+	Statement readStatement(size_t _depth)
+	{
+		if (_depth > maxDepth)
+			throw MalformedInput();
+
+		switch (static_cast<StatementTag>(readByte()))
+		{
+		case StatementTag::ExpressionStatement:
+		{
+			ExpressionStatement statement;
+			statement.debugData = readDebugData();
+			statement.expression = readExpression(_depth + 1);
+			return {std::move(statement)};
+		}
+		case StatementTag::Assignment:
+		{
+			Assignment assignment;
+			assignment.debugData = readDebugData();
+			uint64_t variableCount = readVarint();
+			for (uint64_t i = 0; i < variableCount; ++i)
+			{
+				if (static_cast<ExpressionTag>(readByte()) != ExpressionTag::Identifier)
+					throw MalformedInput();
+				assignment.variableNames.emplace_back(readIdentifier());
+			}
+			assignment.value = std::make_unique<Expression>(readExpression(_depth + 1));
+			return {std::move(assignment)};
+		}
+		case StatementTag::VariableDeclaration:
+		{
+			VariableDeclaration declaration;
+			declaration.debugData = readDebugData();
+			uint64_t variableCount = readVarint();
+			for (uint64_t i = 0; i < variableCount; ++i)
+				declaration.variables.emplace_back(readTypedName());
+			if (readByte() == 1)
+				declaration.value = std::make_unique<Expression>(readExpression(_depth + 1));
+			return {std::move(declaration)};
+		}
+		case StatementTag::FunctionDefinition:
+		{
+			FunctionDefinition function;
+			function.debugData = readDebugData();
+			function.name = readYulString();
+			uint64_t parameterCount = readVarint();
+			for (uint64_t i = 0; i < parameterCount; ++i)
+				function.parameters.emplace_back(readTypedName());
+			uint64_t returnVariableCount = readVarint();
+			for (uint64_t i = 0; i < returnVariableCount; ++i)
+				function.returnVariables.emplace_back(readTypedName());
+			function.body = readBlock(_depth + 1);
+			return {std::move(function)};
+		}
+		case StatementTag::If:
+		{
+			If ifStatement;
+			ifStatement.debugData = readDebugData();
+			ifStatement.condition = std::make_unique<Expression>(readExpression(_depth + 1));
+			ifStatement.body = readBlock(_depth + 1);
+			return {std::move(ifStatement)};
+		}
+		case StatementTag::Switch:
+		{
+			Switch switchStatement;
+			switchStatement.debugData = readDebugData();
+			switchStatement.expression = std::make_unique<Expression>(readExpression(_depth + 1));
+			uint64_t caseCount = readVarint();
+			for (uint64_t i = 0; i < caseCount; ++i)
+			{
+				Case switchCase;
+				switchCase.debugData = readDebugData();
+				if (readByte() == 1)
+				{
+					if (static_cast<ExpressionTag>(readByte()) != ExpressionTag::Literal)
+						throw MalformedInput();
+					switchCase.value = std::make_unique<Literal>(readLiteral());
+				}
+				switchCase.body = readBlock(_depth + 1);
+				switchStatement.cases.emplace_back(std::move(switchCase));
+			}
+			return {std::move(switchStatement)};
+		}
+		case StatementTag::ForLoop:
+		{
+			ForLoop forLoop;
+			forLoop.debugData = readDebugData();
+			forLoop.pre = readBlock(_depth + 1);
+			forLoop.condition = std::make_unique<Expression>(readExpression(_depth + 1));
+			forLoop.post = readBlock(_depth + 1);
+			forLoop.body = readBlock(_depth + 1);
+			return {std::move(forLoop)};
+		}
+		case StatementTag::Break:
+			return {Break{readDebugData()}};
+		case StatementTag::Continue:
+			return {Continue{readDebugData()}};
+		case StatementTag::Leave:
+			return {Leave{readDebugData()}};
+		case StatementTag::Block:
+			return {readBlock(_depth + 1)};
+		}
+		throw MalformedInput();
+	}
+
+	Expression readExpression(size_t _depth)
+	{
+		if (_depth > maxDepth)
+			throw MalformedInput();
+
+		switch (static_cast<ExpressionTag>(readByte()))
+		{
+		case ExpressionTag::FunctionCall:
+		{
+			FunctionCall call;
+			call.debugData = readDebugData();
+			if (static_cast<ExpressionTag>(readByte()) != ExpressionTag::Identifier)
+				throw MalformedInput();
+			call.functionName = readIdentifier();
+			uint64_t argumentCount = readVarint();
+			for (uint64_t i = 0; i < argumentCount; ++i)
+				call.arguments.emplace_back(readExpression(_depth + 1));
+			return {std::move(call)};
+		}
+		case ExpressionTag::Identifier:
+			return {readIdentifier()};
+		case ExpressionTag::Literal:
+			return {readLiteral()};
+		}
+		throw MalformedInput();
+	}
+
+	TypedName readTypedName()
+	{
+		TypedName name;
+		name.debugData = readDebugData();
+		name.name = readYulString();
+		name.type = readYulString();
+		return name;
+	}
+
+	/// Reads the fields of an identifier. The caller has to consume the tag.
+	Identifier readIdentifier()
+	{
+		Identifier identifier;
+		identifier.debugData = readDebugData();
+		identifier.name = readYulString();
+		return identifier;
+	}
+
+	/// Reads the fields of a literal. The caller has to consume the tag.
+	Literal readLiteral()
+	{
+		Literal literal;
+		literal.debugData = readDebugData();
+		uint8_t kind = readByte();
+		if (kind > static_cast<uint8_t>(LiteralKind::String))
+			throw MalformedInput();
+		literal.kind = static_cast<LiteralKind>(kind);
+		literal.value = readYulString();
+		literal.type = readYulString();
+		return literal;
+	}
+
+	char const* m_position;
+	char const* m_end;
+	std::vector<std::string> m_strings;
+	std::map<uint64_t, std::shared_ptr<std::string const>> m_sharedStrings;
+	std::vector<std::shared_ptr<DebugData const>> m_debugData;
+};
+
+}
+
+bool yul::isBinaryObject(std::string const& _data)
+{
+	return _data.compare(0, magic.size(), magic) == 0;
+}
+
+std::string yul::serializeObject(Object const& _object)
+{
+	return Encoder{}.serialize(_object);
+}
+
+std::shared_ptr<Object> yul::deserializeObject(std::string const& _input)
+{
+	if (!isBinaryObject(_input) || _input.size() < magic.size() + 1)
+		return nullptr;
+	if (static_cast<uint8_t>(_input[magic.size()]) != formatVersion)
+		return nullptr;
+
+	try
+	{
+		return Decoder(_input.data() + magic.size() + 1, _input.data() + _input.size()).decode();
+	}
+	catch (MalformedInput const&)
+	{
+		return nullptr;
+	}
+}
@@ -0,0 +1,49 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Compact, versioned binary serialization of Yul objects. Unlike the text and JSON
+ * forms, the binary form interns all strings and encodes the AST structure with
+ * variable-length integers, so that large optimized objects can be stored and
+ * re-loaded without going through the scanner and parser again.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace solidity::yul
+{
+
+struct Object;
+
+/// @returns true if @a _data starts with the magic header of the binary Yul object format.
+/// Note that this does not validate the rest of the document.
+bool isBinaryObject(std::string const& _data);
+
+/// Serializes @a _object (including sub-objects, data and debug data, but not
+/// analysis info) into the binary format, including the magic header.
+std::string serializeObject(Object const& _object);
+
+/// Parses a binary Yul object produced by serializeObject.
+/// The returned object carries no analysis info - run AsmAnalyzer on it before
+/// passing it to components that require analyzed input.
+/// @returns the object or nullptr if the input is malformed.
+std::shared_ptr<Object> deserializeObject(std::string const& _input);
+
+}
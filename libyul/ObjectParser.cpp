@@ -28,6 +28,7 @@
 #include <liblangutil/Token.h>
 #include <liblangutil/Scanner.h>
 
+#include <libsolutil/Common.h>
 #include <libsolutil/StringUtils.h>
 
 #include <regex>
@@ -45,6 +46,14 @@ std::shared_ptr<Object> ObjectParser::parse(std::shared_ptr<Scanner> const& _sca
 		std::shared_ptr<Object> object;
 		m_scanner = _scanner;
 
+		// The object structure itself tokenizes the same way in both scanner modes. Using
+		// Yul mode for the whole object avoids a mode switch per code block, which would
+		// force a rescan, and lets the parser index the pre-tokenized source throughout.
+		auto previousScannerKind = m_scanner->scannerKind();
+		m_scanner->setScannerMode(ScannerKind::Yul);
+		ScopeGuard resetScanner([&]{ m_scanner->setScannerMode(previousScannerKind); });
+		m_scanner->pretokenize();
+
 		if (currentToken() == Token::LBrace)
 		{
 			// Special case: Code-only form.
@@ -28,6 +28,7 @@
 #include <functional>
 #include <memory>
 #include <optional>
+#include <unordered_map>
 #include <variant>
 
 namespace solidity::yul
@@ -91,7 +92,10 @@ struct Scope
 	/// If true, variables from the super scope are not visible here (other identifiers are),
 	/// but they are still taken into account to prevent shadowing.
 	bool functionScope = false;
-	std::map<YulString, Identifier> identifiers;
+	/// Keyed by the precomputed hash of the interned name, so each lookup level is a hash
+	/// probe instead of a tree search. Iteration order is unspecified - consumers that
+	/// influence generated code have to order the entries themselves.
+	std::unordered_map<YulString, Identifier> identifiers;
 };
 
 }
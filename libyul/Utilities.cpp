@@ -30,6 +30,7 @@
 #include <boost/algorithm/string.hpp>
 
 #include <algorithm>
+#include <shared_mutex>
 #include <sstream>
 #include <vector>
 
@@ -90,17 +91,28 @@ u256 solidity::yul::valueOfNumberLiteral(Literal const& _literal)
 {
 	yulAssert(_literal.kind == LiteralKind::Number, "Expected number literal!");
 
+	// The shared mutex makes the cache safe to use from concurrent compilations. As with
+	// YulStringRepository, the reset callback still requires external synchronization.
+	static std::shared_mutex mutex;
 	static std::map<YulString, u256> numberCache;
-	static YulStringRepository::ResetCallback callback{[&] { numberCache.clear(); }};
+	// A transient callback because cached entries are keyed by string IDs that can be
+	// recycled by YulStringRepository::resetToSnapshot().
+	static YulStringRepository::TransientResetCallback callback{[&] { std::unique_lock lock(mutex); numberCache.clear(); }};
 
-	auto&& [it, isNew] = numberCache.try_emplace(_literal.value, 0);
-	if (isNew)
 	{
-		std::string const& literalString = _literal.value.str();
-		yulAssert(isValidDecimal(literalString) || isValidHex(literalString), "Invalid number literal!");
-		it->second = u256(literalString);
+		std::shared_lock lock(mutex);
+		auto it = numberCache.find(_literal.value);
+		if (it != numberCache.end())
+			return it->second;
 	}
-	return it->second;
+
+	std::string const& literalString = _literal.value.str();
+	yulAssert(isValidDecimal(literalString) || isValidHex(literalString), "Invalid number literal!");
+	u256 value{literalString};
+
+	std::unique_lock lock(mutex);
+	numberCache.emplace(_literal.value, value);
+	return value;
 }
 
 u256 solidity::yul::valueOfStringLiteral(Literal const& _literal)
@@ -24,11 +24,14 @@
 
 #include <libyul/AsmAnalysis.h>
 #include <libyul/AsmAnalysisInfo.h>
+#include <libyul/backends/evm/ControlFlowGraphExporter.h>
 #include <libyul/backends/evm/EthAssemblyAdapter.h>
 #include <libyul/backends/evm/EVMCodeTransform.h>
 #include <libyul/backends/evm/EVMDialect.h>
 #include <libyul/backends/evm/EVMObjectCompiler.h>
 #include <libyul/backends/evm/EVMMetrics.h>
+#include <libyul/AsmPrinter.h>
+#include <libyul/ObjectBinary.h>
 #include <libyul/ObjectParser.h>
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/optimiser/Suite.h>
@@ -36,9 +39,20 @@
 #include <liblangutil/Scanner.h>
 #include <libsolidity/interface/OptimiserSettings.h>
 
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/Keccak256.h>
+
+#include <solidity/BuildInfo.h>
+
 #include <boost/algorithm/string.hpp>
+#include <boost/filesystem.hpp>
 
+#include <exception>
+#include <fstream>
+#include <map>
+#include <mutex>
 #include <optional>
+#include <thread>
 
 using namespace solidity;
 using namespace solidity::frontend;
@@ -61,9 +75,187 @@ Dialect const& languageToDialect(YulStack::Language _language, EVMVersion _versi
 	return Dialect::yulDeprecated();
 }
 
+/**
+ * Process-wide cache of optimised Yul object code, keyed by a content hash of the
+ * unoptimised code and everything the optimiser run depends on. Identical objects are
+ * common when the same deployed object is embedded into many creation objects, e.g. by
+ * clone factories, or when unchanged contracts are recompiled as dependencies of others.
+ * The cache optimises each distinct object only once per process and serves all further
+ * requests with a fresh copy of the optimised AST. Entries are held in the binary object
+ * serialization rather than as ASTs: deserializing on a hit re-interns every string into
+ * the current repository, so entries stay valid across YulStringRepository::reset(),
+ * e.g. between the standard JSON requests served by one resident process. Entries are
+ * never evicted. Optionally backed by a directory (see setDirectory()) that persists
+ * the serialized entries across processes and can be shared between concurrent builds.
+ */
+class OptimisedObjectCache
+{
+public:
+	static OptimisedObjectCache& instance()
+	{
+		static OptimisedObjectCache cache;
+		return cache;
+	}
+
+	/// Enables the on-disk tier rooted at @a _directory, creating it if necessary.
+	/// Read and write failures are treated as cache misses; the cache is strictly an
+	/// optimization.
+	void setDirectory(boost::filesystem::path _directory)
+	{
+		boost::system::error_code ignored;
+		boost::filesystem::create_directories(_directory, ignored);
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_directory = std::move(_directory);
+	}
+
+	static util::h256 key(
+		Object const& _object,
+		YulStack::Language _language,
+		EVMVersion _evmVersion,
+		bool _isCreation,
+		bool _optimizeStackAllocation,
+		std::string const& _yulOptimiserSteps,
+		std::string const& _yulOptimiserCleanupSteps,
+		size_t _expectedExecutionsPerDeployment
+	)
+	{
+		std::string preimage;
+		auto append = [&](std::string const& _part) {
+			preimage += std::to_string(_part.size()) + ":" + _part;
+		};
+		// On-disk entries can be shared between runs of different compiler binaries;
+		// mixing the version into the key invalidates them on upgrade.
+		append(ETH_PROJECT_VERSION);
+		append(_evmVersion.name());
+		append(std::to_string(static_cast<unsigned>(_language)));
+		append(_isCreation ? "1" : "0");
+		append(_optimizeStackAllocation ? "1" : "0");
+		append(_yulOptimiserSteps);
+		append(_yulOptimiserCleanupSteps);
+		append(std::to_string(_expectedExecutionsPerDeployment));
+		// The names of the sub-objects and data sections are part of the key because the
+		// code can reference them via datoffset / datasize; their contents are not, since
+		// the optimiser never looks at them.
+		for (YulString dataName: _object.qualifiedDataNames())
+			append(dataName.str());
+		// The printed representation covers everything the optimiser depends on; source
+		// locations are deliberately left out.
+		append(AsmPrinter{}(*_object.code));
+		return util::keccak256(preimage);
+	}
+
+	std::shared_ptr<Block> lookup(util::h256 const& _key)
+	{
+		std::shared_ptr<std::string const> entry;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			auto it = m_entries.find(_key);
+			if (it != m_entries.end())
+				entry = it->second;
+		}
+		if (!entry)
+			entry = diskLookup(_key);
+		if (!entry)
+			return nullptr;
+		// Deserializing outside of the lock yields a fresh AST per hit whose strings are
+		// interned into the current repository, no matter when the entry was stored.
+		// A malformed on-disk entry makes deserialization fail and counts as a miss.
+		if (std::shared_ptr<Object> object = deserializeObject(*entry))
+			return std::move(object->code);
+		return nullptr;
+	}
+
+	void store(util::h256 const& _key, Object const& _object)
+	{
+		// Only the optimised code block is cached; sub-objects are optimised and cached
+		// on their own.
+		Object codeOnly;
+		codeOnly.name = _object.name;
+		codeOnly.code = _object.code;
+		auto entry = std::make_shared<std::string const>(serializeObject(codeOnly));
+		std::optional<boost::filesystem::path> directory;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_entries.emplace(_key, entry);
+			directory = m_directory;
+		}
+		if (directory)
+			diskStore(*directory, _key, *entry);
+	}
+
+private:
+	/// Loads the entry for @a _key from the on-disk tier, if one is configured and has
+	/// it, and adds it to the in-memory table.
+	std::shared_ptr<std::string const> diskLookup(util::h256 const& _key)
+	{
+		std::optional<boost::filesystem::path> directory;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			directory = m_directory;
+		}
+		if (!directory)
+			return nullptr;
+		boost::filesystem::path path = entryPath(*directory, _key);
+		boost::system::error_code errorCode;
+		if (!boost::filesystem::is_regular_file(path, errorCode))
+			return nullptr;
+		try
+		{
+			auto entry = std::make_shared<std::string const>(util::readFileAsString(path));
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_entries.emplace(_key, entry);
+			return entry;
+		}
+		catch (...)
+		{
+			// An unreadable entry counts as a cache miss.
+			return nullptr;
+		}
+	}
+
+	static void diskStore(boost::filesystem::path const& _directory, util::h256 const& _key, std::string const& _entry)
+	{
+		boost::filesystem::path path = entryPath(_directory, _key);
+		boost::filesystem::path temporaryPath = path;
+		temporaryPath += ".tmp";
+		try
+		{
+			{
+				std::ofstream file(temporaryPath.string(), std::ios::trunc | std::ios::binary);
+				file << _entry;
+				if (!file)
+					return;
+			}
+			// Renaming makes the entry visible atomically so that concurrent compiler
+			// processes never observe partially written files.
+			boost::system::error_code ignored;
+			boost::filesystem::rename(temporaryPath, path, ignored);
+		}
+		catch (...)
+		{
+			// Failing to store an entry only costs a future re-optimisation.
+		}
+	}
+
+	static boost::filesystem::path entryPath(boost::filesystem::path const& _directory, util::h256 const& _key)
+	{
+		return _directory / (_key.hex() + ".yulbin");
+	}
+
+	std::mutex m_mutex;
+	std::map<util::h256, std::shared_ptr<std::string const>> m_entries;
+	/// Root of the on-disk tier, if enabled.
+	std::optional<boost::filesystem::path> m_directory;
+};
+
 }
 
 
+void YulStack::setOptimisedObjectCacheDirectory(std::string const& _directory)
+{
+	OptimisedObjectCache::instance().setDirectory(_directory);
+}
+
 CharStream const& YulStack::charStream(std::string const& _sourceName) const
 {
 	yulAssert(m_charStream, "");
@@ -147,19 +339,64 @@ void YulStack::compileEVM(AbstractAssembly& _assembly, bool _optimize) const
 			break;
 	}
 
-	EVMObjectCompiler::compile(*m_parserResult, _assembly, *dialect, _optimize, m_eofVersion);
+	EVMObjectCompiler::compile(
+		*m_parserResult,
+		_assembly,
+		*dialect,
+		_optimize,
+		m_eofVersion,
+		m_optimiserSettings.stackLayoutGenerationBudget,
+		m_cancellationToken
+	);
 }
 
 void YulStack::optimize(Object& _object, bool _isCreation)
 {
 	yulAssert(_object.code, "");
 	yulAssert(_object.analysisInfo, "");
+	std::vector<Object*> subObjects;
 	for (auto& subNode: _object.subObjects)
 		if (auto subObject = dynamic_cast<Object*>(subNode.get()))
+			subObjects.push_back(subObject);
+
+	auto optimizeSubObject = [this](Object& _subObject)
+	{
+		bool isCreation = !boost::ends_with(_subObject.name.str(), "_deployed");
+		optimize(_subObject, isCreation);
+	};
+	if (subObjects.size() >= 2)
+	{
+		// Sibling sub-objects are independent of each other and of the code of the
+		// enclosing object, so they can be optimized concurrently. The optimiser only
+		// touches per-object state apart from the string repository and the step
+		// statistics, both of which are thread-safe.
+		std::exception_ptr exception;
+		std::mutex exceptionMutex;
+		auto guardedOptimize = [&](Object* _subObject)
 		{
-			bool isCreation = !boost::ends_with(subObject->name.str(), "_deployed");
-			optimize(*subObject, isCreation);
-		}
+			try
+			{
+				optimizeSubObject(*_subObject);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> exceptionLock(exceptionMutex);
+				if (!exception)
+					exception = std::current_exception();
+			}
+		};
+		std::vector<std::thread> threads;
+		for (size_t i = 1; i < subObjects.size(); ++i)
+			threads.emplace_back(guardedOptimize, subObjects[i]);
+		guardedOptimize(subObjects.front());
+		for (std::thread& thread: threads)
+			thread.join();
+		if (exception)
+			std::rethrow_exception(exception);
+	}
+	else
+		for (Object* subObject: subObjects)
+			optimizeSubObject(*subObject);
 
 	Dialect const& dialect = languageToDialect(m_language, m_evmVersion);
 	std::unique_ptr<GasMeter> meter;
@@ -191,6 +428,22 @@ void YulStack::optimize(Object& _object, bool _isCreation)
 		);
 	}();
 
+	util::h256 cacheKey = OptimisedObjectCache::key(
+		_object,
+		m_language,
+		m_evmVersion,
+		_isCreation,
+		optimizeStackAllocation,
+		yulOptimiserSteps,
+		yulOptimiserCleanupSteps,
+		m_optimiserSettings.expectedExecutionsPerDeployment
+	);
+	if (std::shared_ptr<Block> cached = OptimisedObjectCache::instance().lookup(cacheKey))
+	{
+		_object.code = std::move(cached);
+		return;
+	}
+
 	OptimiserSuite::run(
 		dialect,
 		meter.get(),
@@ -200,8 +453,10 @@ void YulStack::optimize(Object& _object, bool _isCreation)
 		yulOptimiserSteps,
 		yulOptimiserCleanupSteps,
 		_isCreation ? std::nullopt : std::make_optional(m_optimiserSettings.expectedExecutionsPerDeployment),
-		{}
+		{},
+		m_cancellationToken
 	);
+	OptimisedObjectCache::instance().store(cacheKey, _object);
 }
 
 MachineAssemblyObject YulStack::assemble(Machine _machine) const
@@ -319,6 +574,18 @@ Json::Value YulStack::astJson() const
 	return  m_parserResult->toJson();
 }
 
+Json::Value YulStack::cfgJson() const
+{
+	yulAssert(m_analysisSuccessful, "Analysis was not successful.");
+	yulAssert(m_parserResult, "");
+	yulAssert(m_parserResult->code, "");
+	return ControlFlowGraphExporter::run(
+		*m_parserResult,
+		languageToDialect(m_language, m_evmVersion),
+		m_optimiserSettings.stackLayoutGenerationBudget
+	);
+}
+
 std::shared_ptr<Object> YulStack::parserResult() const
 {
 	yulAssert(m_analysisSuccessful, "Analysis was not successful.");
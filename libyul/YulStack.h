@@ -33,6 +33,8 @@
 
 #include <libevmasm/LinkerObject.h>
 
+#include <libsolutil/CancellationToken.h>
+
 #include <json/json.h>
 
 #include <memory>
@@ -97,6 +99,20 @@ public:
 	/// @returns the char stream used during parsing
 	langutil::CharStream const& charStream(std::string const& _sourceName) const override;
 
+	/// Sets the token used to cooperatively abandon a compilation. The optimizer suite and
+	/// the code generation poll the token and throw util::CompilationCancelled once
+	/// cancellation has been requested.
+	void setCancellationToken(util::CancellationToken _cancellationToken)
+	{
+		m_cancellationToken = std::move(_cancellationToken);
+	}
+
+	/// Enables the process-wide on-disk cache of optimised objects rooted at
+	/// @a _directory, creating the directory if necessary. Entries are stored in the
+	/// binary object serialization and can be shared between processes and builds;
+	/// read and write failures are treated as cache misses.
+	static void setOptimisedObjectCacheDirectory(std::string const& _directory);
+
 	/// Runs parsing and analysis steps, returns false if input cannot be assembled.
 	/// Multiple calls overwrite the previous state.
 	bool parseAndAnalyze(std::string const& _sourceName, std::string const& _source);
@@ -133,6 +149,10 @@ public:
 		langutil::CharStreamProvider const* _soliditySourceProvider = nullptr
 	) const;
 	Json::Value astJson() const;
+	/// @returns a JSON representation of the control flow graph and the stack layouts of the
+	/// parsed object and its sub-objects, as they would be used by code generation.
+	/// Can only be used after a successful analysis.
+	Json::Value cfgJson() const;
 	/// Return the parsed and analyzed object.
 	std::shared_ptr<Object> parserResult() const;
 
@@ -149,6 +169,7 @@ private:
 	std::optional<uint8_t> m_eofVersion;
 	solidity::frontend::OptimiserSettings m_optimiserSettings;
 	langutil::DebugInfoSelection m_debugInfoSelection{};
+	util::CancellationToken m_cancellationToken;
 
 	std::unique_ptr<langutil::CharStream> m_charStream;
 
@@ -25,6 +25,8 @@
 
 #include <unordered_map>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <vector>
 #include <string>
 #include <functional>
@@ -36,6 +38,8 @@ namespace solidity::yul
 /// Owns the string data for all YulStrings, which can be referenced by a Handle.
 /// A Handle consists of an ID (that depends on the insertion order of YulStrings and is potentially
 /// non-deterministic) and a deterministic string hash.
+/// Interning and lookup are guarded by a shared mutex so that multiple threads can
+/// process Yul code concurrently. Note that reset() still requires external synchronization.
 class YulStringRepository
 {
 public:
@@ -56,6 +60,16 @@ public:
 		if (_string.empty())
 			return { 0, emptyHash() };
 		std::uint64_t h = hash(_string);
+		{
+			std::shared_lock lock(m_mutex);
+			auto range = m_hashToID.equal_range(h);
+			for (auto it = range.first; it != range.second; ++it)
+				if (*m_strings[it->second] == _string)
+					return Handle{it->second, h};
+		}
+		std::unique_lock lock(m_mutex);
+		// Re-check under the exclusive lock - another thread might have interned
+		// the string in the meantime.
 		auto range = m_hashToID.equal_range(h);
 		for (auto it = range.first; it != range.second; ++it)
 			if (*m_strings[it->second] == _string)
@@ -66,7 +80,13 @@ public:
 
 		return Handle{id, h};
 	}
-	std::string const& idToString(size_t _id) const	{ return *m_strings.at(_id); }
+	std::string const& idToString(size_t _id) const
+	{
+		std::shared_lock lock(m_mutex);
+		// The string data itself is owned via shared_ptr, so the returned
+		// reference stays valid even if the vector reallocates afterwards.
+		return *m_strings.at(_id);
+	}
 
 	static std::uint64_t hash(std::string const& v)
 	{
@@ -89,7 +109,41 @@ public:
 	{
 		for (auto const& cb: resetCallbacks())
 			cb();
-		instance() = YulStringRepository{};
+		for (auto const& cb: transientResetCallbacks())
+			cb();
+		YulStringRepository& inst = instance();
+		std::unique_lock lock(inst.m_mutex);
+		inst.m_strings = {std::make_shared<std::string>()};
+		inst.m_hashToID = {{emptyHash(), 0}};
+		inst.m_snapshotSize = 1;
+	}
+	/// Records the current contents of the repository as the snapshot for
+	/// resetToSnapshot(). Global tables that intern strings (e.g. the dialect
+	/// caches) should be fully constructed beforehand so that the snapshot
+	/// covers them.
+	static void takeSnapshot()
+	{
+		YulStringRepository& inst = instance();
+		std::unique_lock lock(inst.m_mutex);
+		inst.m_snapshotSize = inst.m_strings.size();
+	}
+	/// Discards all strings interned since the last takeSnapshot() call and clears
+	/// the caches registered via TransientResetCallback. Unlike reset(), strings
+	/// from before the snapshot - and with them the tables built on top of them -
+	/// stay valid, so persistent fuzzing can reuse warm tables across iterations.
+	/// Use with care - there cannot be any dangling references to strings interned
+	/// after the snapshot and the tables registered via ResetCallback must not have
+	/// interned new strings since the snapshot was taken.
+	static void resetToSnapshot()
+	{
+		for (auto const& cb: transientResetCallbacks())
+			cb();
+		YulStringRepository& inst = instance();
+		std::unique_lock lock(inst.m_mutex);
+		if (inst.m_strings.size() <= inst.m_snapshotSize)
+			return;
+		std::erase_if(inst.m_hashToID, [&](auto const& _entry) { return _entry.second >= inst.m_snapshotSize; });
+		inst.m_strings.resize(inst.m_snapshotSize);
 	}
 	/// Struct that registers a reset callback as a side-effect of its construction.
 	/// Useful as static local variable to register a reset callback once.
@@ -100,13 +154,23 @@ public:
 			YulStringRepository::resetCallbacks().emplace_back(std::move(_fun));
 		}
 	};
+	/// Like ResetCallback, but additionally invoked by resetToSnapshot().
+	/// Use it for caches whose entries reference strings interned during regular
+	/// compilation, as opposed to tables that are only rebuilt on a full reset().
+	struct TransientResetCallback
+	{
+		TransientResetCallback(std::function<void()> _fun)
+		{
+			YulStringRepository::transientResetCallbacks().emplace_back(std::move(_fun));
+		}
+	};
 
 private:
 	YulStringRepository() = default;
 	YulStringRepository(YulStringRepository const&) = delete;
-	YulStringRepository(YulStringRepository&&) = default;
+	YulStringRepository(YulStringRepository&&) = delete;
 	YulStringRepository& operator=(YulStringRepository const& _rhs) = delete;
-	YulStringRepository& operator=(YulStringRepository&& _rhs) = default;
+	YulStringRepository& operator=(YulStringRepository&& _rhs) = delete;
 
 	static std::vector<std::function<void()>>& resetCallbacks()
 	{
@@ -114,8 +178,16 @@ private:
 		return callbacks;
 	}
 
+	static std::vector<std::function<void()>>& transientResetCallbacks()
+	{
+		static std::vector<std::function<void()>> callbacks;
+		return callbacks;
+	}
+
 	std::vector<std::shared_ptr<std::string>> m_strings = {std::make_shared<std::string>()};
 	std::unordered_multimap<std::uint64_t, size_t> m_hashToID = {{emptyHash(), 0}};
+	size_t m_snapshotSize = 1;
+	mutable std::shared_mutex m_mutex;
 };
 
 /// Wrapper around handles into the YulString repository.
@@ -33,6 +33,7 @@
 #include <functional>
 #include <memory>
 #include <optional>
+#include <vector>
 
 namespace solidity::langutil
 {
@@ -68,6 +69,14 @@ public:
 	virtual void setStackHeight(int height) = 0;
 	/// Append an EVM instruction.
 	virtual void appendInstruction(evmasm::Instruction _instruction) = 0;
+	/// Append a contiguous run of EVM instructions in one go.
+	/// The default implementation forwards to appendInstruction per item; backends
+	/// can override it to reserve storage for the whole run upfront.
+	virtual void appendInstructions(std::vector<evmasm::Instruction> const& _instructions)
+	{
+		for (evmasm::Instruction instruction: _instructions)
+			appendInstruction(instruction);
+	}
 	/// Append a constant.
 	virtual void appendConstant(u256 const& _constant) = 0;
 	/// Append a label.
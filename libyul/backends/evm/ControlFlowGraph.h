@@ -27,10 +27,12 @@
 #include <libyul/Exceptions.h>
 #include <libyul/Scope.h>
 
+#include <libsolutil/Arena.h>
 #include <libsolutil/Numeric.h>
 
 #include <functional>
 #include <list>
+#include <new>
 #include <vector>
 
 namespace solidity::yul
@@ -128,7 +130,12 @@ struct CFG
 	CFG(CFG&&) = delete;
 	CFG& operator=(CFG const&) = delete;
 	CFG& operator=(CFG&&) = delete;
-	~CFG() = default;
+	~CFG()
+	{
+		// The pool releases the blocks' storage without running destructors.
+		for (BasicBlock* block: blocks)
+			block->~BasicBlock();
+	}
 
 	struct BuiltinCall
 	{
@@ -195,6 +202,9 @@ struct CFG
 		};
 		struct Terminated {};
 		std::shared_ptr<DebugData const> debugData;
+		/// Dense index of the block in ``CFG::blocks`` (i.e. in creation order), assigned by
+		/// ``makeBlock``. Used for indexed lookups and bitsets over the blocks of the graph.
+		size_t id = 0;
 		std::vector<BasicBlock*> entries;
 		std::vector<Operation> operations;
 		/// True, if the block is the beginning of a disconnected subgraph. That is, if no block that is reachable
@@ -227,8 +237,13 @@ struct CFG
 	/// List of functions in order of declaration.
 	std::list<Scope::Function const*> functions;
 
-	/// Container for blocks for explicit ownership.
-	std::list<BasicBlock> blocks;
+	/// Memory pool all basic blocks are carved out of, avoiding a separate allocation per
+	/// block. Has to be declared before ``blocks``: the destructor destroys the blocks
+	/// before the pool releases their storage.
+	util::Arena blockPool;
+	/// The blocks of the graph in creation order, for explicit ownership. The pointed-to
+	/// blocks live in ``blockPool``.
+	std::vector<BasicBlock*> blocks;
 	/// Container for generated variables for explicit ownership.
 	/// Ghost variables are generated to store switch conditions when transforming the control flow
 	/// of a switch to a sequence of conditional jumps.
@@ -240,7 +255,10 @@ struct CFG
 
 	BasicBlock& makeBlock(std::shared_ptr<DebugData const> _debugData)
 	{
-		return blocks.emplace_back(BasicBlock{std::move(_debugData), {}, {}});
+		auto* block = new (blockPool.allocate(sizeof(BasicBlock), alignof(BasicBlock)))
+			BasicBlock{std::move(_debugData), blocks.size(), {}, {}};
+		blocks.emplace_back(block);
+		return *block;
 	}
 };
 
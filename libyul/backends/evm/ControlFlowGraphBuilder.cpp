@@ -52,11 +52,11 @@ namespace
 void cleanUnreachable(CFG& _cfg)
 {
 	// Determine which blocks are reachable from the entry.
-	util::BreadthFirstSearch<CFG::BasicBlock*> reachabilityCheck{{_cfg.entry}};
+	util::IndexedBreadthFirstSearch<CFG::BasicBlock*> reachabilityCheck{{_cfg.entry}};
 	for (auto const& functionInfo: _cfg.functionInfo | ranges::views::values)
 		reachabilityCheck.verticesToTraverse.emplace_back(functionInfo.entry);
 
-	reachabilityCheck.run([&](CFG::BasicBlock* _node, auto&& _addChild) {
+	reachabilityCheck.run([](CFG::BasicBlock* _block) { return _block->id; }, [&](CFG::BasicBlock* _node, auto&& _addChild) {
 		visit(util::GenericVisitor{
 			[&](CFG::BasicBlock::Jump const& _jump) {
 				_addChild(_jump.target);
@@ -72,10 +72,14 @@ void cleanUnreachable(CFG& _cfg)
 	});
 
 	// Remove all entries from unreachable nodes from the graph.
-	for (CFG::BasicBlock* node: reachabilityCheck.visited)
-		cxx20::erase_if(node->entries, [&](CFG::BasicBlock* entry) -> bool {
-			return !reachabilityCheck.visited.count(entry);
-		});
+	auto reachable = [&](CFG::BasicBlock* _block) -> bool {
+		return _block->id < reachabilityCheck.visited.size() && reachabilityCheck.visited[_block->id];
+	};
+	for (CFG::BasicBlock* node: _cfg.blocks)
+		if (reachable(node))
+			cxx20::erase_if(node->entries, [&](CFG::BasicBlock* entry) -> bool {
+				return !reachable(entry);
+			});
 }
 
 /// Sets the ``recursive`` member to ``true`` for all recursive function calls.
@@ -87,25 +91,28 @@ void markRecursiveCalls(CFG& _cfg)
 		if (auto* calls = util::valueOrNullptr(callsPerBlock, _block))
 			return *calls;
 		std::vector<CFG::FunctionCall*>& calls = callsPerBlock[_block];
-		util::BreadthFirstSearch<CFG::BasicBlock*>{{_block}}.run([&](CFG::BasicBlock* _block, auto _addChild) {
-			for (auto& operation: _block->operations)
-				if (auto* functionCall = std::get_if<CFG::FunctionCall>(&operation.operation))
-					calls.emplace_back(functionCall);
-			std::visit(util::GenericVisitor{
-				[&](CFG::BasicBlock::MainExit const&) {},
-				[&](CFG::BasicBlock::Jump const& _jump)
-				{
-					_addChild(_jump.target);
-				},
-				[&](CFG::BasicBlock::ConditionalJump const& _conditionalJump)
-				{
-					_addChild(_conditionalJump.zero);
-					_addChild(_conditionalJump.nonZero);
-				},
-				[&](CFG::BasicBlock::FunctionReturn const&) {},
-				[&](CFG::BasicBlock::Terminated const&)	{},
-			}, _block->exit);
-		});
+		util::IndexedBreadthFirstSearch<CFG::BasicBlock*>{{_block}}.run(
+			[](CFG::BasicBlock* _block) { return _block->id; },
+			[&](CFG::BasicBlock* _block, auto _addChild) {
+				for (auto& operation: _block->operations)
+					if (auto* functionCall = std::get_if<CFG::FunctionCall>(&operation.operation))
+						calls.emplace_back(functionCall);
+				std::visit(util::GenericVisitor{
+					[&](CFG::BasicBlock::MainExit const&) {},
+					[&](CFG::BasicBlock::Jump const& _jump)
+					{
+						_addChild(_jump.target);
+					},
+					[&](CFG::BasicBlock::ConditionalJump const& _conditionalJump)
+					{
+						_addChild(_conditionalJump.zero);
+						_addChild(_conditionalJump.nonZero);
+					},
+					[&](CFG::BasicBlock::FunctionReturn const&) {},
+					[&](CFG::BasicBlock::Terminated const&)	{},
+				}, _block->exit);
+			}
+		);
 		return calls;
 	};
 	for (auto& functionInfo: _cfg.functionInfo | ranges::views::values)
@@ -197,11 +204,14 @@ void markNeedsCleanStack(CFG& _cfg)
 {
 	for (auto& functionInfo: _cfg.functionInfo | ranges::views::values)
 		for (CFG::BasicBlock* exit: functionInfo.exits)
-			util::BreadthFirstSearch<CFG::BasicBlock*>{{exit}}.run([&](CFG::BasicBlock* _block, auto _addChild) {
-				_block->needsCleanStack = true;
-				for (CFG::BasicBlock* entry: _block->entries)
-					_addChild(entry);
-			});
+			util::IndexedBreadthFirstSearch<CFG::BasicBlock*>{{exit}}.run(
+				[](CFG::BasicBlock* _block) { return _block->id; },
+				[](CFG::BasicBlock* _block, auto _addChild) {
+					_block->needsCleanStack = true;
+					for (CFG::BasicBlock* entry: _block->entries)
+						_addChild(entry);
+				}
+			);
 }
 }
 
@@ -315,6 +325,9 @@ void ControlFlowGraphBuilder::operator()(Block const& _block)
 	for (auto const& statement: _block.statements)
 		if (auto const* function = std::get_if<FunctionDefinition>(&statement))
 			registerFunction(*function);
+	// Most statements add at most one operation to the current block, so reserving ahead
+	// avoids repeated regrowth of long straight-line blocks.
+	m_currentBlock->operations.reserve(m_currentBlock->operations.size() + _block.statements.size());
 	for (auto const& statement: _block.statements)
 		std::visit(*this, statement);
 }
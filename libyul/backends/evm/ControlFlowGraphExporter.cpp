@@ -0,0 +1,207 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * JSON export of the control flow graph and the stack layouts used during code generation.
+ */
+
+#include <libyul/backends/evm/ControlFlowGraphExporter.h>
+
+#include <libyul/backends/evm/ControlFlowGraphBuilder.h>
+#include <libyul/backends/evm/StackHelpers.h>
+
+#include <libyul/Object.h>
+#include <libyul/Exceptions.h>
+
+#include <libsolutil/CommonData.h>
+#include <libsolutil/Visitor.h>
+
+using namespace solidity;
+using namespace solidity::langutil;
+using namespace solidity::yul;
+
+Json::Value ControlFlowGraphExporter::run(Object const& _object, Dialect const& _dialect, size_t _stackLayoutGenerationBudget)
+{
+	yulAssert(_object.code, "No code.");
+	yulAssert(_object.analysisInfo, "No analysis info.");
+
+	std::unique_ptr<CFG> cfg = ControlFlowGraphBuilder::build(*_object.analysisInfo, _dialect, *_object.code);
+	StackLayout stackLayout = StackLayoutGenerator::run(*cfg, _stackLayoutGenerationBudget);
+
+	Json::Value json = ControlFlowGraphExporter(*cfg, stackLayout).toJson();
+	for (auto const& subNode: _object.subObjects)
+		if (auto const* subObject = dynamic_cast<Object const*>(subNode.get()))
+			json["subObjects"][subObject->name.str()] = run(*subObject, _dialect, _stackLayoutGenerationBudget);
+	return json;
+}
+
+ControlFlowGraphExporter::ControlFlowGraphExporter(CFG const& _cfg, StackLayout const& _stackLayout):
+	m_cfg(_cfg),
+	m_stackLayout(_stackLayout)
+{
+	for (CFG::BasicBlock const* block: m_cfg.blocks)
+		m_blockIds.emplace(block, m_blockIds.size());
+}
+
+Json::Value ControlFlowGraphExporter::toJson() const
+{
+	Json::Value json{Json::objectValue};
+	json["entry"] = Json::UInt64(blockId(*m_cfg.entry));
+
+	json["blocks"] = Json::arrayValue;
+	for (CFG::BasicBlock const* block: m_cfg.blocks)
+		json["blocks"].append(toJson(*block));
+
+	json["functions"] = Json::objectValue;
+	for (Scope::Function const* function: m_cfg.functions)
+	{
+		CFG::FunctionInfo const& info = m_cfg.functionInfo.at(function);
+		Json::Value functionJson{Json::objectValue};
+		functionJson["entry"] = Json::UInt64(blockId(*info.entry));
+		functionJson["parameters"] = toJson(info.parameters);
+		functionJson["returnVariables"] = toJson(info.returnVariables);
+		functionJson["exits"] = Json::arrayValue;
+		for (CFG::BasicBlock const* exit: info.exits)
+			functionJson["exits"].append(Json::UInt64(blockId(*exit)));
+		functionJson["canContinue"] = info.canContinue;
+		addDebugData(functionJson, info.debugData);
+		json["functions"][function->name.str()] = std::move(functionJson);
+	}
+	return json;
+}
+
+Json::Value ControlFlowGraphExporter::toJson(CFG::BasicBlock const& _block) const
+{
+	Json::Value json{Json::objectValue};
+	json["id"] = Json::UInt64(blockId(_block));
+	json["entries"] = Json::arrayValue;
+	for (CFG::BasicBlock const* entry: _block.entries)
+		json["entries"].append(Json::UInt64(blockId(*entry)));
+
+	// The layouts list the slots - and thereby the variables - that are live on the stack
+	// at the block boundaries. Blocks that turned out to be unreachable have no layout.
+	if (StackLayout::BlockInfo const* blockInfo = util::valueOrNullptr(m_stackLayout.blockInfos, &_block))
+	{
+		json["entryLayout"] = toJson(blockInfo->entryLayout);
+		json["exitLayout"] = toJson(blockInfo->exitLayout);
+	}
+
+	json["operations"] = Json::arrayValue;
+	for (CFG::Operation const& operation: _block.operations)
+		json["operations"].append(toJson(operation));
+
+	json["exit"] = exitToJson(_block);
+	addDebugData(json, _block.debugData);
+	return json;
+}
+
+Json::Value ControlFlowGraphExporter::toJson(CFG::Operation const& _operation) const
+{
+	Json::Value json{Json::objectValue};
+	std::visit(util::GenericVisitor{
+		[&](CFG::FunctionCall const& _call) {
+			json["type"] = "FunctionCall";
+			json["name"] = _call.function.get().name.str();
+			json["recursive"] = _call.recursive;
+			json["canContinue"] = _call.canContinue;
+			addDebugData(json, _call.debugData);
+		},
+		[&](CFG::BuiltinCall const& _call) {
+			json["type"] = "BuiltinCall";
+			json["name"] = _call.functionCall.get().functionName.name.str();
+			addDebugData(json, _call.debugData);
+		},
+		[&](CFG::Assignment const& _assignment) {
+			json["type"] = "Assignment";
+			json["variables"] = toJson(_assignment.variables);
+			addDebugData(json, _assignment.debugData);
+		}
+	}, _operation.operation);
+	json["in"] = toJson(_operation.input);
+	json["out"] = toJson(_operation.output);
+	if (Stack const* entryLayout = util::valueOrNullptr(m_stackLayout.operationEntryLayout, &_operation))
+		json["entryLayout"] = toJson(*entryLayout);
+	return json;
+}
+
+Json::Value ControlFlowGraphExporter::toJson(Stack const& _stack) const
+{
+	Json::Value json{Json::arrayValue};
+	for (StackSlot const& slot: _stack)
+		json.append(stackSlotToString(slot));
+	return json;
+}
+
+Json::Value ControlFlowGraphExporter::toJson(std::vector<VariableSlot> const& _variables) const
+{
+	Json::Value json{Json::arrayValue};
+	for (VariableSlot const& variable: _variables)
+		json.append(variable.variable.get().name.str());
+	return json;
+}
+
+Json::Value ControlFlowGraphExporter::exitToJson(CFG::BasicBlock const& _block) const
+{
+	Json::Value json{Json::objectValue};
+	std::visit(util::GenericVisitor{
+		[&](CFG::BasicBlock::MainExit const&) {
+			json["type"] = "MainExit";
+		},
+		[&](CFG::BasicBlock::Jump const& _jump) {
+			json["type"] = "Jump";
+			json["target"] = Json::UInt64(blockId(*_jump.target));
+			json["backwards"] = _jump.backwards;
+			addDebugData(json, _jump.debugData);
+		},
+		[&](CFG::BasicBlock::ConditionalJump const& _jump) {
+			json["type"] = "ConditionalJump";
+			json["condition"] = stackSlotToString(_jump.condition);
+			json["nonZero"] = Json::UInt64(blockId(*_jump.nonZero));
+			json["zero"] = Json::UInt64(blockId(*_jump.zero));
+			addDebugData(json, _jump.debugData);
+		},
+		[&](CFG::BasicBlock::FunctionReturn const& _return) {
+			json["type"] = "FunctionReturn";
+			json["function"] = _return.info->function.name.str();
+			addDebugData(json, _return.debugData);
+		},
+		[&](CFG::BasicBlock::Terminated const&) {
+			json["type"] = "Terminated";
+		}
+	}, _block.exit);
+	return json;
+}
+
+size_t ControlFlowGraphExporter::blockId(CFG::BasicBlock const& _block) const
+{
+	return m_blockIds.at(&_block);
+}
+
+void ControlFlowGraphExporter::addDebugData(Json::Value& _json, std::shared_ptr<DebugData const> const& _debugData)
+{
+	if (!_debugData)
+		return;
+	auto srcLocation = [](SourceLocation const& _location) -> std::string
+	{
+		int length = (_location.start >= 0 && _location.end >= _location.start) ? _location.end - _location.start : -1;
+		return std::to_string(_location.start) + ":" + std::to_string(length) + ":-1";
+	};
+	if (_debugData->originLocation.isValid())
+		_json["src"] = srcLocation(_debugData->originLocation);
+	if (_debugData->nativeLocation.isValid())
+		_json["nativeSrc"] = srcLocation(_debugData->nativeLocation);
+}
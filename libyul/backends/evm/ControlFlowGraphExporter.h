@@ -0,0 +1,70 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * JSON export of the control flow graph and the stack layouts used during code generation,
+ * so that debugging and tracing tools do not have to re-derive them from raw bytecode.
+ */
+
+#pragma once
+
+#include <libyul/backends/evm/ControlFlowGraph.h>
+#include <libyul/backends/evm/StackLayoutGenerator.h>
+
+#include <json/json.h>
+
+#include <map>
+
+namespace solidity::yul
+{
+
+struct Object;
+
+/**
+ * Serializes the control flow graph of a Yul object and the stack layouts generated for it
+ * into a JSON representation. Blocks are identified by dense indices and reference each
+ * other through them; source locations are attached in the same ``start:length:sourceIndex``
+ * format the Yul AST export uses, so that consumers can key the blocks to bytecode offsets
+ * via the source mapping.
+ */
+class ControlFlowGraphExporter
+{
+public:
+	/// Builds the control flow graph and stack layouts of @a _object and all of its
+	/// sub-objects and @returns their JSON representation. The object has to be analyzed.
+	/// @a _stackLayoutGenerationBudget should match the budget used during code generation
+	/// so that the reported layouts are the ones the generated code actually uses.
+	static Json::Value run(Object const& _object, Dialect const& _dialect, size_t _stackLayoutGenerationBudget = 0);
+
+private:
+	explicit ControlFlowGraphExporter(CFG const& _cfg, StackLayout const& _stackLayout);
+
+	Json::Value toJson() const;
+	Json::Value toJson(CFG::BasicBlock const& _block) const;
+	Json::Value toJson(CFG::Operation const& _operation) const;
+	Json::Value toJson(Stack const& _stack) const;
+	Json::Value toJson(std::vector<VariableSlot> const& _variables) const;
+	Json::Value exitToJson(CFG::BasicBlock const& _block) const;
+	size_t blockId(CFG::BasicBlock const& _block) const;
+	static void addDebugData(Json::Value& _json, std::shared_ptr<DebugData const> const& _debugData);
+
+	CFG const& m_cfg;
+	StackLayout const& m_stackLayout;
+	std::map<CFG::BasicBlock const*, size_t> m_blockIds;
+};
+
+}
@@ -101,26 +101,37 @@ void CodeTransform::freeUnusedVariables(bool _popUnusedSlotsAtStackTop)
 	if (!m_allowStackOpt)
 		return;
 
-	for (auto const& identifier: m_scope->identifiers)
-		if (Scope::Variable const* var = std::get_if<Scope::Variable>(&identifier.second))
-			if (m_variablesScheduledForDeletion.count(var))
-				deleteVariable(*var);
+	// The order of the deletions influences the emitted swaps and pops, so it must not
+	// depend on the iteration order of the scope's symbol table.
+	auto deleteScheduledVariables = [this](Scope const& _scope)
+	{
+		std::vector<Scope::Variable const*> scheduled;
+		for (auto const& identifier: _scope.identifiers)
+			if (Scope::Variable const* var = std::get_if<Scope::Variable>(&identifier.second))
+				if (m_variablesScheduledForDeletion.count(var))
+					scheduled.push_back(var);
+		std::sort(scheduled.begin(), scheduled.end(), [](Scope::Variable const* _a, Scope::Variable const* _b) {
+			return _a->name < _b->name;
+		});
+		for (Scope::Variable const* var: scheduled)
+			deleteVariable(*var);
+	};
+	deleteScheduledVariables(*m_scope);
 	// Directly in a function body block, we can also delete the function arguments,
 	// which live in the virtual function scope.
 	// However, doing so after the return variables are already allocated, seems to have an adverse
 	// effect, so we only do it before that.
 	if (!returnVariablesAndFunctionExitAreSetup() && !m_scope->functionScope && m_scope->superScope && m_scope->superScope->functionScope)
-		for (auto const& identifier: m_scope->superScope->identifiers)
-			if (Scope::Variable const* var = std::get_if<Scope::Variable>(&identifier.second))
-				if (m_variablesScheduledForDeletion.count(var))
-					deleteVariable(*var);
+		deleteScheduledVariables(*m_scope->superScope);
 
 	if (_popUnusedSlotsAtStackTop)
-		while (m_unusedStackSlots.count(m_assembly.stackHeight() - 1))
-		{
-			yulAssert(m_unusedStackSlots.erase(m_assembly.stackHeight() - 1), "");
-			m_assembly.appendInstruction(evmasm::Instruction::POP);
-		}
+	{
+		size_t popCount = 0;
+		while (m_unusedStackSlots.erase(m_assembly.stackHeight() - 1 - static_cast<int>(popCount)))
+			++popCount;
+		if (popCount > 0)
+			m_assembly.appendInstructions(std::vector<evmasm::Instruction>(popCount, evmasm::Instruction::POP));
+	}
 }
 
 void CodeTransform::deleteVariable(Scope::Variable const& _var)
@@ -200,8 +211,11 @@ void CodeTransform::stackError(StackTooDeepError _error, int _targetStackHeight)
 {
 	m_assembly.appendInstruction(evmasm::Instruction::INVALID);
 	// Correct the stack.
-	while (m_assembly.stackHeight() > _targetStackHeight)
-		m_assembly.appendInstruction(evmasm::Instruction::POP);
+	if (m_assembly.stackHeight() > _targetStackHeight)
+		m_assembly.appendInstructions(std::vector<evmasm::Instruction>(
+			static_cast<size_t>(m_assembly.stackHeight() - _targetStackHeight),
+			evmasm::Instruction::POP
+		));
 	while (m_assembly.stackHeight() < _targetStackHeight)
 		m_assembly.appendConstant(u256(0));
 	// Store error.
@@ -469,17 +483,20 @@ void CodeTransform::operator()(FunctionDefinition const& _function)
 		}
 		else
 		{
+			std::vector<evmasm::Instruction> shuffle;
 			while (!stackLayout.empty() && stackLayout.back() != static_cast<int>(stackLayout.size() - 1))
 				if (stackLayout.back() < 0)
 				{
-					m_assembly.appendInstruction(evmasm::Instruction::POP);
+					shuffle.emplace_back(evmasm::Instruction::POP);
 					stackLayout.pop_back();
 				}
 				else
 				{
-					m_assembly.appendInstruction(evmasm::swapInstruction(static_cast<unsigned>(stackLayout.size()) - static_cast<unsigned>(stackLayout.back()) - 1u));
+					shuffle.emplace_back(evmasm::swapInstruction(static_cast<unsigned>(stackLayout.size()) - static_cast<unsigned>(stackLayout.back()) - 1u));
 					std::swap(stackLayout[static_cast<size_t>(stackLayout.back())], stackLayout.back());
 				}
+			if (!shuffle.empty())
+				m_assembly.appendInstructions(shuffle);
 			for (size_t i = 0; i < stackLayout.size(); ++i)
 				yulAssert(i == static_cast<size_t>(stackLayout[i]), "Error reshuffling stack.");
 		}
@@ -533,8 +550,11 @@ void CodeTransform::operator()(ForLoop const& _forLoop)
 int CodeTransform::appendPopUntil(int _targetDepth)
 {
 	int const stackDiffAfter = m_assembly.stackHeight() - _targetDepth;
-	for (int i = 0; i < stackDiffAfter; ++i)
-		m_assembly.appendInstruction(evmasm::Instruction::POP);
+	if (stackDiffAfter > 0)
+		m_assembly.appendInstructions(std::vector<evmasm::Instruction>(
+			static_cast<size_t>(stackDiffAfter),
+			evmasm::Instruction::POP
+		));
 	return stackDiffAfter;
 }
 
@@ -723,6 +743,7 @@ void CodeTransform::finalizeBlock(Block const& _block, std::optional<int> blockS
 
 	// pop variables
 	yulAssert(m_info.scopes.at(&_block).get() == m_scope, "");
+	size_t popCount = 0;
 	for (auto const& id: m_scope->identifiers)
 		if (std::holds_alternative<Scope::Variable>(id.second))
 		{
@@ -733,8 +754,10 @@ void CodeTransform::finalizeBlock(Block const& _block, std::optional<int> blockS
 				yulAssert(!m_context->variableReferences.count(&var), "");
 			}
 			else
-				m_assembly.appendInstruction(evmasm::Instruction::POP);
+				++popCount;
 		}
+	if (popCount > 0)
+		m_assembly.appendInstructions(std::vector<evmasm::Instruction>(popCount, evmasm::Instruction::POP));
 
 	if (blockStartStackHeight)
 	{
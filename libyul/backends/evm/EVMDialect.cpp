@@ -36,6 +36,7 @@
 #include <range/v3/view/reverse.hpp>
 #include <range/v3/view/tail.hpp>
 
+#include <mutex>
 #include <regex>
 
 using namespace std::string_literals;
@@ -310,21 +311,35 @@ EVMDialect::EVMDialect(langutil::EVMVersion _evmVersion, bool _objectAccess):
 	m_functions(createBuiltins(_evmVersion, _objectAccess)),
 	m_reserved(createReservedIdentifiers(_evmVersion))
 {
+	cacheBuiltinFunctionLookup();
 }
 
 BuiltinFunctionForEVM const* EVMDialect::builtin(YulString _name) const
 {
+	auto it = m_builtinFunctionLookup.find(_name);
+	if (it != m_builtinFunctionLookup.end())
+		return it->second;
 	if (m_objectAccess)
 	{
-		std::smatch match;
-		if (regex_match(_name.str(), match, verbatimPattern()))
-			return verbatimFunction(stoul(match[1]), stoul(match[2]));
+		// Only names of the form ``verbatim_<n>i_<m>o`` can still refer to a builtin here,
+		// so the comparatively expensive regular expression match is skipped for all others.
+		std::string const& name = _name.str();
+		if (name.compare(0, "verbatim_"s.size(), "verbatim_") == 0)
+		{
+			std::smatch match;
+			if (regex_match(name, match, verbatimPattern()))
+				return verbatimFunction(stoul(match[1]), stoul(match[2]));
+		}
 	}
-	auto it = m_functions.find(_name);
-	if (it != m_functions.end())
-		return &it->second;
-	else
-		return nullptr;
+	return nullptr;
+}
+
+void EVMDialect::cacheBuiltinFunctionLookup()
+{
+	m_builtinFunctionLookup.clear();
+	m_builtinFunctionLookup.reserve(m_functions.size());
+	for (auto const& [name, function]: m_functions)
+		m_builtinFunctionLookup[name] = &function;
 }
 
 bool EVMDialect::reservedIdentifier(YulString _name) const
@@ -337,8 +352,12 @@ bool EVMDialect::reservedIdentifier(YulString _name) const
 
 EVMDialect const& EVMDialect::strictAssemblyForEVM(langutil::EVMVersion _version)
 {
+	// The mutex makes the lazy construction safe for concurrent compilations. As with
+	// YulStringRepository, the reset callback still requires external synchronization.
+	static std::mutex mutex;
 	static std::map<langutil::EVMVersion, std::unique_ptr<EVMDialect const>> dialects;
-	static YulStringRepository::ResetCallback callback{[&] { dialects.clear(); }};
+	static YulStringRepository::ResetCallback callback{[&] { std::lock_guard lock(mutex); dialects.clear(); }};
+	std::lock_guard lock(mutex);
 	if (!dialects[_version])
 		dialects[_version] = std::make_unique<EVMDialect>(_version, false);
 	return *dialects[_version];
@@ -346,8 +365,10 @@ EVMDialect const& EVMDialect::strictAssemblyForEVM(langutil::EVMVersion _version
 
 EVMDialect const& EVMDialect::strictAssemblyForEVMObjects(langutil::EVMVersion _version)
 {
+	static std::mutex mutex;
 	static std::map<langutil::EVMVersion, std::unique_ptr<EVMDialect const>> dialects;
-	static YulStringRepository::ResetCallback callback{[&] { dialects.clear(); }};
+	static YulStringRepository::ResetCallback callback{[&] { std::lock_guard lock(mutex); dialects.clear(); }};
+	std::lock_guard lock(mutex);
 	if (!dialects[_version])
 		dialects[_version] = std::make_unique<EVMDialect>(_version, true);
 	return *dialects[_version];
@@ -475,6 +496,8 @@ EVMDialectTyped::EVMDialectTyped(langutil::EVMVersion _evmVersion, bool _objectA
 	}));
 	m_functions["u256_to_bool"_yulstring].parameters = {"u256"_yulstring};
 	m_functions["u256_to_bool"_yulstring].returns = {"bool"_yulstring};
+
+	cacheBuiltinFunctionLookup();
 }
 
 BuiltinFunctionForEVM const* EVMDialectTyped::discardFunction(YulString _type) const
@@ -501,8 +524,10 @@ BuiltinFunctionForEVM const* EVMDialectTyped::equalityFunction(YulString _type)
 
 EVMDialectTyped const& EVMDialectTyped::instance(langutil::EVMVersion _version)
 {
+	static std::mutex mutex;
 	static std::map<langutil::EVMVersion, std::unique_ptr<EVMDialectTyped const>> dialects;
-	static YulStringRepository::ResetCallback callback{[&] { dialects.clear(); }};
+	static YulStringRepository::ResetCallback callback{[&] { std::lock_guard lock(mutex); dialects.clear(); }};
+	std::lock_guard lock(mutex);
 	if (!dialects[_version])
 		dialects[_version] = std::make_unique<EVMDialectTyped>(_version, true);
 	return *dialects[_version];
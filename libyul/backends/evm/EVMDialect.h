@@ -29,6 +29,7 @@
 
 #include <map>
 #include <set>
+#include <unordered_map>
 
 namespace solidity::yul
 {
@@ -96,9 +97,16 @@ struct EVMDialect: public Dialect
 protected:
 	BuiltinFunctionForEVM const* verbatimFunction(size_t _arguments, size_t _returnVariables) const;
 
+	/// Rebuilds @a m_builtinFunctionLookup. Has to be called again whenever @a m_functions
+	/// is modified after construction.
+	void cacheBuiltinFunctionLookup();
+
 	bool const m_objectAccess;
 	langutil::EVMVersion const m_evmVersion;
 	std::map<YulString, BuiltinFunctionForEVM> m_functions;
+	/// Hash table into @a m_functions keyed by the precomputed hash of the interned name,
+	/// so builtin resolution does not have to walk the map or hash any strings.
+	std::unordered_map<YulString, BuiltinFunctionForEVM const*> m_builtinFunctionLookup;
 	std::map<std::pair<size_t, size_t>, std::shared_ptr<BuiltinFunctionForEVM const>> mutable m_verbatimFunctions;
 	std::set<YulString> m_reserved;
 };
@@ -40,11 +40,6 @@ bigint GasMeter::costs(Expression const& _expression) const
 	return combineCosts(GasMeterVisitor::costs(_expression, m_dialect, m_isCreation));
 }
 
-bigint GasMeter::instructionCosts(evmasm::Instruction _instruction) const
-{
-	return combineCosts(GasMeterVisitor::instructionCosts(_instruction, m_dialect, m_isCreation));
-}
-
 bigint GasMeter::combineCosts(std::pair<bigint, bigint> _costs) const
 {
 	return _costs.first * m_runs + _costs.second;
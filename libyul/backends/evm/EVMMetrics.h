@@ -26,6 +26,9 @@
 #include <libsolutil/Numeric.h>
 #include <libevmasm/Instruction.h>
 
+#include <array>
+#include <optional>
+
 namespace solidity::yul
 {
 
@@ -52,8 +55,9 @@ public:
 	/// @returns the full combined costs of deploying and evaluating the expression.
 	bigint costs(Expression const& _expression) const;
 	/// @returns the combined costs of deploying and running the instruction, not including
-	/// the costs for its arguments.
-	bigint instructionCosts(evmasm::Instruction _instruction) const;
+	/// the costs for its arguments. Defined inline below; it is queried once per candidate
+	/// rewrite, so repeated requests are served from a per-instruction cache.
+	bigint const& instructionCosts(evmasm::Instruction _instruction) const;
 
 private:
 	bigint combineCosts(std::pair<bigint, bigint> _costs) const;
@@ -61,6 +65,9 @@ private:
 	EVMDialect const& m_dialect;
 	bool m_isCreation = false;
 	bigint m_runs;
+	/// Combined cost per instruction, filled on first use. The combined cost is a pure
+	/// function of the dialect, the creation flag and the run count, all fixed per meter.
+	mutable std::array<std::optional<bigint>, 256> m_instructionCostCache;
 };
 
 class GasMeterVisitor: public ASTWalker
@@ -101,4 +108,12 @@ private:
 	bigint m_dataGas = 0;
 };
 
+inline bigint const& GasMeter::instructionCosts(evmasm::Instruction _instruction) const
+{
+	std::optional<bigint>& cached = m_instructionCostCache[static_cast<uint8_t>(_instruction)];
+	if (!cached)
+		cached = combineCosts(GasMeterVisitor::instructionCosts(_instruction, m_dialect, m_isCreation));
+	return *cached;
+}
+
 }
@@ -32,6 +32,13 @@
 
 #include <boost/algorithm/string.hpp>
 
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
 using namespace solidity::yul;
 
 void EVMObjectCompiler::compile(
@@ -39,19 +46,31 @@ void EVMObjectCompiler::compile(
 	AbstractAssembly& _assembly,
 	EVMDialect const& _dialect,
 	bool _optimize,
-	std::optional<uint8_t> _eofVersion
+	std::optional<uint8_t> _eofVersion,
+	size_t _stackLayoutGenerationBudget,
+	util::CancellationToken const& _cancellationToken
 )
 {
 	EVMObjectCompiler compiler(_assembly, _dialect, _eofVersion);
-	compiler.run(_object, _optimize);
+	compiler.run(_object, _optimize, _stackLayoutGenerationBudget, _cancellationToken);
 }
 
-void EVMObjectCompiler::run(Object& _object, bool _optimize)
+void EVMObjectCompiler::run(
+	Object& _object,
+	bool _optimize,
+	size_t _stackLayoutGenerationBudget,
+	util::CancellationToken const& _cancellationToken
+)
 {
+	_cancellationToken.throwIfCancelled();
+
 	BuiltinContext context;
 	context.currentObject = &_object;
 
 
+	// Creating the sub-assemblies mutates the enclosing assembly and assigns the sub IDs,
+	// so it has to happen in object order before any code is generated.
+	std::vector<std::pair<Object*, std::shared_ptr<AbstractAssembly>>> subObjectsToCompile;
 	for (auto const& subNode: _object.subObjects)
 		if (auto* subObject = dynamic_cast<Object*>(subNode.get()))
 		{
@@ -59,7 +78,7 @@ void EVMObjectCompiler::run(Object& _object, bool _optimize)
 			auto subAssemblyAndID = m_assembly.createSubAssembly(isCreation, subObject->name.str());
 			context.subIDs[subObject->name] = subAssemblyAndID.second;
 			subObject->subId = subAssemblyAndID.second;
-			compile(*subObject, *subAssemblyAndID.first, m_dialect, _optimize, m_eofVersion);
+			subObjectsToCompile.emplace_back(subObject, std::move(subAssemblyAndID.first));
 		}
 		else
 		{
@@ -71,6 +90,51 @@ void EVMObjectCompiler::run(Object& _object, bool _optimize)
 				context.subIDs[data.name] = m_assembly.appendData(data.data);
 		}
 
+	auto compileSubObject = [&](std::pair<Object*, std::shared_ptr<AbstractAssembly>> const& _subObjectAndAssembly)
+	{
+		compile(
+			*_subObjectAndAssembly.first,
+			*_subObjectAndAssembly.second,
+			m_dialect,
+			_optimize,
+			m_eofVersion,
+			_stackLayoutGenerationBudget,
+			_cancellationToken
+		);
+	};
+	if (subObjectsToCompile.size() >= 2)
+	{
+		// Sibling sub-objects, e.g. the creation and deployed objects or factory children,
+		// only write to their own sub-assemblies, so they can be compiled concurrently,
+		// mirroring the sibling parallelism of the optimiser in YulStack::optimize().
+		std::exception_ptr exception;
+		std::mutex exceptionMutex;
+		auto guardedCompile = [&](std::pair<Object*, std::shared_ptr<AbstractAssembly>> const* _subObjectAndAssembly)
+		{
+			try
+			{
+				compileSubObject(*_subObjectAndAssembly);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> exceptionLock(exceptionMutex);
+				if (!exception)
+					exception = std::current_exception();
+			}
+		};
+		std::vector<std::thread> threads;
+		for (size_t i = 1; i < subObjectsToCompile.size(); ++i)
+			threads.emplace_back(guardedCompile, &subObjectsToCompile[i]);
+		guardedCompile(&subObjectsToCompile.front());
+		for (std::thread& thread: threads)
+			thread.join();
+		if (exception)
+			std::rethrow_exception(exception);
+	}
+	else
+		for (auto const& subObjectAndAssembly: subObjectsToCompile)
+			compileSubObject(subObjectAndAssembly);
+
 	yulAssert(_object.analysisInfo, "No analysis info.");
 	yulAssert(_object.code, "No code.");
 	if (m_eofVersion.has_value())
@@ -86,7 +150,9 @@ void EVMObjectCompiler::run(Object& _object, bool _optimize)
 			*_object.code,
 			m_dialect,
 			context,
-			OptimizedEVMCodeTransform::UseNamedLabels::ForFirstFunctionOfEachName
+			OptimizedEVMCodeTransform::UseNamedLabels::ForFirstFunctionOfEachName,
+			_stackLayoutGenerationBudget,
+			_cancellationToken
 		);
 		if (!stackErrors.empty())
 		{
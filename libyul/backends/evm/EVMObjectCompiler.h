@@ -21,8 +21,11 @@
 
 #pragma once
 
-#include <optional>
+#include <libsolutil/CancellationToken.h>
+
+#include <cstddef>
 #include <cstdint>
+#include <optional>
 
 namespace solidity::yul
 {
@@ -33,19 +36,30 @@ struct EVMDialect;
 class EVMObjectCompiler
 {
 public:
+	/// A non-zero @a _stackLayoutGenerationBudget bounds the work spent per function searching
+	/// for an optimal stack layout, see StackLayoutGenerator::run.
+	/// @a _cancellationToken is polled during code generation; compilation aborts with
+	/// util::CompilationCancelled once cancellation has been requested.
 	static void compile(
 		Object& _object,
 		AbstractAssembly& _assembly,
 		EVMDialect const& _dialect,
 		bool _optimize,
-		std::optional<uint8_t> _eofVersion
+		std::optional<uint8_t> _eofVersion,
+		size_t _stackLayoutGenerationBudget = 0,
+		util::CancellationToken const& _cancellationToken = {}
 	);
 private:
 	EVMObjectCompiler(AbstractAssembly& _assembly, EVMDialect const& _dialect, std::optional<uint8_t> _eofVersion):
 		m_assembly(_assembly), m_dialect(_dialect), m_eofVersion(_eofVersion)
 	{}
 
-	void run(Object& _object, bool _optimize);
+	void run(
+		Object& _object,
+		bool _optimize,
+		size_t _stackLayoutGenerationBudget,
+		util::CancellationToken const& _cancellationToken
+	);
 
 	AbstractAssembly& m_assembly;
 	EVMDialect const& m_dialect;
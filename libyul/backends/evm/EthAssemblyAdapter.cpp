@@ -63,6 +63,11 @@ void EthAssemblyAdapter::appendInstruction(evmasm::Instruction _instruction)
 	m_assembly.append(_instruction);
 }
 
+void EthAssemblyAdapter::appendInstructions(std::vector<evmasm::Instruction> const& _instructions)
+{
+	m_assembly.appendInstructions(_instructions);
+}
+
 void EthAssemblyAdapter::appendConstant(u256 const& _constant)
 {
 	m_assembly.append(_constant);
@@ -45,11 +45,13 @@ std::vector<StackTooDeepError> OptimizedEVMCodeTransform::run(
 	Block const& _block,
 	EVMDialect const& _dialect,
 	BuiltinContext& _builtinContext,
-	UseNamedLabels _useNamedLabelsForFunctions
+	UseNamedLabels _useNamedLabelsForFunctions,
+	size_t _stackLayoutGenerationBudget,
+	util::CancellationToken const& _cancellationToken
 )
 {
 	std::unique_ptr<CFG> dfg = ControlFlowGraphBuilder::build(_analysisInfo, _dialect, _block);
-	StackLayout stackLayout = StackLayoutGenerator::run(*dfg);
+	StackLayout stackLayout = StackLayoutGenerator::run(*dfg, _stackLayoutGenerationBudget, _cancellationToken);
 	OptimizedEVMCodeTransform optimizedCodeTransform(
 		_assembly,
 		_builtinContext,
@@ -250,18 +252,32 @@ void OptimizedEVMCodeTransform::createStackLayout(std::shared_ptr<DebugData cons
 	// ::createStackLayout asserts that it has successfully achieved the target layout.
 	langutil::SourceLocation sourceLocation = _debugData ? _debugData->originLocation : langutil::SourceLocation{};
 	m_assembly.setSourceLocation(sourceLocation);
+	// Plain swap, dup and pop runs are collected and appended to the assembly in
+	// bulk; anything else flushes the pending run first. The deposit of the pending
+	// run has to be taken into account when comparing the assembly's stack height
+	// against m_stack, which the shuffler updates eagerly.
+	std::vector<evmasm::Instruction> pendingInstructions;
+	int pendingDeposit = 0;
+	auto flushPendingInstructions = [&]() {
+		if (pendingInstructions.empty())
+			return;
+		m_assembly.appendInstructions(pendingInstructions);
+		pendingInstructions.clear();
+		pendingDeposit = 0;
+	};
 	::createStackLayout(
 		m_stack,
 		_targetStack | ranges::to<Stack>,
 		// Swap callback.
 		[&](unsigned _i)
 		{
-			yulAssert(static_cast<int>(m_stack.size()) == m_assembly.stackHeight(), "");
+			yulAssert(static_cast<int>(m_stack.size()) == m_assembly.stackHeight() + pendingDeposit, "");
 			yulAssert(_i > 0 && _i < m_stack.size(), "");
 			if (_i <= 16)
-				m_assembly.appendInstruction(evmasm::swapInstruction(_i));
+				pendingInstructions.emplace_back(evmasm::swapInstruction(_i));
 			else
 			{
+				flushPendingInstructions();
 				int deficit = static_cast<int>(_i) - 16;
 				StackSlot const& deepSlot = m_stack.at(m_stack.size() - _i - 1);
 				YulString varNameDeep = slotVariableName(deepSlot);
@@ -282,18 +298,20 @@ void OptimizedEVMCodeTransform::createStackLayout(std::shared_ptr<DebugData cons
 		// Push or dup callback.
 		[&](StackSlot const& _slot)
 		{
-			yulAssert(static_cast<int>(m_stack.size()) == m_assembly.stackHeight(), "");
+			yulAssert(static_cast<int>(m_stack.size()) == m_assembly.stackHeight() + pendingDeposit, "");
 
 			// Dup the slot, if already on stack and reachable.
 			if (auto depth = util::findOffset(m_stack | ranges::views::reverse, _slot))
 			{
 				if (*depth < 16)
 				{
-					m_assembly.appendInstruction(evmasm::dupInstruction(static_cast<unsigned>(*depth + 1)));
+					pendingInstructions.emplace_back(evmasm::dupInstruction(static_cast<unsigned>(*depth + 1)));
+					++pendingDeposit;
 					return;
 				}
 				else if (!canBeFreelyGenerated(_slot))
 				{
+					flushPendingInstructions();
 					int deficit = static_cast<int>(*depth - 15);
 					YulString varName = slotVariableName(_slot);
 					std::string msg =
@@ -313,6 +331,7 @@ void OptimizedEVMCodeTransform::createStackLayout(std::shared_ptr<DebugData cons
 			}
 
 			// The slot can be freely generated or is an unassigned return variable. Push it.
+			flushPendingInstructions();
 			std::visit(util::GenericVisitor{
 				[&](LiteralSlot const& _literal)
 				{
@@ -360,9 +379,11 @@ void OptimizedEVMCodeTransform::createStackLayout(std::shared_ptr<DebugData cons
 		// Pop callback.
 		[&]()
 		{
-			m_assembly.appendInstruction(evmasm::Instruction::POP);
+			pendingInstructions.emplace_back(evmasm::Instruction::POP);
+			--pendingDeposit;
 		}
 	);
+	flushPendingInstructions();
 	yulAssert(m_assembly.stackHeight() == static_cast<int>(m_stack.size()), "");
 }
 
@@ -27,6 +27,8 @@
 #include <libyul/Exceptions.h>
 #include <libyul/Scope.h>
 
+#include <libsolutil/CancellationToken.h>
+
 #include <optional>
 #include <stack>
 
@@ -47,13 +49,19 @@ public:
 	/// 2) For none of the functions 3) for the first function of each name.
 	enum class UseNamedLabels { YesAndForceUnique, Never, ForFirstFunctionOfEachName };
 
+	/// A non-zero @a _stackLayoutGenerationBudget bounds the work spent per function searching
+	/// for an optimal stack layout, see StackLayoutGenerator::run.
+	/// @a _cancellationToken is polled during stack layout generation; the transform aborts
+	/// with util::CompilationCancelled once cancellation has been requested.
 	[[nodiscard]] static std::vector<StackTooDeepError> run(
 		AbstractAssembly& _assembly,
 		AsmAnalysisInfo& _analysisInfo,
 		Block const& _block,
 		EVMDialect const& _dialect,
 		BuiltinContext& _builtinContext,
-		UseNamedLabels _useNamedLabelsForFunctions
+		UseNamedLabels _useNamedLabelsForFunctions,
+		size_t _stackLayoutGenerationBudget = 0,
+		util::CancellationToken const& _cancellationToken = {}
 	);
 
 	/// Generate code for the function call @a _call. Only public for using with std::visit.
@@ -23,6 +23,8 @@
 
 #include <libyul/backends/evm/StackHelpers.h>
 
+#include <libyul/optimiser/BlockHasher.h>
+
 #include <libevmasm/GasMeter.h>
 
 #include <libsolutil/Algorithms.h>
@@ -44,16 +46,313 @@
 #include <range/v3/view/take_last.hpp>
 #include <range/v3/view/transform.hpp>
 
+#include <limits>
+#include <mutex>
+#include <optional>
+
 using namespace solidity;
 using namespace solidity::yul;
 
-StackLayout StackLayoutGenerator::run(CFG const& _cfg)
+namespace
+{
+
+/// Pointer-free representation of the stack layout of a single function, expressed in
+/// terms of block and stack slot indices of an ``EncodedFunctionCFG``.
+struct CachedFunctionLayout
+{
+	/// Entry layout of each block, indexed as in ``EncodedFunctionCFG``.
+	std::vector<std::vector<size_t>> entryLayouts;
+	/// Exit layout of each block, indexed as in ``EncodedFunctionCFG``.
+	std::vector<std::vector<size_t>> exitLayouts;
+	/// Entry layout of each operation of each block.
+	std::vector<std::vector<std::vector<size_t>>> operationLayouts;
+};
+
+/// Canonical pointer-free encoding of the control flow graph of a single function.
+/// Blocks are numbered in breadth-first order starting at the function entry and stack
+/// slots in order of first occurrence, so the encoding of two functions is equal if and
+/// only if their control flow graphs only differ in the identity of the referenced AST
+/// nodes. A stack layout generated for one of two such functions is also valid for the
+/// other after translating its slots, which allows reusing layouts of functions that
+/// were already processed earlier in the session.
+class EncodedFunctionCFG
+{
+public:
+	/// The layout generation budget becomes part of the encoding, since the generated layout
+	/// depends on it: a layout generated under a tighter budget must not be reused for a run
+	/// with a more generous one and vice versa.
+	static EncodedFunctionCFG encode(CFG::FunctionInfo const& _functionInfo, size_t _layoutGenerationBudget)
+	{
+		EncodedFunctionCFG result;
+		result.collectBlocks(*_functionInfo.entry);
+		result.append(_layoutGenerationBudget);
+		result.append(_functionInfo.canContinue);
+		result.registerSlot(FunctionReturnLabelSlot{_functionInfo.function});
+		result.registerSlot(JunkSlot{});
+		result.append(_functionInfo.parameters.size());
+		for (VariableSlot const& parameter: _functionInfo.parameters)
+			result.append(result.registerSlot(parameter));
+		result.append(_functionInfo.returnVariables.size());
+		for (VariableSlot const& returnVariable: _functionInfo.returnVariables)
+			result.append(result.registerSlot(returnVariable));
+		for (CFG::BasicBlock const* block: result.m_blocks)
+			result.encodeBlock(*block);
+		return result;
+	}
+
+	std::vector<uint64_t> const& encoding() const { return m_encoding; }
+
+	/// @returns a Fowler-Noll-Vo hash of the encoding in the style of ``BlockHasher``.
+	uint64_t hash() const
+	{
+		uint64_t hash = HasherBase::fnvEmptyHash;
+		for (uint64_t value: m_encoding)
+		{
+			hash *= HasherBase::fnvPrime;
+			hash ^= value;
+		}
+		return hash;
+	}
+
+	/// Translates the parts of @a _layout concerning this function into the pointer-free
+	/// cached representation. @returns nullopt if the layout contains slots that do not
+	/// occur in the function's control flow graph, in which case it cannot be cached.
+	std::optional<CachedFunctionLayout> extractLayout(StackLayout const& _layout) const
+	{
+		CachedFunctionLayout result;
+		for (CFG::BasicBlock const* block: m_blocks)
+		{
+			auto blockInfo = _layout.blockInfos.find(block);
+			if (blockInfo == _layout.blockInfos.end())
+				return std::nullopt;
+			std::optional<std::vector<size_t>> entryLayout = stackToIndices(blockInfo->second.entryLayout);
+			std::optional<std::vector<size_t>> exitLayout = stackToIndices(blockInfo->second.exitLayout);
+			if (!entryLayout || !exitLayout)
+				return std::nullopt;
+			result.entryLayouts.emplace_back(std::move(*entryLayout));
+			result.exitLayouts.emplace_back(std::move(*exitLayout));
+			std::vector<std::vector<size_t>>& operationLayouts = result.operationLayouts.emplace_back();
+			for (CFG::Operation const& operation: block->operations)
+			{
+				auto operationLayout = _layout.operationEntryLayout.find(&operation);
+				if (operationLayout == _layout.operationEntryLayout.end())
+					return std::nullopt;
+				if (std::optional<std::vector<size_t>> layout = stackToIndices(operationLayout->second))
+					operationLayouts.emplace_back(std::move(*layout));
+				else
+					return std::nullopt;
+			}
+		}
+		return result;
+	}
+
+	/// Applies @a _cachedLayout - extracted from a function with equal encoding - to the
+	/// blocks and operations of this function.
+	void applyLayout(CachedFunctionLayout const& _cachedLayout, StackLayout& _layout) const
+	{
+		yulAssert(_cachedLayout.entryLayouts.size() == m_blocks.size(), "");
+		for (size_t blockIndex = 0; blockIndex < m_blocks.size(); ++blockIndex)
+		{
+			CFG::BasicBlock const* block = m_blocks[blockIndex];
+			_layout.blockInfos[block] = StackLayout::BlockInfo{
+				indicesToStack(_cachedLayout.entryLayouts[blockIndex]),
+				indicesToStack(_cachedLayout.exitLayouts[blockIndex])
+			};
+			std::vector<std::vector<size_t>> const& operationLayouts = _cachedLayout.operationLayouts[blockIndex];
+			yulAssert(operationLayouts.size() == block->operations.size(), "");
+			for (size_t operationIndex = 0; operationIndex < block->operations.size(); ++operationIndex)
+				_layout.operationEntryLayout[&block->operations[operationIndex]] = indicesToStack(operationLayouts[operationIndex]);
+		}
+	}
+
+private:
+	EncodedFunctionCFG() = default;
+
+	void collectBlocks(CFG::BasicBlock const& _entry)
+	{
+		util::IndexedBreadthFirstSearch<CFG::BasicBlock const*>{{&_entry}}.run(
+			[](CFG::BasicBlock const* _block) { return _block->id; },
+			[&](CFG::BasicBlock const* _block, auto _addChild) {
+				m_blockIndices[_block] = m_blocks.size();
+				m_blocks.emplace_back(_block);
+				std::visit(util::GenericVisitor{
+					[&](CFG::BasicBlock::Jump const& _jump) { _addChild(_jump.target); },
+					[&](CFG::BasicBlock::ConditionalJump const& _jump) {
+						_addChild(_jump.zero);
+						_addChild(_jump.nonZero);
+					},
+					[](auto const&) {}
+				}, _block->exit);
+			}
+		);
+	}
+
+	void encodeBlock(CFG::BasicBlock const& _block)
+	{
+		append(_block.isStartOfSubGraph);
+		append(_block.needsCleanStack);
+		append(_block.operations.size());
+		for (CFG::Operation const& operation: _block.operations)
+		{
+			std::visit(util::GenericVisitor{
+				[&](CFG::FunctionCall const& _call) {
+					append(0);
+					append(_call.recursive);
+					append(_call.canContinue);
+				},
+				[&](CFG::BuiltinCall const& _call) {
+					append(1);
+					append(_call.builtin.get().name.hash());
+				},
+				[&](CFG::Assignment const&) { append(2); }
+			}, operation.operation);
+			encodeStack(operation.input);
+			encodeStack(operation.output);
+		}
+		std::visit(util::GenericVisitor{
+			[&](CFG::BasicBlock::MainExit const&) { append(0); },
+			[&](CFG::BasicBlock::Jump const& _jump) {
+				append(1);
+				append(_jump.backwards);
+				append(m_blockIndices.at(_jump.target));
+			},
+			[&](CFG::BasicBlock::ConditionalJump const& _jump) {
+				append(2);
+				append(registerSlot(_jump.condition));
+				append(m_blockIndices.at(_jump.zero));
+				append(m_blockIndices.at(_jump.nonZero));
+			},
+			[&](CFG::BasicBlock::FunctionReturn const&) { append(3); },
+			[&](CFG::BasicBlock::Terminated const&) { append(4); }
+		}, _block.exit);
+	}
+
+	void encodeStack(Stack const& _stack)
+	{
+		append(_stack.size());
+		for (StackSlot const& slot: _stack)
+			append(registerSlot(slot));
+	}
+
+	/// @returns the index of @a _slot, registering it in order of first occurrence and
+	/// appending the data intrinsic to the slot to the encoding when it is first seen.
+	size_t registerSlot(StackSlot const& _slot)
+	{
+		auto [it, inserted] = m_slotIndices.emplace(_slot, m_slots.size());
+		if (inserted)
+		{
+			m_slots.emplace_back(_slot);
+			append(_slot.index());
+			std::visit(util::GenericVisitor{
+				[&](LiteralSlot const& _literal) {
+					for (size_t limb = 0; limb < 4; ++limb)
+						append(static_cast<uint64_t>((_literal.value >> (64 * limb)) & std::numeric_limits<uint64_t>::max()));
+				},
+				[&](TemporarySlot const& _temporary) { append(_temporary.index); },
+				[](auto const&) {}
+			}, _slot);
+		}
+		return it->second;
+	}
+
+	std::optional<std::vector<size_t>> stackToIndices(Stack const& _stack) const
+	{
+		std::vector<size_t> result;
+		for (StackSlot const& slot: _stack)
+			if (auto it = m_slotIndices.find(slot); it != m_slotIndices.end())
+				result.emplace_back(it->second);
+			else
+				return std::nullopt;
+		return result;
+	}
+
+	Stack indicesToStack(std::vector<size_t> const& _indices) const
+	{
+		Stack result;
+		for (size_t index: _indices)
+			result.emplace_back(m_slots.at(index));
+		return result;
+	}
+
+	void append(uint64_t _value) { m_encoding.emplace_back(_value); }
+
+	std::vector<CFG::BasicBlock const*> m_blocks;
+	std::map<CFG::BasicBlock const*, size_t> m_blockIndices;
+	std::vector<StackSlot> m_slots;
+	std::map<StackSlot, size_t> m_slotIndices;
+	std::vector<uint64_t> m_encoding;
+};
+
+/// Session-wide cache of per-function stack layouts. Functions are looked up by the hash
+/// of their encoded control flow graph; since reusing the layout of a different function
+/// would result in invalid code, the full encoding is compared before a cached layout is
+/// applied. The cached layouts are pointer-free and thereby outlive the control flow
+/// graphs they were extracted from, so they can be reused whenever a structurally
+/// identical function is encountered again, e.g. for functions that were not affected by
+/// an optimiser run or for bytecode dependencies compiled as part of multiple contracts.
+class StackLayoutCache
+{
+public:
+	/// Singleton instance shared by all compilations in the process.
+	static StackLayoutCache& instance()
+	{
+		static StackLayoutCache cache;
+		return cache;
+	}
+
+	/// Applies the previously stored layout of a function with an encoding equal to
+	/// @a _encodedFunction to @a _layout. @returns false if no such layout is known.
+	bool restore(EncodedFunctionCFG const& _encodedFunction, StackLayout& _layout) const
+	{
+		std::lock_guard lock(m_mutex);
+		auto it = m_cachedLayouts.find(_encodedFunction.hash());
+		if (it == m_cachedLayouts.end())
+			return false;
+		for (auto const& [encoding, cachedLayout]: it->second)
+			if (encoding == _encodedFunction.encoding())
+			{
+				_encodedFunction.applyLayout(cachedLayout, _layout);
+				return true;
+			}
+		return false;
+	}
+
+	/// Stores the parts of @a _layout concerning the function described by @a _encodedFunction.
+	void store(EncodedFunctionCFG const& _encodedFunction, StackLayout const& _layout)
+	{
+		std::optional<CachedFunctionLayout> cachedLayout = _encodedFunction.extractLayout(_layout);
+		if (!cachedLayout)
+			return;
+		std::lock_guard lock(m_mutex);
+		std::vector<std::pair<std::vector<uint64_t>, CachedFunctionLayout>>& entries = m_cachedLayouts[_encodedFunction.hash()];
+		for (auto const& [encoding, layout]: entries)
+			if (encoding == _encodedFunction.encoding())
+				return;
+		entries.emplace_back(_encodedFunction.encoding(), std::move(*cachedLayout));
+	}
+
+private:
+	StackLayoutCache() = default;
+
+	mutable std::mutex m_mutex;
+	std::map<uint64_t, std::vector<std::pair<std::vector<uint64_t>, CachedFunctionLayout>>> m_cachedLayouts;
+};
+
+}
+
+StackLayout StackLayoutGenerator::run(CFG const& _cfg, size_t _layoutGenerationBudget, util::CancellationToken const& _cancellationToken)
 {
 	StackLayout stackLayout;
-	StackLayoutGenerator{stackLayout, nullptr}.processEntryPoint(*_cfg.entry);
+	StackLayoutGenerator{stackLayout, nullptr, _layoutGenerationBudget, _cancellationToken}.processEntryPoint(*_cfg.entry);
 
 	for (auto& functionInfo: _cfg.functionInfo | ranges::views::values)
-		StackLayoutGenerator{stackLayout, &functionInfo}.processEntryPoint(*functionInfo.entry, &functionInfo);
+	{
+		EncodedFunctionCFG encodedFunction = EncodedFunctionCFG::encode(functionInfo, _layoutGenerationBudget);
+		if (StackLayoutCache::instance().restore(encodedFunction, stackLayout))
+			continue;
+		StackLayoutGenerator{stackLayout, &functionInfo, _layoutGenerationBudget, _cancellationToken}.processEntryPoint(*functionInfo.entry, &functionInfo);
+		StackLayoutCache::instance().store(encodedFunction, stackLayout);
+	}
 
 	return stackLayout;
 }
@@ -88,10 +387,18 @@ std::vector<StackLayoutGenerator::StackTooDeep> StackLayoutGenerator::reportStac
 	return generator.reportStackTooDeep(*entry);
 }
 
-StackLayoutGenerator::StackLayoutGenerator(StackLayout& _layout, CFG::FunctionInfo const* _functionInfo):
+StackLayoutGenerator::StackLayoutGenerator(
+	StackLayout& _layout,
+	CFG::FunctionInfo const* _functionInfo,
+	size_t _layoutGenerationBudget,
+	util::CancellationToken _cancellationToken
+):
 	m_layout(_layout),
-	m_currentFunctionInfo(_functionInfo)
+	m_currentFunctionInfo(_functionInfo),
+	m_cancellationToken(std::move(_cancellationToken))
 {
+	if (_layoutGenerationBudget > 0)
+		m_remainingLayoutGenerationBudget = _layoutGenerationBudget;
 }
 
 namespace
@@ -281,7 +588,20 @@ Stack StackLayoutGenerator::propagateStackThroughOperation(Stack _exitStack, CFG
 
 	// Determine the ideal permutation of the slots in _exitLayout that are not operation outputs (and not to be
 	// generated on the fly), s.t. shuffling the `stack + _operation.output` to _exitLayout is cheap.
-	Stack stack = createIdealLayout(_operation.output, _exitStack, generateSlotOnTheFly);
+	// Searching for the ideal permutation shuffles a stack of the size of _exitStack, so it is charged against
+	// the layout generation budget accordingly. Once the budget is exhausted, the slots are kept in the order
+	// in which they occur in _exitStack, which is always valid, but may require more shuffling at runtime.
+	Stack stack;
+	if (m_remainingLayoutGenerationBudget && *m_remainingLayoutGenerationBudget < _exitStack.size())
+		stack = _exitStack | ranges::views::filter([&](StackSlot const& _slot) {
+			return !util::contains(_operation.output, _slot) && !generateSlotOnTheFly(_slot);
+		}) | ranges::to<Stack>;
+	else
+	{
+		if (m_remainingLayoutGenerationBudget)
+			*m_remainingLayoutGenerationBudget -= _exitStack.size();
+		stack = createIdealLayout(_operation.output, _exitStack, generateSlotOnTheFly);
+	}
 
 	// Make sure the resulting previous slots do not overlap with any assignmed variables.
 	if (auto const* assignment = std::get_if<CFG::Assignment>(&_operation.operation))
@@ -346,6 +666,8 @@ void StackLayoutGenerator::processEntryPoint(CFG::BasicBlock const& _entry, CFG:
 		// entry layout of the backwards jump target as the initial exit layout of the backwards-jumping block.
 		while (!toVisit.empty())
 		{
+			m_cancellationToken.throwIfCancelled();
+
 			CFG::BasicBlock const *block = *toVisit.begin();
 			toVisit.pop_front();
 
@@ -385,7 +707,8 @@ void StackLayoutGenerator::processEntryPoint(CFG::BasicBlock const& _entry, CFG:
 				// required stack shuffling from the loop condition to outside the loop.
 				for (CFG::BasicBlock const* entry: target->entries)
 					visited.erase(entry);
-				util::BreadthFirstSearch<CFG::BasicBlock const*>{{jumpingBlock}}.run(
+				util::IndexedBreadthFirstSearch<CFG::BasicBlock const*>{{jumpingBlock}}.run(
+					[](CFG::BasicBlock const* _block) { return _block->id; },
 					[&visited, target = target](CFG::BasicBlock const* _block, auto _addChild) {
 						visited.erase(_block);
 						if (_block == target)
@@ -478,31 +801,34 @@ std::optional<Stack> StackLayoutGenerator::getExitLayoutOrStageDependencies(
 std::list<std::pair<CFG::BasicBlock const*, CFG::BasicBlock const*>> StackLayoutGenerator::collectBackwardsJumps(CFG::BasicBlock const& _entry) const
 {
 	std::list<std::pair<CFG::BasicBlock const*, CFG::BasicBlock const*>> backwardsJumps;
-	util::BreadthFirstSearch<CFG::BasicBlock const*>{{&_entry}}.run([&](CFG::BasicBlock const* _block, auto _addChild) {
-		std::visit(util::GenericVisitor{
-			[&](CFG::BasicBlock::MainExit const&) {},
-			[&](CFG::BasicBlock::Jump const& _jump)
-			{
-				if (_jump.backwards)
-					backwardsJumps.emplace_back(_block, _jump.target);
-				_addChild(_jump.target);
-			},
-			[&](CFG::BasicBlock::ConditionalJump const& _conditionalJump)
-			{
-				_addChild(_conditionalJump.zero);
-				_addChild(_conditionalJump.nonZero);
-			},
-			[&](CFG::BasicBlock::FunctionReturn const&) {},
-			[&](CFG::BasicBlock::Terminated const&) {},
-		}, _block->exit);
-	});
+	util::IndexedBreadthFirstSearch<CFG::BasicBlock const*>{{&_entry}}.run(
+		[](CFG::BasicBlock const* _block) { return _block->id; },
+		[&](CFG::BasicBlock const* _block, auto _addChild) {
+			std::visit(util::GenericVisitor{
+				[&](CFG::BasicBlock::MainExit const&) {},
+				[&](CFG::BasicBlock::Jump const& _jump)
+				{
+					if (_jump.backwards)
+						backwardsJumps.emplace_back(_block, _jump.target);
+					_addChild(_jump.target);
+				},
+				[&](CFG::BasicBlock::ConditionalJump const& _conditionalJump)
+				{
+					_addChild(_conditionalJump.zero);
+					_addChild(_conditionalJump.nonZero);
+				},
+				[&](CFG::BasicBlock::FunctionReturn const&) {},
+				[&](CFG::BasicBlock::Terminated const&) {},
+			}, _block->exit);
+		}
+	);
 	return backwardsJumps;
 }
 
 void StackLayoutGenerator::stitchConditionalJumps(CFG::BasicBlock const& _block)
 {
-	util::BreadthFirstSearch<CFG::BasicBlock const*> breadthFirstSearch{{&_block}};
-	breadthFirstSearch.run([&](CFG::BasicBlock const* _block, auto _addChild) {
+	util::IndexedBreadthFirstSearch<CFG::BasicBlock const*> breadthFirstSearch{{&_block}};
+	breadthFirstSearch.run([](CFG::BasicBlock const* _block) { return _block->id; }, [&](CFG::BasicBlock const* _block, auto _addChild) {
 		auto& info = m_layout.blockInfos.at(_block);
 		std::visit(util::GenericVisitor{
 			[&](CFG::BasicBlock::MainExit const&) {},
@@ -635,8 +961,8 @@ Stack StackLayoutGenerator::combineStack(Stack const& _stack1, Stack const& _sta
 std::vector<StackLayoutGenerator::StackTooDeep> StackLayoutGenerator::reportStackTooDeep(CFG::BasicBlock const& _entry) const
 {
 	std::vector<StackTooDeep> stackTooDeepErrors;
-	util::BreadthFirstSearch<CFG::BasicBlock const*> breadthFirstSearch{{&_entry}};
-	breadthFirstSearch.run([&](CFG::BasicBlock const* _block, auto _addChild) {
+	util::IndexedBreadthFirstSearch<CFG::BasicBlock const*> breadthFirstSearch{{&_entry}};
+	breadthFirstSearch.run([](CFG::BasicBlock const* _block) { return _block->id; }, [&](CFG::BasicBlock const* _block, auto _addChild) {
 		Stack currentStack = m_layout.blockInfos.at(_block).entryLayout;
 
 		for (auto const& operation: _block->operations)
@@ -713,8 +1039,8 @@ void StackLayoutGenerator::fillInJunk(CFG::BasicBlock const& _block, CFG::Functi
 	/// Recursively adds junk to the subgraph starting on @a _entry.
 	/// Since it is only called on cut-vertices, the full subgraph retains proper stack balance.
 	auto addJunkRecursive = [&](CFG::BasicBlock const* _entry, size_t _numJunk) {
-		util::BreadthFirstSearch<CFG::BasicBlock const*> breadthFirstSearch{{_entry}};
-		breadthFirstSearch.run([&](CFG::BasicBlock const* _block, auto _addChild) {
+		util::IndexedBreadthFirstSearch<CFG::BasicBlock const*> breadthFirstSearch{{_entry}};
+		breadthFirstSearch.run([](CFG::BasicBlock const* _block) { return _block->id; }, [&](CFG::BasicBlock const* _block, auto _addChild) {
 			auto& blockInfo = m_layout.blockInfos.at(_block);
 			blockInfo.entryLayout = Stack{_numJunk, JunkSlot{}} + std::move(blockInfo.entryLayout);
 			for (auto const& operation: _block->operations)
@@ -810,7 +1136,7 @@ void StackLayoutGenerator::fillInJunk(CFG::BasicBlock const& _block, CFG::Functi
 	/// Traverses the CFG and at each block that allows junk, i.e. that is a cut-vertex that never leads to a function
 	/// return, checks if adding junk reduces the shuffling cost upon entering and if so recursively adds junk
 	/// to the spanned subgraph.
-	util::BreadthFirstSearch<CFG::BasicBlock const*>{{&_block}}.run([&](CFG::BasicBlock const* _block, auto _addChild) {
+	util::IndexedBreadthFirstSearch<CFG::BasicBlock const*>{{&_block}}.run([](CFG::BasicBlock const* _block) { return _block->id; }, [&](CFG::BasicBlock const* _block, auto _addChild) {
 		if (_block->allowsJunk())
 		{
 			auto& blockInfo = m_layout.blockInfos.at(_block);
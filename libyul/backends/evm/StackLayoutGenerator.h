@@ -23,7 +23,10 @@
 
 #include <libyul/backends/evm/ControlFlowGraph.h>
 
+#include <libsolutil/CancellationToken.h>
+
 #include <map>
+#include <optional>
 
 namespace solidity::yul
 {
@@ -55,7 +58,16 @@ public:
 		std::vector<YulString> variableChoices;
 	};
 
-	static StackLayout run(CFG const& _cfg);
+	/// If @a _layoutGenerationBudget is non-zero, it bounds the number of stack shuffling steps
+	/// spent per function searching for an optimal layout; once it is exhausted, the remaining
+	/// operations of the function receive a cheap greedy layout instead.
+	/// @a _cancellationToken is polled during the layout iteration; generation aborts with
+	/// util::CompilationCancelled once cancellation has been requested.
+	static StackLayout run(
+		CFG const& _cfg,
+		size_t _layoutGenerationBudget = 0,
+		util::CancellationToken const& _cancellationToken = {}
+	);
 	/// @returns a map from function names to the stack too deep errors occurring in that function.
 	/// Requires @a _cfg to be a control flow graph generated from disambiguated Yul.
 	/// The empty string is mapped to the stack too deep errors of the main entry point.
@@ -66,7 +78,12 @@ public:
 	static std::vector<StackTooDeep> reportStackTooDeep(CFG const& _cfg, YulString _functionName);
 
 private:
-	StackLayoutGenerator(StackLayout& _context, CFG::FunctionInfo const* _functionInfo);
+	StackLayoutGenerator(
+		StackLayout& _context,
+		CFG::FunctionInfo const* _functionInfo,
+		size_t _layoutGenerationBudget = 0,
+		util::CancellationToken _cancellationToken = {}
+	);
 
 	/// @returns the optimal entry stack layout, s.t. @a _operation can be applied to it and
 	/// the result can be transformed to @a _exitStack with minimal stack shuffling.
@@ -116,6 +133,12 @@ private:
 
 	StackLayout& m_layout;
 	CFG::FunctionInfo const* m_currentFunctionInfo = nullptr;
+	/// Remaining number of stack shuffling steps that may be spent searching for optimal
+	/// stack layouts. ``std::nullopt`` means no limit.
+	std::optional<size_t> m_remainingLayoutGenerationBudget;
+	/// Polled while iterating over the blocks; generation aborts with
+	/// util::CompilationCancelled once cancellation has been requested.
+	util::CancellationToken m_cancellationToken;
 };
 
 }
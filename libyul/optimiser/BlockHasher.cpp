@@ -41,9 +41,9 @@ static constexpr uint64_t compileTimeLiteralHash(char const (&_literal)[N])
 }
 }
 
-std::map<Block const*, uint64_t> BlockHasher::run(Block const& _block)
+util::FlatHashMap<Block const*, uint64_t> BlockHasher::run(Block const& _block)
 {
-	std::map<Block const*, uint64_t> result;
+	util::FlatHashMap<Block const*, uint64_t> result;
 	BlockHasher blockHasher(result);
 	blockHasher(_block);
 	return result;
@@ -225,3 +225,135 @@ void ExpressionHasher::operator()(FunctionCall const& _funCall)
 	hash64(_funCall.arguments.size());
 	ASTWalker::operator()(_funCall);
 }
+
+uint64_t ASTHasher::run(Block const& _block)
+{
+	ASTHasher hasher;
+	hasher(_block);
+	return hasher.m_hash;
+}
+
+uint64_t ASTHasher::run(FunctionDefinition const& _function)
+{
+	ASTHasher hasher;
+	hasher(_function);
+	return hasher.m_hash;
+}
+
+void ASTHasher::operator()(Literal const& _literal)
+{
+	hash64(compileTimeLiteralHash("Literal"));
+	hash64(_literal.value.hash());
+	hash64(_literal.type.hash());
+	hash8(static_cast<uint8_t>(_literal.kind));
+}
+
+void ASTHasher::operator()(Identifier const& _identifier)
+{
+	hash64(compileTimeLiteralHash("Identifier"));
+	hash64(_identifier.name.hash());
+}
+
+void ASTHasher::operator()(FunctionCall const& _funCall)
+{
+	hash64(compileTimeLiteralHash("FunctionCall"));
+	hash64(_funCall.functionName.name.hash());
+	hash64(_funCall.arguments.size());
+	ASTWalker::operator()(_funCall);
+}
+
+void ASTHasher::operator()(ExpressionStatement const& _statement)
+{
+	hash64(compileTimeLiteralHash("ExpressionStatement"));
+	ASTWalker::operator()(_statement);
+}
+
+void ASTHasher::operator()(Assignment const& _assignment)
+{
+	hash64(compileTimeLiteralHash("Assignment"));
+	hash64(_assignment.variableNames.size());
+	ASTWalker::operator()(_assignment);
+}
+
+void ASTHasher::operator()(VariableDeclaration const& _varDecl)
+{
+	hash64(compileTimeLiteralHash("VariableDeclaration"));
+	hash64(_varDecl.variables.size());
+	for (auto const& var: _varDecl.variables)
+	{
+		hash64(var.name.hash());
+		hash64(var.type.hash());
+	}
+	hash8(_varDecl.value ? 1 : 0);
+	ASTWalker::operator()(_varDecl);
+}
+
+void ASTHasher::operator()(If const& _if)
+{
+	hash64(compileTimeLiteralHash("If"));
+	ASTWalker::operator()(_if);
+}
+
+void ASTHasher::operator()(Switch const& _switch)
+{
+	hash64(compileTimeLiteralHash("Switch"));
+	hash64(_switch.cases.size());
+	visit(*_switch.expression);
+	for (auto const& _case: _switch.cases)
+	{
+		hash8(_case.value ? 1 : 0);
+		if (_case.value)
+			(*this)(*_case.value);
+		(*this)(_case.body);
+	}
+}
+
+void ASTHasher::operator()(FunctionDefinition const& _funDef)
+{
+	hash64(compileTimeLiteralHash("FunctionDefinition"));
+	hash64(_funDef.name.hash());
+	hash64(_funDef.parameters.size());
+	for (auto const& parameter: _funDef.parameters)
+	{
+		hash64(parameter.name.hash());
+		hash64(parameter.type.hash());
+	}
+	hash64(_funDef.returnVariables.size());
+	for (auto const& returnVariable: _funDef.returnVariables)
+	{
+		hash64(returnVariable.name.hash());
+		hash64(returnVariable.type.hash());
+	}
+	ASTWalker::operator()(_funDef);
+}
+
+void ASTHasher::operator()(ForLoop const& _loop)
+{
+	hash64(compileTimeLiteralHash("ForLoop"));
+	ASTWalker::operator()(_loop);
+}
+
+void ASTHasher::operator()(Break const& _break)
+{
+	hash64(compileTimeLiteralHash("Break"));
+	ASTWalker::operator()(_break);
+}
+
+void ASTHasher::operator()(Continue const& _continue)
+{
+	hash64(compileTimeLiteralHash("Continue"));
+	ASTWalker::operator()(_continue);
+}
+
+void ASTHasher::operator()(Leave const& _leaveStatement)
+{
+	hash64(compileTimeLiteralHash("Leave"));
+	ASTWalker::operator()(_leaveStatement);
+}
+
+void ASTHasher::operator()(Block const& _block)
+{
+	hash64(compileTimeLiteralHash("Block"));
+	hash64(_block.statements.size());
+	ASTWalker::operator()(_block);
+}
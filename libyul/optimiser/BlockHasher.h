@@ -23,6 +23,7 @@
 #include <libyul/optimiser/ASTWalker.h>
 #include <libyul/ASTForward.h>
 #include <libyul/YulString.h>
+#include <libsolutil/FlatHashMap.h>
 
 namespace solidity::yul
 {
@@ -94,13 +95,13 @@ public:
 	void operator()(Leave const&) override;
 	void operator()(Block const& _block) override;
 
-	static std::map<Block const*, uint64_t> run(Block const& _block);
+	static util::FlatHashMap<Block const*, uint64_t> run(Block const& _block);
 
 
 private:
-	BlockHasher(std::map<Block const*, uint64_t>& _blockHashes): m_blockHashes(_blockHashes) {}
+	BlockHasher(util::FlatHashMap<Block const*, uint64_t>& _blockHashes): m_blockHashes(_blockHashes) {}
 
-	std::map<Block const*, uint64_t>& m_blockHashes;
+	util::FlatHashMap<Block const*, uint64_t>& m_blockHashes;
 
 	struct VariableReference
 	{
@@ -142,4 +143,34 @@ struct ExpressionHash
 	}
 };
 
+/**
+ * Computes a hash of a full AST that changes whenever the code is rewritten
+ * (up to hash collisions). In contrast to the BlockHasher, all identifiers and
+ * names are hashed verbatim, so renames change the hash as well.
+ * Used to detect whether cached analysis results are still valid.
+ */
+class ASTHasher: public ASTWalker, public HasherBase
+{
+public:
+	static uint64_t run(Block const& _block);
+	static uint64_t run(FunctionDefinition const& _function);
+
+	using ASTWalker::operator();
+
+	void operator()(Literal const&) override;
+	void operator()(Identifier const&) override;
+	void operator()(FunctionCall const& _funCall) override;
+	void operator()(ExpressionStatement const& _statement) override;
+	void operator()(Assignment const& _assignment) override;
+	void operator()(VariableDeclaration const& _varDecl) override;
+	void operator()(If const& _if) override;
+	void operator()(Switch const& _switch) override;
+	void operator()(FunctionDefinition const& _funDef) override;
+	void operator()(ForLoop const& _loop) override;
+	void operator()(Break const&) override;
+	void operator()(Continue const&) override;
+	void operator()(Leave const&) override;
+	void operator()(Block const& _block) override;
+};
+
 }
@@ -126,7 +126,9 @@ void DataFlowAnalyzer::operator()(VariableDeclaration& _varDecl)
 void DataFlowAnalyzer::operator()(If& _if)
 {
 	clearKnowledgeIfInvalidated(*_if.condition);
-	Environment preEnvironment = m_state.environment;
+	// The copy is only needed for joinKnowledge, which ignores it if the
+	// analysis of memory and storage is disabled.
+	Environment preEnvironment = m_analyzeStores ? m_state.environment : Environment{};
 
 	ASTModifier::operator()(_if);
 	joinKnowledge(preEnvironment);
@@ -141,7 +143,7 @@ void DataFlowAnalyzer::operator()(Switch& _switch)
 	std::set<YulString> assignedVariables;
 	for (auto& _case: _switch.cases)
 	{
-		Environment preEnvironment = m_state.environment;
+		Environment preEnvironment = m_analyzeStores ? m_state.environment : Environment{};
 		(*this)(_case.body);
 		joinKnowledge(preEnvironment);
 
@@ -270,7 +272,7 @@ void DataFlowAnalyzer::handleAssignment(std::set<YulString> const& _variables, E
 	auto const& referencedVariables = movableChecker.referencedVariables();
 	for (auto const& name: _variables)
 	{
-		m_state.references[name] = referencedVariables;
+		setReferences(name, referencedVariables);
 		if (!_isDeclaration)
 		{
 			// assignment to slot denoted by "name"
@@ -315,7 +317,7 @@ void DataFlowAnalyzer::popScope()
 	for (auto const& name: m_variableScopes.back().variables)
 	{
 		m_state.value.erase(name);
-		m_state.references.erase(name);
+		clearReferences(name);
 	}
 	m_variableScopes.pop_back();
 }
@@ -351,20 +353,46 @@ void DataFlowAnalyzer::clearValues(std::set<YulString> _variables)
 	});
 
 	// Also clear variables that reference variables to be cleared.
+	// The inverse index makes this linear in the number of affected
+	// variables instead of the number of tracked references.
 	std::set<YulString> referencingVariables;
 	for (auto const& variableToClear: _variables)
-		for (auto const& [ref, names]: m_state.references)
-			if (names.count(variableToClear))
-				referencingVariables.emplace(ref);
+		if (std::set<YulString> const* referencing = valueOrNullptr(m_state.referencedBy, variableToClear))
+			referencingVariables += *referencing;
 
 	// Clear the value and update the reference relation.
 	for (auto const& name: _variables + referencingVariables)
 	{
 		m_state.value.erase(name);
-		m_state.references.erase(name);
+		clearReferences(name);
 	}
 }
 
+void DataFlowAnalyzer::setReferences(YulString _variable, std::set<YulString> _references)
+{
+	clearReferences(_variable);
+	for (auto const& reference: _references)
+		m_state.referencedBy[reference].emplace(_variable);
+	m_state.references[_variable] = std::move(_references);
+}
+
+void DataFlowAnalyzer::clearReferences(YulString _variable)
+{
+	auto references = m_state.references.find(_variable);
+	if (references == m_state.references.end())
+		return;
+	for (auto const& reference: references->second)
+	{
+		auto referencedBy = m_state.referencedBy.find(reference);
+		if (referencedBy == m_state.referencedBy.end())
+			continue;
+		referencedBy->second.erase(_variable);
+		if (referencedBy->second.empty())
+			m_state.referencedBy.erase(referencedBy);
+	}
+	m_state.references.erase(references);
+}
+
 void DataFlowAnalyzer::assignValue(YulString _variable, Expression const* _value)
 {
 	m_state.value[_variable] = {_value, m_loopDepth};
@@ -466,8 +494,8 @@ void DataFlowAnalyzer::joinKnowledge(Environment const& _olderEnvironment)
 }
 
 void DataFlowAnalyzer::joinKnowledgeHelper(
-	std::unordered_map<YulString, YulString>& _this,
-	std::unordered_map<YulString, YulString> const& _older
+	util::FlatHashMap<YulString, YulString>& _this,
+	util::FlatHashMap<YulString, YulString> const& _older
 )
 {
 	// We clear if the key does not exist in the older map or if the value is different.
@@ -31,6 +31,7 @@
 
 #include <libsolutil/Numeric.h>
 #include <libsolutil/Common.h>
+#include <libsolutil/FlatHashMap.h>
 
 #include <map>
 #include <set>
@@ -105,7 +106,7 @@ public:
 	/// @returns the current value of the given variable, if known - always movable.
 	AssignedValue const* variableValue(YulString _variable) const { return util::valueOrNullptr(m_state.value, _variable); }
 	std::set<YulString> const* references(YulString _variable) const { return util::valueOrNullptr(m_state.references, _variable); }
-	std::map<YulString, AssignedValue> const& allValues() const { return m_state.value; }
+	util::FlatHashMap<YulString, AssignedValue> const& allValues() const { return m_state.value; }
 	std::optional<YulString> storageValue(YulString _key) const;
 	std::optional<YulString> memoryValue(YulString _key) const;
 	std::optional<YulString> keccakValue(YulString _start, YulString _length) const;
@@ -170,21 +171,29 @@ protected:
 private:
 	struct Environment
 	{
-		std::unordered_map<YulString, YulString> storage;
-		std::unordered_map<YulString, YulString> memory;
+		util::FlatHashMap<YulString, YulString> storage;
+		util::FlatHashMap<YulString, YulString> memory;
 		/// If keccak[s, l] = y then y := keccak256(s, l) occurs in the code.
-		std::map<std::pair<YulString, YulString>, YulString> keccak;
+		util::FlatHashMap<std::pair<YulString, YulString>, YulString> keccak;
 	};
 	struct State
 	{
 		/// Current values of variables, always movable.
-		std::map<YulString, AssignedValue> value;
+		util::FlatHashMap<YulString, AssignedValue> value;
 		/// m_references[a].contains(b) <=> the current expression assigned to a references b
-		std::unordered_map<YulString, std::set<YulString>> references;
+		util::FlatHashMap<YulString, std::set<YulString>> references;
+		/// Inverse of the reference relation: referencedBy[b].contains(a) <=> references[a].contains(b).
+		/// Kept in sync so that clearing a variable does not have to scan all references.
+		util::FlatHashMap<YulString, std::set<YulString>> referencedBy;
 
 		Environment environment;
 	};
 
+	/// Sets the references of @a _variable, updating both directions of the index.
+	void setReferences(YulString _variable, std::set<YulString> _references);
+	/// Removes the references of @a _variable from both directions of the index.
+	void clearReferences(YulString _variable);
+
 	/// Joins knowledge about storage and memory with an older point in the control-flow.
 	/// This only works if the current state is a direct successor of the older point,
 	/// i.e. `_olderState.storage` and `_olderState.memory` cannot have additional changes.
@@ -192,8 +201,8 @@ private:
 	void joinKnowledge(Environment const& _olderEnvironment);
 
 	static void joinKnowledgeHelper(
-		std::unordered_map<YulString, YulString>& _thisData,
-		std::unordered_map<YulString, YulString> const& _olderData
+		util::FlatHashMap<YulString, YulString>& _thisData,
+		util::FlatHashMap<YulString, YulString> const& _olderData
 	);
 
 	State m_state;
@@ -26,6 +26,8 @@
 #include <libyul/Exceptions.h>
 #include <libyul/Scope.h>
 
+#include <libsolutil/Common.h>
+
 using namespace solidity;
 using namespace solidity::yul;
 using namespace solidity::util;
@@ -74,3 +76,68 @@ void Disambiguator::leaveScopeInternal(Scope& _scope)
 	assertThrow(m_scopes.back() == &_scope, OptimizerException, "");
 	m_scopes.pop_back();
 }
+
+void InPlaceDisambiguator::operator()(Identifier& _identifier)
+{
+	translate(_identifier.name);
+}
+
+void InPlaceDisambiguator::operator()(VariableDeclaration& _varDecl)
+{
+	for (TypedName& variable: _varDecl.variables)
+		translate(variable.name);
+	ASTModifier::operator()(_varDecl);
+}
+
+void InPlaceDisambiguator::operator()(FunctionDefinition& _function)
+{
+	translate(_function.name);
+
+	m_scopes.push_back(m_info.scopes.at(m_info.virtualBlocks.at(&_function).get()).get());
+	ScopeGuard guard([&]() { m_scopes.pop_back(); });
+
+	for (TypedName& parameter: _function.parameters)
+		translate(parameter.name);
+	for (TypedName& returnVariable: _function.returnVariables)
+		translate(returnVariable.name);
+	(*this)(_function.body);
+}
+
+void InPlaceDisambiguator::operator()(FunctionCall& _funCall)
+{
+	translate(_funCall.functionName.name);
+	// The base class walks the arguments in reverse. Visit them in source order instead,
+	// so that the name dispenser hands out the same names as the copying Disambiguator.
+	for (Expression& argument: _funCall.arguments)
+		visit(argument);
+}
+
+void InPlaceDisambiguator::operator()(ForLoop& _forLoop)
+{
+	// The scope of the init block spans the whole loop.
+	m_scopes.push_back(m_info.scopes.at(&_forLoop.pre).get());
+	ScopeGuard guard([&]() { m_scopes.pop_back(); });
+
+	ASTModifier::operator()(_forLoop);
+}
+
+void InPlaceDisambiguator::operator()(Block& _block)
+{
+	m_scopes.push_back(m_info.scopes.at(&_block).get());
+	ScopeGuard guard([&]() { m_scopes.pop_back(); });
+
+	ASTModifier::operator()(_block);
+}
+
+void InPlaceDisambiguator::translate(YulString& _name)
+{
+	if (m_dialect.builtin(_name) || m_externallyUsedIdentifiers.count(_name))
+		return;
+
+	assertThrow(!m_scopes.empty() && m_scopes.back(), OptimizerException, "");
+	Scope::Identifier const* id = m_scopes.back()->lookup(_name);
+	assertThrow(id, OptimizerException, "");
+	if (!m_translations.count(id))
+		m_translations[id] = m_nameDispenser.newName(_name);
+	_name = m_translations.at(id);
+}
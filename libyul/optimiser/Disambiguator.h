@@ -24,6 +24,7 @@
 #include <libyul/ASTForward.h>
 #include <libyul/AsmAnalysisInfo.h>
 #include <libyul/optimiser/ASTCopier.h>
+#include <libyul/optimiser/ASTWalker.h>
 #include <libyul/optimiser/NameDispenser.h>
 
 #include <optional>
@@ -70,4 +71,47 @@ protected:
 	NameDispenser m_nameDispenser;
 };
 
+/**
+ * Variant of the Disambiguator that renames the identifiers directly inside the existing
+ * AST. Suitable whenever the original AST does not have to be preserved, e.g. at the start
+ * of the optimiser suite, since all subtrees stay in place instead of being deep-copied.
+ * Chooses the same names as the copying Disambiguator.
+ */
+class InPlaceDisambiguator: public ASTModifier
+{
+public:
+	explicit InPlaceDisambiguator(
+		Dialect const& _dialect,
+		AsmAnalysisInfo const& _analysisInfo,
+		std::set<YulString> const& _externallyUsedIdentifiers = {}
+	):
+		m_info(_analysisInfo),
+		m_dialect(_dialect),
+		m_externallyUsedIdentifiers(_externallyUsedIdentifiers),
+		m_nameDispenser(_dialect, m_externallyUsedIdentifiers)
+	{
+	}
+
+	using ASTModifier::operator();
+	void operator()(Identifier& _identifier) override;
+	void operator()(VariableDeclaration& _varDecl) override;
+	void operator()(FunctionDefinition& _function) override;
+	void operator()(FunctionCall& _funCall) override;
+	void operator()(ForLoop& _forLoop) override;
+	void operator()(Block& _block) override;
+
+private:
+	/// Replaces @a _name by its unique name, generating one on the first use of the scoped
+	/// identifier it refers to. Builtins and externally used identifiers stay unchanged.
+	void translate(YulString& _name);
+
+	AsmAnalysisInfo const& m_info;
+	Dialect const& m_dialect;
+	std::set<YulString> const& m_externallyUsedIdentifiers;
+
+	std::vector<Scope*> m_scopes;
+	std::map<void const*, YulString> m_translations;
+	NameDispenser m_nameDispenser;
+};
+
 }
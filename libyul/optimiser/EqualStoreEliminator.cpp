@@ -37,7 +37,7 @@ void EqualStoreEliminator::run(OptimiserStepContext const& _context, Block& _ast
 {
 	EqualStoreEliminator eliminator{
 		_context.dialect,
-		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast))
+		functionSideEffects(_context, _ast)
 	};
 	eliminator(_ast);
 
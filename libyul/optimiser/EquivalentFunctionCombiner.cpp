@@ -28,7 +28,12 @@ using namespace solidity::yul;
 
 void EquivalentFunctionCombiner::run(OptimiserStepContext&, Block& _ast)
 {
-	EquivalentFunctionCombiner{EquivalentFunctionDetector::run(_ast)}(_ast);
+	std::map<YulString, FunctionDefinition const*> duplicates = EquivalentFunctionDetector::run(_ast);
+	// Once all duplicates have been combined in an earlier run, repeated runs of the
+	// step only confirm that; skip the rewriting pass over the whole AST in that case.
+	if (duplicates.empty())
+		return;
+	EquivalentFunctionCombiner{std::move(duplicates)}(_ast);
 }
 
 void EquivalentFunctionCombiner::operator()(FunctionCall& _funCall)
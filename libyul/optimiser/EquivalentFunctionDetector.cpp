@@ -28,12 +28,35 @@
 using namespace solidity;
 using namespace solidity::yul;
 
+namespace
+{
+
+/// @returns a hash of the body hash combined with the signature of the function,
+/// so that functions with differing signatures end up in different buckets.
+uint64_t candidateHash(FunctionDefinition const& _fun, uint64_t _bodyHash)
+{
+	uint64_t hash = _bodyHash;
+	auto feed = [&hash](uint64_t _value) {
+		hash ^= _value;
+		hash *= BlockHasher::fnvPrime;
+	};
+	feed(_fun.parameters.size());
+	for (auto const& parameter: _fun.parameters)
+		feed(parameter.type.hash());
+	feed(_fun.returnVariables.size());
+	for (auto const& returnVariable: _fun.returnVariables)
+		feed(returnVariable.type.hash());
+	return hash;
+}
+
+}
+
 void EquivalentFunctionDetector::operator()(FunctionDefinition const& _fun)
 {
 	uint64_t bodyHash = m_blockHashes[&_fun.body];
-	auto& candidates = m_candidates[bodyHash];
+	auto& candidates = m_candidates[candidateHash(_fun, bodyHash)];
 	for (auto const& candidate: candidates)
-		if (SyntacticallyEqual{}.statementEqual(_fun, *candidate))
+		if (SyntacticallyEqual{m_blockHashes}.statementEqual(_fun, *candidate))
 		{
 			m_duplicates[_fun.name] = candidate;
 			return;
@@ -46,10 +46,10 @@ public:
 	void operator()(FunctionDefinition const& _fun) override;
 
 private:
-	EquivalentFunctionDetector(std::map<Block const*, uint64_t> _blockHashes): m_blockHashes(std::move(_blockHashes)) {}
+	EquivalentFunctionDetector(util::FlatHashMap<Block const*, uint64_t> _blockHashes): m_blockHashes(std::move(_blockHashes)) {}
 
-	std::map<Block const*, uint64_t> m_blockHashes;
-	std::map<uint64_t, std::vector<FunctionDefinition const*>> m_candidates;
+	util::FlatHashMap<Block const*, uint64_t> m_blockHashes;
+	util::FlatHashMap<uint64_t, std::vector<FunctionDefinition const*>> m_candidates;
 	std::map<YulString, FunctionDefinition const*> m_duplicates;
 };
 
@@ -35,8 +35,86 @@ using namespace solidity::yul;
 using namespace solidity::util;
 using namespace solidity::langutil;
 
+namespace
+{
+
+/**
+ * Checks whether the AST contains any expression the splitter would outline,
+ * i.e. whether it is not in split form already. Mirrors the traversal of
+ * ExpressionSplitter, in particular loop conditions and literal builtin
+ * arguments are not visited.
+ */
+class ContainsComplexExpression: public ASTWalker
+{
+public:
+	static bool check(Dialect const& _dialect, Block const& _ast)
+	{
+		ContainsComplexExpression checker(_dialect);
+		checker(_ast);
+		return checker.m_found;
+	}
+
+	using ASTWalker::operator();
+	void operator()(FunctionCall const& _funCall) override
+	{
+		BuiltinFunction const* builtin = m_dialect.builtin(_funCall.functionName.name);
+
+		for (size_t i = 0; i < _funCall.arguments.size(); ++i)
+			if (!builtin || !builtin->literalArgument(i))
+				checkExpression(_funCall.arguments[i]);
+	}
+	void operator()(If const& _if) override
+	{
+		checkExpression(*_if.condition);
+		(*this)(_if.body);
+	}
+	void operator()(Switch const& _switch) override
+	{
+		checkExpression(*_switch.expression);
+		for (auto const& _case: _switch.cases)
+			(*this)(_case.body);
+	}
+	void operator()(ForLoop const& _loop) override
+	{
+		(*this)(_loop.pre);
+		// The condition is not visited because expressions cannot be split there.
+		(*this)(_loop.post);
+		(*this)(_loop.body);
+	}
+	void visit(Statement const& _statement) override
+	{
+		if (!m_found)
+			ASTWalker::visit(_statement);
+	}
+	void visit(Expression const& _expression) override
+	{
+		if (!m_found)
+			ASTWalker::visit(_expression);
+	}
+
+private:
+	explicit ContainsComplexExpression(Dialect const& _dialect): m_dialect(_dialect) {}
+
+	/// Records whether @a _expr would be outlined by the splitter and recurses via visit().
+	void checkExpression(Expression const& _expr)
+	{
+		if (std::holds_alternative<Identifier>(_expr))
+			return;
+		m_found = true;
+	}
+
+	Dialect const& m_dialect;
+	bool m_found = false;
+};
+
+}
+
 void ExpressionSplitter::run(OptimiserStepContext& _context, Block& _ast)
 {
+	// Skip the rewriting walk and the type info collection if the code is in split
+	// form already, e.g. because the last join is several steps in the past.
+	if (!ContainsComplexExpression::check(_context.dialect, _ast))
+		return;
 	TypeInfo typeInfo(_context.dialect, _ast);
 	ExpressionSplitter{_context.dialect, _context.dispenser, typeInfo}(_ast);
 }
@@ -53,10 +53,11 @@ void FullInliner::run(OptimiserStepContext& _context, Block& _ast)
 
 FullInliner::FullInliner(Block& _ast, NameDispenser& _dispenser, Dialect const& _dialect):
 	m_ast(_ast),
-	m_recursiveFunctions(CallGraphGenerator::callGraph(_ast).recursiveFunctions()),
+	m_initialCallGraph(CallGraphGenerator::callGraph(_ast)),
 	m_nameDispenser(_dispenser),
 	m_dialect(_dialect)
 {
+	m_recursiveFunctions = m_initialCallGraph.recursiveFunctions();
 
 	// Determine constants
 	SSAValueTracker tracker;
@@ -104,7 +105,11 @@ void FullInliner::run(Pass _pass)
 	// function name) order.
 	// We use stable_sort below to keep the inlining order of two functions
 	// with the same depth.
-	std::map<YulString, size_t> depths = callDepths();
+	// The first pass runs on the same AST the constructor saw, so its call graph can
+	// be reused; later passes have to recompute it after the inlining already done.
+	std::map<YulString, size_t> depths = callDepths(
+		m_pass == Pass::InlineTiny ? m_initialCallGraph : CallGraphGenerator::callGraph(m_ast)
+	);
 	std::vector<FunctionDefinition*> functions;
 	for (auto& statement: m_ast.statements)
 		if (std::holds_alternative<FunctionDefinition>(statement))
@@ -118,7 +123,10 @@ void FullInliner::run(Pass _pass)
 	for (FunctionDefinition* fun: functions)
 	{
 		handleBlock(fun->name, fun->body);
-		updateCodeSize(*fun);
+		// The tentative updates during inlining only approximate the size, so recompute
+		// it exactly - but only for functions that actually had something inlined into them.
+		if (m_dirtyFunctions.erase(fun->name))
+			updateCodeSize(*fun);
 	}
 
 	for (auto& statement: m_ast.statements)
@@ -126,9 +134,9 @@ void FullInliner::run(Pass _pass)
 			handleBlock({}, std::get<Block>(statement));
 }
 
-std::map<YulString, size_t> FullInliner::callDepths() const
+std::map<YulString, size_t> FullInliner::callDepths(CallGraph _callGraph) const
 {
-	CallGraph cg = CallGraphGenerator::callGraph(m_ast);
+	CallGraph cg = std::move(_callGraph);
 	cg.functionCalls.erase(""_yulstring);
 
 	// Remove calls to builtin functions.
@@ -240,6 +248,8 @@ bool FullInliner::shallInline(FunctionCall const& _funCall, YulString _callSite)
 void FullInliner::tentativelyUpdateCodeSize(YulString _function, YulString _callSite)
 {
 	m_functionSizes.at(_callSite) += m_functionSizes.at(_function);
+	m_dirtyFunctions.insert(_callSite);
+	m_recursionCache.erase(_callSite);
 }
 
 void FullInliner::updateCodeSize(FunctionDefinition const& _fun)
@@ -254,8 +264,13 @@ void FullInliner::handleBlock(YulString _currentFunctionName, Block& _block)
 
 bool FullInliner::recursive(FunctionDefinition const& _fun) const
 {
-	std::map<YulString, size_t> references = ReferencesCounter::countReferences(_fun);
-	return references[_fun.name] > 0;
+	auto it = m_recursionCache.find(_fun.name);
+	if (it == m_recursionCache.end())
+	{
+		std::map<YulString, size_t> references = ReferencesCounter::countReferences(_fun);
+		it = m_recursionCache.emplace(_fun.name, references[_fun.name] > 0).first;
+	}
+	return it->second;
 }
 
 void InlineModifier::operator()(Block& _block)
@@ -24,6 +24,7 @@
 
 #include <libyul/optimiser/ASTCopier.h>
 #include <libyul/optimiser/ASTWalker.h>
+#include <libyul/optimiser/CallGraphGenerator.h>
 #include <libyul/optimiser/NameDispenser.h>
 #include <libyul/optimiser/OptimiserStep.h>
 #include <libyul/Exceptions.h>
@@ -97,8 +98,9 @@ private:
 	void run(Pass _pass);
 
 	/// @returns a map containing the maximum depths of a call chain starting at each
-	/// function. For recursive functions, the value is one larger than for all others.
-	std::map<YulString, size_t> callDepths() const;
+	/// function, based on the call graph @a _callGraph. For recursive functions, the
+	/// value is one larger than for all others.
+	std::map<YulString, size_t> callDepths(CallGraph _callGraph) const;
 
 	void updateCodeSize(FunctionDefinition const& _fun);
 	void handleBlock(YulString _currentFunctionName, Block& _block);
@@ -120,6 +122,15 @@ private:
 	/// Variables that are constants (used for inlining heuristic)
 	std::set<YulString> m_constants;
 	std::map<YulString, size_t> m_functionSizes;
+	/// Functions whose body changed since their entry in @a m_functionSizes was last
+	/// recomputed exactly, i.e. functions something was inlined into.
+	std::set<YulString> m_dirtyFunctions;
+	/// Call graph as of construction, reused for the ordering of the first pass
+	/// before any inlining has modified the AST.
+	CallGraph m_initialCallGraph;
+	/// Cached results of recursive(), invalidated whenever something is inlined
+	/// into the function.
+	mutable std::map<YulString, bool> m_recursionCache;
 	NameDispenser& m_nameDispenser;
 	Dialect const& m_dialect;
 };
@@ -65,15 +65,33 @@ void FunctionSpecializer::operator()(FunctionCall& _f)
 	if (ranges::any_of(arguments, [](auto& _a) { return _a.has_value(); }))
 	{
 		YulString oldName = std::move(_f.functionName.name);
-		auto newName = m_nameDispenser.newName(oldName);
+		std::vector<bool> retainedArguments = applyMap(arguments, [](auto& _a) { return !_a; });
 
-		m_oldToNewMap[oldName].emplace_back(std::make_pair(newName, arguments));
+		// Calls with the same literal arguments share one specialization per distinct
+		// argument tuple, so repeated calls do not multiply the code size.
+		ArgumentTuple key{oldName, applyMap(
+			arguments,
+			[](std::optional<Expression> const& _a) -> std::optional<std::tuple<LiteralKind, YulString, YulString>>
+			{
+				if (!_a)
+					return std::nullopt;
+				Literal const& literal = std::get<Literal>(*_a);
+				return std::make_tuple(literal.kind, literal.value, literal.type);
+			}
+		)};
+
+		YulString newName;
+		if (YulString const* cachedName = util::valueOrNullptr(m_specializations, key))
+			newName = *cachedName;
+		else
+		{
+			newName = m_nameDispenser.newName(oldName);
+			m_specializations[std::move(key)] = newName;
+			m_oldToNewMap[oldName].emplace_back(std::make_pair(newName, std::move(arguments)));
+		}
 
 		_f.functionName.name = newName;
-		_f.arguments = util::filter(
-			_f.arguments,
-			applyMap(arguments, [](auto& _a) { return !_a; })
-		);
+		_f.arguments = util::filter(_f.arguments, retainedArguments);
 	}
 }
 
@@ -27,6 +27,7 @@
 
 #include <map>
 #include <optional>
+#include <tuple>
 #include <vector>
 
 namespace solidity::yul
@@ -47,6 +48,9 @@ namespace solidity::yul
  * Other optimization steps will be able to make more simplifications to the function. The
  * optimization step is mainly useful for functions that would not be inlined.
  *
+ * Calls that agree on all their literal arguments share a single specialization, so repeated
+ * calls with the same constants do not increase the code size further.
+ *
  * Prerequisites: Disambiguator, FunctionHoister
  *
  * LiteralRematerialiser is recommended as a prerequisite, even though it's not required for
@@ -100,9 +104,16 @@ private:
 		FunctionSpecializer::LiteralArguments _arguments
 	);
 
+	/// A function name together with a comparable representation of the literal arguments of a
+	/// call to it (kind, value and type per specialized argument, nullopt for the rest).
+	using ArgumentTuple = std::pair<YulString, std::vector<std::optional<std::tuple<LiteralKind, YulString, YulString>>>>;
+
 	/// A mapping between the old function name and a pair of new function name and its arguments.
 	/// Note that at least one of the argument will have a literal value.
 	std::map<YulString, std::vector<std::pair<YulString, LiteralArguments>>> m_oldToNewMap;
+	/// The specialization created for each distinct argument tuple. Calls that agree on their
+	/// literal arguments share it instead of each getting their own clone of the function.
+	std::map<ArgumentTuple, YulString> m_specializations;
 	/// We skip specializing recursive functions. Need backtracking to properly deal with them.
 	std::set<YulString> const m_recursiveFunctions;
 
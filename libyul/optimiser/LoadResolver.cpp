@@ -46,7 +46,7 @@ void LoadResolver::run(OptimiserStepContext& _context, Block& _ast)
 	bool containsMSize = MSizeFinder::containsMSize(_context.dialect, _ast);
 	LoadResolver{
 		_context.dialect,
-		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast)),
+		functionSideEffects(_context, _ast),
 		containsMSize,
 		_context.expectedExecutionsPerDeployment
 	}(_ast);
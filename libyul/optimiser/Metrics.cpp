@@ -20,6 +20,7 @@
 
 #include <libyul/optimiser/Metrics.h>
 #include <libyul/optimiser/OptimizerUtilities.h>
+#include <libyul/optimiser/PreorderTraversal.h>
 #include <libyul/backends/evm/EVMDialect.h>
 
 #include <libyul/AST.h>
@@ -34,94 +35,95 @@ using namespace solidity;
 using namespace solidity::yul;
 using namespace solidity::util;
 
-size_t CodeWeights::costOf(Statement const& _statement) const
-{
-	if (std::holds_alternative<ExpressionStatement>(_statement))
-		return expressionStatementCost;
-	else if (std::holds_alternative<Assignment>(_statement))
-		return assignmentCost;
-	else if (std::holds_alternative<VariableDeclaration>(_statement))
-		return variableDeclarationCost;
-	else if (std::holds_alternative<FunctionDefinition>(_statement))
-		return functionDefinitionCost;
-	else if (std::holds_alternative<If>(_statement))
-		return ifCost;
-	else if (std::holds_alternative<Switch>(_statement))
-		return switchCost + caseCost * std::get<Switch>(_statement).cases.size();
-	else if (std::holds_alternative<ForLoop>(_statement))
-		return forLoopCost;
-	else if (std::holds_alternative<Break>(_statement))
-		return breakCost;
-	else if (std::holds_alternative<Continue>(_statement))
-		return continueCost;
-	else if (std::holds_alternative<Leave>(_statement))
-		return leaveCost;
-	else if (std::holds_alternative<Block>(_statement))
-		return blockCost;
-	else
-		yulAssert(false, "If you add a new statement type, you must update CodeWeights.");
-}
-
-size_t CodeWeights::costOf(Expression const& _expression) const
-{
-	if (std::holds_alternative<FunctionCall>(_expression))
-		return functionCallCost;
-	else if (std::holds_alternative<Identifier>(_expression))
-		return identifierCost;
-	else if (Literal const* literal = std::get_if<Literal>(&_expression))
+namespace
+{
+
+template<typename NodeType>
+size_t costOfNode(CodeWeights const& _weights, NodeType const& _node)
+{
+	if constexpr (std::is_same_v<NodeType, ExpressionStatement>)
+		return _weights.expressionStatementCost;
+	else if constexpr (std::is_same_v<NodeType, Assignment>)
+		return _weights.assignmentCost;
+	else if constexpr (std::is_same_v<NodeType, VariableDeclaration>)
+		return _weights.variableDeclarationCost;
+	else if constexpr (std::is_same_v<NodeType, FunctionDefinition>)
+		return _weights.functionDefinitionCost;
+	else if constexpr (std::is_same_v<NodeType, If>)
+		return _weights.ifCost;
+	else if constexpr (std::is_same_v<NodeType, Switch>)
+		return _weights.switchCost + _weights.caseCost * _node.cases.size();
+	else if constexpr (std::is_same_v<NodeType, ForLoop>)
+		return _weights.forLoopCost;
+	else if constexpr (std::is_same_v<NodeType, Break>)
+		return _weights.breakCost;
+	else if constexpr (std::is_same_v<NodeType, Continue>)
+		return _weights.continueCost;
+	else if constexpr (std::is_same_v<NodeType, Leave>)
+		return _weights.leaveCost;
+	else if constexpr (std::is_same_v<NodeType, Block>)
+		return _weights.blockCost;
+	else if constexpr (std::is_same_v<NodeType, FunctionCall>)
+		return _weights.functionCallCost;
+	else if constexpr (std::is_same_v<NodeType, Identifier>)
+		return _weights.identifierCost;
+	else if constexpr (std::is_same_v<NodeType, Literal>)
 	{
 		// Avoid strings because they could be longer than 32 bytes.
-		if (literal->kind != LiteralKind::String && valueOfLiteral(*literal) == 0)
-			return literalZeroCost;
+		if (_node.kind != LiteralKind::String && valueOfLiteral(_node) == 0)
+			return _weights.literalZeroCost;
 		else
-			return literalCost;
+			return _weights.literalCost;
 	}
 	else
-		yulAssert(false, "If you add a new expression type, you must update CodeWeights.");
+		static_assert(sizeof(NodeType) == 0, "If you add a new AST node type, you must update CodeWeights.");
 }
 
-
-size_t CodeSize::codeSize(Statement const& _statement, CodeWeights const& _weights)
+template<typename Entry>
+size_t computeCodeSize(Entry const& _entry, bool _ignoreFunctions, CodeWeights const& _weights)
 {
-	CodeSize cs(true, _weights);
-	cs.visit(_statement);
-	return cs.m_size;
+	size_t size = 0;
+	forEachPreorder(_entry, [&](auto const& _node) {
+		if constexpr (std::is_same_v<std::decay_t<decltype(_node)>, FunctionDefinition>)
+			if (_ignoreFunctions)
+				return false;
+		size += costOfNode(_weights, _node);
+		return true;
+	});
+	return size;
 }
 
-size_t CodeSize::codeSize(Expression const& _expression, CodeWeights const& _weights)
+}
+
+size_t CodeWeights::costOf(Statement const& _statement) const
 {
-	CodeSize cs(true, _weights);
-	cs.visit(_expression);
-	return cs.m_size;
+	return std::visit([this](auto const& _node) { return costOfNode(*this, _node); }, _statement);
 }
 
-size_t CodeSize::codeSize(Block const& _block, CodeWeights const& _weights)
+size_t CodeWeights::costOf(Expression const& _expression) const
 {
-	CodeSize cs(true, _weights);
-	cs(_block);
-	return cs.m_size;
+	return std::visit([this](auto const& _node) { return costOfNode(*this, _node); }, _expression);
 }
 
-size_t CodeSize::codeSizeIncludingFunctions(Block const& _block, CodeWeights const& _weights)
+
+size_t CodeSize::codeSize(Statement const& _statement, CodeWeights const& _weights)
 {
-	CodeSize cs(false, _weights);
-	cs(_block);
-	return cs.m_size;
+	return computeCodeSize(_statement, true, _weights);
 }
 
-void CodeSize::visit(Statement const& _statement)
+size_t CodeSize::codeSize(Expression const& _expression, CodeWeights const& _weights)
 {
-	if (std::holds_alternative<FunctionDefinition>(_statement) && m_ignoreFunctions)
-		return;
+	return computeCodeSize(_expression, true, _weights);
+}
 
-	m_size += m_weights.costOf(_statement);
-	ASTWalker::visit(_statement);
+size_t CodeSize::codeSize(Block const& _block, CodeWeights const& _weights)
+{
+	return computeCodeSize(_block, true, _weights);
 }
 
-void CodeSize::visit(Expression const& _expression)
+size_t CodeSize::codeSizeIncludingFunctions(Block const& _block, CodeWeights const& _weights)
 {
-	m_size += m_weights.costOf(_expression);
-	ASTWalker::visit(_expression);
+	return computeCodeSize(_block, false, _weights);
 }
 
 
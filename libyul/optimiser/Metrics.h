@@ -81,27 +81,17 @@ struct CodeWeights
  * If you want to know the size of a function, you have to invoke this on its body.
  *
  * The cost of each statement and expression type is configurable via CodeWeights.
+ *
+ * Traverses the AST through the statically dispatched preorder traversal instead of
+ * an ASTWalker, since it is invoked very often and only matches on node types.
  */
-class CodeSize: public ASTWalker
+class CodeSize
 {
 public:
 	static size_t codeSize(Statement const& _statement, CodeWeights const& _weights = {});
 	static size_t codeSize(Expression const& _expression, CodeWeights const& _weights = {});
 	static size_t codeSize(Block const& _block, CodeWeights const& _weights = {});
 	static size_t codeSizeIncludingFunctions(Block const& _block, CodeWeights const& _weights = {});
-
-private:
-	CodeSize(bool _ignoreFunctions = true, CodeWeights const& _weights = {}):
-		m_ignoreFunctions(_ignoreFunctions),
-		m_weights(_weights) {}
-
-	void visit(Statement const& _statement) override;
-	void visit(Expression const& _expression) override;
-
-private:
-	bool m_ignoreFunctions;
-	size_t m_size = 0;
-	CodeWeights m_weights;
 };
 
 /**
@@ -43,17 +43,36 @@ NameDispenser::NameDispenser(Dialect const& _dialect, std::set<YulString> _usedN
 	m_dialect(_dialect),
 	m_usedNames(std::move(_usedNames))
 {
+	for (YulString const& name: m_usedNames)
+		m_usedNameStrings.insert(name.str());
 }
 
 YulString NameDispenser::newName(YulString _nameHint)
 {
 	YulString name = _nameHint;
-	while (illegalName(name))
+	if (illegalName(name))
 	{
-		m_counter++;
-		name = YulString(_nameHint.str() + "_" + std::to_string(m_counter));
+		// Probe candidates against the string index first, reusing one buffer, so that
+		// only the finally chosen name is constructed (and thereby interned) as a YulString.
+		std::string candidate = _nameHint.str();
+		size_t const hintLength = candidate.size();
+		do
+		{
+			do
+			{
+				m_counter++;
+				candidate.resize(hintLength);
+				candidate += '_';
+				candidate += std::to_string(m_counter);
+			}
+			while (m_usedNameStrings.count(std::string_view{candidate}));
+			name = YulString(candidate);
+		}
+		// Re-check the interned name; this only loops when the candidate happens to be a
+		// keyword or an identifier reserved by the dialect.
+		while (illegalName(name));
 	}
-	m_usedNames.emplace(name);
+	markUsed(name);
 	return name;
 }
 
@@ -65,5 +84,8 @@ bool NameDispenser::illegalName(YulString _name)
 void NameDispenser::reset(Block const& _ast)
 {
 	m_usedNames = NameCollector(_ast).names() + m_reservedNames;
+	m_usedNameStrings.clear();
+	for (YulString const& name: m_usedNames)
+		m_usedNameStrings.insert(name.str());
 	m_counter = 0;
 }
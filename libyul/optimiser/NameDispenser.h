@@ -25,6 +25,8 @@
 #include <libyul/YulString.h>
 
 #include <set>
+#include <string_view>
+#include <unordered_set>
 
 namespace solidity::yul
 {
@@ -49,7 +51,11 @@ public:
 
 	/// Mark @a _name as used, i.e. the dispenser's newName function will not
 	/// return it.
-	void markUsed(YulString _name) { m_usedNames.insert(_name); }
+	void markUsed(YulString _name)
+	{
+		m_usedNames.insert(_name);
+		m_usedNameStrings.insert(_name.str());
+	}
 
 	std::set<YulString> const& usedNames() { return m_usedNames; }
 
@@ -63,6 +69,10 @@ public:
 private:
 	Dialect const& m_dialect;
 	std::set<YulString> m_usedNames;
+	/// The same names as `m_usedNames`, as views into the interned strings. Lets newName
+	/// probe candidate names without constructing (and thereby interning) a YulString
+	/// for every attempt.
+	std::unordered_set<std::string_view> m_usedNameStrings;
 	std::set<YulString> m_reservedNames;
 	size_t m_counter = 0;
 };
@@ -31,6 +31,8 @@ struct Dialect;
 struct Block;
 class YulString;
 class NameDispenser;
+class ControlFlowSideEffectsCache;
+class SideEffectsCache;
 
 struct OptimiserStepContext
 {
@@ -39,6 +41,12 @@ struct OptimiserStepContext
 	std::set<YulString> const& reservedIdentifiers;
 	/// The value nullopt represents creation code
 	std::optional<size_t> expectedExecutionsPerDeployment;
+	/// Cache for control-flow side effects of user-defined functions, shared between
+	/// steps and invalidated automatically when the code changes. Can be unset.
+	ControlFlowSideEffectsCache* controlFlowSideEffectsCache = nullptr;
+	/// Cache for the propagated data side effects of user-defined functions, shared
+	/// between steps and invalidated automatically when the code changes. Can be unset.
+	SideEffectsCache* sideEffectsCache = nullptr;
 };
 
 
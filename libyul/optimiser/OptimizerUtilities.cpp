@@ -21,8 +21,11 @@
 
 #include <libyul/optimiser/OptimizerUtilities.h>
 
+#include <libyul/optimiser/OptimiserStep.h>
+#include <libyul/optimiser/Semantics.h>
 #include <libyul/backends/evm/EVMDialect.h>
 
+#include <libyul/ControlFlowSideEffectsCollector.h>
 #include <libyul/Dialect.h>
 #include <libyul/AST.h>
 
@@ -36,6 +39,26 @@ using namespace solidity::langutil;
 using namespace solidity::util;
 using namespace solidity::yul;
 
+std::map<YulString, ControlFlowSideEffects> yul::functionControlFlowSideEffects(
+	OptimiserStepContext& _context,
+	Block const& _ast
+)
+{
+	if (_context.controlFlowSideEffectsCache)
+		return _context.controlFlowSideEffectsCache->functionSideEffectsNamed(_context.dialect, _ast);
+	return ControlFlowSideEffectsCollector{_context.dialect, _ast}.functionSideEffectsNamed();
+}
+
+std::map<YulString, SideEffects> yul::functionSideEffects(
+	OptimiserStepContext const& _context,
+	Block const& _ast
+)
+{
+	if (_context.sideEffectsCache)
+		return _context.sideEffectsCache->functionSideEffects(_context.dialect, _ast);
+	return SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast));
+}
+
 void yul::removeEmptyBlocks(Block& _block)
 {
 	auto isEmptyBlock = [](Statement const& _st) -> bool {
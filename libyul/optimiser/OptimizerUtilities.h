@@ -23,11 +23,14 @@
 
 #include <libsolutil/Common.h>
 #include <libyul/ASTForward.h>
+#include <libyul/ControlFlowSideEffects.h>
 #include <libyul/Dialect.h>
+#include <libyul/SideEffects.h>
 #include <libyul/YulString.h>
 #include <libyul/optimiser/ASTWalker.h>
 #include <liblangutil/EVMVersion.h>
 
+#include <map>
 #include <optional>
 
 namespace solidity::evmasm
@@ -38,6 +41,22 @@ enum class Instruction: uint8_t;
 namespace solidity::yul
 {
 
+struct OptimiserStepContext;
+
+/// @returns the control-flow side effects of all functions defined in @a _ast by name,
+/// consulting the cache in @a _context if one is present.
+std::map<YulString, ControlFlowSideEffects> functionControlFlowSideEffects(
+	OptimiserStepContext& _context,
+	Block const& _ast
+);
+
+/// @returns the propagated data side effects of all functions defined in @a _ast by
+/// name, consulting the cache in @a _context if one is present.
+std::map<YulString, SideEffects> functionSideEffects(
+	OptimiserStepContext const& _context,
+	Block const& _ast
+);
+
 /// Removes statements that are just empty blocks (non-recursive).
 /// If this is run on the outermost block, the FunctionGrouper should be run afterwards to keep
 /// the canonical form.
@@ -0,0 +1,120 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Statically dispatched preorder AST traversal.
+ */
+
+#pragma once
+
+#include <libyul/AST.h>
+
+#include <type_traits>
+#include <variant>
+
+namespace solidity::yul
+{
+
+namespace detail
+{
+
+template<typename Visitor>
+void traversePreorder(Block const& _block, Visitor& _visitor);
+
+template<typename Visitor>
+void traversePreorder(Expression const& _expression, Visitor& _visitor)
+{
+	std::visit([&](auto const& _node) {
+		using NodeType = std::decay_t<decltype(_node)>;
+		if (!_visitor(_node))
+			return;
+		if constexpr (std::is_same_v<NodeType, FunctionCall>)
+			// Does not visit _node.functionName on purpose, like the ASTWalker.
+			for (auto argument = _node.arguments.rbegin(); argument != _node.arguments.rend(); ++argument)
+				traversePreorder(*argument, _visitor);
+	}, _expression);
+}
+
+template<typename Visitor>
+void traversePreorder(Statement const& _statement, Visitor& _visitor)
+{
+	std::visit([&](auto const& _node) {
+		using NodeType = std::decay_t<decltype(_node)>;
+		if (!_visitor(_node))
+			return;
+		if constexpr (std::is_same_v<NodeType, ExpressionStatement>)
+			traversePreorder(_node.expression, _visitor);
+		else if constexpr (std::is_same_v<NodeType, Assignment>)
+			traversePreorder(*_node.value, _visitor);
+		else if constexpr (std::is_same_v<NodeType, VariableDeclaration>)
+		{
+			if (_node.value)
+				traversePreorder(*_node.value, _visitor);
+		}
+		else if constexpr (std::is_same_v<NodeType, If>)
+		{
+			traversePreorder(*_node.condition, _visitor);
+			traversePreorder(_node.body, _visitor);
+		}
+		else if constexpr (std::is_same_v<NodeType, Switch>)
+		{
+			traversePreorder(*_node.expression, _visitor);
+			for (Case const& _case: _node.cases)
+				traversePreorder(_case.body, _visitor);
+		}
+		else if constexpr (std::is_same_v<NodeType, FunctionDefinition>)
+			traversePreorder(_node.body, _visitor);
+		else if constexpr (std::is_same_v<NodeType, ForLoop>)
+		{
+			traversePreorder(_node.pre, _visitor);
+			traversePreorder(*_node.condition, _visitor);
+			traversePreorder(_node.body, _visitor);
+			traversePreorder(_node.post, _visitor);
+		}
+		else if constexpr (std::is_same_v<NodeType, Block>)
+			for (Statement const& statement: _node.statements)
+				traversePreorder(statement, _visitor);
+	}, _statement);
+}
+
+template<typename Visitor>
+void traversePreorder(Block const& _block, Visitor& _visitor)
+{
+	for (Statement const& statement: _block.statements)
+		traversePreorder(statement, _visitor);
+}
+
+}
+
+/// Preorder traversal without virtual dispatch.
+///
+/// Calls @a _visitor with the concrete node type of every statement and expression that
+/// the ASTWalker would dispatch through its visit functions and descends into bodies and
+/// branches in the same order. Switch case values and the variables on the left-hand side
+/// of assignments are not visited. If the visitor returns false, the subtree below the
+/// node is skipped.
+///
+/// Since the visitor is known at compile time, each node costs a single variant dispatch
+/// with inlined handlers instead of the two virtual calls of a walker subclass. Intended
+/// for read-only passes that only match on node types, e.g. the code metrics.
+template<typename Entry, typename Visitor>
+void forEachPreorder(Entry const& _entry, Visitor&& _visitor)
+{
+	detail::traversePreorder(_entry, _visitor);
+}
+
+}
@@ -37,6 +37,39 @@ using namespace solidity::langutil;
 namespace
 {
 
+/**
+ * Collects the names of all functions that contain at least one assignment, including
+ * functions that only contain such a function nested inside. All other functions are
+ * already in SSA form and can be skipped by the stages of the transform.
+ */
+class FunctionsWithAssignments: public ASTWalker
+{
+public:
+	static std::set<YulString> run(Block const& _ast)
+	{
+		FunctionsWithAssignments collector;
+		collector(_ast);
+		return std::move(collector.m_functions);
+	}
+
+	using ASTWalker::operator();
+	void operator()(FunctionDefinition const& _function) override
+	{
+		m_functionStack.emplace_back(_function.name);
+		ASTWalker::operator()(_function);
+		m_functionStack.pop_back();
+	}
+	void operator()(Assignment const& _assignment) override
+	{
+		m_functions.insert(m_functionStack.begin(), m_functionStack.end());
+		ASTWalker::operator()(_assignment);
+	}
+
+private:
+	std::vector<YulString> m_functionStack;
+	std::set<YulString> m_functions;
+};
+
 /**
  * First step of SSA transform: Introduces new SSA variables for each assignment or
  * declaration of a variable to be replaced.
@@ -47,18 +80,26 @@ public:
 	explicit IntroduceSSA(
 		NameDispenser& _nameDispenser,
 		std::set<YulString> const& _variablesToReplace,
+		std::set<YulString> const& _functionsWithAssignments,
 		TypeInfo& _typeInfo
 	):
 		m_nameDispenser(_nameDispenser),
 		m_variablesToReplace(_variablesToReplace),
+		m_functionsWithAssignments(_functionsWithAssignments),
 		m_typeInfo(_typeInfo)
 	{ }
 
+	void operator()(FunctionDefinition& _function) override
+	{
+		if (m_functionsWithAssignments.count(_function.name))
+			ASTModifier::operator()(_function);
+	}
 	void operator()(Block& _block) override;
 
 private:
 	NameDispenser& m_nameDispenser;
 	std::set<YulString> const& m_variablesToReplace;
+	std::set<YulString> const& m_functionsWithAssignments;
 	TypeInfo const& m_typeInfo;
 };
 
@@ -149,10 +190,12 @@ public:
 	explicit IntroduceControlFlowSSA(
 		NameDispenser& _nameDispenser,
 		std::set<YulString> const& _variablesToReplace,
+		std::set<YulString> const& _functionsWithAssignments,
 		TypeInfo const& _typeInfo
 	):
 		m_nameDispenser(_nameDispenser),
 		m_variablesToReplace(_variablesToReplace),
+		m_functionsWithAssignments(_functionsWithAssignments),
 		m_typeInfo(_typeInfo)
 	{ }
 
@@ -164,6 +207,7 @@ public:
 private:
 	NameDispenser& m_nameDispenser;
 	std::set<YulString> const& m_variablesToReplace;
+	std::set<YulString> const& m_functionsWithAssignments;
 	/// Variables (that are to be replaced) currently in scope.
 	std::set<YulString> m_variablesInScope;
 	/// Set of variables that do not have a specific value.
@@ -173,6 +217,9 @@ private:
 
 void IntroduceControlFlowSSA::operator()(FunctionDefinition& _function)
 {
+	if (!m_functionsWithAssignments.count(_function.name))
+		return;
+
 	std::set<YulString> varsInScope;
 	std::swap(varsInScope, m_variablesInScope);
 	std::set<YulString> toReassign;
@@ -280,10 +327,19 @@ void IntroduceControlFlowSSA::operator()(Block& _block)
 class PropagateValues: public ASTModifier
 {
 public:
-	explicit PropagateValues(std::set<YulString> const& _variablesToReplace):
-		m_variablesToReplace(_variablesToReplace)
+	explicit PropagateValues(
+		std::set<YulString> const& _variablesToReplace,
+		std::set<YulString> const& _functionsWithAssignments
+	):
+		m_variablesToReplace(_variablesToReplace),
+		m_functionsWithAssignments(_functionsWithAssignments)
 	{ }
 
+	void operator()(FunctionDefinition& _function) override
+	{
+		if (m_functionsWithAssignments.count(_function.name))
+			ASTModifier::operator()(_function);
+	}
 	void operator()(Identifier& _identifier) override;
 	void operator()(VariableDeclaration& _varDecl) override;
 	void operator()(Assignment& _assignment) override;
@@ -294,6 +350,7 @@ private:
 	/// This is a set of all variables that are assigned to anywhere in the code.
 	/// Variables that are only declared but never re-assigned are not touched.
 	std::set<YulString> const& m_variablesToReplace;
+	std::set<YulString> const& m_functionsWithAssignments;
 	std::map<YulString, YulString> m_currentVariableValues;
 	std::set<YulString> m_clearAtEndOfBlock;
 };
@@ -378,11 +435,15 @@ void PropagateValues::operator()(Block& _block)
 
 void SSATransform::run(OptimiserStepContext& _context, Block& _ast)
 {
-	TypeInfo typeInfo(_context.dialect, _ast);
 	std::set<YulString> assignedVariables = assignedVariableNames(_ast);
-	IntroduceSSA{_context.dispenser, assignedVariables, typeInfo}(_ast);
-	IntroduceControlFlowSSA{_context.dispenser, assignedVariables, typeInfo}(_ast);
-	PropagateValues{assignedVariables}(_ast);
+	// Code without assignments is already in SSA form.
+	if (assignedVariables.empty())
+		return;
+	std::set<YulString> functionsWithAssignments = FunctionsWithAssignments::run(_ast);
+	TypeInfo typeInfo(_context.dialect, _ast);
+	IntroduceSSA{_context.dispenser, assignedVariables, functionsWithAssignments, typeInfo}(_ast);
+	IntroduceControlFlowSSA{_context.dispenser, assignedVariables, functionsWithAssignments, typeInfo}(_ast);
+	PropagateValues{assignedVariables, functionsWithAssignments}(_ast);
 }
 
 
@@ -84,6 +84,10 @@ class NameDispenser;
  * The last stage replaces references to variables that are assigned to somewhere in the
  * code by their current SSA variable.
  *
+ * Functions that do not contain any assignments are already in SSA form and are left
+ * untouched by all stages, so repeated runs only pay for the functions that still
+ * contain assignments.
+ *
  * TODO Which transforms are required to keep this idempotent?
  *
  * Prerequisite: Disambiguator, ForLoopInitRewriter.
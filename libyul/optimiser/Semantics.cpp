@@ -21,7 +21,9 @@
 
 #include <libyul/optimiser/Semantics.h>
 
+#include <libyul/optimiser/BlockHasher.h>
 #include <libyul/optimiser/OptimizerUtilities.h>
+#include <libyul/optimiser/PreorderTraversal.h>
 #include <libyul/Exceptions.h>
 #include <libyul/AST.h>
 #include <libyul/Dialect.h>
@@ -88,9 +90,16 @@ void SideEffectsCollector::operator()(FunctionCall const& _functionCall)
 
 bool MSizeFinder::containsMSize(Dialect const& _dialect, Block const& _ast)
 {
-	MSizeFinder finder(_dialect);
-	finder(_ast);
-	return finder.m_msizeFound;
+	bool msizeFound = false;
+	forEachPreorder(_ast, [&](auto const& _node) {
+		if constexpr (std::is_same_v<std::decay_t<decltype(_node)>, FunctionCall>)
+			if (BuiltinFunction const* f = _dialect.builtin(_node.functionName.name))
+				if (f->isMSize)
+					msizeFound = true;
+		// Once found, there is no need to look at the remaining subtrees.
+		return !msizeFound;
+	});
+	return msizeFound;
 }
 
 bool MSizeFinder::containsMSize(Dialect const& _dialect, Object const& _object)
@@ -106,15 +115,6 @@ bool MSizeFinder::containsMSize(Dialect const& _dialect, Object const& _object)
 	return false;
 }
 
-void MSizeFinder::operator()(FunctionCall const& _functionCall)
-{
-	ASTWalker::operator()(_functionCall);
-
-	if (BuiltinFunction const* f = m_dialect.builtin(_functionCall.functionName.name))
-		if (f->isMSize)
-			m_msizeFound = true;
-}
-
 std::map<YulString, SideEffects> SideEffectsPropagator::sideEffects(
 	Dialect const& _dialect,
 	CallGraph const& _directCallGraph
@@ -161,6 +161,20 @@ std::map<YulString, SideEffects> SideEffectsPropagator::sideEffects(
 	return ret;
 }
 
+std::map<YulString, SideEffects> const& SideEffectsCache::functionSideEffects(
+	Dialect const& _dialect,
+	Block const& _ast
+)
+{
+	uint64_t fingerprint = ASTHasher::run(_ast);
+	if (m_fingerprint != fingerprint)
+	{
+		m_functionSideEffects = SideEffectsPropagator::sideEffects(_dialect, CallGraphGenerator::callGraph(_ast));
+		m_fingerprint = fingerprint;
+	}
+	return m_functionSideEffects;
+}
+
 MovableChecker::MovableChecker(Dialect const& _dialect, Expression const& _expression):
 	MovableChecker(_dialect)
 {
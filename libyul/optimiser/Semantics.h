@@ -27,6 +27,7 @@
 #include <libyul/optimiser/ASTWalker.h>
 #include <libyul/optimiser/CallGraphGenerator.h>
 
+#include <optional>
 #include <set>
 
 namespace solidity::yul
@@ -131,6 +132,31 @@ public:
 	);
 };
 
+/**
+ * Cache for the result of the SideEffectsPropagator, shared between optimiser steps
+ * via the OptimiserStepContext.
+ *
+ * The side effects are memoized together with a name-sensitive structural hash of the
+ * AST, so consecutive steps that did not rewrite the code share one computation of
+ * the call graph and the propagated effects. Any rewrite changes the hash and thus
+ * invalidates the cache automatically.
+ */
+class SideEffectsCache
+{
+public:
+	/// @returns the side effects of all user-defined functions in @a _ast by name,
+	/// recomputing them only if the code changed since the last call.
+	/// Requires unique function names.
+	std::map<YulString, SideEffects> const& functionSideEffects(
+		Dialect const& _dialect,
+		Block const& _ast
+	);
+
+private:
+	std::optional<uint64_t> m_fingerprint;
+	std::map<YulString, SideEffects> m_functionSideEffects;
+};
+
 /**
  * Class that can be used to find out if certain code contains the MSize instruction
  * or a verbatim bytecode builtin (which is always assumed that it could contain MSize).
@@ -140,19 +166,11 @@ public:
  *
  * The only safe way to determine this is by passing the full AST.
  */
-class MSizeFinder: public ASTWalker
+class MSizeFinder
 {
 public:
 	static bool containsMSize(Dialect const& _dialect, Block const& _ast);
 	static bool containsMSize(Dialect const& _dialect, Object const& _object);
-
-	using ASTWalker::operator();
-	void operator()(FunctionCall const& _funCall) override;
-
-private:
-	MSizeFinder(Dialect const& _dialect): m_dialect(_dialect) {}
-	Dialect const& m_dialect;
-	bool m_msizeFound = false;
 };
 
 /**
@@ -59,8 +59,21 @@ SimplificationRules::Rule const* SimplificationRules::findFirstMatch(
 	SimplificationRules& rules = *evmRules[version];
 	assertThrow(rules.isInitialized(), OptimizerException, "Rule list not properly initialized.");
 
-	for (auto const& rule: rules.m_rules[uint8_t(instruction->first)])
+	// Pattern::matches rejects function calls as direct arguments for every rule, since their
+	// side-effects could prevent arbitrary modifications of the code.
+	for (Expression const& argument: *instruction->second)
+		if (std::holds_alternative<FunctionCall>(argument))
+			return nullptr;
+
+	evmasm::SimplificationRulePrefilter expressionPrefilter =
+		prefilterFor(*instruction->second, _dialect, _ssaValues);
+	auto const& candidates = rules.m_rules[uint8_t(instruction->first)];
+	for (size_t ruleIndex = 0; ruleIndex < candidates.size(); ++ruleIndex)
 	{
+		if (!rules.m_rulePrefilters[uint8_t(instruction->first)][ruleIndex].canMatch(expressionPrefilter))
+			continue;
+
+		auto const& rule = candidates[ruleIndex];
 		rules.resetMatchGroups();
 		if (rule.pattern.matches(_expr, _dialect, _ssaValues))
 			if (!rule.feasible || rule.feasible())
@@ -95,6 +108,62 @@ void SimplificationRules::addRules(std::vector<Rule> const& _rules)
 void SimplificationRules::addRule(Rule const& _rule)
 {
 	m_rules[uint8_t(_rule.pattern.instruction())].push_back(_rule);
+	m_rulePrefilters[uint8_t(_rule.pattern.instruction())].push_back(prefilterFor(_rule.pattern));
+}
+
+evmasm::SimplificationRulePrefilter SimplificationRules::prefilterFor(Pattern const& _pattern)
+{
+	evmasm::SimplificationRulePrefilter prefilter;
+	std::vector<Pattern> const arguments = _pattern.arguments();
+	for (size_t argumentIndex = 0; argumentIndex < arguments.size(); ++argumentIndex)
+		switch (arguments[argumentIndex].kind())
+		{
+		case PatternKind::Any:
+			break;
+		case PatternKind::Constant:
+			prefilter.setArgumentClass(argumentIndex, evmasm::SimplificationRulePrefilter::constantClass);
+			break;
+		case PatternKind::Operation:
+			prefilter.setArgumentClass(
+				argumentIndex,
+				evmasm::SimplificationRulePrefilter::operationClass(arguments[argumentIndex].instruction())
+			);
+			break;
+		}
+	return prefilter;
+}
+
+evmasm::SimplificationRulePrefilter SimplificationRules::prefilterFor(
+	std::vector<Expression> const& _arguments,
+	Dialect const& _dialect,
+	std::function<AssignedValue const*(YulString)> const& _ssaValues
+)
+{
+	evmasm::SimplificationRulePrefilter prefilter;
+	for (size_t argumentIndex = 0; argumentIndex < _arguments.size(); ++argumentIndex)
+	{
+		// Resolve variables the same way Pattern::matches does for non-"Any" patterns.
+		Expression const* argument = &_arguments[argumentIndex];
+		if (std::holds_alternative<Identifier>(*argument))
+			if (AssignedValue const* value = _ssaValues(std::get<Identifier>(*argument).name))
+				if (value->value)
+					argument = value->value;
+
+		if (std::holds_alternative<Literal>(*argument))
+		{
+			if (std::get<Literal>(*argument).kind == LiteralKind::Number)
+				prefilter.setArgumentClass(argumentIndex, evmasm::SimplificationRulePrefilter::constantClass);
+			else
+				// Matched neither by constant nor by operation patterns.
+				prefilter.setArgumentClass(argumentIndex, evmasm::SimplificationRulePrefilter::customClassBase);
+		}
+		else if (auto instrAndArgs = instructionAndArguments(_dialect, *argument))
+			prefilter.setArgumentClass(
+				argumentIndex,
+				evmasm::SimplificationRulePrefilter::operationClass(instrAndArgs->first)
+			);
+	}
+	return prefilter;
 }
 
 SimplificationRules::SimplificationRules(std::optional<langutil::EVMVersion> _evmVersion)
@@ -128,7 +197,7 @@ yul::Pattern::Pattern(evmasm::Instruction _instruction, std::initializer_list<Pa
 {
 }
 
-void Pattern::setMatchGroup(unsigned _group, std::map<unsigned, Expression const*>& _matchGroups)
+void Pattern::setMatchGroup(unsigned _group, evmasm::SimplificationMatchGroups<Expression>& _matchGroups)
 {
 	m_matchGroup = _group;
 	m_matchGroups = &_matchGroups;
@@ -202,11 +271,9 @@ bool Pattern::matches(
 		// on the variables and not their values.
 		// The assumption is that CSE or local value numbering has been done prior to this step.
 
-		if (m_matchGroups->count(m_matchGroup))
+		if (Expression const* firstMatch = (*m_matchGroups)[m_matchGroup])
 		{
 			assertThrow(m_kind == PatternKind::Any, OptimizerException, "Match group repetition for non-any.");
-			Expression const* firstMatch = (*m_matchGroups)[m_matchGroup];
-			assertThrow(firstMatch, OptimizerException, "Match set but to null.");
 			assertThrow(
 				!std::holds_alternative<FunctionCall>(_expr) &&
 				!std::holds_alternative<FunctionCall>(*firstMatch),
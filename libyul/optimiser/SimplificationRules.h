@@ -76,10 +76,22 @@ private:
 	void addRules(std::vector<Rule> const& _rules);
 	void addRule(Rule const& _rule);
 
+	/// @returns the argument classification of @a _pattern for the rule prefilter.
+	static evmasm::SimplificationRulePrefilter prefilterFor(Pattern const& _pattern);
+	/// @returns the argument classification of an expression with arguments @a _arguments
+	/// for the rule prefilter.
+	static evmasm::SimplificationRulePrefilter prefilterFor(
+		std::vector<Expression> const& _arguments,
+		Dialect const& _dialect,
+		std::function<AssignedValue const*(YulString)> const& _ssaValues
+	);
+
 	void resetMatchGroups() { m_matchGroups.clear(); }
 
-	std::map<unsigned, Expression const*> m_matchGroups;
+	evmasm::SimplificationMatchGroups<Expression> m_matchGroups;
 	std::vector<evmasm::SimplificationRule<Pattern>> m_rules[256];
+	/// Argument classifications of the rules in @a m_rules, kept in the same order.
+	std::vector<evmasm::SimplificationRulePrefilter> m_rulePrefilters[256];
 };
 
 enum class PatternKind
@@ -114,7 +126,7 @@ public:
 	/// Sets this pattern to be part of the match group with the identifier @a _group.
 	/// Inside one rule, all patterns in the same match group have to match expressions from the
 	/// same expression equivalence class.
-	void setMatchGroup(unsigned _group, std::map<unsigned, Expression const*>& _matchGroups);
+	void setMatchGroup(unsigned _group, evmasm::SimplificationMatchGroups<Expression>& _matchGroups);
 	unsigned matchGroup() const { return m_matchGroup; }
 	bool matches(
 		Expression const& _expr,
@@ -123,6 +135,7 @@ public:
 	) const;
 
 	std::vector<Pattern> arguments() const { return m_arguments; }
+	PatternKind kind() const { return m_kind; }
 
 	/// @returns the data of the matched expression if this pattern is part of a match group.
 	u256 d() const;
@@ -141,7 +154,7 @@ private:
 	std::shared_ptr<u256> m_data; ///< Only valid if m_kind is Constant
 	std::vector<Pattern> m_arguments;
 	unsigned m_matchGroup = 0;
-	std::map<unsigned, Expression const*>* m_matchGroups = nullptr;
+	evmasm::SimplificationMatchGroups<Expression>* m_matchGroups = nullptr;
 };
 
 }
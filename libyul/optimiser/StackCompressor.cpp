@@ -266,9 +266,13 @@ bool StackCompressor::run(
 		);
 	}
 	else
+	{
+		// The cached checker only recompiles the functions that were modified by the
+		// previous iteration.
+		CachedCompilabilityChecker compilabilityChecker(_dialect, _optimizeStackAllocation);
 		for (size_t iterations = 0; iterations < _maxIterations; iterations++)
 		{
-			std::map<YulString, int> stackSurplus = CompilabilityChecker(_dialect, _object, _optimizeStackAllocation).stackDeficit;
+			std::map<YulString, int> stackSurplus = compilabilityChecker.stackDeficit(_object);
 			if (stackSurplus.empty())
 				return true;
 			eliminateVariables(
@@ -278,6 +282,7 @@ bool StackCompressor::run(
 				allowMSizeOptimzation
 			);
 		}
+	}
 	return false;
 }
 
@@ -19,6 +19,7 @@
 #include <libyul/optimiser/CallGraphGenerator.h>
 #include <libyul/optimiser/FunctionCallFinder.h>
 #include <libyul/optimiser/NameDispenser.h>
+#include <libyul/optimiser/ASTWalker.h>
 #include <libyul/optimiser/NameCollector.h>
 #include <libyul/optimiser/StackToMemoryMover.h>
 #include <libyul/backends/evm/ControlFlowGraphBuilder.h>
@@ -32,6 +33,7 @@
 #include <libsolutil/Algorithms.h>
 #include <libsolutil/CommonData.h>
 
+#include <range/v3/algorithm/all_of.hpp>
 #include <range/v3/range/conversion.hpp>
 #include <range/v3/view/concat.hpp>
 #include <range/v3/view/take.hpp>
@@ -41,6 +43,91 @@ using namespace solidity::yul;
 
 namespace
 {
+/**
+ * Determines the scope in which each variable of a function is declared, with scopes
+ * forming a tree of blocks rooted in the function itself. Since a variable is out of
+ * scope - and therefore surely dead - outside of its declaring block, two variables
+ * whose scopes are disjoint, i.e. neither scope contains the other, are never live at
+ * the same time. Variables declared in the init block of a for loop stay in scope for
+ * the rest of the loop and are treated as if declared in an enclosing block.
+ */
+class VariableScopeTracker: ASTWalker
+{
+public:
+	explicit VariableScopeTracker(FunctionDefinition const& _function)
+	{
+		m_parents.emplace_back(0);
+		for (TypedName const& var: ranges::concat_view(_function.parameters, _function.returnVariables))
+			m_scopes[var.name] = 0;
+		// The variables of the outermost block share the scope of the arguments.
+		walkVector(_function.body.statements);
+	}
+
+	/// @returns true, if the scope of @a _var is known, i.e. it is an argument,
+	/// return variable or local variable of the function.
+	bool known(YulString _var) const { return m_scopes.count(_var); }
+	/// @returns true, if the scopes of @a _var1 and @a _var2 are disjoint.
+	/// Both variables have to be known.
+	bool disjointScopes(YulString _var1, YulString _var2) const
+	{
+		size_t scope1 = m_scopes.at(_var1);
+		size_t scope2 = m_scopes.at(_var2);
+		return !containsScope(scope1, scope2) && !containsScope(scope2, scope1);
+	}
+
+	using ASTWalker::operator();
+	void operator()(Block const& _block) override
+	{
+		size_t enclosingScope = m_currentScope;
+		m_currentScope = newScope(enclosingScope);
+		walkVector(_block.statements);
+		m_currentScope = enclosingScope;
+	}
+	void operator()(ForLoop const& _forLoop) override
+	{
+		size_t enclosingScope = m_currentScope;
+		m_currentScope = newScope(enclosingScope);
+		walkVector(_forLoop.pre.statements);
+		visit(*_forLoop.condition);
+		(*this)(_forLoop.body);
+		(*this)(_forLoop.post);
+		m_currentScope = enclosingScope;
+	}
+	void operator()(VariableDeclaration const& _varDecl) override
+	{
+		for (TypedName const& var: _varDecl.variables)
+			m_scopes[var.name] = m_currentScope;
+		ASTWalker::operator()(_varDecl);
+	}
+	/// Variables of nested function definitions are allocated separately.
+	void operator()(FunctionDefinition const&) override {}
+
+private:
+	size_t newScope(size_t _parent)
+	{
+		m_parents.emplace_back(_parent);
+		return m_parents.size() - 1;
+	}
+	/// @returns true, if @a _outer equals @a _inner or is one of its ancestors.
+	bool containsScope(size_t _outer, size_t _inner) const
+	{
+		while (true)
+		{
+			if (_outer == _inner)
+				return true;
+			if (_inner == 0)
+				return false;
+			_inner = m_parents[_inner];
+		}
+	}
+
+	/// Maps each scope to its enclosing scope. The root scope 0 is its own parent.
+	std::vector<size_t> m_parents;
+	/// Maps variable names to the scope they are declared in.
+	std::map<YulString, size_t> m_scopes;
+	size_t m_currentScope = 0;
+};
+
 /**
  * Walks the call graph using a Depth-First-Search assigning memory slots to variables.
  * - The leaves of the call graph will get the lowest slot, increasing towards the root.
@@ -71,7 +158,8 @@ struct MemoryOffsetAllocator
 
 		if (auto const* unreachables = util::valueOrNullptr(unreachableVariables, _function))
 		{
-			if (FunctionDefinition const* functionDefinition = util::valueOrDefault(functionDefinitions, _function, nullptr, util::allow_copy))
+			FunctionDefinition const* functionDefinition = util::valueOrDefault(functionDefinitions, _function, nullptr, util::allow_copy);
+			if (functionDefinition)
 				if (
 					size_t totalArgCount = functionDefinition->returnVariables.size() + functionDefinition->parameters.size();
 					totalArgCount > 16
@@ -82,13 +170,36 @@ struct MemoryOffsetAllocator
 					) | ranges::views::take(totalArgCount - 16))
 						slotAllocations[var.name] = requiredSlots++;
 
+			std::optional<VariableScopeTracker> scopeTracker;
+			if (functionDefinition)
+				scopeTracker.emplace(*functionDefinition);
+
 			// Assign slots for all variables that become unreachable in the function body, if the above did not
-			// assign a slot for them already.
+			// assign a slot for them already. Variables with disjoint scopes are never live at the same time
+			// and can share a slot.
+			std::vector<std::vector<YulString>> variablesPerSlot;
 			for (YulString variable: *unreachables)
+			{
 				// The empty case is a function with too many arguments or return values,
 				// which was already handled above.
-				if (!variable.empty() && !slotAllocations.count(variable))
-					slotAllocations[variable] = requiredSlots++;
+				if (variable.empty() || slotAllocations.count(variable))
+					continue;
+				std::optional<size_t> slot;
+				if (scopeTracker && scopeTracker->known(variable))
+					for (size_t candidate = 0; candidate < variablesPerSlot.size() && !slot; ++candidate)
+						if (ranges::all_of(variablesPerSlot[candidate], [&](YulString _other) {
+							return scopeTracker->known(_other) && scopeTracker->disjointScopes(variable, _other);
+						}))
+							slot = candidate;
+				if (!slot)
+				{
+					slot = variablesPerSlot.size();
+					variablesPerSlot.emplace_back();
+				}
+				variablesPerSlot[*slot].emplace_back(variable);
+				slotAllocations[variable] = requiredSlots + *slot;
+			}
+			requiredSlots += variablesPerSlot.size();
 		}
 
 		return slotsRequiredForFunction[_function] = requiredSlots;
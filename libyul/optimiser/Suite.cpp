@@ -67,6 +67,7 @@
 #include <libyul/AsmAnalysisInfo.h>
 #include <libyul/AsmPrinter.h>
 #include <libyul/AST.h>
+#include <libyul/ControlFlowSideEffectsCollector.h>
 #include <libyul/Object.h>
 
 #include <libyul/backends/evm/NoOutputAssembly.h>
@@ -78,24 +79,57 @@
 #include <range/v3/view/map.hpp>
 #include <range/v3/action/remove.hpp>
 
+#include <iostream>
 #include <limits>
+#include <mutex>
+#include <optional>
 #include <tuple>
 
-#ifdef PROFILE_OPTIMIZER_STEPS
 #include <chrono>
 #include <fmt/format.h>
-#endif
 
 using namespace solidity;
 using namespace solidity::yul;
-#ifdef PROFILE_OPTIMIZER_STEPS
 using namespace std::chrono;
-#endif
 using namespace std::string_literals;
 
 namespace
 {
 
+bool g_collectStepStatistics = false;
+/// Guards g_stepStatistics; suite runs can happen concurrently on multiple threads.
+std::mutex g_stepStatisticsMutex;
+std::map<std::string, OptimiserSuite::StepStatistics> g_stepStatistics;
+
+bool g_adaptiveScheduling = false;
+/// Guards g_observedSchedules; suite runs can happen concurrently on multiple threads.
+std::mutex g_observedSchedulesMutex;
+std::vector<std::pair<std::string, std::string>> g_observedSchedules;
+
+/// Weights for the second component of the metric fingerprint used by adaptive scheduling.
+/// Chosen (as distinct primes) to be sensitive to changes that keep the plain node count
+/// unchanged, e.g. turning an assignment into a declaration; they do not model any cost.
+CodeWeights const fingerprintCodeWeights = []{
+	CodeWeights weights;
+	weights.expressionStatementCost = 2;
+	weights.assignmentCost = 3;
+	weights.variableDeclarationCost = 5;
+	weights.functionDefinitionCost = 7;
+	weights.ifCost = 11;
+	weights.switchCost = 13;
+	weights.caseCost = 17;
+	weights.forLoopCost = 19;
+	weights.breakCost = 23;
+	weights.continueCost = 29;
+	weights.leaveCost = 31;
+	weights.blockCost = 37;
+	weights.functionCallCost = 41;
+	weights.identifierCost = 43;
+	weights.literalCost = 47;
+	weights.literalZeroCost = 53;
+	return weights;
+}();
+
 #ifdef PROFILE_OPTIMIZER_STEPS
 void outputPerformanceMetrics(map<string, int64_t> const& _metrics)
 {
@@ -139,7 +173,8 @@ void OptimiserSuite::run(
 	std::string_view _optimisationSequence,
 	std::string_view _optimisationCleanupSequence,
 	std::optional<size_t> _expectedExecutionsPerDeployment,
-	std::set<YulString> const& _externallyUsedIdentifiers
+	std::set<YulString> const& _externallyUsedIdentifiers,
+	util::CancellationToken const& _cancellationToken
 )
 {
 	EVMDialect const* evmDialect = dynamic_cast<EVMDialect const*>(&_dialect);
@@ -151,17 +186,36 @@ void OptimiserSuite::run(
 	std::set<YulString> reservedIdentifiers = _externallyUsedIdentifiers;
 	reservedIdentifiers += _dialect.fixedFunctionNames();
 
-	*_object.code = std::get<Block>(Disambiguator(
+	// Renaming in place keeps all subtrees that need no renaming instead of deep-copying
+	// the whole AST before the first optimisation step has even run.
+	InPlaceDisambiguator(
 		_dialect,
 		*_object.analysisInfo,
 		reservedIdentifiers
-	)(*_object.code));
+	)(*_object.code);
 	Block& ast = *_object.code;
 
 	NameDispenser dispenser{_dialect, ast, reservedIdentifiers};
-	OptimiserStepContext context{_dialect, dispenser, reservedIdentifiers, _expectedExecutionsPerDeployment};
+	// Shared between all steps of this run, so that steps running back-to-back without a
+	// rewrite in between do not recompute the control-flow or data side effects of all
+	// functions.
+	ControlFlowSideEffectsCache controlFlowSideEffectsCache;
+	SideEffectsCache sideEffectsCache;
+	OptimiserStepContext context{
+		_dialect,
+		dispenser,
+		reservedIdentifiers,
+		_expectedExecutionsPerDeployment,
+		&controlFlowSideEffectsCache,
+		&sideEffectsCache
+	};
 
-	OptimiserSuite suite(context, Debug::None);
+	OptimiserSuite suite(
+		context,
+		Debug::None,
+		g_adaptiveScheduling ? Scheduling::Adaptive : Scheduling::Fixed,
+		_cancellationToken
+	);
 
 	// Some steps depend on properties ensured by FunctionHoister, BlockFlattener, FunctionGrouper and
 	// ForLoopInitRewriter. Run them first to be able to run arbitrary sequences safely.
@@ -219,6 +273,12 @@ void OptimiserSuite::run(
 	outputPerformanceMetrics(suite.m_durationPerStepInMicroseconds);
 #endif
 
+	if (g_adaptiveScheduling)
+	{
+		std::lock_guard<std::mutex> schedulesLock(g_observedSchedulesMutex);
+		g_observedSchedules.emplace_back(_object.name.str(), suite.observedSchedule());
+	}
+
 	*_object.analysisInfo = AsmAnalyzer::analyzeStrictAssertCorrect(_dialect, _object);
 }
 
@@ -472,15 +532,41 @@ void OptimiserSuite::runSequence(std::string_view _stepAbbreviations, Block& _as
 			subsequences.push_back({subsequence, true});
 	}
 
+	using Fingerprint = std::pair<size_t, size_t>;
+	auto fingerprint = [&]() -> Fingerprint
+	{
+		return {
+			CodeSize::codeSizeIncludingFunctions(_ast),
+			CodeSize::codeSizeIncludingFunctions(_ast, fingerprintCodeWeights)
+		};
+	};
+	/// The fingerprints before and after the last execution of each subsequence.
+	std::vector<std::optional<std::pair<Fingerprint, Fingerprint>>> lastExecution(subsequences.size());
+
 	size_t codeSize = 0;
 	for (size_t round = 0; round < MaxRounds; ++round)
 	{
-		for (auto const& [subsequence, repeat]: subsequences)
+		for (size_t index = 0; index < subsequences.size(); ++index)
 		{
+			auto const& [subsequence, repeat] = subsequences[index];
+
+			std::optional<Fingerprint> current;
+			if (m_scheduling == Scheduling::Adaptive)
+			{
+				current = fingerprint();
+				// The subsequence already ran on an AST with this fingerprint and changed
+				// nothing the metrics can see - assume it would be a no-op again.
+				if (lastExecution[index] && *lastExecution[index] == std::make_pair(*current, *current))
+					continue;
+			}
+
 			if (repeat)
 				runSequence(subsequence, _ast, true);
 			else
 				runSequence(abbreviationsToSteps(subsequence), _ast);
+
+			if (current)
+				lastExecution[index] = std::make_pair(*current, fingerprint());
 		}
 
 		if (!_repeatUntilStable)
@@ -500,16 +586,38 @@ void OptimiserSuite::runSequence(std::vector<std::string> const& _steps, Block&
 		copy = std::make_unique<Block>(std::get<Block>(ASTCopier{}(_ast)));
 	for (std::string const& step: _steps)
 	{
+		// Superseded compilations should free their cores as soon as possible, so poll
+		// for cancellation between steps rather than only once per sequence.
+		m_cancellationToken.throwIfCancelled();
 		if (m_debug == Debug::PrintStep)
 			std::cout << "Running " << step << std::endl;
+		size_t codeSizeBefore = 0;
+		steady_clock::time_point statisticsStartTime;
+		if (g_collectStepStatistics)
+		{
+			codeSizeBefore = CodeSize::codeSizeIncludingFunctions(_ast);
+			statisticsStartTime = steady_clock::now();
+		}
 #ifdef PROFILE_OPTIMIZER_STEPS
 		steady_clock::time_point startTime = steady_clock::now();
 #endif
 		allSteps().at(step)->run(m_context, _ast);
+		if (m_scheduling == Scheduling::Adaptive)
+			m_observedSchedule += stepNameToAbbreviationMap().at(step);
 #ifdef PROFILE_OPTIMIZER_STEPS
 		steady_clock::time_point endTime = steady_clock::now();
 		m_durationPerStepInMicroseconds[step] += duration_cast<microseconds>(endTime - startTime).count();
 #endif
+		if (g_collectStepStatistics)
+		{
+			std::lock_guard<std::mutex> statisticsLock(g_stepStatisticsMutex);
+			StepStatistics& stats = g_stepStatistics[step];
+			stats.durationInMicroseconds += duration_cast<microseconds>(steady_clock::now() - statisticsStartTime).count();
+			++stats.invocations;
+			stats.codeSizeDelta +=
+				static_cast<int64_t>(CodeSize::codeSizeIncludingFunctions(_ast)) -
+				static_cast<int64_t>(codeSizeBefore);
+		}
 		if (m_debug == Debug::PrintChanges)
 		{
 			// TODO should add switch to also compare variable names!
@@ -524,3 +632,86 @@ void OptimiserSuite::runSequence(std::vector<std::string> const& _steps, Block&
 		}
 	}
 }
+
+void OptimiserSuite::enableStatistics(bool _enabled)
+{
+	g_collectStepStatistics = _enabled;
+}
+
+bool OptimiserSuite::statisticsEnabled()
+{
+	return g_collectStepStatistics;
+}
+
+std::map<std::string, OptimiserSuite::StepStatistics> const& OptimiserSuite::collectedStatistics()
+{
+	// NOTE: Only safe to call once concurrent suite runs have finished.
+	return g_stepStatistics;
+}
+
+void OptimiserSuite::clearStatistics()
+{
+	std::lock_guard<std::mutex> statisticsLock(g_stepStatisticsMutex);
+	g_stepStatistics.clear();
+}
+
+void OptimiserSuite::enableAdaptiveScheduling(bool _enabled)
+{
+	g_adaptiveScheduling = _enabled;
+}
+
+bool OptimiserSuite::adaptiveSchedulingEnabled()
+{
+	return g_adaptiveScheduling;
+}
+
+std::vector<std::pair<std::string, std::string>> const& OptimiserSuite::observedSchedules()
+{
+	// NOTE: Only safe to call once concurrent suite runs have finished.
+	return g_observedSchedules;
+}
+
+void OptimiserSuite::clearObservedSchedules()
+{
+	std::lock_guard<std::mutex> schedulesLock(g_observedSchedulesMutex);
+	g_observedSchedules.clear();
+}
+
+void OptimiserSuite::printStatistics(std::ostream& _out)
+{
+	int64_t totalDurationInMicroseconds = 0;
+	for (auto const& [step, stats]: g_stepStatistics)
+		totalDurationInMicroseconds += stats.durationInMicroseconds;
+
+	std::vector<std::pair<std::string, StepStatistics>> sortedStatistics{g_stepStatistics.begin(), g_stepStatistics.end()};
+	sort(
+		sortedStatistics.begin(),
+		sortedStatistics.end(),
+		[](auto const& _lhs, auto const& _rhs) -> bool
+		{
+			return _lhs.second.durationInMicroseconds > _rhs.second.durationInMicroseconds;
+		}
+	);
+
+	_out << "Optimiser step statistics" << std::endl;
+	_out << "=========================" << std::endl;
+	for (auto const& [step, stats]: sortedStatistics)
+	{
+		double percentage =
+			totalDurationInMicroseconds > 0 ?
+			100.0 * static_cast<double>(stats.durationInMicroseconds) / static_cast<double>(totalDurationInMicroseconds) :
+			0.0;
+		_out << fmt::format(
+			"{:>7.3f}% ({:>10.3f} ms, {:>6} runs, {:>+10} nodes): {}",
+			percentage,
+			static_cast<double>(stats.durationInMicroseconds) / 1000.0,
+			stats.invocations,
+			stats.codeSizeDelta,
+			step
+		) << std::endl;
+	}
+	_out << fmt::format(
+		"Total: {:.3f} s",
+		static_cast<double>(totalDurationInMicroseconds) / 1000000.0
+	) << std::endl;
+}
@@ -27,10 +27,16 @@
 #include <libyul/optimiser/NameDispenser.h>
 #include <liblangutil/EVMVersion.h>
 
+#include <libsolutil/CancellationToken.h>
+
+#include <iosfwd>
+#include <map>
 #include <set>
 #include <string>
 #include <string_view>
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace solidity::yul
 {
@@ -59,9 +65,31 @@ public:
 		PrintStep,
 		PrintChanges
 	};
-	OptimiserSuite(OptimiserStepContext& _context, Debug _debug = Debug::None): m_context(_context), m_debug(_debug) {}
+	enum class Scheduling
+	{
+		/// Runs every step of the sequence as written.
+		Fixed,
+		/// Skips a group of steps when the metric fingerprint of the AST matches the one the
+		/// group last ran on without changing it. A heuristic mode: fingerprints are cheap
+		/// size metrics, not full AST comparisons, so a group can be skipped spuriously if
+		/// unrelated changes cancel out in the metrics.
+		Adaptive
+	};
+	OptimiserSuite(
+		OptimiserStepContext& _context,
+		Debug _debug = Debug::None,
+		Scheduling _scheduling = Scheduling::Fixed,
+		util::CancellationToken _cancellationToken = {}
+	):
+		m_context(_context),
+		m_debug(_debug),
+		m_scheduling(_scheduling),
+		m_cancellationToken(std::move(_cancellationToken))
+	{}
 
 	/// The value nullopt for `_expectedExecutionsPerDeployment` represents creation code.
+	/// @a _cancellationToken is polled between steps; the run aborts with
+	/// util::CompilationCancelled once cancellation has been requested.
 	static void run(
 		Dialect const& _dialect,
 		GasMeter const* _meter,
@@ -70,7 +98,8 @@ public:
 		std::string_view _optimisationSequence,
 		std::string_view _optimisationCleanupSequence,
 		std::optional<size_t> _expectedExecutionsPerDeployment,
-		std::set<YulString> const& _externallyUsedIdentifiers = {}
+		std::set<YulString> const& _externallyUsedIdentifiers = {},
+		util::CancellationToken const& _cancellationToken = {}
 	);
 
 	/// Ensures that specified sequence of step abbreviations is well-formed and can be executed.
@@ -84,13 +113,49 @@ public:
 	void runSequence(std::vector<std::string> const& _steps, Block& _ast);
 	void runSequence(std::string_view _stepAbbreviations, Block& _ast, bool _repeatUntilStable = false);
 
+	/// @returns the abbreviations of the steps this suite instance actually executed, in
+	/// order, usable as a literal step sequence. Only recorded in adaptive scheduling mode.
+	std::string const& observedSchedule() const { return m_observedSchedule; }
+
 	static std::map<std::string, std::unique_ptr<OptimiserStep>> const& allSteps();
 	static std::map<std::string, char> const& stepNameToAbbreviationMap();
 	static std::map<char, std::string> const& stepAbbreviationToNameMap();
 
+	/// Per-step cost statistics, aggregated over all invocations of a step.
+	struct StepStatistics
+	{
+		int64_t durationInMicroseconds = 0;
+		size_t invocations = 0;
+		/// Total change in AST size (in nodes, via CodeSize) caused by the step.
+		int64_t codeSizeDelta = 0;
+	};
+
+	/// Enables or disables collection of per-step statistics during runSequence.
+	/// Collection is disabled by default since measuring the AST size before and
+	/// after each step is not free.
+	static void enableStatistics(bool _enabled = true);
+	static bool statisticsEnabled();
+	/// @returns the statistics collected so far, by step name.
+	static std::map<std::string, StepStatistics> const& collectedStatistics();
+	static void clearStatistics();
+	/// Writes a human-readable report of the collected statistics to @a _out.
+	static void printStatistics(std::ostream& _out);
+
+	/// Enables or disables adaptive scheduling for suites created by the static run function.
+	static void enableAdaptiveScheduling(bool _enabled = true);
+	static bool adaptiveSchedulingEnabled();
+	/// @returns the schedules observed by adaptively scheduled runs so far, as pairs of
+	/// object name and executed step sequence, reusable as literal step strings.
+	static std::vector<std::pair<std::string, std::string>> const& observedSchedules();
+	static void clearObservedSchedules();
+
 private:
 	OptimiserStepContext& m_context;
 	Debug m_debug;
+	Scheduling m_scheduling;
+	util::CancellationToken m_cancellationToken;
+	/// The abbreviations of the steps executed so far, recorded in adaptive scheduling mode.
+	std::string m_observedSchedule;
 #ifdef PROFILE_OPTIMIZER_STEPS
 	std::map<std::string, int64_t> m_durationPerStepInMicroseconds;
 #endif
@@ -150,6 +150,19 @@ bool SyntacticallyEqual::statementEqual(ForLoop const& _lhs, ForLoop const& _rhs
 
 bool SyntacticallyEqual::statementEqual(Block const& _lhs, Block const& _rhs)
 {
+	// Syntactically equal blocks have equal hashes, so differing hashes prove
+	// inequality without descending into the blocks.
+	if (m_blockHashes)
+	{
+		auto lhsHash = m_blockHashes->find(&_lhs);
+		auto rhsHash = m_blockHashes->find(&_rhs);
+		if (
+			lhsHash != m_blockHashes->end() &&
+			rhsHash != m_blockHashes->end() &&
+			lhsHash->second != rhsHash->second
+		)
+			return false;
+	}
 	return util::containerEqual(_lhs.statements, _rhs.statements, [this](Statement const& _lhsStmt, Statement const& _rhsStmt) -> bool {
 		return (*this)(_lhsStmt, _rhsStmt);
 	});
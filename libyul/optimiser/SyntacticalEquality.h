@@ -23,7 +23,9 @@
 
 #include <libyul/ASTForward.h>
 #include <libyul/YulString.h>
+#include <libsolutil/FlatHashMap.h>
 
+#include <cstdint>
 #include <map>
 #include <type_traits>
 
@@ -35,11 +37,19 @@ namespace solidity::yul
  * Component that can compare ASTs for equality on a syntactic basis.
  * Ignores source locations and allows for different variable names but requires exact matches otherwise.
  *
+ * If block hashes computed by the BlockHasher are supplied, blocks with differing
+ * hashes are reported as unequal without descending into them, so repeated
+ * comparisons only walk blocks whose hashes collide.
+ *
  * Prerequisite: Disambiguator (unless only expressions are compared)
  */
 class SyntacticallyEqual
 {
 public:
+	SyntacticallyEqual() = default;
+	explicit SyntacticallyEqual(util::FlatHashMap<Block const*, uint64_t> const& _blockHashes):
+		m_blockHashes(&_blockHashes) {}
+
 	bool operator()(Expression const& _lhs, Expression const& _rhs);
 	bool operator()(Statement const& _lhs, Statement const& _rhs);
 
@@ -83,6 +93,8 @@ private:
 	std::size_t m_idsUsed = 0;
 	std::map<YulString, std::size_t> m_identifiersLHS;
 	std::map<YulString, std::size_t> m_identifiersRHS;
+	/// Block hashes as computed by the BlockHasher, if supplied.
+	util::FlatHashMap<Block const*, uint64_t> const* m_blockHashes = nullptr;
 };
 
 /**
@@ -37,11 +37,95 @@
 using namespace solidity;
 using namespace solidity::yul;
 
+namespace
+{
+
+/**
+ * Collects the names of all variables whose active assignments a block can change:
+ * everything that is assigned, declared or referenced in it. Gives up - meaning the
+ * whole state has to be assumed changed - if the block can leave the enclosing
+ * control flow altogether, i.e. on ``leave``, on ``break`` or ``continue`` belonging
+ * to an outer loop and on calls that do not continue.
+ */
+class ChangedVariablesCollector: public ASTWalker
+{
+public:
+	static std::optional<std::set<YulString>> run(
+		Block const& _block,
+		Dialect const& _dialect,
+		std::map<YulString, ControlFlowSideEffects> const& _controlFlowSideEffects
+	)
+	{
+		ChangedVariablesCollector collector(_dialect, _controlFlowSideEffects);
+		collector(_block);
+		if (collector.m_aborted)
+			return std::nullopt;
+		return std::move(collector.m_variables);
+	}
+
+	using ASTWalker::operator();
+	void operator()(Identifier const& _identifier) override { m_variables.insert(_identifier.name); }
+	void operator()(VariableDeclaration const& _variableDeclaration) override
+	{
+		for (TypedName const& var: _variableDeclaration.variables)
+			m_variables.insert(var.name);
+		ASTWalker::operator()(_variableDeclaration);
+	}
+	void operator()(FunctionCall const& _functionCall) override
+	{
+		ASTWalker::operator()(_functionCall);
+
+		ControlFlowSideEffects sideEffects;
+		if (auto builtin = m_dialect.builtin(_functionCall.functionName.name))
+			sideEffects = builtin->controlFlowSideEffects;
+		else
+			sideEffects = m_controlFlowSideEffects.at(_functionCall.functionName.name);
+		if (!sideEffects.canContinue)
+			m_aborted = true;
+	}
+	void operator()(ForLoop const& _forLoop) override
+	{
+		++m_loopNestingDepth;
+		ASTWalker::operator()(_forLoop);
+		--m_loopNestingDepth;
+	}
+	void operator()(Break const&) override
+	{
+		if (m_loopNestingDepth == 0)
+			m_aborted = true;
+	}
+	void operator()(Continue const&) override
+	{
+		if (m_loopNestingDepth == 0)
+			m_aborted = true;
+	}
+	void operator()(Leave const&) override { m_aborted = true; }
+	// The state of nested functions is tracked separately.
+	void operator()(FunctionDefinition const&) override {}
+
+private:
+	ChangedVariablesCollector(
+		Dialect const& _dialect,
+		std::map<YulString, ControlFlowSideEffects> const& _controlFlowSideEffects
+	):
+		m_dialect(_dialect),
+		m_controlFlowSideEffects(_controlFlowSideEffects)
+	{}
+
+	Dialect const& m_dialect;
+	std::map<YulString, ControlFlowSideEffects> const& m_controlFlowSideEffects;
+	std::set<YulString> m_variables;
+	size_t m_loopNestingDepth = 0;
+	bool m_aborted = false;
+};
+
+}
+
 void UnusedAssignEliminator::run(OptimiserStepContext& _context, Block& _ast)
 {
 	UnusedAssignEliminator uae{
 		_context.dialect,
-		ControlFlowSideEffectsCollector{_context.dialect, _ast}.functionSideEffectsNamed()
+		functionControlFlowSideEffects(_context, _ast)
 	};
 	uae(_ast);
 
@@ -146,6 +230,11 @@ void UnusedAssignEliminator::shortcutNestedLoop(ActiveStores const& _zeroRuns)
 	}
 }
 
+std::optional<std::set<YulString>> UnusedAssignEliminator::keysPotentiallyChangedBy(Block const& _branch) const
+{
+	return ChangedVariablesCollector::run(_branch, m_dialect, m_controlFlowSideEffects);
+}
+
 void UnusedAssignEliminator::finalizeFunctionDefinition(FunctionDefinition const& _functionDefinition)
 {
 	for (auto const& retParam: _functionDefinition.returnVariables)
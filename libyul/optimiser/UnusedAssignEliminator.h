@@ -29,6 +29,8 @@
 #include <libyul/optimiser/Semantics.h>
 
 #include <map>
+#include <optional>
+#include <set>
 #include <vector>
 
 namespace solidity::yul
@@ -140,6 +142,7 @@ public:
 private:
 	void shortcutNestedLoop(ActiveStores const& _beforeLoop) override;
 	void finalizeFunctionDefinition(FunctionDefinition const& _functionDefinition) override;
+	std::optional<std::set<YulString>> keysPotentiallyChangedBy(Block const& _branch) const override;
 
 	void markUsed(YulString _variable);
 
@@ -35,7 +35,9 @@ using namespace solidity::yul;
 
 void UnusedPruner::run(OptimiserStepContext& _context, Block& _ast)
 {
-	UnusedPruner::runUntilStabilisedOnFullAST(_context.dialect, _ast, _context.reservedIdentifiers);
+	std::map<YulString, SideEffects> functionSideEffects = yul::functionSideEffects(_context, _ast);
+	bool allowMSizeOptimization = !MSizeFinder::containsMSize(_context.dialect, _ast);
+	runUntilStabilised(_context.dialect, _ast, allowMSizeOptimization, &functionSideEffects, _context.reservedIdentifiers);
 	FunctionGrouper::run(_context, _ast);
 }
 
@@ -36,10 +36,28 @@ void UnusedStoreBase::operator()(If const& _if)
 {
 	visit(*_if.condition);
 
-	ActiveStores skipBranch{m_activeStores};
-	(*this)(_if.body);
+	if (std::optional<std::set<YulString>> changedKeys = keysPotentiallyChangedBy(_if.body))
+	{
+		// The branch can only change the active stores for these keys, so it suffices
+		// to save their entries instead of copying the whole mapping. This keeps long
+		// chains of ifs, e.g. generated dispatch code, linear in the number of branches.
+		ActiveStores savedEntries;
+		for (YulString key: *changedKeys)
+			if (auto it = m_activeStores.find(key); it != m_activeStores.end())
+				savedEntries.emplace(key, it->second);
+
+		(*this)(_if.body);
+
+		for (auto&& [key, stores]: savedEntries)
+			m_activeStores[key] += std::move(stores);
+	}
+	else
+	{
+		ActiveStores skipBranch{m_activeStores};
+		(*this)(_if.body);
 
-	merge(m_activeStores, std::move(skipBranch));
+		merge(m_activeStores, std::move(skipBranch));
+	}
 }
 
 void UnusedStoreBase::operator()(Switch const& _switch)
@@ -26,6 +26,8 @@
 
 #include <range/v3/action/remove_if.hpp>
 
+#include <optional>
+#include <set>
 #include <variant>
 
 
@@ -67,6 +69,15 @@ protected:
 	/// and correct manner.
 	virtual void shortcutNestedLoop(ActiveStores const& _beforeLoop) = 0;
 
+	/// @returns the set of keys of the active stores that visiting @a _branch can
+	/// possibly change, or nullopt if that cannot be determined cheaply. Used to limit
+	/// the state that has to be saved around a branch; returning nullopt is always safe
+	/// and falls back to copying the whole mapping.
+	virtual std::optional<std::set<YulString>> keysPotentiallyChangedBy(Block const& /*_branch*/) const
+	{
+		return std::nullopt;
+	}
+
 	/// This function is called right before the scoped restore of the function definition.
 	virtual void finalizeFunctionDefinition(FunctionDefinition const& /*_functionDefinition*/) {}
 
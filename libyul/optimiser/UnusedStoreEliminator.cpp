@@ -51,10 +51,7 @@ static std::string const thirtyTwo{"@ 32"};
 
 void UnusedStoreEliminator::run(OptimiserStepContext& _context, Block& _ast)
 {
-	std::map<YulString, SideEffects> functionSideEffects = SideEffectsPropagator::sideEffects(
-		_context.dialect,
-		CallGraphGenerator::callGraph(_ast)
-	);
+	std::map<YulString, SideEffects> functionSideEffects = yul::functionSideEffects(_context, _ast);
 
 	SSAValueTracker ssaValues;
 	ssaValues(_ast);
@@ -72,7 +69,7 @@ void UnusedStoreEliminator::run(OptimiserStepContext& _context, Block& _ast)
 	UnusedStoreEliminator rse{
 		_context.dialect,
 		functionSideEffects,
-		ControlFlowSideEffectsCollector{_context.dialect, _ast}.functionSideEffectsNamed(),
+		functionControlFlowSideEffects(_context, _ast),
 		values,
 		ignoreMemory
 	};
@@ -209,7 +206,10 @@ void UnusedStoreEliminator::visit(Statement const& _statement)
 		std::vector<Operation> operations = operationsFromFunctionCall(*funCall);
 		yulAssert(operations.size() == 1, "");
 		if (operations.front().location == Location::Storage)
-			activeStorageStores().insert(&_statement);
+		{
+			yulAssert(operations.front().length == YulString(one));
+			activeStorageStores(operations.front().start).insert(&_statement);
+		}
 		else
 			activeMemoryStores().insert(&_statement);
 		m_storeOperations[&_statement] = std::move(operations.front());
@@ -268,11 +268,46 @@ std::vector<UnusedStoreEliminator::Operation> UnusedStoreEliminator::operationsF
 
 void UnusedStoreEliminator::applyOperation(UnusedStoreEliminator::Operation const& _operation)
 {
-	std::set<Statement const*>& active =
-		_operation.location == Location::Storage ?
-		activeStorageStores() :
-		activeMemoryStores();
+	if (_operation.location == Location::Storage)
+	{
+		// Since storage stores are indexed by the variable containing their slot, the
+		// relation to the slot affected by @a _operation only has to be determined once
+		// per distinct slot variable instead of once per active store.
+		if (_operation.effect == Effect::Write)
+		{
+			// A write to a known slot covers exactly the stores indexed under the same
+			// slot variable; it cannot cover stores to different or unknown slots and
+			// a write to an unknown slot covers nothing.
+			if (_operation.start && _operation.length == YulString(one))
+				activeStorageStores(_operation.start).clear();
+			return;
+		}
+		yulAssert(_operation.effect == Effect::Read, "");
+		yulAssert(
+			!_operation.start ||
+			(_operation.length && m_knowledgeBase.valueIfKnownConstant(*_operation.length) == 1)
+		);
+		for (auto& [key, active]: m_activeStores)
+		{
+			if (active.empty() || locationOfActiveKey(key) != Location::Storage)
+				continue;
+			// Stores to a slot known to be different from the one being read stay
+			// active; all others are read from here.
+			if (
+				_operation.start &&
+				key != "@ storage"_yulstring &&
+				key != *_operation.start &&
+				m_knowledgeBase.knownToBeDifferent(key, *_operation.start)
+			)
+				continue;
+			m_usedStores.insert(active.begin(), active.end());
+			active.clear();
+		}
+		return;
+	}
 
+	yulAssert(_operation.location == Location::Memory, "");
+	std::set<Statement const*>& active = activeMemoryStores();
 
 	for (auto it = active.begin(); it != active.end();)
 	{
@@ -410,12 +445,9 @@ void UnusedStoreEliminator::markActiveAsUsed(
 	std::optional<UnusedStoreEliminator::Location> _onlyLocation
 )
 {
-	if (_onlyLocation == std::nullopt || _onlyLocation == Location::Memory)
-		for (Statement const* statement: activeMemoryStores())
-			m_usedStores.insert(statement);
-	if (_onlyLocation == std::nullopt || _onlyLocation == Location::Storage)
-		for (Statement const* statement: activeStorageStores())
-			m_usedStores.insert(statement);
+	for (auto& [key, active]: m_activeStores)
+		if (_onlyLocation == std::nullopt || _onlyLocation == locationOfActiveKey(key))
+			m_usedStores.insert(active.begin(), active.end());
 	clearActive(_onlyLocation);
 }
 
@@ -423,10 +455,9 @@ void UnusedStoreEliminator::clearActive(
 	std::optional<UnusedStoreEliminator::Location> _onlyLocation
 )
 {
-	if (_onlyLocation == std::nullopt || _onlyLocation == Location::Memory)
-		activeMemoryStores() = {};
-	if (_onlyLocation == std::nullopt || _onlyLocation == Location::Storage)
-		activeStorageStores() = {};
+	for (auto& [key, active]: m_activeStores)
+		if (_onlyLocation == std::nullopt || _onlyLocation == locationOfActiveKey(key))
+			active = {};
 }
 
 std::optional<YulString> UnusedStoreEliminator::identifierNameIfSSA(Expression const& _expression) const
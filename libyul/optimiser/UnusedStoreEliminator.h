@@ -32,6 +32,7 @@
 #include <libevmasm/SemanticInformation.h>
 
 #include <map>
+#include <optional>
 #include <vector>
 
 namespace solidity::yul
@@ -50,7 +51,9 @@ struct AssignedValue;
  * to sstore, as we don't know whether the memory location will be read once we leave the function's scope,
  * so the statement will be removed only if all code code paths lead to a memory overwrite.
  *
- * The m_store member of UnusedStoreBase uses the key "m" for memory and "s" for storage stores.
+ * The m_store member of UnusedStoreBase uses the key "@ memory" for all memory stores, while
+ * storage stores are indexed by the SSA variable containing the affected slot, with the key
+ * "@ storage" for stores to a statically unknown slot.
  *
  * Best run in SSA form.
  *
@@ -92,8 +95,20 @@ public:
 	};
 
 private:
-	std::set<Statement const*>& activeMemoryStores() { return m_activeStores["m"_yulstring]; }
-	std::set<Statement const*>& activeStorageStores() { return m_activeStores["s"_yulstring]; }
+	/// All memory stores share one active set, while storage stores are indexed by the
+	/// SSA variable containing the affected slot, so that covering and conflicting
+	/// stores can be looked up by key. The "@ " prefix of the special keys guarantees
+	/// that they cannot collide with Yul identifiers.
+	std::set<Statement const*>& activeMemoryStores() { return m_activeStores["@ memory"_yulstring]; }
+	std::set<Statement const*>& activeStorageStores(std::optional<YulString> _start = std::nullopt)
+	{
+		return m_activeStores[_start.value_or("@ storage"_yulstring)];
+	}
+	/// @returns the location the active stores indexed under @a _key belong to.
+	static Location locationOfActiveKey(YulString _key)
+	{
+		return _key == "@ memory"_yulstring ? Location::Memory : Location::Storage;
+	}
 
 	void shortcutNestedLoop(ActiveStores const&) override
 	{
@@ -42,6 +42,7 @@
 #include <libsolidity/lsp/Transport.h>
 
 #include <libyul/YulStack.h>
+#include <libyul/optimiser/Suite.h>
 
 #include <libevmasm/Instruction.h>
 #include <libevmasm/Disassemble.h>
@@ -55,11 +56,18 @@
 #include <libsolutil/Common.h>
 #include <libsolutil/CommonData.h>
 #include <libsolutil/CommonIO.h>
+#include <libsolutil/BinaryJSON.h>
 #include <libsolutil/JSON.h>
 
 #include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
 #include <fstream>
 #include <memory>
+#include <mutex>
+#include <thread>
 
 #include <range/v3/view/map.hpp>
 
@@ -72,6 +80,8 @@
 	#define isatty _isatty
 	#define fileno _fileno
 #else // unix
+	#include <sys/socket.h>
+	#include <sys/un.h>
 	#include <unistd.h>
 #endif
 
@@ -178,7 +188,9 @@ void CommandLineInterface::handleEVMAssembly(std::string const& _contract)
 		return;
 
 	std::string assembly;
-	if (m_options.compiler.outputs.asmJson)
+	if (PreparedOutputs* prepared = util::valueOrNullptr(m_preparedOutputs, _contract); prepared && prepared->assembly)
+		assembly = std::move(*prepared->assembly);
+	else if (m_options.compiler.outputs.asmJson)
 		assembly = util::jsonPrint(removeNullMembers(m_assemblyStack->assemblyJSON(_contract)), m_options.formatting.json);
 	else
 		assembly = m_assemblyStack->assemblyString(_contract, m_fileReader.sourceUnits());
@@ -203,10 +215,15 @@ void CommandLineInterface::handleBinary(std::string const& _contract)
 
 	std::string binary;
 	std::string binaryRuntime;
+	PreparedOutputs* prepared = util::valueOrNullptr(m_preparedOutputs, _contract);
 	if (m_options.compiler.outputs.binary)
-		binary = objectWithLinkRefsHex(m_assemblyStack->object(_contract));
+		binary = prepared && prepared->binary ?
+			std::move(*prepared->binary) :
+			objectWithLinkRefsHex(m_assemblyStack->object(_contract));
 	if (m_options.compiler.outputs.binaryRuntime)
-		binaryRuntime = objectWithLinkRefsHex(m_assemblyStack->runtimeObject(_contract));
+		binaryRuntime = prepared && prepared->binaryRuntime ?
+			std::move(*prepared->binaryRuntime) :
+			objectWithLinkRefsHex(m_assemblyStack->runtimeObject(_contract));
 
 	if (m_options.compiler.outputs.binary)
 	{
@@ -517,7 +534,8 @@ void CommandLineInterface::readInputFiles()
 	static std::set<frontend::InputMode> const noInputFiles{
 		frontend::InputMode::Help,
 		frontend::InputMode::License,
-		frontend::InputMode::Version
+		frontend::InputMode::Version,
+		frontend::InputMode::Daemon
 	};
 
 	if (noInputFiles.count(m_options.input.mode) == 1)
@@ -625,7 +643,10 @@ std::map<std::string, Json::Value> CommandLineInterface::parseAstFromInput()
 	for (SourceCode const& sourceCode: m_fileReader.sourceUnits() | ranges::views::values)
 	{
 		Json::Value ast;
-		astAssert(jsonParseStrict(sourceCode, ast), "Input file could not be parsed to JSON");
+		if (isBinaryJson(sourceCode))
+			astAssert(binaryJsonParse(sourceCode, ast), "Input file could not be decoded from binary AST format");
+		else
+			astAssert(jsonParseStrict(sourceCode, ast), "Input file could not be parsed to JSON");
 		astAssert(ast.isMember("sources"), "Invalid Format for import-JSON: Must have 'sources'-object");
 
 		for (auto& src: ast["sources"].getMemberNames())
@@ -750,13 +771,19 @@ void CommandLineInterface::processInput()
 		solAssert(m_standardJsonInput.has_value());
 
 		StandardCompiler compiler(m_universalCallback.callback(), m_options.formatting.json);
-		sout() << compiler.compile(std::move(m_standardJsonInput.value())) << std::endl;
+		if (m_options.input.cacheDirectory.has_value())
+			compiler.setArtifactCacheDirectory(m_options.input.cacheDirectory.value());
+		compiler.compile(std::move(m_standardJsonInput.value()), sout());
+		sout() << std::endl;
 		m_standardJsonInput.reset();
 		break;
 	}
 	case InputMode::LanguageServer:
 		serveLSP();
 		break;
+	case InputMode::Daemon:
+		serveStandardJsonDaemon();
+		break;
 	case InputMode::Assembler:
 		assembleYul(m_options.assembly.inputLanguage, m_options.assembly.targetMachine);
 		break;
@@ -766,8 +793,13 @@ void CommandLineInterface::processInput()
 		break;
 	case InputMode::Compiler:
 	case InputMode::CompilerWithASTImport:
-		compile();
-		outputCompilationResults();
+		if (m_options.input.watchMode)
+			watchAndRecompile();
+		else
+		{
+			compile();
+			outputCompilationResults();
+		}
 		break;
 	case InputMode::EVMAssemblerJSON:
 		assembleFromEVMAssemblyJSON();
@@ -874,6 +906,8 @@ void CommandLineInterface::compile()
 		);
 
 		m_compiler->setOptimiserSettings(m_options.optimiserSettings());
+		yul::OptimiserSuite::enableStatistics(m_options.optimizer.statistics);
+		yul::OptimiserSuite::enableAdaptiveScheduling(m_options.optimizer.adaptive);
 
 		if (m_options.input.mode == InputMode::CompilerWithASTImport)
 		{
@@ -899,6 +933,13 @@ void CommandLineInterface::compile()
 
 		bool successful = m_compiler->compile(m_options.output.stopAfter);
 
+		if (m_options.optimizer.statistics)
+			yul::OptimiserSuite::printStatistics(serr());
+
+		if (m_options.optimizer.adaptive)
+			for (auto const& [objectName, schedule]: yul::OptimiserSuite::observedSchedules())
+				serr() << "Optimizer schedule for " << objectName << ": " << schedule << std::endl;
+
 		for (auto const& error: m_compiler->errors())
 		{
 			m_hasOutput = true;
@@ -933,6 +974,80 @@ void CommandLineInterface::compile()
 	}
 }
 
+void CommandLineInterface::watchAndRecompile()
+{
+	solAssert(m_options.input.mode == InputMode::Compiler);
+
+	// The files given on the command line are always part of the source set. Files pulled
+	// in through imports are dropped before each rebuild so that the import callback
+	// reloads them and picks up changes to the import graph.
+	std::set<std::string> cliSourceUnits;
+	for (auto const& [sourceUnitName, source]: m_fileReader.sourceUnits())
+		cliSourceUnits.insert(sourceUnitName);
+
+	while (true)
+	{
+		try
+		{
+			compile();
+			outputCompilationResults();
+		}
+		catch (CommandLineError const& _exception)
+		{
+			// Errors are not fatal in watch mode - the next edit may fix them.
+			if (_exception.what() != ""s)
+				report(Error::Severity::Error, _exception.what());
+		}
+
+		std::map<boost::filesystem::path, std::time_t> modificationTimes;
+		for (auto const& [sourceUnitName, path]: m_fileReader.sourceUnitPaths())
+		{
+			boost::system::error_code errorCode;
+			modificationTimes[path] = boost::filesystem::last_write_time(path, errorCode);
+		}
+
+		report(Error::Severity::Info, "Watching " + std::to_string(modificationTimes.size()) + " files for changes.");
+
+		bool changed = false;
+		while (!changed)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(500));
+			for (auto const& [path, modificationTime]: modificationTimes)
+			{
+				boost::system::error_code errorCode;
+				if (boost::filesystem::last_write_time(path, errorCode) != modificationTime)
+				{
+					changed = true;
+					break;
+				}
+			}
+		}
+
+		// Re-read the command-line inputs and drop everything loaded through imports.
+		FileReader::StringMap freshSources;
+		for (std::string const& sourceUnitName: cliSourceUnits)
+		{
+			auto it = m_fileReader.sourceUnitPaths().find(sourceUnitName);
+			solAssert(it != m_fileReader.sourceUnitPaths().end());
+			try
+			{
+				freshSources[sourceUnitName] = readFileAsString(it->second);
+			}
+			catch (util::Exception const&)
+			{
+				// The file may be briefly missing, e.g. during an editor save. Recompile
+				// with the old content; the next change triggers another read.
+				freshSources[sourceUnitName] = m_fileReader.sourceUnits().at(sourceUnitName);
+			}
+		}
+		m_fileReader.setSourceUnits(std::move(freshSources));
+
+		m_assemblyStack = nullptr;
+		m_compiler.reset();
+		m_hasOutput = false;
+	}
+}
+
 void CommandLineInterface::handleCombinedJSON()
 {
 	solAssert(m_assemblyStack);
@@ -951,10 +1066,9 @@ void CommandLineInterface::handleCombinedJSON()
 
 	if (!contracts.empty())
 		output[g_strContracts] = Json::Value(Json::objectValue);
-	for (std::string const& contractName: contracts)
-	{
-		Json::Value& contractData = output[g_strContracts][contractName] = Json::objectValue;
 
+	auto buildFrontendData = [&](std::string const& contractName, Json::Value& contractData)
+	{
 		// NOTE: The state checks here are more strict that in Standard JSON. There we allow
 		// requesting certain outputs even if compilation fails as long as analysis went ok.
 		if (m_compiler && m_compiler->compilationSuccessful())
@@ -976,7 +1090,10 @@ void CommandLineInterface::handleCombinedJSON()
 			if (m_options.compiler.combinedJsonRequests->natspecUser)
 				contractData[g_strNatspecUser] = m_compiler->natspecUser(contractName);
 		}
+	};
 
+	auto buildAssemblyData = [&](std::string const& contractName, Json::Value& contractData)
+	{
 		if (m_assemblyStack->compilationSuccessful())
 		{
 			if (m_options.compiler.combinedJsonRequests->binary)
@@ -1006,7 +1123,65 @@ void CommandLineInterface::handleCombinedJSON()
 					m_assemblyStack->runtimeObject(contractName).functionDebugData
 				);
 		}
+	};
+
+	std::vector<Json::Value> contractOutputs(contracts.size(), Json::Value(Json::objectValue));
+
+	// The frontend outputs have to be produced serially: ABIs, signature hashes, natspec
+	// and metadata memoize function types and external signatures in the process-wide
+	// TypeProvider tables and in per-type caches shared between contracts, none of which
+	// are synchronized.
+	for (size_t i = 0; i < contracts.size(); ++i)
+		buildFrontendData(contracts[i], contractOutputs[i]);
+
+	// The assembly-side outputs of different contracts only read the assembled objects
+	// (guarded by Assembly's own synchronization) and per-contract caches of distinct
+	// contracts, so they can be produced concurrently. Merging into the output object
+	// happens on one thread afterwards.
+	size_t threads = std::min<size_t>(
+		contracts.size(),
+		std::max<unsigned>(std::thread::hardware_concurrency(), 1)
+	);
+	if (threads < 2)
+		for (size_t i = 0; i < contracts.size(); ++i)
+			buildAssemblyData(contracts[i], contractOutputs[i]);
+	else
+	{
+		std::atomic<size_t> nextContract{0};
+		std::mutex exceptionMutex;
+		std::exception_ptr workerException;
+		auto work = [&]()
+		{
+			try
+			{
+				while (true)
+				{
+					size_t contractIndex = nextContract.fetch_add(1);
+					if (contractIndex >= contracts.size())
+						break;
+					buildAssemblyData(contracts[contractIndex], contractOutputs[contractIndex]);
+				}
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(exceptionMutex);
+				if (!workerException)
+					workerException = std::current_exception();
+				// Make the other workers stop early.
+				nextContract = contracts.size();
+			}
+		};
+		std::vector<std::thread> workers;
+		for (size_t i = 1; i < threads; ++i)
+			workers.emplace_back(work);
+		work();
+		for (std::thread& worker: workers)
+			worker.join();
+		if (workerException)
+			std::rethrow_exception(workerException);
 	}
+	for (size_t i = 0; i < contracts.size(); ++i)
+		output[g_strContracts][contracts[i]] = std::move(contractOutputs[i]);
 
 	bool needsSourceList =
 		m_options.compiler.combinedJsonRequests->ast ||
@@ -1043,6 +1218,34 @@ void CommandLineInterface::handleCombinedJSON()
 		sout() << json << std::endl;
 }
 
+void CommandLineInterface::handleBinaryAst()
+{
+	solAssert(CompilerInputModes.count(m_options.input.mode) == 1);
+
+	if (!m_options.compiler.outputs.astBinary)
+		return;
+
+	// Use the same layout as the "ast" component of --combined-json, which is what
+	// --import-ast expects, so that the output can be fed back into the compiler.
+	Json::Value output(Json::objectValue);
+	output[g_strSources] = Json::Value(Json::objectValue);
+	for (auto const& sourceCode: m_fileReader.sourceUnits())
+	{
+		output[g_strSources][sourceCode.first] = Json::Value(Json::objectValue);
+		output[g_strSources][sourceCode.first]["AST"] = ASTJsonExporter(
+			m_compiler->state(),
+			m_compiler->sourceIndices()
+		).toJson(m_compiler->ast(sourceCode.first));
+		output[g_strSources][sourceCode.first]["id"] = m_compiler->sourceIndices().at(sourceCode.first);
+	}
+
+	std::string data = binaryJsonPrint(output);
+	if (!m_options.output.dir.empty())
+		createFile("ast.bin", data);
+	else
+		sout() << data;
+}
+
 void CommandLineInterface::handleAst()
 {
 	solAssert(CompilerInputModes.count(m_options.input.mode) == 1);
@@ -1084,6 +1287,87 @@ void CommandLineInterface::serveLSP()
 		solThrow(CommandLineExecutionError, "LSP terminated abnormally.");
 }
 
+void CommandLineInterface::serveStandardJsonDaemon()
+{
+	solAssert(m_options.input.mode == InputMode::Daemon);
+
+#ifdef _WIN32
+	solThrow(CommandLineExecutionError, "Daemon mode is not supported on this platform.");
+#else
+	std::string const socketPath = m_options.input.daemonSocketPath.string();
+
+	sockaddr_un address{};
+	if (socketPath.size() >= sizeof(address.sun_path))
+		solThrow(CommandLineValidationError, "Socket path \"" + socketPath + "\" is too long.");
+	address.sun_family = AF_UNIX;
+	std::memcpy(address.sun_path, socketPath.c_str(), socketPath.size() + 1);
+
+	int listeningSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (listeningSocket < 0)
+		solThrow(CommandLineExecutionError, "Could not create socket: "s + std::strerror(errno));
+
+	// NOTE: We deliberately do not remove an existing file at the socket path. It could belong
+	// to another running daemon and a stale socket is better removed explicitly by the user.
+	if (
+		bind(listeningSocket, reinterpret_cast<sockaddr const*>(&address), sizeof(address)) < 0 ||
+		listen(listeningSocket, SOMAXCONN) < 0
+	)
+	{
+		std::string message = std::strerror(errno);
+		close(listeningSocket);
+		solThrow(CommandLineExecutionError, "Could not listen on \"" + socketPath + "\": " + message);
+	}
+
+	report(Error::Severity::Info, "Serving Standard JSON requests on \"" + socketPath + "\".");
+
+	// A single compiler instance serves all requests. This keeps process-wide structures
+	// (interned Yul strings, EVM dialect builtins, the simplification rule list) warm and
+	// lets consecutive requests share the artifact cache, if one was configured.
+	StandardCompiler compiler(m_universalCallback.callback(), m_options.formatting.json);
+	if (m_options.input.cacheDirectory.has_value())
+		compiler.setArtifactCacheDirectory(m_options.input.cacheDirectory.value());
+
+	while (true)
+	{
+		int connection = accept(listeningSocket, nullptr, nullptr);
+		if (connection < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			std::string message = std::strerror(errno);
+			close(listeningSocket);
+			unlink(socketPath.c_str());
+			solThrow(CommandLineExecutionError, "Could not accept connection: " + message);
+		}
+
+		std::string input;
+		char buffer[4096];
+		ssize_t bytesRead = 0;
+		while ((bytesRead = read(connection, buffer, sizeof(buffer))) > 0)
+			input.append(buffer, static_cast<size_t>(bytesRead));
+
+		std::string output = compiler.compile(input);
+		char const* outputData = output.data();
+		size_t bytesLeft = output.size();
+		while (bytesLeft > 0)
+		{
+			// MSG_NOSIGNAL so that a client disconnecting early does not kill the daemon via SIGPIPE.
+			ssize_t bytesWritten = send(connection, outputData, bytesLeft, MSG_NOSIGNAL);
+			if (bytesWritten < 0)
+			{
+				if (errno == EINTR)
+					continue;
+				// The client may have given up on the request. Not fatal for the daemon.
+				break;
+			}
+			outputData += bytesWritten;
+			bytesLeft -= static_cast<size_t>(bytesWritten);
+		}
+		close(connection);
+	}
+#endif
+}
+
 void CommandLineInterface::link()
 {
 	solAssert(m_options.input.mode == InputMode::Linker);
@@ -1108,6 +1392,16 @@ void CommandLineInterface::link()
 		librariesReplacements[replacement] = library.second;
 	}
 
+	// Hints for resolved libraries are removed below in a single pass per file instead
+	// of one scan per library. They all have the form "// <placeholder> -> <name>", so
+	// they can be recognized by the fixed-size placeholder.
+	std::map<std::string, std::string> resolvedHints;
+	for (auto const& library: m_options.linker.libraries)
+		resolvedHints.emplace(
+			evmasm::LinkerObject::libraryPlaceholder(library.first),
+			libraryPlaceholderHint(library.first)
+		);
+
 	FileReader::StringMap sourceCodes = m_fileReader.sourceUnits();
 	for (auto& src: sourceCodes)
 	{
@@ -1142,8 +1436,32 @@ void CommandLineInterface::link()
 			it += placeholderSize;
 		}
 		// Remove hints for resolved libraries.
-		for (auto const& library: m_options.linker.libraries)
-			boost::algorithm::erase_all(src.second, "\n" + libraryPlaceholderHint(library.first));
+		std::string stripped;
+		stripped.reserve(src.second.size());
+		size_t pos = 0;
+		while (pos < src.second.size())
+		{
+			size_t newlinePos = src.second.find('\n', pos);
+			if (newlinePos == std::string::npos)
+				break;
+			std::string const* hint = nullptr;
+			if (src.second.compare(newlinePos + 1, 3, "// ") == 0)
+				if (auto hintIt = resolvedHints.find(src.second.substr(newlinePos + 4, 36)); hintIt != resolvedHints.end())
+					if (src.second.compare(newlinePos + 1, hintIt->second.size(), hintIt->second) == 0)
+						hint = &hintIt->second;
+			if (hint)
+			{
+				stripped.append(src.second, pos, newlinePos - pos);
+				pos = newlinePos + 1 + hint->size();
+			}
+			else
+			{
+				stripped.append(src.second, pos, newlinePos + 1 - pos);
+				pos = newlinePos + 1;
+			}
+		}
+		stripped.append(src.second, pos, std::string::npos);
+		src.second = std::move(stripped);
 		while (!src.second.empty() && *prev(src.second.end()) == '\n')
 			src.second.resize(src.second.size() - 1);
 	}
@@ -1273,6 +1591,78 @@ void CommandLineInterface::assembleYul(yul::YulStack::Language _language, yul::Y
 	}
 }
 
+void CommandLineInterface::prepareContractOutputs(std::vector<std::string> const& _contracts)
+{
+	bool assemblyRequested = m_options.compiler.outputs.asm_ || m_options.compiler.outputs.asmJson;
+	bool binaryRequested = m_options.compiler.outputs.binary;
+	bool binaryRuntimeRequested = m_options.compiler.outputs.binaryRuntime;
+	if (!assemblyRequested && !binaryRequested && !binaryRuntimeRequested)
+		return;
+
+	size_t threads = std::min<size_t>(
+		_contracts.size(),
+		std::max<unsigned>(std::thread::hardware_concurrency(), 1)
+	);
+	if (threads < 2)
+		return;
+
+	// Create the entries up front so that the workers only ever fill existing
+	// entries and do not modify the map itself.
+	for (std::string const& contract: _contracts)
+		m_preparedOutputs[contract];
+
+	std::atomic<size_t> nextContract{0};
+	std::mutex exceptionMutex;
+	std::exception_ptr workerException;
+
+	auto work = [&]()
+	{
+		try
+		{
+			while (true)
+			{
+				size_t contractIndex = nextContract.fetch_add(1);
+				if (contractIndex >= _contracts.size())
+					break;
+				std::string const& contract = _contracts[contractIndex];
+				PreparedOutputs& prepared = m_preparedOutputs.at(contract);
+				if (assemblyRequested)
+				{
+					if (m_options.compiler.outputs.asmJson)
+						prepared.assembly = util::jsonPrint(
+							removeNullMembers(m_assemblyStack->assemblyJSON(contract)),
+							m_options.formatting.json
+						);
+					else
+						prepared.assembly = m_assemblyStack->assemblyString(contract, m_fileReader.sourceUnits());
+				}
+				if (binaryRequested)
+					prepared.binary = objectWithLinkRefsHex(m_assemblyStack->object(contract));
+				if (binaryRuntimeRequested)
+					prepared.binaryRuntime = objectWithLinkRefsHex(m_assemblyStack->runtimeObject(contract));
+			}
+		}
+		catch (...)
+		{
+			std::lock_guard<std::mutex> lock(exceptionMutex);
+			if (!workerException)
+				workerException = std::current_exception();
+			// Make the other workers stop early.
+			nextContract = _contracts.size();
+		}
+	};
+
+	std::vector<std::thread> workers;
+	for (size_t i = 1; i < threads; ++i)
+		workers.emplace_back(work);
+	work();
+	for (std::thread& worker: workers)
+		worker.join();
+
+	if (workerException)
+		std::rethrow_exception(workerException);
+}
+
 void CommandLineInterface::outputCompilationResults()
 {
 	solAssert(CompilerInputModes.count(m_options.input.mode) == 1);
@@ -1281,6 +1671,7 @@ void CommandLineInterface::outputCompilationResults()
 
 	// do we need AST output?
 	handleAst();
+	handleBinaryAst();
 
 	CompilerOutputs astOutputSelection;
 	astOutputSelection.astCompactJson = true;
@@ -1290,7 +1681,10 @@ void CommandLineInterface::outputCompilationResults()
 		// we can safely assume that full compilation was performed and successful.
 		solAssert(m_options.output.stopAfter >= CompilerStack::State::CompilationSuccessful);
 
-		for (std::string const& contract: m_compiler->contractNames())
+		std::vector<std::string> contracts = m_compiler->contractNames();
+		prepareContractOutputs(contracts);
+
+		for (std::string const& contract: contracts)
 		{
 			if (needsHumanTargetedStdout(m_options))
 				sout() << std::endl << "======= " << contract << " =======" << std::endl;
@@ -1312,6 +1706,8 @@ void CommandLineInterface::outputCompilationResults()
 			handleNatspec(true, contract);
 			handleNatspec(false, contract);
 		} // end of contracts iteration
+
+		m_preparedOutputs.clear();
 	}
 
 	if (!m_hasOutput)
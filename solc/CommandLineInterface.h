@@ -86,8 +86,16 @@ private:
 	void printVersion();
 	void printLicense();
 	void compile();
+	/// Compiles, then keeps polling the files the compilation read from disk and recompiles
+	/// whenever one of them changes. Keeping the process resident lets consecutive rebuilds
+	/// share the process-wide caches. Only returns on an unrecoverable error.
+	void watchAndRecompile();
 	void assembleFromEVMAssemblyJSON();
 	void serveLSP();
+	/// Listens on the unix socket given on the command line and serves Standard JSON requests
+	/// until the process is terminated. Keeps process-wide state such as the interned Yul
+	/// strings, the EVM dialects and the simplification rules warm between requests.
+	void serveStandardJsonDaemon();
 	void link();
 	void writeLinkedFiles();
 	/// @returns the ``// <identifier> -> name`` hint for library placeholders.
@@ -99,8 +107,25 @@ private:
 
 	void outputCompilationResults();
 
+	/// Output strings whose formatting was prepared ahead of emission, see
+	/// prepareContractOutputs(). The handlers move them out instead of formatting.
+	struct PreparedOutputs
+	{
+		std::optional<std::string> assembly;
+		std::optional<std::string> binary;
+		std::optional<std::string> binaryRuntime;
+	};
+
+	/// Formats the outputs of @a _contracts whose formatting is expensive - the assembly
+	/// export and the hex encoding of the bytecode - concurrently on all hardware threads
+	/// and stores the results in m_preparedOutputs, so that the handlers only have to emit
+	/// them in the usual order. Does nothing if fewer than two contracts are given or none
+	/// of the expensive outputs is requested.
+	void prepareContractOutputs(std::vector<std::string> const& _contracts);
+
 	void handleCombinedJSON();
 	void handleAst();
+	void handleBinaryAst();
 	void handleEVMAssembly(std::string const& _contract);
 	void handleBinary(std::string const& _contract);
 	void handleOpcode(std::string const& _contract);
@@ -153,6 +178,8 @@ private:
 	std::unique_ptr<frontend::CompilerStack> m_compiler;
 	std::unique_ptr<evmasm::EVMAssemblyStack> m_evmAssemblyStack;
 	evmasm::AbstractAssemblyStack* m_assemblyStack = nullptr;
+	/// Outputs prepared by prepareContractOutputs(), keyed by contract name.
+	std::map<std::string, PreparedOutputs> m_preparedOutputs;
 	CommandLineOptions m_options;
 };
 
@@ -57,7 +57,9 @@ static std::string const g_strImportEvmAssemblerJson = "import-asm-json";
 static std::string const g_strInputFile = "input-file";
 static std::string const g_strYul = "yul";
 static std::string const g_strYulDialect = "yul-dialect";
+static std::string const g_strDaemon = "daemon";
 static std::string const g_strDebugInfo = "debug-info";
+static std::string const g_strWatch = "watch";
 static std::string const g_strIPFS = "ipfs";
 static std::string const g_strLicense = "license";
 static std::string const g_strLibraries = "libraries";
@@ -72,6 +74,7 @@ static std::string const g_strModelCheckerDivModNoSlacks = "model-checker-div-mo
 static std::string const g_strModelCheckerEngine = "model-checker-engine";
 static std::string const g_strModelCheckerExtCalls = "model-checker-ext-calls";
 static std::string const g_strModelCheckerInvariants = "model-checker-invariants";
+static std::string const g_strModelCheckerNoCounterexamples = "model-checker-no-counterexamples";
 static std::string const g_strModelCheckerPrintQuery = "model-checker-print-query";
 static std::string const g_strModelCheckerShowProvedSafe = "model-checker-show-proved-safe";
 static std::string const g_strModelCheckerShowUnproved = "model-checker-show-unproved";
@@ -79,11 +82,14 @@ static std::string const g_strModelCheckerShowUnsupported = "model-checker-show-
 static std::string const g_strModelCheckerSolvers = "model-checker-solvers";
 static std::string const g_strModelCheckerTargets = "model-checker-targets";
 static std::string const g_strModelCheckerTimeout = "model-checker-timeout";
+static std::string const g_strModelCheckerTimeoutLadder = "model-checker-timeout-ladder";
 static std::string const g_strModelCheckerBMCLoopIterations = "model-checker-bmc-loop-iterations";
 static std::string const g_strNone = "none";
 static std::string const g_strNoOptimizeYul = "no-optimize-yul";
 static std::string const g_strNoImportCallback = "no-import-callback";
 static std::string const g_strOptimize = "optimize";
+static std::string const g_strOptimizerStats = "optimizer-stats";
+static std::string const g_strOptimizerAdaptive = "optimizer-adaptive";
 static std::string const g_strOptimizeRuns = "optimize-runs";
 static std::string const g_strOptimizeYul = "optimize-yul";
 static std::string const g_strYulOptimizations = "yul-optimizations";
@@ -102,6 +108,7 @@ static std::set<std::string> const g_revertStringsArgs
 	revertStringsToString(RevertStrings::VerboseDebug)
 };
 
+static std::string const g_strCacheDir = "cache-dir";
 static std::string const g_strSources = "sources";
 static std::string const g_strSourceList = "sourceList";
 static std::string const g_strStandardJSON = "standard-json";
@@ -146,6 +153,7 @@ static std::map<InputMode, std::string> const g_inputModeName = {
 	{InputMode::Linker, "linker"},
 	{InputMode::LanguageServer, "language server (LSP)"},
 	{InputMode::EVMAssemblerJSON, "EVM assembler (JSON format)"},
+	{InputMode::Daemon, "daemon (standard JSON server)"},
 };
 
 void CommandLineParser::checkMutuallyExclusive(std::vector<std::string> const& _optionNames)
@@ -231,6 +239,9 @@ bool CommandLineOptions::operator==(CommandLineOptions const& _other) const noex
 		input.allowedDirectories == _other.input.allowedDirectories &&
 		input.ignoreMissingFiles == _other.input.ignoreMissingFiles &&
 		input.noImportCallback == _other.input.noImportCallback &&
+		input.cacheDirectory == _other.input.cacheDirectory &&
+		input.daemonSocketPath == _other.input.daemonSocketPath &&
+		input.watchMode == _other.input.watchMode &&
 		output.dir == _other.output.dir &&
 		output.overwriteFiles == _other.output.overwriteFiles &&
 		output.evmVersion == _other.output.evmVersion &&
@@ -256,6 +267,8 @@ bool CommandLineOptions::operator==(CommandLineOptions const& _other) const noex
 		optimizer.optimizeYul == _other.optimizer.optimizeYul &&
 		optimizer.expectedExecutionsPerDeployment == _other.optimizer.expectedExecutionsPerDeployment &&
 		optimizer.yulSteps == _other.optimizer.yulSteps &&
+		optimizer.statistics == _other.optimizer.statistics &&
+		optimizer.adaptive == _other.optimizer.adaptive &&
 		modelChecker.initialize == _other.modelChecker.initialize &&
 		modelChecker.settings == _other.modelChecker.settings;
 }
@@ -496,6 +509,7 @@ void CommandLineParser::parseOutputSelection()
 			return util::contains(assemblerModeOutputs, _outputName);
 		case InputMode::StandardJson:
 		case InputMode::Linker:
+		case InputMode::Daemon:
 			return false;
 		}
 
@@ -587,6 +601,18 @@ General Information)").c_str(),
 			"Disable the default import callback to prevent the compiler from loading any source "
 			"files not listed on the command line or given in the Standard JSON input."
 		)
+		(
+			g_strCacheDir.c_str(),
+			po::value<std::string>()->value_name("path"),
+			"Cache compilation outputs and optimised Yul objects in the given directory and "
+			"reuse them for identical inputs. Can only be used in Standard JSON mode."
+		)
+		(
+			g_strWatch.c_str(),
+			"Keep running after the first compilation and recompile whenever one of the input "
+			"files or any file loaded through imports changes. Can only be used in compiler mode "
+			"with input files given on the command line."
+		)
 	;
 	desc.add(inputOptions);
 
@@ -686,6 +712,14 @@ General Information)").c_str(),
 			"Switch to language server mode (\"LSP\"). Allows the compiler to be used as an analysis backend "
 			"for your favourite IDE."
 		)
+		(
+			g_strDaemon.c_str(),
+			po::value<std::string>()->value_name("path"),
+			"Switch to daemon mode: listen on a unix domain socket at the given path and serve "
+			"Standard JSON requests until terminated, avoiding compiler startup cost for every request. "
+			"Each connection carries a single request, terminated by shutting down the writing side "
+			"of the connection; the response is written back on the same connection."
+		)
 	;
 	desc.add(alternativeInputModes);
 
@@ -745,6 +779,7 @@ General Information)").c_str(),
 	po::options_description outputComponents("Output Components");
 	outputComponents.add_options()
 		(CompilerOutputs::componentName(&CompilerOutputs::astCompactJson).c_str(), "AST of all source files in a compact JSON format.")
+		(CompilerOutputs::componentName(&CompilerOutputs::astBinary).c_str(), "AST of all source files in a compact binary format that can be read back via --import-ast.")
 		(CompilerOutputs::componentName(&CompilerOutputs::asm_).c_str(), "EVM assembly of the contracts.")
 		(CompilerOutputs::componentName(&CompilerOutputs::asmJson).c_str(), "EVM assembly of the contracts in JSON format.")
 		(CompilerOutputs::componentName(&CompilerOutputs::opcodes).c_str(), "Opcodes of the contracts.")
@@ -824,6 +859,15 @@ General Information)").c_str(),
 			po::value<std::string>()->value_name("steps"),
 			"Forces Yul optimizer to use the specified sequence of optimization steps instead of the built-in one."
 		)
+		(
+			g_strOptimizerStats.c_str(),
+			"Collect and print per-step statistics (wall time, number of runs, AST size delta) of the Yul optimizer."
+		)
+		(
+			g_strOptimizerAdaptive.c_str(),
+			"Let the Yul optimizer skip step groups that did not change the code the last time "
+			"they ran on it and print the observed schedule per object, reusable via --yul-optimizations."
+		)
 	;
 	desc.add(optimizerOptions);
 
@@ -859,6 +903,11 @@ General Information)").c_str(),
 			" Multiple types of invariants can be selected at the same time, separated by a comma and no spaces."
 			" By default no invariants are reported."
 		)
+		(
+			g_strModelCheckerNoCounterexamples.c_str(),
+			"Report unsafe targets without reconstructing counterexample traces,"
+			" skipping the extra solver run needed per trace."
+		)
 		(
 			g_strModelCheckerPrintQuery.c_str(),
 			"Print the queries created by the SMTChecker in the SMTLIB2 format."
@@ -894,6 +943,12 @@ General Information)").c_str(),
 			"The default is a deterministic resource limit."
 			"A timeout of 0 means no resource/time restrictions for any query."
 		)
+		(
+			g_strModelCheckerTimeoutLadder.c_str(),
+			"Query each verification target first with a small fraction of the budget"
+			" and retry only the unsolved targets with the full budget."
+			" Only used by the CHC engine with z3."
+		)
 		(
 			g_strModelCheckerBMCLoopIterations.c_str(),
 			po::value<unsigned>(),
@@ -958,6 +1013,7 @@ void CommandLineParser::processArgs()
 		g_strImportAst,
 		g_strLSP,
 		g_strImportEvmAssemblerJson,
+		g_strDaemon,
 	});
 
 	if (m_args.count(g_strHelp) > 0)
@@ -978,6 +1034,8 @@ void CommandLineParser::processArgs()
 		m_options.input.mode = InputMode::CompilerWithASTImport;
 	else if (m_args.count(g_strImportEvmAssemblerJson) > 0)
 		m_options.input.mode = InputMode::EVMAssemblerJSON;
+	else if (m_args.count(g_strDaemon) > 0)
+		m_options.input.mode = InputMode::Daemon;
 	else
 		m_options.input.mode = InputMode::Compiler;
 
@@ -999,12 +1057,14 @@ void CommandLineParser::processArgs()
 		{g_strModelCheckerDivModNoSlacks, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerEngine, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerInvariants, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strModelCheckerNoCounterexamples, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerPrintQuery, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerShowProvedSafe, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerShowUnproved, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerShowUnsupported, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerSolvers, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerTimeout, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strModelCheckerTimeoutLadder, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerBMCLoopIterations, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerContracts, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerTargets, {InputMode::Compiler, InputMode::CompilerWithASTImport}}
@@ -1034,7 +1094,10 @@ void CommandLineParser::processArgs()
 	checkMutuallyExclusive({g_strStopAfter, g_strGas});
 
 	for (std::string const& option: CompilerOutputs::componentMap() | ranges::views::keys)
-		if (option != CompilerOutputs::componentName(&CompilerOutputs::astCompactJson))
+		if (
+			option != CompilerOutputs::componentName(&CompilerOutputs::astCompactJson) &&
+			option != CompilerOutputs::componentName(&CompilerOutputs::astBinary)
+		)
 			checkMutuallyExclusive({g_strStopAfter, option});
 
 	if (m_options.input.mode == InputMode::EVMAssemblerJSON)
@@ -1182,8 +1245,35 @@ void CommandLineParser::processArgs()
 			m_options.output.stopAfter = CompilerStack::State::Parsed;
 	}
 
+	if (m_args.count(g_strCacheDir))
+	{
+		if (m_options.input.mode != InputMode::StandardJson && m_options.input.mode != InputMode::Daemon)
+			solThrow(
+				CommandLineValidationError,
+				"Option --" + g_strCacheDir + " is only valid in Standard JSON or daemon mode."
+			);
+		m_options.input.cacheDirectory = m_args[g_strCacheDir].as<std::string>();
+	}
+
+	if (m_options.input.mode == InputMode::Daemon)
+	{
+		m_options.input.daemonSocketPath = m_args[g_strDaemon].as<std::string>();
+		if (m_options.input.daemonSocketPath.empty())
+			solThrow(CommandLineValidationError, "Option --" + g_strDaemon + " requires a non-empty socket path.");
+		return;
+	}
+
 	parseInputPathsAndRemappings();
 
+	if (m_args.count(g_strWatch) > 0)
+	{
+		if (m_options.input.mode != InputMode::Compiler)
+			solThrow(CommandLineValidationError, "Option --" + g_strWatch + " is only valid in compiler mode.");
+		if (m_options.input.addStdin)
+			solThrow(CommandLineValidationError, "Option --" + g_strWatch + " cannot be used with standard input, since it cannot be re-read.");
+		m_options.input.watchMode = true;
+	}
+
 	if (m_options.input.mode == InputMode::StandardJson)
 		return;
 
@@ -1219,6 +1309,8 @@ void CommandLineParser::processArgs()
 		);
 
 	m_options.optimizer.optimizeEvmasm = (m_args.count(g_strOptimize) > 0);
+	m_options.optimizer.statistics = (m_args.count(g_strOptimizerStats) > 0);
+	m_options.optimizer.adaptive = (m_args.count(g_strOptimizerAdaptive) > 0);
 	m_options.optimizer.optimizeYul = (
 		(m_args.count(g_strOptimize) > 0 && m_args.count(g_strNoOptimizeYul) == 0) ||
 		m_args.count(g_strOptimizeYul) > 0
@@ -1368,6 +1460,9 @@ void CommandLineParser::processArgs()
 		m_options.modelChecker.settings.invariants = *invs;
 	}
 
+	if (m_args.count(g_strModelCheckerNoCounterexamples))
+		m_options.modelChecker.settings.noCounterexamples = true;
+
 	if (m_args.count(g_strModelCheckerShowProvedSafe))
 		m_options.modelChecker.settings.showProvedSafe = true;
 
@@ -1405,6 +1500,9 @@ void CommandLineParser::processArgs()
 	if (m_args.count(g_strModelCheckerTimeout))
 		m_options.modelChecker.settings.timeout = m_args[g_strModelCheckerTimeout].as<unsigned>();
 
+	if (m_args.count(g_strModelCheckerTimeoutLadder))
+		m_options.modelChecker.settings.timeoutLadder = true;
+
 	if (m_args.count(g_strModelCheckerBMCLoopIterations))
 	{
 		if (!m_options.modelChecker.settings.engine.bmc)
@@ -1419,12 +1517,14 @@ void CommandLineParser::processArgs()
 		m_args.count(g_strModelCheckerEngine) ||
 		m_args.count(g_strModelCheckerExtCalls) ||
 		m_args.count(g_strModelCheckerInvariants) ||
+		m_args.count(g_strModelCheckerNoCounterexamples) ||
 		m_args.count(g_strModelCheckerShowProvedSafe) ||
 		m_args.count(g_strModelCheckerShowUnproved) ||
 		m_args.count(g_strModelCheckerShowUnsupported) ||
 		m_args.count(g_strModelCheckerSolvers) ||
 		m_args.count(g_strModelCheckerTargets) ||
-		m_args.count(g_strModelCheckerTimeout);
+		m_args.count(g_strModelCheckerTimeout) ||
+		m_args.count(g_strModelCheckerTimeoutLadder);
 	m_options.output.viaIR = (m_args.count(g_strExperimentalViaIR) > 0 || m_args.count(g_strViaIR) > 0);
 
 	solAssert(
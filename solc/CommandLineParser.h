@@ -57,7 +57,8 @@ enum class InputMode
 	Linker,
 	Assembler,
 	LanguageServer,
-	EVMAssemblerJSON
+	EVMAssemblerJSON,
+	Daemon
 };
 
 struct CompilerOutputs
@@ -71,6 +72,7 @@ struct CompilerOutputs
 	{
 		static std::map<std::string, bool CompilerOutputs::*> const components = {
 			{"ast-compact-json", &CompilerOutputs::astCompactJson},
+			{"ast-binary", &CompilerOutputs::astBinary},
 			{"asm", &CompilerOutputs::asm_},
 			{"asm-json", &CompilerOutputs::asmJson},
 			{"opcodes", &CompilerOutputs::opcodes},
@@ -91,6 +93,7 @@ struct CompilerOutputs
 	}
 
 	bool astCompactJson = false;
+	bool astBinary = false;
 	bool asm_ = false;
 	bool asmJson = false;
 	bool opcodes = false;
@@ -176,6 +179,9 @@ struct CommandLineOptions
 		FileReader::FileSystemPathSet allowedDirectories;
 		bool ignoreMissingFiles = false;
 		bool noImportCallback = false;
+		std::optional<boost::filesystem::path> cacheDirectory;
+		boost::filesystem::path daemonSocketPath;
+		bool watchMode = false;
 	} input;
 
 	struct
@@ -228,6 +234,8 @@ struct CommandLineOptions
 		bool optimizeYul = false;
 		std::optional<unsigned> expectedExecutionsPerDeployment;
 		std::optional<std::string> yulSteps;
+		bool statistics = false;
+		bool adaptive = false;
 	} optimizer;
 
 	struct
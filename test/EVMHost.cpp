@@ -31,6 +31,8 @@
 #include <libsolutil/Keccak256.h>
 #include <libsolutil/picosha2.h>
 
+#include <mutex>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::util;
@@ -41,6 +43,10 @@ evmc::VM& EVMHost::getVM(string const& _path)
 {
 	static evmc::VM NullVM{nullptr};
 	static map<string, unique_ptr<evmc::VM>> vms;
+	// The loaded VMs are shared between all hosts, which can live on different
+	// threads when the test runner shards test cases.
+	static std::mutex vmsMutex;
+	std::lock_guard lock(vmsMutex);
 	if (vms.count(_path) == 0)
 	{
 		evmc_loader_error_code errorCode = {};
@@ -169,6 +175,22 @@ void EVMHost::reset()
 	}
 }
 
+EVMHost::StateSnapshot EVMHost::snapshot() const
+{
+	return {accounts, tx_context};
+}
+
+void EVMHost::restore(StateSnapshot const& _snapshot)
+{
+	accounts = _snapshot.accounts;
+	tx_context = _snapshot.txContext;
+	recorded_selfdestructs.clear();
+	recorded_calls.clear();
+	recorded_account_accesses.clear();
+	recorded_logs.clear();
+	recorded_blockhashes.clear();
+}
+
 void EVMHost::newTransactionFrame()
 {
 	// Clear EIP-2929 account access indicator
@@ -77,9 +77,23 @@ public:
 
 	explicit EVMHost(langutil::EVMVersion _evmVersion, evmc::VM& _vm);
 
+	/// Snapshot of the world state that can be restored later via @a restore().
+	struct StateSnapshot
+	{
+		std::unordered_map<evmc::address, evmc::MockedAccount> accounts;
+		evmc_tx_context txContext;
+	};
+
 	/// Reset entire state (including accounts).
 	void reset();
 
+	/// @returns a snapshot of the current account state and transaction context.
+	StateSnapshot snapshot() const;
+
+	/// Restores a state previously recorded by @a snapshot(). Transient records
+	/// (logs, call records, access indicators, pending selfdestructs) are cleared.
+	void restore(StateSnapshot const& _snapshot);
+
 	/// Start new block.
 	void newBlock()
 	{
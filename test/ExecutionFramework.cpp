@@ -87,6 +87,22 @@ void ExecutionFramework::reset()
 			EVMHost::convertToEVMC(u256(1) << 100);
 }
 
+void ExecutionFramework::takeSnapshot()
+{
+	m_stateSnapshot = m_evmcHost->snapshot();
+	m_snapshotContractAddress = m_contractAddress;
+}
+
+void ExecutionFramework::restoreSnapshot()
+{
+	solAssert(m_stateSnapshot.has_value(), "No snapshot to restore.");
+	m_evmcHost->restore(*m_stateSnapshot);
+	m_contractAddress = m_snapshotContractAddress;
+	m_transactionSuccessful = true;
+	m_output.clear();
+	m_gasUsed = 0;
+}
+
 std::pair<bool, string> ExecutionFramework::compareAndCreateMessage(
 	bytes const& _result,
 	bytes const& _expectation
@@ -35,6 +35,7 @@
 #include <libsolutil/ErrorCodes.h>
 
 #include <functional>
+#include <optional>
 
 #include <boost/rational.hpp>
 #include <boost/test/unit_test.hpp>
@@ -277,6 +278,13 @@ protected:
 	void selectVM(evmc_capabilities _cap = evmc_capabilities::EVMC_CAPABILITY_EVM1);
 	void reset();
 
+	/// Records the current blockchain state and contract address so that
+	/// @a restoreSnapshot() can roll back to this point. Allows tests that share
+	/// a deployment to avoid paying for it repeatedly.
+	void takeSnapshot();
+	/// Rolls the blockchain state back to the last @a takeSnapshot() call.
+	void restoreSnapshot();
+
 	void sendMessage(bytes const& _data, bool _isCreation, u256 const& _value = 0);
 	void sendEther(util::h160 const& _to, u256 const& _value);
 	size_t currentTimestamp();
@@ -304,6 +312,9 @@ protected:
 	util::h160 m_contractAddress;
 	bytes m_output;
 	u256 m_gasUsed;
+
+	std::optional<EVMHost::StateSnapshot> m_stateSnapshot;
+	util::h160 m_snapshotContractAddress;
 };
 
 #define ABI_CHECK(result, expectation) do { \
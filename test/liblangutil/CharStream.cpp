@@ -24,7 +24,10 @@
 #include <liblangutil/CharStream.h>
 #include <liblangutil/Exceptions.h>
 
+#include <libsolutil/TemporaryDirectory.h>
+
 #include <test/Common.h>
+#include <test/FilesystemUtils.h>
 
 #include <boost/test/unit_test.hpp>
 
@@ -74,6 +77,23 @@ BOOST_AUTO_TEST_CASE(test_fail)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(memory_mapped_backing)
+{
+	util::TemporaryDirectory tempDir("char-stream-test");
+	solidity::test::createFileWithContent(tempDir.path() / "test.sol", "now is the time for testing");
+
+	auto mapping = std::make_shared<util::MemoryMappedFile const>(tempDir.path() / "test.sol");
+	CharStream stream(mapping, "source");
+
+	BOOST_CHECK_EQUAL(stream.size(), 27);
+	BOOST_CHECK('n' == stream.get());
+	BOOST_CHECK('o' == stream.advanceAndGet());
+	BOOST_CHECK('w' == stream.setPosition(2));
+	BOOST_CHECK(stream.sourceView() == "now is the time for testing");
+	// source() materializes an owned copy only on demand.
+	BOOST_CHECK_EQUAL(stream.source(), "now is the time for testing");
+}
+
 namespace
 {
 std::optional<int> toPosition(int _line, int _column, std::string const& _text)
@@ -83,6 +103,31 @@ std::optional<int> toPosition(int _line, int _column, std::string const& _text)
 	);
 }
 
+std::pair<int, int> toLineColumn(int _position, std::string const& _text)
+{
+	LineColumn lineColumn = CharStream{_text, "source"}.translatePositionToLineColumn(_position);
+	return {lineColumn.line, lineColumn.column};
+}
+
+}
+
+BOOST_AUTO_TEST_CASE(translatePositionToLineColumn)
+{
+	BOOST_CHECK(toLineColumn(0, "") == std::make_pair(0, 0));
+	BOOST_CHECK(toLineColumn(5, "") == std::make_pair(0, 0));
+
+	BOOST_CHECK(toLineColumn(0, "ABC") == std::make_pair(0, 0));
+	BOOST_CHECK(toLineColumn(2, "ABC") == std::make_pair(0, 2));
+	BOOST_CHECK(toLineColumn(3, "ABC") == std::make_pair(0, 3));
+
+	// Position of the LF itself still belongs to the line it terminates.
+	BOOST_CHECK(toLineColumn(3, "ABC\nDEF") == std::make_pair(0, 3));
+	BOOST_CHECK(toLineColumn(4, "ABC\nDEF") == std::make_pair(1, 0));
+	BOOST_CHECK(toLineColumn(6, "ABC\nDEF") == std::make_pair(1, 2));
+	BOOST_CHECK(toLineColumn(7, "ABC\nDEF") == std::make_pair(1, 3));
+
+	BOOST_CHECK(toLineColumn(8, "ABC\nDEF\n") == std::make_pair(2, 0));
+	BOOST_CHECK(toLineColumn(100, "ABC\nDEF\n") == std::make_pair(2, 0));
 }
 
 BOOST_AUTO_TEST_CASE(translateLineColumnToPosition)
@@ -1026,6 +1026,44 @@ BOOST_AUTO_TEST_CASE(yul_function_with_whitespace)
 	BOOST_CHECK_EQUAL(scanner.next(), Token::EOS);
 }
 
+BOOST_AUTO_TEST_CASE(token_stream_record_and_replay)
+{
+	CharStream stream("/// @dev docs\ncontract C { uint x = 0x42; /* comment */ string s = \"abc\"; }", "");
+	BOOST_CHECK(!stream.tokenStream());
+
+	struct TokenData { Token token; std::string literal; SourceLocation location; };
+	auto scanAll = [&]() {
+		std::vector<TokenData> result;
+		Scanner scanner(stream);
+		while (true)
+		{
+			result.push_back({scanner.currentToken(), scanner.currentLiteral(), scanner.currentLocation()});
+			if (scanner.currentToken() == Token::EOS)
+				break;
+			scanner.next();
+		}
+		return result;
+	};
+
+	std::vector<TokenData> firstScan = scanAll();
+	BOOST_REQUIRE(stream.tokenStream());
+	BOOST_CHECK_EQUAL(stream.tokenStream()->size(), firstScan.size());
+	BOOST_CHECK(stream.tokenStream()->kind() == ScannerKind::Solidity);
+
+	std::shared_ptr<TokenStream const> recorded = stream.tokenStream();
+	std::vector<TokenData> secondScan = scanAll();
+	// The replayed scan must not re-record the stream.
+	BOOST_CHECK(stream.tokenStream() == recorded);
+
+	BOOST_REQUIRE_EQUAL(firstScan.size(), secondScan.size());
+	for (size_t i = 0; i < firstScan.size(); ++i)
+	{
+		BOOST_CHECK_EQUAL(firstScan[i].token, secondScan[i].token);
+		BOOST_CHECK_EQUAL(firstScan[i].literal, secondScan[i].literal);
+		BOOST_CHECK(firstScan[i].location == secondScan[i].location);
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
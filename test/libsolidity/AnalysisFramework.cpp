@@ -32,6 +32,7 @@
 
 #include <liblangutil/Scanner.h>
 
+#include <libsolutil/CommonData.h>
 #include <libsolutil/FunctionSelector.h>
 
 #include <boost/test/unit_test.hpp>
@@ -228,5 +229,5 @@ FunctionTypePointer AnalysisFramework::retrieveFunctionBySignature(
 	std::string const& _signature
 )
 {
-	return _contract.interfaceFunctions()[util::selectorFromSignatureH32(_signature)];
+	return util::valueOrDefault(_contract.interfaceFunctions(), util::selectorFromSignatureH32(_signature), nullptr, util::allow_copy);
 }
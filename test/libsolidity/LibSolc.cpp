@@ -22,6 +22,7 @@
 
 #include <string>
 #include <boost/test/unit_test.hpp>
+#include <libsolutil/CommonData.h>
 #include <libsolutil/JSON.h>
 #include <libsolidity/interface/ReadFile.h>
 #include <libsolidity/interface/Version.h>
@@ -178,6 +179,111 @@ BOOST_AUTO_TEST_CASE(with_callback)
 	BOOST_CHECK(containsError(result, "ParserError", "Source \"notfound.sol\" not found: Callback not supported."));
 }
 
+BOOST_AUTO_TEST_CASE(context_compilation)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"fileA": {
+				"content": "contract A { }"
+			}
+		},
+		"settings": {
+			"outputSelection": { "*": { "*": ["evm.bytecode", "evm.deployedBytecode"] } }
+		}
+	}
+	)";
+
+	SolidityContext* context = solidity_context_create(nullptr, nullptr);
+	BOOST_REQUIRE(context != nullptr);
+
+	// The same context can be used for multiple compilations.
+	for (size_t run = 0; run < 2; run++)
+	{
+		Json::Value result;
+		BOOST_REQUIRE(util::jsonParseStrict(solidity_context_compile(context, input), result));
+		BOOST_REQUIRE(result.isObject());
+		BOOST_CHECK(result.isMember("contracts"));
+
+		unsigned char const* data = nullptr;
+		size_t size = 0;
+		BOOST_REQUIRE(solidity_context_bytecode(context, "fileA", "A", false, &data, &size));
+		BOOST_REQUIRE(data != nullptr);
+		BOOST_REQUIRE(size > 0);
+		std::string hex = result["contracts"]["fileA"]["A"]["evm"]["bytecode"]["object"].asString();
+		BOOST_CHECK_EQUAL(util::toHex(bytes(data, data + size)), hex);
+
+		// Not present in the output.
+		BOOST_CHECK(!solidity_context_bytecode(context, "fileA", "B", false, &data, &size));
+	}
+
+	solidity_context_destroy(context);
+}
+
+BOOST_AUTO_TEST_CASE(context_compilation_callback)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"fileA": {
+				"content": "contract A { }"
+			}
+		}
+	}
+	)";
+
+	SolidityContext* context = solidity_context_create(nullptr, nullptr);
+	BOOST_REQUIRE(context != nullptr);
+
+	std::string output;
+	CStyleOutputCallback outputCallback{
+		[](void* _context, char const* _data, size_t _size)
+		{
+			static_cast<std::string*>(_context)->append(_data, _size);
+		}
+	};
+	solidity_context_compile_callback(context, input, outputCallback, &output);
+
+	Json::Value result;
+	BOOST_REQUIRE(util::jsonParseStrict(output, result));
+	BOOST_REQUIRE(result.isObject());
+	BOOST_CHECK(result.isMember("sources"));
+
+	solidity_context_destroy(context);
+}
+
+BOOST_AUTO_TEST_CASE(context_compilation_buffer)
+{
+	std::string input = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"fileA": {
+				"content": "contract A { }"
+			}
+		}
+	}
+	)";
+
+	SolidityContext* context = solidity_context_create(nullptr, nullptr);
+	BOOST_REQUIRE(context != nullptr);
+
+	// Ownership of the input buffer passes to the compiler.
+	size_t outputSize = 0;
+	char const* output = solidity_context_compile_buffer(context, stringToSolidity(input), &outputSize);
+	BOOST_REQUIRE(output != nullptr);
+	BOOST_CHECK_EQUAL(outputSize, std::strlen(output));
+
+	Json::Value result;
+	BOOST_REQUIRE(util::jsonParseStrict(std::string(output, outputSize), result));
+	BOOST_REQUIRE(result.isObject());
+	BOOST_CHECK(result.isMember("sources"));
+
+	solidity_context_destroy(context);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -29,10 +29,13 @@
 #include <liblangutil/Exceptions.h>
 #include <liblangutil/SourceReferenceFormatter.h>
 
+#include <libsolutil/Keccak256.h>
+
 #include <boost/test/framework.hpp>
 
 #include <cstdlib>
 #include <iostream>
+#include <mutex>
 
 using namespace solidity;
 using namespace solidity::frontend;
@@ -40,6 +43,19 @@ using namespace solidity::frontend::test;
 using namespace solidity::langutil;
 using namespace solidity::test;
 
+namespace
+{
+
+/// Process-wide cache of creation bytecode, shared between isoltest worker threads.
+/// Test files frequently contain identical sources compiled with identical settings,
+/// so code generation - by far the most expensive phase - only has to run once per
+/// distinct input. Cache hits still run analysis so that AST and ABI queries on the
+/// compiler keep working.
+std::mutex g_bytecodeCacheMutex;
+std::map<util::h256, bytes> g_bytecodeCache;
+
+}
+
 bytes SolidityExecutionFramework::multiSourceCompileContract(
 	std::map<std::string, std::string> const& _sourceCode,
 	std::optional<std::string> const& _mainSourceName,
@@ -50,11 +66,13 @@ bytes SolidityExecutionFramework::multiSourceCompileContract(
 	if (_mainSourceName.has_value())
 		solAssert(_sourceCode.find(_mainSourceName.value()) != _sourceCode.end(), "");
 
-	m_compiler.reset();
-	m_compiler.setSources(withPreamble(
+	std::map<std::string, std::string> sourceCode = withPreamble(
 		_sourceCode,
 		solidity::test::CommonOptions::get().useABIEncoderV1 // _addAbicoderV1Pragma
-	));
+	);
+
+	m_compiler.reset();
+	m_compiler.setSources(sourceCode);
 	m_compiler.setLibraries(_libraryAddresses);
 	m_compiler.setRevertStringBehaviour(m_revertStrings);
 	m_compiler.setEVMVersion(m_evmVersion);
@@ -68,6 +86,23 @@ bytes SolidityExecutionFramework::multiSourceCompileContract(
 	}
 	m_compiler.setMetadataHash(m_metadataHash);
 
+	// Showing the metadata requires a full compile, so bypass the cache in that case.
+	util::h256 cacheKey;
+	if (!m_showMetadata)
+	{
+		cacheKey = bytecodeCacheKey(sourceCode, _mainSourceName, _contractName, _libraryAddresses);
+		bytes const* cachedBytecode = nullptr;
+		{
+			std::lock_guard<std::mutex> lock(g_bytecodeCacheMutex);
+			auto it = g_bytecodeCache.find(cacheKey);
+			if (it != g_bytecodeCache.end())
+				// References into std::map stay valid under concurrent insertions.
+				cachedBytecode = &it->second;
+		}
+		if (cachedBytecode && m_compiler.parseAndAnalyze())
+			return *cachedBytecode;
+	}
+
 	if (!m_compiler.compile())
 	{
 		// The testing framework expects an exception for
@@ -85,9 +120,52 @@ bytes SolidityExecutionFramework::multiSourceCompileContract(
 	BOOST_REQUIRE(obj.linkReferences.empty());
 	if (m_showMetadata)
 		std::cout << "metadata: " << m_compiler.metadata(contractName) << std::endl;
+	else
+	{
+		std::lock_guard<std::mutex> lock(g_bytecodeCacheMutex);
+		g_bytecodeCache.emplace(cacheKey, obj.bytecode);
+	}
 	return obj.bytecode;
 }
 
+util::h256 SolidityExecutionFramework::bytecodeCacheKey(
+	std::map<std::string, std::string> const& _sourceCode,
+	std::optional<std::string> const& _mainSourceName,
+	std::string const& _contractName,
+	std::map<std::string, Address> const& _libraryAddresses
+) const
+{
+	std::string keyData;
+	for (auto const& [sourceName, source]: _sourceCode)
+		keyData += sourceName + '\0' + source + '\0';
+	keyData += _contractName + '\0' + _mainSourceName.value_or("") + '\0';
+	for (auto const& [library, address]: _libraryAddresses)
+		keyData += library + '\0' + util::toHex(address.asBytes()) + '\0';
+	keyData += m_evmVersion.name();
+	keyData += static_cast<char>(m_eofVersion.value_or(0));
+	keyData += static_cast<char>(m_revertStrings);
+	keyData += static_cast<char>(m_compileViaYul);
+	keyData += static_cast<char>(m_appendCBORMetadata);
+	keyData += static_cast<char>(m_metadataHash);
+	for (bool flag: {
+		m_optimiserSettings.runOrderLiterals,
+		m_optimiserSettings.runInliner,
+		m_optimiserSettings.runJumpdestRemover,
+		m_optimiserSettings.runPeephole,
+		m_optimiserSettings.runDeduplicate,
+		m_optimiserSettings.runCSE,
+		m_optimiserSettings.runConstantOptimiser,
+		m_optimiserSettings.optimizeStackAllocation,
+		m_optimiserSettings.runYulOptimiser
+	})
+		keyData += static_cast<char>(flag);
+	keyData +=
+		m_optimiserSettings.yulOptimiserSteps + '\0' +
+		m_optimiserSettings.yulOptimiserCleanupSteps + '\0' +
+		std::to_string(m_optimiserSettings.expectedExecutionsPerDeployment);
+	return util::keccak256(keyData);
+}
+
 bytes SolidityExecutionFramework::compileContract(
 	std::string const& _sourceCode,
 	std::string const& _contractName,
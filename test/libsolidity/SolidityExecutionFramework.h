@@ -80,6 +80,15 @@ public:
 	);
 
 protected:
+	/// @returns a digest of the full compiler input, used as key into the shared
+	/// bytecode cache.
+	util::h256 bytecodeCacheKey(
+		std::map<std::string, std::string> const& _sourceCode,
+		std::optional<std::string> const& _mainSourceName,
+		std::string const& _contractName,
+		std::map<std::string, solidity::test::Address> const& _libraryAddresses
+	) const;
+
 	using CompilerStack = solidity::frontend::CompilerStack;
 	std::optional<uint8_t> m_eofVersion;
 	CompilerStack m_compiler;
@@ -1611,6 +1611,58 @@ BOOST_AUTO_TEST_CASE(stopAfter_invalid_type)
 	BOOST_CHECK(containsError(result, "JSONError", "\"settings.stopAfter\" must be a string."));
 }
 
+BOOST_AUTO_TEST_CASE(jobs_invalid_value)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources":
+		{ "": { "content": "pragma solidity >=0.0; contract C { function f() public pure {} }" } },
+		"settings":
+		{
+			"jobs": 0,
+			"outputSelection":
+			{
+				"*": { "C": ["evm.bytecode"] }
+			}
+		}
+	}
+	)";
+	Json::Value result = compile(input);
+	BOOST_CHECK(containsError(result, "JSONError", "\"settings.jobs\" must be an unsigned integer greater than zero."));
+}
+
+BOOST_AUTO_TEST_CASE(jobs_via_ir)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources":
+		{
+			"a.sol": { "content": "pragma solidity >=0.0; contract A { function f() public pure {} }" },
+			"b.sol": { "content": "pragma solidity >=0.0; contract B { function g() public pure {} }" }
+		},
+		"settings":
+		{
+			"viaIR": true,
+			"jobs": 2,
+			"outputSelection":
+			{
+				"*": { "*": ["evm.bytecode"] }
+			}
+		}
+	}
+	)";
+	Json::Value result = compile(input);
+	BOOST_CHECK(containsAtMostWarnings(result));
+	Json::Value contractA = getContractResult(result, "a.sol", "A");
+	BOOST_CHECK(contractA.isObject());
+	BOOST_CHECK(contractA["evm"]["bytecode"].isObject());
+	Json::Value contractB = getContractResult(result, "b.sol", "B");
+	BOOST_CHECK(contractB.isObject());
+	BOOST_CHECK(contractB["evm"]["bytecode"].isObject());
+}
+
 BOOST_AUTO_TEST_CASE(stopAfter_bin_conflict)
 {
 	char const* input = R"(
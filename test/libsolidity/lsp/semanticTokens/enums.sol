@@ -37,5 +37,6 @@ function getColorEnum() pure returns (Color result)
 //         2, 4, 6, 2, 0,
 //         0, 9, 5, 2, 0,
 //         0, 6, 3, 3, 0
-//     ]
+//     ],
+//     "resultId": "1"
 // }
@@ -47,5 +47,6 @@ contract Contract
 //         2, 13, 9, 5, 0,
 //         0, 33, 4, 11, 0,
 //         2, 15, 4, 11, 0
-//     ]
+//     ],
+//     "resultId": "1"
 // }
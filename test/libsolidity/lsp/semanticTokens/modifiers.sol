@@ -77,5 +77,6 @@ contract C
 //         0, 11, 8, 19, 0,
 //         0, 11, 1, 19, 0,
 //         0, 4, 1, 19, 0
-//     ]
+//     ],
+//     "resultId": "1"
 // }
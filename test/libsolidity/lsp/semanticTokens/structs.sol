@@ -44,5 +44,6 @@ function memberAccess(RGBColor memory color) pure returns(uint)
 //         2, 17, 3, 19, 0,
 //         0, 12, 5, 19, 0,
 //         0, 14, 4, 19, 0
-//     ]
+//     ],
+//     "resultId": "1"
 // }
@@ -0,0 +1,75 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the arena allocator.
+ */
+
+#include <libsolutil/Arena.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstring>
+#include <memory>
+
+namespace solidity::util::test
+{
+
+BOOST_AUTO_TEST_SUITE(ArenaTest)
+
+BOOST_AUTO_TEST_CASE(alignment)
+{
+	Arena arena;
+	for (std::size_t alignment: {1, 2, 4, 8, 16, 32})
+	{
+		void* memory = arena.allocate(alignment * 3, alignment);
+		BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(memory) % alignment, 0);
+		// Make sure the memory is actually usable.
+		std::memset(memory, 0xaa, alignment * 3);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(large_allocations_span_blocks)
+{
+	Arena arena;
+	// Larger than the initial block size so that fresh blocks have to be reserved.
+	void* first = arena.allocate(std::size_t(1) << 17, 8);
+	void* second = arena.allocate(std::size_t(1) << 17, 8);
+	BOOST_CHECK(first != second);
+	std::memset(first, 0x11, std::size_t(1) << 17);
+	std::memset(second, 0x22, std::size_t(1) << 17);
+}
+
+BOOST_AUTO_TEST_CASE(allocate_shared_keeps_arena_alive)
+{
+	std::weak_ptr<Arena> observer;
+	std::shared_ptr<int> object;
+	{
+		auto arena = std::make_shared<Arena>();
+		observer = arena;
+		object = std::allocate_shared<int>(ArenaAllocator<int>(arena), 42);
+	}
+	// The object's control block holds the allocator and with it the arena.
+	BOOST_REQUIRE(!observer.expired());
+	BOOST_CHECK_EQUAL(*object, 42);
+	object.reset();
+	BOOST_CHECK(observer.expired());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,76 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for BinaryJSON.h.
+ */
+
+#include <libsolutil/BinaryJSON.h>
+#include <libsolutil/JSON.h>
+
+#include <test/Common.h>
+
+#include <boost/test/unit_test.hpp>
+
+namespace solidity::util::test
+{
+
+BOOST_AUTO_TEST_SUITE(BinaryJsonTest, *boost::unit_test::label("nooptions"))
+
+BOOST_AUTO_TEST_CASE(roundtrip)
+{
+	auto roundtrip = [](std::string const& _jsonText) {
+		Json::Value original;
+		BOOST_REQUIRE(jsonParseStrict(_jsonText, original));
+		std::string encoded = binaryJsonPrint(original);
+		BOOST_CHECK(isBinaryJson(encoded));
+		Json::Value decoded;
+		BOOST_REQUIRE(binaryJsonParse(encoded, decoded));
+		BOOST_CHECK_EQUAL(jsonCompactPrint(decoded), jsonCompactPrint(original));
+	};
+
+	roundtrip("null");
+	roundtrip("true");
+	roundtrip("[]");
+	roundtrip("{}");
+	roundtrip("[0,1,-1,127,128,-128,9223372036854775807,-9223372036854775808]");
+	roundtrip("[0.5,-2.25]");
+	roundtrip("[\"\",\"nodeType\",\"\\u00e4\\n\"]");
+	roundtrip("{\"nodeType\":\"SourceUnit\",\"nodes\":[{\"id\":1,\"literals\":[\"solidity\",\"0.8\"]}]}");
+}
+
+BOOST_AUTO_TEST_CASE(malformed_input)
+{
+	Json::Value value;
+	// Not the binary format at all.
+	BOOST_CHECK(!isBinaryJson("{\"a\": 1}"));
+	BOOST_CHECK(!binaryJsonParse("{\"a\": 1}", value));
+	// Magic header only, without a version and document.
+	BOOST_CHECK(!binaryJsonParse("solc-bjson", value));
+
+	std::string encoded = binaryJsonPrint(Json::Value("some string"));
+	// Truncation and trailing garbage are both rejected.
+	BOOST_CHECK(!binaryJsonParse(encoded.substr(0, encoded.size() - 1), value));
+	BOOST_CHECK(!binaryJsonParse(encoded + "x", value));
+	// Unsupported version.
+	encoded[10] = '\xff';
+	BOOST_CHECK(!binaryJsonParse(encoded, value));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -96,6 +96,22 @@ BOOST_AUTO_TEST_CASE(tohex_bytes)
 	BOOST_CHECK_EQUAL(toHex(fromHex("00112233445566778899aAbBcCdDeEfF"), HexPrefix::Add, static_cast<HexCase>(42)), "0x00112233445566778899aabbccddeeff");
 }
 
+BOOST_AUTO_TEST_CASE(hex_buffer_roundtrip)
+{
+	bytes data = fromHex("00112233445566778899aabbccddeeff");
+	std::string encoded(data.size() * 2, 0);
+	toHex(data.data(), data.size(), encoded.data(), HexCase::Lower);
+	BOOST_CHECK_EQUAL(encoded, "00112233445566778899aabbccddeeff");
+	toHex(data.data(), data.size(), encoded.data(), HexCase::Upper);
+	BOOST_CHECK_EQUAL(encoded, "00112233445566778899AABBCCDDEEFF");
+	BOOST_CHECK_THROW(toHex(data.data(), data.size(), encoded.data(), HexCase::Mixed), BadHexCase);
+
+	bytes decoded(encoded.size() / 2, 0);
+	BOOST_CHECK(fromHex(encoded.data(), encoded.size(), decoded.data()));
+	BOOST_CHECK_EQUAL(decoded, data);
+	BOOST_CHECK(!fromHex("gg", 2, decoded.data()));
+}
+
 BOOST_AUTO_TEST_CASE(test_format_number)
 {
 	BOOST_CHECK_EQUAL(formatNumber(u256(0x8000000)), "0x08000000");
@@ -0,0 +1,182 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the open-addressing hash map and set.
+ */
+
+#include <libsolutil/FlatHashMap.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <map>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+namespace solidity::util::test
+{
+
+BOOST_AUTO_TEST_SUITE(FlatHashMapTest)
+
+BOOST_AUTO_TEST_CASE(basic_operations)
+{
+	FlatHashMap<std::string, int> map;
+	BOOST_CHECK(map.empty());
+	BOOST_CHECK(map.begin() == map.end());
+
+	map["a"] = 1;
+	map["b"] = 2;
+	BOOST_CHECK_EQUAL(map.size(), 2);
+	BOOST_CHECK_EQUAL(map.at("a"), 1);
+	BOOST_CHECK(map.contains("b"));
+	BOOST_CHECK(map.find("c") == map.end());
+
+	map["a"] = 7;
+	BOOST_CHECK_EQUAL(map.size(), 2);
+	BOOST_CHECK_EQUAL(map.at("a"), 7);
+
+	BOOST_CHECK_EQUAL(map.erase("a"), 1);
+	BOOST_CHECK_EQUAL(map.erase("a"), 0);
+	BOOST_CHECK_EQUAL(map.count("a"), 0);
+	BOOST_CHECK_THROW(map.at("a"), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(try_emplace_does_not_overwrite)
+{
+	FlatHashMap<std::string, int> map{{"a", 1}};
+	auto [existing, insertedExisting] = map.try_emplace("a", 99);
+	BOOST_CHECK(!insertedExisting);
+	BOOST_CHECK_EQUAL(existing->second, 1);
+	auto [added, insertedAdded] = map.try_emplace("b", 2);
+	BOOST_CHECK(insertedAdded);
+	BOOST_CHECK_EQUAL(added->second, 2);
+	map.insert_or_assign("a", 99);
+	BOOST_CHECK_EQUAL(map.at("a"), 99);
+}
+
+BOOST_AUTO_TEST_CASE(heterogeneous_string_lookup)
+{
+	FlatHashMap<std::string, int> map{{"key", 42}};
+	// Lookups with a string_view must not construct a temporary std::string.
+	std::string_view view("key");
+	BOOST_CHECK(map.contains(view));
+	BOOST_CHECK_EQUAL(map.find(view)->second, 42);
+	BOOST_CHECK_EQUAL(map.at(view), 42);
+	BOOST_CHECK_EQUAL(map.count(std::string_view("other")), 0);
+}
+
+BOOST_AUTO_TEST_CASE(copy_move_and_iteration)
+{
+	FlatHashMap<int, int> original{{1, 10}, {2, 20}, {3, 30}};
+	FlatHashMap<int, int> copy = original;
+	BOOST_CHECK_EQUAL(copy.size(), 3);
+	BOOST_CHECK_EQUAL(copy.at(2), 20);
+
+	FlatHashMap<int, int> moved = std::move(copy);
+	BOOST_CHECK_EQUAL(moved.size(), 3);
+
+	int keySum = 0;
+	int valueSum = 0;
+	for (auto const& [key, value]: moved)
+	{
+		keySum += key;
+		valueSum += value;
+	}
+	BOOST_CHECK_EQUAL(keySum, 6);
+	BOOST_CHECK_EQUAL(valueSum, 60);
+}
+
+BOOST_AUTO_TEST_CASE(erase_during_iteration)
+{
+	FlatHashMap<int, int> map;
+	for (int i = 0; i < 100; ++i)
+		map[i] = i;
+	size_t erased = cxx20::erase_if(map, [](auto const& _entry) { return _entry.first % 2 == 0; });
+	BOOST_CHECK_EQUAL(erased, 50);
+	BOOST_CHECK_EQUAL(map.size(), 50);
+	for (auto const& [key, value]: map)
+		BOOST_CHECK_EQUAL(key % 2, 1);
+}
+
+BOOST_AUTO_TEST_CASE(pair_keys)
+{
+	FlatHashMap<std::pair<int, int>, int> map;
+	map[{1, 2}] = 3;
+	map[{2, 1}] = 4;
+	BOOST_CHECK_EQUAL(map.at(std::make_pair(1, 2)), 3);
+	BOOST_CHECK_EQUAL(map.at(std::make_pair(2, 1)), 4);
+}
+
+BOOST_AUTO_TEST_CASE(set_operations)
+{
+	FlatHashSet<std::string> set;
+	BOOST_CHECK(set.insert("x").second);
+	BOOST_CHECK(!set.insert("x").second);
+	set.emplace("y");
+	BOOST_CHECK_EQUAL(set.size(), 2);
+	BOOST_CHECK(set.contains(std::string_view("y")));
+	BOOST_CHECK_EQUAL(set.erase("x"), 1);
+	BOOST_CHECK_EQUAL(set.size(), 1);
+
+	FlatHashSet<int> initialized{1, 2, 3};
+	BOOST_CHECK_EQUAL(initialized.size(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(randomized_against_std_map)
+{
+	// Exercises growth, tombstone reuse and rehashing with a fixed seed and
+	// compares every observable result against std::unordered_map.
+	std::mt19937 rng(42);
+	FlatHashMap<int, int> map;
+	std::unordered_map<int, int> reference;
+	for (int round = 0; round < 20000; ++round)
+	{
+		int key = static_cast<int>(rng() % 500);
+		switch (rng() % 4)
+		{
+		case 0:
+		case 1:
+		{
+			int value = static_cast<int>(rng());
+			map[key] = value;
+			reference[key] = value;
+			break;
+		}
+		case 2:
+			BOOST_REQUIRE_EQUAL(map.erase(key), reference.erase(key));
+			break;
+		case 3:
+		{
+			auto it = map.find(key);
+			auto referenceIt = reference.find(key);
+			BOOST_REQUIRE_EQUAL(it == map.end(), referenceIt == reference.end());
+			if (it != map.end())
+				BOOST_REQUIRE_EQUAL(it->second, referenceIt->second);
+			break;
+		}
+		}
+		BOOST_REQUIRE_EQUAL(map.size(), reference.size());
+	}
+	std::map<int, int> sorted(map.begin(), map.end());
+	std::map<int, int> referenceSorted(reference.begin(), reference.end());
+	BOOST_CHECK(sorted == referenceSorted);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,74 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+/// Unit tests for read-only memory mappings of files.
+
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/MemoryMappedFile.h>
+#include <libsolutil/TemporaryDirectory.h>
+
+#include <test/Common.h>
+#include <test/FilesystemUtils.h>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
+
+#include <string>
+
+using namespace solidity::test;
+
+#define TEST_CASE_NAME (boost::unit_test::framework::current_test_case().p_name)
+
+namespace solidity::util::test
+{
+
+BOOST_AUTO_TEST_SUITE(MemoryMappedFileTest)
+
+BOOST_AUTO_TEST_CASE(regular_file)
+{
+	TemporaryDirectory tempDir(TEST_CASE_NAME);
+	createFileWithContent(tempDir.path() / "test.txt", "ABC\ndef\n");
+
+	MemoryMappedFile mapping(tempDir.path() / "test.txt");
+	BOOST_TEST(mapping.view() == "ABC\ndef\n");
+}
+
+BOOST_AUTO_TEST_CASE(empty_file)
+{
+	TemporaryDirectory tempDir(TEST_CASE_NAME);
+	createFileWithContent(tempDir.path() / "test.txt", "");
+
+	MemoryMappedFile mapping(tempDir.path() / "test.txt");
+	BOOST_TEST(mapping.view().empty());
+}
+
+BOOST_AUTO_TEST_CASE(missing_file)
+{
+	TemporaryDirectory tempDir(TEST_CASE_NAME);
+	BOOST_CHECK_THROW(MemoryMappedFile(tempDir.path() / "test.txt"), FileNotFound);
+}
+
+BOOST_AUTO_TEST_CASE(directory)
+{
+	TemporaryDirectory tempDir(TEST_CASE_NAME);
+	BOOST_CHECK_THROW(MemoryMappedFile{tempDir.path()}, NotAFile);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
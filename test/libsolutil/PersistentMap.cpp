@@ -0,0 +1,130 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/// Unit tests for the persistent map with structural sharing.
+
+#include <libsolutil/PersistentMap.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace solidity::util::test
+{
+
+namespace
+{
+
+using TestMap = PersistentMap<int, int>;
+
+/// Key together with the value on each side, std::nullopt denoting absence.
+using Difference = std::vector<std::tuple<int, std::optional<int>, std::optional<int>>>;
+
+Difference difference(TestMap const& _left, TestMap const& _right)
+{
+	Difference result;
+	_left.visitDifference(_right, [&](int _key, int const* _leftValue, int const* _rightValue) {
+		result.emplace_back(
+			_key,
+			_leftValue ? std::optional<int>(*_leftValue) : std::nullopt,
+			_rightValue ? std::optional<int>(*_rightValue) : std::nullopt
+		);
+	});
+	return result;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(PersistentMapTest)
+
+BOOST_AUTO_TEST_CASE(set_and_find)
+{
+	TestMap map;
+	BOOST_CHECK(map.empty());
+	BOOST_CHECK(!map.find(1));
+
+	map = map.set(1, 10);
+	map = map.set(2, 20);
+	map = map.set(1, 11);
+
+	BOOST_CHECK(!map.empty());
+	BOOST_REQUIRE(map.find(1));
+	BOOST_CHECK_EQUAL(*map.find(1), 11);
+	BOOST_REQUIRE(map.find(2));
+	BOOST_CHECK_EQUAL(*map.find(2), 20);
+	BOOST_CHECK(!map.find(3));
+}
+
+BOOST_AUTO_TEST_CASE(snapshots_are_independent)
+{
+	TestMap map;
+	for (int i = 0; i < 100; ++i)
+		map = map.set(i, i);
+
+	TestMap snapshot = map;
+	map = map.set(42, 1000);
+	map = map.set(100, 100);
+
+	BOOST_CHECK_EQUAL(*snapshot.find(42), 42);
+	BOOST_CHECK(!snapshot.find(100));
+	BOOST_CHECK_EQUAL(*map.find(42), 1000);
+}
+
+BOOST_AUTO_TEST_CASE(difference_of_identical_maps_is_empty)
+{
+	TestMap map;
+	for (int i = 0; i < 100; ++i)
+		map = map.set(i, i);
+
+	BOOST_CHECK(difference(map, map).empty());
+	// Same content reached through different updates.
+	TestMap other = map.set(5, 1000).set(5, 5);
+	BOOST_CHECK(difference(map, other).empty());
+}
+
+BOOST_AUTO_TEST_CASE(difference_reports_divergent_keys_in_order)
+{
+	TestMap map;
+	for (int i = 0; i < 100; ++i)
+		map = map.set(i, i);
+
+	TestMap left = map.set(7, 70).set(3, 30);
+	TestMap right = map.set(7, 700).set(200, 2);
+
+	Difference expected{
+		{3, {30}, {3}},
+		{7, {70}, {700}},
+		{200, std::nullopt, {2}},
+	};
+	BOOST_CHECK(difference(left, right) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(difference_against_empty_map)
+{
+	TestMap map = TestMap{}.set(1, 10).set(2, 20);
+
+	Difference expectedLeft{{1, {10}, std::nullopt}, {2, {20}, std::nullopt}};
+	Difference expectedRight{{1, std::nullopt, {10}}, {2, std::nullopt, {20}}};
+	BOOST_CHECK(difference(map, {}) == expectedLeft);
+	BOOST_CHECK(difference({}, map) == expectedRight);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
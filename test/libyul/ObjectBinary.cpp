@@ -0,0 +1,169 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the binary serialization of Yul objects.
+ */
+
+#include <test/Common.h>
+
+#include <liblangutil/DebugInfoSelection.h>
+
+#include <libyul/Object.h>
+#include <libyul/ObjectBinary.h>
+#include <libyul/YulStack.h>
+#include <libyul/backends/evm/EVMDialect.h>
+
+#include <libsolidity/interface/OptimiserSettings.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+#include <string>
+
+using namespace std;
+using namespace solidity::langutil;
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+
+shared_ptr<Object> parseObject(string const& _source)
+{
+	YulStack stack(
+		solidity::test::CommonOptions::get().evmVersion(),
+		solidity::test::CommonOptions::get().eofVersion(),
+		YulStack::Language::StrictAssembly,
+		solidity::frontend::OptimiserSettings::none(),
+		DebugInfoSelection::All()
+	);
+	BOOST_REQUIRE(stack.parseAndAnalyze("source", _source));
+	return stack.parserResult();
+}
+
+string printed(Object const& _object)
+{
+	return _object.toString(
+		&EVMDialect::strictAssemblyForEVM(solidity::test::CommonOptions::get().evmVersion()),
+		DebugInfoSelection::All()
+	);
+}
+
+void checkRoundtrip(string const& _source)
+{
+	shared_ptr<Object> object = parseObject(_source);
+	string encoded = serializeObject(*object);
+	BOOST_CHECK(isBinaryObject(encoded));
+	shared_ptr<Object> decoded = deserializeObject(encoded);
+	BOOST_REQUIRE(decoded);
+	BOOST_CHECK_EQUAL(printed(*decoded), printed(*object));
+	BOOST_CHECK(decoded->subIndexByName == object->subIndexByName);
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(YulObjectBinary, *boost::unit_test::label("nooptions"))
+
+BOOST_AUTO_TEST_CASE(code_only)
+{
+	checkRoundtrip("{ }");
+	checkRoundtrip("{ let x := add(1, 2) sstore(0, x) }");
+}
+
+BOOST_AUTO_TEST_CASE(all_statement_types)
+{
+	checkRoundtrip(
+		"object \"a\" {\n"
+		"    code {\n"
+		"        function f(x, y) -> z {\n"
+		"            switch x\n"
+		"            case 0 { z := y }\n"
+		"            case \"abc\" { leave }\n"
+		"            default { z := add(x, y) }\n"
+		"        }\n"
+		"        function g() -> p, q {\n"
+		"            p := 1\n"
+		"            q := 2\n"
+		"        }\n"
+		"        for { let i := 0 } lt(i, 10) { i := add(i, 1) } {\n"
+		"            if eq(i, 5) { break }\n"
+		"            if eq(i, 3) { continue }\n"
+		"            { let j := f(i, i) }\n"
+		"        }\n"
+		"        let a, b := g()\n"
+		"        let c\n"
+		"        a, b := g()\n"
+		"        sstore(a, add(b, c))\n"
+		"    }\n"
+		"}\n"
+	);
+}
+
+BOOST_AUTO_TEST_CASE(nested_objects_and_data)
+{
+	checkRoundtrip(
+		"object \"a\" {\n"
+		"    code { sstore(0, dataoffset(\"b\")) }\n"
+		"    data \"str\" \"abc\"\n"
+		"    data \"hex\" hex\"48656c6c6f2c20576f726c6421\"\n"
+		"    object \"b\" {\n"
+		"        code { sstore(0, datasize(\"c\")) }\n"
+		"        object \"c\" {\n"
+		"            code { }\n"
+		"        }\n"
+		"    }\n"
+		"}\n"
+	);
+}
+
+BOOST_AUTO_TEST_CASE(source_name_mapping)
+{
+	checkRoundtrip(
+		"/// @use-src 0:\"abc.sol\", 1:\"def.sol\"\n"
+		"object \"a\" {\n"
+		"    code {\n"
+		"        /// @src 0:10:20\n"
+		"        let x := 1\n"
+		"        /// @src 1:30:40\n"
+		"        sstore(0, x)\n"
+		"    }\n"
+		"}\n"
+	);
+}
+
+BOOST_AUTO_TEST_CASE(malformed_input)
+{
+	// Not the binary format at all.
+	BOOST_CHECK(!isBinaryObject("object \"a\" { code { } }"));
+	BOOST_CHECK(!deserializeObject("object \"a\" { code { } }"));
+	// Magic header only, without a version and document.
+	BOOST_CHECK(!deserializeObject("solc-yulbin"));
+
+	string encoded = serializeObject(*parseObject("object \"a\" { code { let x := 1 } }"));
+	// Truncation and trailing garbage are both rejected.
+	BOOST_CHECK(!deserializeObject(encoded.substr(0, encoded.size() - 1)));
+	BOOST_CHECK(!deserializeObject(encoded + "x"));
+	// Unsupported version.
+	encoded[11] = '\xff';
+	BOOST_CHECK(!deserializeObject(encoded));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
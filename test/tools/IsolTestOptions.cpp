@@ -69,7 +69,8 @@ void IsolTestOptions::addOptions()
 		("help", po::bool_switch(&showHelp)->default_value(showHelp), "Show this help screen.")
 		("no-color", po::bool_switch(&noColor)->default_value(noColor), "Don't use colors.")
 		("accept-updates", po::bool_switch(&acceptUpdates)->default_value(acceptUpdates), "Automatically accept expectation updates.")
-		("test,t", po::value<std::string>(&testFilter)->default_value("*/*"), "Filters which test units to include.");
+		("test,t", po::value<std::string>(&testFilter)->default_value("*/*"), "Filters which test units to include.")
+		("jobs,j", po::value<size_t>(&jobs)->default_value(jobs), "Number of test cases to run in parallel. Failing tests are re-run serially so that they can still be handled interactively.");
 }
 
 bool IsolTestOptions::parse(int _argc, char const* const* _argv)
@@ -97,6 +98,7 @@ void IsolTestOptions::validate() const
 		ConfigException,
 		"Invalid test unit filter - can only contain '" + filterString + ": " + testFilter
 	);
+	assertThrow(jobs >= 1, ConfigException, "Number of jobs has to be at least 1.");
 }
 
 }
@@ -28,11 +28,17 @@
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/filesystem.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <iostream>
+#include <mutex>
 #include <queue>
 #include <regex>
+#include <sstream>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #if defined(_WIN32)
 #include <windows.h>
@@ -113,7 +119,9 @@ public:
 		Skipped
 	};
 
-	Result process();
+	/// Runs the test case and writes its results to @a _out. The output is written to a
+	/// caller-provided stream so that test cases running on worker threads can buffer it.
+	Result process(ostream& _out);
 
 	static TestStats processPath(
 		TestCreator _testCaseCreator,
@@ -146,7 +154,7 @@ private:
 
 bool TestTool::m_exitRequested = false;
 
-TestTool::Result TestTool::process()
+TestTool::Result TestTool::process(ostream& _out)
 {
 	bool formatted{!m_options.noColor};
 
@@ -154,7 +162,7 @@ TestTool::Result TestTool::process()
 	{
 		if (m_filter.matches(m_path, m_name))
 		{
-			(AnsiColorized(cout, formatted, {BOLD}) << m_name << ": ").flush();
+			(AnsiColorized(_out, formatted, {BOLD}) << m_name << ": ").flush();
 
 			m_test = m_testCaseCreator(TestCase::Config{
 				m_path.string(),
@@ -170,22 +178,22 @@ TestTool::Result TestTool::process()
 				switch (TestCase::TestResult result = m_test->run(outputMessages, "  ", formatted))
 				{
 					case TestCase::TestResult::Success:
-						AnsiColorized(cout, formatted, {BOLD, GREEN}) << "OK" << endl;
+						AnsiColorized(_out, formatted, {BOLD, GREEN}) << "OK" << endl;
 						return Result::Success;
 					default:
-						AnsiColorized(cout, formatted, {BOLD, RED}) << "FAIL" << endl;
+						AnsiColorized(_out, formatted, {BOLD, RED}) << "FAIL" << endl;
 
-						AnsiColorized(cout, formatted, {BOLD, CYAN}) << "  Contract:" << endl;
-						m_test->printSource(cout, "    ", formatted);
-						m_test->printSettings(cout, "    ", formatted);
+						AnsiColorized(_out, formatted, {BOLD, CYAN}) << "  Contract:" << endl;
+						m_test->printSource(_out, "    ", formatted);
+						m_test->printSettings(_out, "    ", formatted);
 
-						cout << endl << outputMessages.str() << endl;
+						_out << endl << outputMessages.str() << endl;
 						return result == TestCase::TestResult::FatalError ? Result::Exception : Result::Failure;
 				}
 			}
 			else
 			{
-				AnsiColorized(cout, formatted, {BOLD, YELLOW}) << "NOT RUN" << endl;
+				AnsiColorized(_out, formatted, {BOLD, YELLOW}) << "NOT RUN" << endl;
 				return Result::Skipped;
 			}
 		}
@@ -194,19 +202,19 @@ TestTool::Result TestTool::process()
 	}
 	catch (boost::exception const& _e)
 	{
-		AnsiColorized(cout, formatted, {BOLD, RED}) <<
+		AnsiColorized(_out, formatted, {BOLD, RED}) <<
 			"Exception during test: " << boost::diagnostic_information(_e) << endl;
 		return Result::Exception;
 	}
 	catch (std::exception const& _e)
 	{
-		AnsiColorized(cout, formatted, {BOLD, RED}) <<
+		AnsiColorized(_out, formatted, {BOLD, RED}) <<
 			"Exception during test: " << boost::diagnostic_information(_e) << endl;
 		return Result::Exception;
 	}
 	catch (...)
 	{
-		AnsiColorized(cout, formatted, {BOLD, RED}) <<
+		AnsiColorized(_out, formatted, {BOLD, RED}) <<
 			"Unknown exception during test: " << boost::current_exception_diagnostic_information() << endl;
 		return Result::Exception;
 	}
@@ -273,20 +281,22 @@ TestStats TestTool::processPath(
 	solidity::test::Batcher& _batcher
 )
 {
-	std::queue<fs::path> paths;
-	paths.push(_path);
 	int successCount = 0;
 	int testCount = 0;
 	int skippedCount = 0;
 
+	// Enumerate the test files up front so that they can be distributed among worker threads.
+	std::queue<fs::path> paths;
+	paths.push(_path);
+	std::vector<fs::path> testFiles;
 	while (!paths.empty())
 	{
 		auto currentPath = paths.front();
+		paths.pop();
 
 		fs::path fullpath = _basepath / currentPath;
 		if (fs::is_directory(fullpath))
 		{
-			paths.pop();
 			for (auto const& entry: boost::iterator_range<fs::directory_iterator>(
 				fs::directory_iterator(fullpath),
 				fs::directory_iterator()
@@ -294,56 +304,113 @@ TestStats TestTool::processPath(
 				if (fs::is_directory(entry.path()) || TestCase::isTestFilename(entry.path().filename()))
 					paths.push(currentPath / entry.path().filename());
 		}
-		else if (m_exitRequested)
-		{
-			++testCount;
-			paths.pop();
-		}
 		else if (!_batcher.checkAndAdvance())
-		{
-			paths.pop();
 			++skippedCount;
-		}
 		else
-		{
-			++testCount;
-			TestTool testTool(
-				_testCaseCreator,
-				_options,
-				fullpath,
-				currentPath.generic_path().string()
-			);
-			auto result = testTool.process();
+			testFiles.emplace_back(std::move(currentPath));
+	}
+
+	if (m_exitRequested)
+		return { successCount, testCount + static_cast<int>(testFiles.size()), skippedCount };
 
-			switch(result)
+	std::queue<fs::path> serialQueue;
+	if (size_t jobs = std::min<size_t>(_options.jobs, testFiles.size()); jobs > 1)
+	{
+		// First pass: run the test cases in parallel with buffered output. Each test case uses
+		// its own compiler and EVM host instance. Failing tests are only collected here and
+		// re-run serially below, so that they can still be handled interactively.
+		std::atomic<size_t> nextTest{0};
+		std::mutex resultMutex;
+		std::vector<std::thread> workers;
+		for (size_t i = 0; i < jobs; ++i)
+			workers.emplace_back([&]()
 			{
-			case Result::Failure:
-			case Result::Exception:
-				switch(testTool.handleResponse(result == Result::Exception))
+				for (size_t index = nextTest++; index < testFiles.size(); index = nextTest++)
 				{
-				case Request::Quit:
-					paths.pop();
-					m_exitRequested = true;
-					break;
-				case Request::Rerun:
-					cout << "Re-running test case..." << endl;
-					--testCount;
-					break;
-				case Request::Skip:
-					paths.pop();
-					++skippedCount;
-					break;
+					fs::path const& currentPath = testFiles[index];
+					std::ostringstream output;
+					TestTool testTool(
+						_testCaseCreator,
+						_options,
+						_basepath / currentPath,
+						currentPath.generic_path().string()
+					);
+					auto result = testTool.process(output);
+
+					std::lock_guard lock(resultMutex);
+					cout << output.str();
+					switch (result)
+					{
+					case Result::Failure:
+					case Result::Exception:
+						serialQueue.push(currentPath);
+						break;
+					case Result::Success:
+						++testCount;
+						++successCount;
+						break;
+					case Result::Skipped:
+						++testCount;
+						++skippedCount;
+						break;
+					}
 				}
+			});
+		for (std::thread& worker: workers)
+			worker.join();
+	}
+	else
+		for (auto& testFile: testFiles)
+			serialQueue.push(std::move(testFile));
+
+	while (!serialQueue.empty())
+	{
+		auto currentPath = serialQueue.front();
+
+		if (m_exitRequested)
+		{
+			++testCount;
+			serialQueue.pop();
+			continue;
+		}
+
+		++testCount;
+		TestTool testTool(
+			_testCaseCreator,
+			_options,
+			_basepath / currentPath,
+			currentPath.generic_path().string()
+		);
+		auto result = testTool.process(cout);
+
+		switch(result)
+		{
+		case Result::Failure:
+		case Result::Exception:
+			switch(testTool.handleResponse(result == Result::Exception))
+			{
+			case Request::Quit:
+				serialQueue.pop();
+				m_exitRequested = true;
 				break;
-			case Result::Success:
-				paths.pop();
-				++successCount;
+			case Request::Rerun:
+				cout << "Re-running test case..." << endl;
+				--testCount;
 				break;
-			case Result::Skipped:
-				paths.pop();
+			case Request::Skip:
+				serialQueue.pop();
 				++skippedCount;
 				break;
 			}
+			break;
+		case Result::Success:
+			serialQueue.pop();
+			++successCount;
+			break;
+		case Result::Skipped:
+			serialQueue.pop();
+			++skippedCount;
+			break;
 		}
 	}
 
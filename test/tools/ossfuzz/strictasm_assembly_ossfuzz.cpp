@@ -16,6 +16,8 @@
 */
 // SPDX-License-Identifier: GPL-3.0
 
+#include <test/tools/ossfuzz/yulFuzzerCommon.h>
+
 #include <libyul/YulStack.h>
 #include <libyul/backends/evm/EVMCodeTransform.h>
 
@@ -24,6 +26,7 @@
 
 using namespace solidity;
 using namespace solidity::yul;
+using namespace solidity::yul::test::yul_fuzzer;
 using namespace std;
 
 // Prototype as we can't use the FuzzerInterface.h header.
@@ -34,7 +37,7 @@ extern "C" int LLVMFuzzerTestOneInput(uint8_t const* _data, size_t _size)
 	if (_size > 600)
 		return 0;
 
-	YulStringRepository::reset();
+	yulFuzzerUtil::resetGlobalState();
 
 	string input(reinterpret_cast<char const*>(_data), _size);
 	YulStack stack(
@@ -17,6 +17,9 @@
 // SPDX-License-Identifier: GPL-3.0
 #include <test/tools/yulInterpreter/Interpreter.h>
 #include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/Dialect.h>
+#include <libyul/YulString.h>
+#include <liblangutil/EVMVersion.h>
 
 namespace solidity::yul::test::yul_fuzzer
 {
@@ -53,6 +56,46 @@ struct yulFuzzerUtil
 	/// resource exhaustion of some form e.g., exceeded maximum time-out
 	/// threshold, number of nested expressions etc.
 	static bool resourceLimitsExceeded(TerminationReason _reason);
+
+	/// Discards global state accumulated during a fuzzing iteration while keeping
+	/// the dialect tables warm across iterations. On the first call, everything
+	/// interned so far is dropped and the dialects for all EVM versions are
+	/// constructed before taking a snapshot of the string repository; subsequent
+	/// calls merely discard the strings interned since then. Call at the beginning
+	/// of each iteration in place of YulStringRepository::reset().
+	/// Defined inline so that fuzz targets that do not link yulFuzzerCommon.cpp
+	/// can use it as well.
+	static void resetGlobalState()
+	{
+		static bool warmedUp = false;
+		if (!warmedUp)
+		{
+			YulStringRepository::reset();
+			for (auto const& version: {
+				langutil::EVMVersion::homestead(),
+				langutil::EVMVersion::tangerineWhistle(),
+				langutil::EVMVersion::spuriousDragon(),
+				langutil::EVMVersion::byzantium(),
+				langutil::EVMVersion::constantinople(),
+				langutil::EVMVersion::petersburg(),
+				langutil::EVMVersion::istanbul(),
+				langutil::EVMVersion::berlin(),
+				langutil::EVMVersion::london(),
+				langutil::EVMVersion::paris(),
+				langutil::EVMVersion::shanghai()
+			})
+			{
+				EVMDialect::strictAssemblyForEVM(version);
+				EVMDialect::strictAssemblyForEVMObjects(version);
+				EVMDialectTyped::instance(version);
+			}
+			Dialect::yulDeprecated();
+			YulStringRepository::takeSnapshot();
+			warmedUp = true;
+		}
+		YulStringRepository::resetToSnapshot();
+	}
+
 	static size_t constexpr maxSteps = 100;
 	static size_t constexpr maxTraceSize = 75;
 	static size_t constexpr maxExprNesting = 64;
@@ -20,6 +20,7 @@
 
 #include <test/tools/ossfuzz/yulProto.pb.h>
 #include <test/tools/ossfuzz/protoToYul.h>
+#include <test/tools/ossfuzz/yulFuzzerCommon.h>
 
 #include <test/tools/fuzzer_common.h>
 
@@ -59,7 +60,7 @@ DEFINE_PROTO_FUZZER(Program const& _input)
 	if (yul_source.size() > 1200)
 		return;
 
-	YulStringRepository::reset();
+	yulFuzzerUtil::resetGlobalState();
 
 	// YulStack entry point
 	YulStack stack(
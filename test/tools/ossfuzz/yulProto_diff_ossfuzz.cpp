@@ -58,7 +58,7 @@ DEFINE_PROTO_FUZZER(Program const& _input)
 		of.write(yul_source.data(), static_cast<streamsize>(yul_source.size()));
 	}
 
-	YulStringRepository::reset();
+	yulFuzzerUtil::resetGlobalState();
 
 	// YulStack entry point
 	YulStack stack(
@@ -0,0 +1,367 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Micro-benchmarks of the compiler phases, driven by a corpus of real-world contracts
+ * (see test/benchmarks). Reports wall time per phase, optionally as JSON for regression
+ * tracking, and can compare a run against a stored baseline report with a configurable
+ * regression threshold.
+ */
+
+#include <libsolidity/interface/CompilerStack.h>
+#include <libsolidity/interface/OptimiserSettings.h>
+#include <libsolidity/interface/Version.h>
+#include <libsolidity/parsing/Parser.h>
+
+#include <libyul/YulStack.h>
+
+#include <liblangutil/CharStream.h>
+#include <liblangutil/DebugInfoSelection.h>
+#include <liblangutil/ErrorReporter.h>
+#include <liblangutil/EVMVersion.h>
+#include <liblangutil/Scanner.h>
+
+#include <libsolutil/CommonData.h>
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/JSON.h>
+
+#include <json/json.h>
+
+#include <boost/program_options.hpp>
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::langutil;
+using namespace solidity::frontend;
+
+namespace po = boost::program_options;
+
+namespace
+{
+
+struct BenchmarkResult
+{
+	string name;
+	size_t iterations = 0;
+	/// Wall time of the fastest iteration in nanoseconds.
+	int64_t realTimeNs = 0;
+};
+
+/// Runs @a _body @a _iterations times and @returns the wall time of the fastest run.
+/// The minimum is less noisy than the mean and later iterations benefit from warm
+/// process-wide caches, so it tracks the steady-state cost of the phase.
+int64_t measure(size_t _iterations, function<void()> const& _body)
+{
+	int64_t best = numeric_limits<int64_t>::max();
+	for (size_t i = 0; i < _iterations; ++i)
+	{
+		auto start = chrono::steady_clock::now();
+		_body();
+		auto end = chrono::steady_clock::now();
+		best = min(best, chrono::duration_cast<chrono::nanoseconds>(end - start).count());
+	}
+	return best;
+}
+
+void benchmarkScanner(string const& _name, string const& _source, size_t _iterations, vector<BenchmarkResult>& _results)
+{
+	_results.push_back({"scanner/" + _name, _iterations, measure(_iterations, [&]() {
+		// A fresh character stream per iteration, so that the token stream recorded
+		// during the first scan is not replayed by the later ones.
+		CharStream stream(_source, _name);
+		Scanner scanner(stream);
+		while (scanner.next() != Token::EOS) {}
+	})});
+}
+
+void benchmarkParser(string const& _name, string const& _source, size_t _iterations, vector<BenchmarkResult>& _results)
+{
+	_results.push_back({"parser/" + _name, _iterations, measure(_iterations, [&]() {
+		ErrorList errors;
+		ErrorReporter errorReporter(errors);
+		CharStream stream(_source, _name);
+		Parser parser{errorReporter, EVMVersion{}};
+		parser.parse(stream);
+	})});
+}
+
+void benchmarkAnalysis(string const& _name, string const& _source, size_t _iterations, vector<BenchmarkResult>& _results)
+{
+	_results.push_back({"analysis/" + _name, _iterations, measure(_iterations, [&]() {
+		CompilerStack stack;
+		stack.setSources({{_name, _source}});
+		stack.parseAndAnalyze(CompilerStack::State::AnalysisSuccessful);
+	})});
+}
+
+void benchmarkLegacyCompilation(string const& _name, string const& _source, size_t _iterations, vector<BenchmarkResult>& _results)
+{
+	// The legacy pipeline can fail on the corpus, e.g. by running out of reachable stack.
+	try
+	{
+		{
+			CompilerStack stack;
+			stack.setSources({{_name, _source}});
+			stack.setOptimiserSettings(OptimiserSettings::standard());
+			if (!stack.compile())
+				throw runtime_error("Compilation failed.");
+		}
+		_results.push_back({"compile-legacy/" + _name, _iterations, measure(_iterations, [&]() {
+			CompilerStack stack;
+			stack.setSources({{_name, _source}});
+			stack.setOptimiserSettings(OptimiserSettings::standard());
+			stack.compile();
+		})});
+	}
+	catch (exception const&)
+	{
+		cerr << "Skipping compile-legacy/" << _name << ": legacy pipeline failed." << endl;
+	}
+}
+
+void benchmarkIRPipeline(string const& _name, string const& _source, size_t _iterations, vector<BenchmarkResult>& _results)
+{
+	// Generate the IR of all contracts once and benchmark the Yul phases on it, so that
+	// the frontend cost is not attributed to the optimizer and code generation.
+	CompilerStack stack;
+	stack.setSources({{_name, _source}});
+	stack.setViaIR(true);
+	stack.setOptimiserSettings(OptimiserSettings::standard());
+	stack.enableIRGeneration(true);
+	stack.enableEvmBytecodeGeneration(false);
+	if (!stack.compile())
+	{
+		cerr << "Skipping IR benchmarks for " << _name << ": IR generation failed." << endl;
+		return;
+	}
+
+	vector<string> unoptimizedIR;
+	vector<string> optimizedIR;
+	for (string const& contractName: stack.contractNames())
+	{
+		// Contracts that cannot be deployed, e.g. interfaces, have no IR.
+		if (!stack.yulIR(contractName).empty())
+			unoptimizedIR.push_back(stack.yulIR(contractName));
+		if (!stack.yulIROptimized(contractName).empty())
+			optimizedIR.push_back(stack.yulIROptimized(contractName));
+	}
+
+	// Runs the full optimizer step sequence on the unoptimized IR of each contract.
+	// Includes parsing the IR, which is cheap compared to the suite itself.
+	_results.push_back({"yul-optimizer/" + _name, _iterations, measure(_iterations, [&]() {
+		for (string const& ir: unoptimizedIR)
+		{
+			yul::YulStack yulStack(
+				EVMVersion{},
+				nullopt,
+				yul::YulStack::Language::StrictAssembly,
+				OptimiserSettings::standard(),
+				DebugInfoSelection::Default()
+			);
+			if (!yulStack.parseAndAnalyze("", ir))
+				throw runtime_error("Analysis of generated IR failed.");
+			yulStack.optimize();
+		}
+	})});
+
+	// Code generation from the optimized IR: stack layout generation, the code transform
+	// and the final bytecode assembly.
+	_results.push_back({"ir-codegen/" + _name, _iterations, measure(_iterations, [&]() {
+		for (string const& ir: optimizedIR)
+		{
+			yul::YulStack yulStack(
+				EVMVersion{},
+				nullopt,
+				yul::YulStack::Language::StrictAssembly,
+				OptimiserSettings::standard(),
+				DebugInfoSelection::Default()
+			);
+			if (!yulStack.parseAndAnalyze("", ir))
+				throw runtime_error("Analysis of optimized IR failed.");
+			yulStack.assembleWithDeployed();
+		}
+	})});
+}
+
+vector<BenchmarkResult> benchmarkFile(string const& _name, string const& _source, size_t _iterations)
+{
+	vector<BenchmarkResult> results;
+	benchmarkScanner(_name, _source, _iterations, results);
+	benchmarkParser(_name, _source, _iterations, results);
+	benchmarkAnalysis(_name, _source, _iterations, results);
+	benchmarkLegacyCompilation(_name, _source, _iterations, results);
+	benchmarkIRPipeline(_name, _source, _iterations, results);
+	return results;
+}
+
+void printText(vector<BenchmarkResult> const& _results)
+{
+	for (BenchmarkResult const& result: _results)
+		cout <<
+			result.name << ": " <<
+			static_cast<double>(result.realTimeNs) / 1.0e6 << " ms " <<
+			"(fastest of " << result.iterations << ")" << endl;
+}
+
+void printJSON(vector<BenchmarkResult> const& _results)
+{
+	Json::Value output{Json::objectValue};
+	output["context"]["version"] = frontend::VersionString;
+	output["benchmarks"] = Json::arrayValue;
+	for (BenchmarkResult const& result: _results)
+	{
+		Json::Value benchmark{Json::objectValue};
+		benchmark["name"] = result.name;
+		benchmark["iterations"] = Json::UInt64(result.iterations);
+		benchmark["real_time"] = Json::Int64(result.realTimeNs);
+		benchmark["time_unit"] = "ns";
+		output["benchmarks"].append(benchmark);
+	}
+	cout << util::jsonPrettyPrint(output) << endl;
+}
+
+/// Compares @a _results against the JSON report at @a _baselinePath (as produced by
+/// --json) and prints the per-phase change. @returns false if the wall time of any
+/// benchmark regressed by more than @a _thresholdPercent. Comparing phase by phase
+/// catches regressions that end-to-end timing would hide because other phases got
+/// faster at the same time.
+bool compareAgainstBaseline(vector<BenchmarkResult> const& _results, string const& _baselinePath, double _thresholdPercent)
+{
+	Json::Value baseline;
+	string errors;
+	if (!util::jsonParseStrict(util::readFileAsString(_baselinePath), baseline, &errors))
+		throw runtime_error("Could not parse baseline report " + _baselinePath + ": " + errors);
+
+	map<string, int64_t> baselineTimes;
+	for (Json::Value const& benchmark: baseline["benchmarks"])
+		baselineTimes[benchmark["name"].asString()] = benchmark["real_time"].asInt64();
+
+	bool withinThreshold = true;
+	for (BenchmarkResult const& result: _results)
+	{
+		auto it = baselineTimes.find(result.name);
+		if (it == baselineTimes.end() || it->second <= 0)
+		{
+			cout << result.name << ": no baseline, skipping comparison." << endl;
+			continue;
+		}
+		double changePercent =
+			100.0 * static_cast<double>(result.realTimeNs - it->second) / static_cast<double>(it->second);
+		cout <<
+			result.name << ": " <<
+			static_cast<double>(it->second) / 1.0e6 << " ms -> " <<
+			static_cast<double>(result.realTimeNs) / 1.0e6 << " ms " <<
+			"(" << (changePercent >= 0 ? "+" : "") << changePercent << "%)";
+		if (changePercent > _thresholdPercent)
+		{
+			cout << " REGRESSION";
+			withinThreshold = false;
+		}
+		cout << endl;
+	}
+	return withinThreshold;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	po::options_description options(
+		R"(solbench, micro-benchmarks of the compiler phases.
+Usage: solbench [Options] file1.sol file2.sol ...
+Benchmarks scanning, parsing, analysis, the legacy pipeline, the Yul optimizer and
+IR code generation on each given source file and prints the timings. With --baseline,
+compares each benchmark against a previous JSON report and fails on regressions.
+
+Allowed options)",
+		po::options_description::m_default_line_length,
+		po::options_description::m_default_line_length - 23);
+	options.add_options()
+		("help", "Show this help screen.")
+		("iterations", po::value<size_t>()->default_value(3), "Number of runs per benchmark; the fastest is reported.")
+		("json", "Print the results as JSON instead of text.")
+		("baseline", po::value<string>(), "JSON report of a previous run (as printed by --json) to compare against.")
+		("threshold", po::value<double>()->default_value(5.0), "Maximum allowed wall time regression over the baseline in percent; exceeding it fails the run.")
+		("input-file", po::value<vector<string>>(), "input file");
+	po::positional_options_description filesPositions;
+	filesPositions.add("input-file", -1);
+
+	po::variables_map arguments;
+	try
+	{
+		po::command_line_parser cmdLineParser(argc, argv);
+		cmdLineParser.options(options).positional(filesPositions);
+		po::store(cmdLineParser.run(), arguments);
+	}
+	catch (po::error const& _exception)
+	{
+		cerr << _exception.what() << endl;
+		return 1;
+	}
+
+	if (arguments.count("help") || !arguments.count("input-file"))
+	{
+		cout << options;
+		return 0;
+	}
+
+	size_t iterations = max<size_t>(1, arguments["iterations"].as<size_t>());
+
+	vector<BenchmarkResult> results;
+	for (string const& path: arguments["input-file"].as<vector<string>>())
+	{
+		string source;
+		try
+		{
+			source = util::readFileAsString(path);
+		}
+		catch (exception const& _exception)
+		{
+			cerr << "Could not read " << path << ": " << _exception.what() << endl;
+			return 1;
+		}
+		results += benchmarkFile(path, source, iterations);
+	}
+
+	if (arguments.count("json"))
+		printJSON(results);
+	else
+		printText(results);
+
+	if (arguments.count("baseline"))
+		try
+		{
+			if (!compareAgainstBaseline(results, arguments["baseline"].as<string>(), arguments["threshold"].as<double>()))
+				return 1;
+		}
+		catch (exception const& _exception)
+		{
+			cerr << _exception.what() << endl;
+			return 1;
+		}
+
+	return 0;
+}
@@ -58,7 +58,7 @@ void InspectedInterpreter::run(
 	InspectedInterpreter{_inspector, _state, _dialect, scope, _disableExternalCalls, _disableMemoryTrace}(_ast);
 }
 
-Inspector::NodeAction Inspector::queryUser(DebugData const& _data, map<YulString, u256> const& _variables)
+Inspector::NodeAction Inspector::queryUser(DebugData const& _data, VariableValueMap const& _variables)
 {
 	if (m_stepMode == NodeAction::RunNode)
 	{
@@ -53,13 +53,13 @@ public:
 	 * @returns NodeAction::RunNode if the current AST node (and all children nodes!) should be
 	 *          processed without stopping, else NodeAction::StepThroughNode.
 	 */
-	NodeAction queryUser(DebugData const& _data, std::map<YulString, u256> const& _variables);
+	NodeAction queryUser(DebugData const& _data, VariableValueMap const& _variables);
 
 	void stepMode(NodeAction _action) { m_stepMode = _action; }
 
 	std::string const& source() const { return m_source; }
 
-	void interactiveVisit(DebugData const& _debugData, std::map<YulString, u256> const& _variables, std::function<void()> _visitNode)
+	void interactiveVisit(DebugData const& _debugData, VariableValueMap const& _variables, std::function<void()> _visitNode)
 	{
 		Inspector::NodeAction action = queryUser(_debugData, _variables);
 
@@ -116,7 +116,7 @@ public:
 		Scope& _scope,
 		bool _disableExternalCalls,
 		bool _disableMemoryTracing,
-		std::map<YulString, u256> _variables = {}
+		VariableValueMap _variables = {}
 	):
 		Interpreter(_state, _dialect, _scope, _disableExternalCalls, _disableMemoryTracing, _variables),
 		m_inspector(_inspector)
@@ -160,7 +160,7 @@ public:
 		InterpreterState& _state,
 		Dialect const& _dialect,
 		Scope& _scope,
-		std::map<YulString, u256> const& _variables,
+		VariableValueMap const& _variables,
 		bool _disableExternalCalls,
 		bool _disableMemoryTrace
 	):
@@ -180,7 +180,7 @@ public:
 	void operator()(Identifier const& _node) override { helper(_node); }
 	void operator()(FunctionCall const& _node) override { helper(_node); }
 protected:
-	std::unique_ptr<Interpreter> makeInterpreterCopy(std::map<YulString, u256> _variables = {}) const override
+	std::unique_ptr<Interpreter> makeInterpreterCopy(VariableValueMap _variables = {}) const override
 	{
 		return std::make_unique<InspectedInterpreter>(
 			m_inspector,
@@ -302,30 +302,35 @@ void ExpressionEvaluator::operator()(Identifier const& _identifier)
 
 void ExpressionEvaluator::operator()(FunctionCall const& _funCall)
 {
+	// Resolve the builtin only once and reuse the result both for the literal
+	// argument check and for the evaluation itself.
+	EVMDialect const* dialect = dynamic_cast<EVMDialect const*>(&m_dialect);
+	BuiltinFunction const* builtin =
+		dialect ?
+		dialect->builtin(_funCall.functionName.name) :
+		m_dialect.builtin(_funCall.functionName.name);
+
 	vector<optional<LiteralKind>> const* literalArguments = nullptr;
-	if (BuiltinFunction const* builtin = m_dialect.builtin(_funCall.functionName.name))
-		if (!builtin->literalArguments.empty())
-			literalArguments = &builtin->literalArguments;
+	if (builtin && !builtin->literalArguments.empty())
+		literalArguments = &builtin->literalArguments;
 	evaluateArgs(_funCall.arguments, literalArguments);
 
-	if (EVMDialect const* dialect = dynamic_cast<EVMDialect const*>(&m_dialect))
+	if (dialect && builtin)
 	{
-		if (BuiltinFunctionForEVM const* fun = dialect->builtin(_funCall.functionName.name))
-		{
-			EVMInstructionInterpreter interpreter(dialect->evmVersion(), m_state, m_disableMemoryTrace);
+		BuiltinFunctionForEVM const& fun = static_cast<BuiltinFunctionForEVM const&>(*builtin);
+		EVMInstructionInterpreter interpreter(dialect->evmVersion(), m_state, m_disableMemoryTrace);
 
-			u256 const value = interpreter.evalBuiltin(*fun, _funCall.arguments, values());
+		u256 const value = interpreter.evalBuiltin(fun, _funCall.arguments, values());
 
-			if (
-				!m_disableExternalCalls &&
-				fun->instruction &&
-				evmasm::isCallInstruction(*fun->instruction)
-			)
-				runExternalCall(*fun->instruction);
+		if (
+			!m_disableExternalCalls &&
+			fun.instruction &&
+			evmasm::isCallInstruction(*fun.instruction)
+		)
+			runExternalCall(*fun.instruction);
 
-			setValue(value);
-			return;
-		}
+		setValue(value);
+		return;
 	}
 
 	Scope* scope = &m_scope;
@@ -337,7 +342,8 @@ void ExpressionEvaluator::operator()(FunctionCall const& _funCall)
 	FunctionDefinition const* fun = scope->names.at(_funCall.functionName.name);
 	yulAssert(fun, "Function not found.");
 	yulAssert(m_values.size() == fun->parameters.size(), "");
-	map<YulString, u256> variables;
+	VariableValueMap variables;
+	variables.reserve(fun->parameters.size() + fun->returnVariables.size());
 	for (size_t i = 0; i < fun->parameters.size(); ++i)
 		variables[fun->parameters.at(i).name] = m_values.at(i);
 	for (size_t i = 0; i < fun->returnVariables.size(); ++i)
@@ -372,6 +378,7 @@ void ExpressionEvaluator::evaluateArgs(
 {
 	incrementStep();
 	vector<u256> values;
+	values.reserve(_expr.size());
 	size_t i = 0;
 	/// Function arguments are evaluated in reverse.
 	for (auto const& expr: _expr | ranges::views::reverse)
@@ -28,6 +28,7 @@
 
 #include <libsolutil/FixedHash.h>
 #include <libsolutil/CommonData.h>
+#include <libsolutil/FlatHashMap.h>
 
 #include <libsolutil/Exceptions.h>
 
@@ -65,6 +66,10 @@ class ExpressionNestingLimitReached: public InterpreterTerminatedGeneric
 {
 };
 
+/// Values of the variables in scope. An open-addressing hash table so that the
+/// per-statement variable lookups of the interpreter do not chase pointers.
+using VariableValueMap = util::FlatHashMap<YulString, u256>;
+
 enum class ControlFlowState
 {
 	Default,
@@ -135,8 +140,8 @@ struct InterpreterState
 struct Scope
 {
 	/// Used for variables and functions. Value is nullptr for variables.
-	std::map<YulString, FunctionDefinition const*> names;
-	std::map<Block const*, std::unique_ptr<Scope>> subScopes;
+	util::FlatHashMap<YulString, FunctionDefinition const*> names;
+	util::FlatHashMap<Block const*, std::unique_ptr<Scope>> subScopes;
 	Scope* parent = nullptr;
 };
 
@@ -164,7 +169,7 @@ public:
 		Scope& _scope,
 		bool _disableExternalCalls,
 		bool _disableMemoryTracing,
-		std::map<YulString, u256> _variables = {}
+		VariableValueMap _variables = {}
 	):
 		m_dialect(_dialect),
 		m_state(_state),
@@ -208,7 +213,7 @@ protected:
 	Dialect const& m_dialect;
 	InterpreterState& m_state;
 	/// Values of variables.
-	std::map<YulString, u256> m_variables;
+	VariableValueMap m_variables;
 	Scope* m_scope;
 	/// If not set, external calls (e.g. using `call()`) to the same contract
 	/// are evaluated in a new parser instance.
@@ -226,7 +231,7 @@ public:
 		InterpreterState& _state,
 		Dialect const& _dialect,
 		Scope& _scope,
-		std::map<YulString, u256> const& _variables,
+		VariableValueMap const& _variables,
 		bool _disableExternalCalls,
 		bool _disableMemoryTrace
 	):
@@ -249,7 +254,7 @@ public:
 
 protected:
 	void runExternalCall(evmasm::Instruction _instruction);
-	virtual std::unique_ptr<Interpreter> makeInterpreterCopy(std::map<YulString, u256> _variables = {}) const
+	virtual std::unique_ptr<Interpreter> makeInterpreterCopy(VariableValueMap _variables = {}) const
 	{
 		return std::make_unique<Interpreter>(
 			m_state,
@@ -288,7 +293,7 @@ protected:
 	InterpreterState& m_state;
 	Dialect const& m_dialect;
 	/// Values of variables.
-	std::map<YulString, u256> const& m_variables;
+	VariableValueMap const& m_variables;
 	Scope& m_scope;
 	/// Current value of the expression
 	std::vector<u256> m_values;
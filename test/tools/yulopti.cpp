@@ -30,8 +30,10 @@
 #include <libyul/AsmParser.h>
 #include <libyul/AsmPrinter.h>
 #include <libyul/Object.h>
+#include <libyul/ObjectBinary.h>
 #include <liblangutil/SourceReferenceFormatter.h>
 
+#include <libyul/optimiser/ASTCopier.h>
 #include <libyul/optimiser/Disambiguator.h>
 #include <libyul/optimiser/OptimiserStep.h>
 #include <libyul/optimiser/StackCompressor.h>
@@ -93,7 +95,13 @@ public:
 		CharStream _charStream(_input, "");
 		try
 		{
-			m_ast = yul::Parser(errorReporter, m_dialect).parse(_charStream);
+			if (isBinaryObject(_input))
+			{
+				if (shared_ptr<Object> object = deserializeObject(_input))
+					m_ast = std::move(object->code);
+			}
+			else
+				m_ast = yul::Parser(errorReporter, m_dialect).parse(_charStream);
 			if (!m_ast || !errorReporter.errors().empty())
 			{
 				cerr << "Error parsing source." << endl;
@@ -177,6 +185,27 @@ public:
 		m_nameDispenser.reset(*m_ast);
 	}
 
+	/// Re-runs analysis on the resident AST, e.g. to validate it after an applied step,
+	/// without printing and re-parsing the whole source.
+	void analyze()
+	{
+		ErrorList errors;
+		ErrorReporter errorReporter(errors);
+		m_analysisInfo = make_unique<yul::AsmAnalysisInfo>();
+		AsmAnalyzer analyzer(
+			*m_analysisInfo,
+			errorReporter,
+			m_dialect
+		);
+		if (!analyzer.analyze(*m_ast) || !errorReporter.errors().empty())
+		{
+			cerr << "Error analyzing AST." << endl;
+			CharStream charStream(AsmPrinter{m_dialect}(*m_ast), "");
+			printErrors(charStream, errors);
+			throw std::runtime_error("Could not analyze AST.");
+		}
+	}
+
 	void runSteps(string _source, string _steps)
 	{
 		parse(_source);
@@ -187,11 +216,11 @@ public:
 
 	void runInteractive(string _source, bool _disambiguated = false)
 	{
-		bool disambiguated = _disambiguated;
+		parse(_source);
+		if (!_disambiguated)
+			disambiguate();
 		while (true)
 		{
-			parse(_source);
-			disambiguated = disambiguated || (disambiguate(), true);
 			map<char, string> const& extraOptions = {
 				// QUIT starts with a non-letter character on purpose to get it to show up on top of the list
 				{'#', ">>> QUIT <<<"},
@@ -205,6 +234,9 @@ public:
 			char option = static_cast<char>(readStandardInputChar());
 			cout << ' ' << option << endl;
 
+			// The AST stays resident across steps; keep a copy so that a failing step
+			// can be rolled back without re-parsing the previous source.
+			yul::Block backup = ASTCopier{}.translate(*m_ast);
 			try
 			{
 				switch (option)
@@ -214,8 +246,10 @@ public:
 						return;
 					case ',':
 						VarNameCleaner::run(m_context, *m_ast);
-						// VarNameCleaner destroys the unique names guarantee of the disambiguator.
-						disambiguated = false;
+						// VarNameCleaner destroys the unique names guarantee of the
+						// disambiguator; re-establish it right away.
+						analyze();
+						disambiguate();
 						break;
 					case ';':
 					{
@@ -230,15 +264,21 @@ public:
 							*m_ast
 						);
 				}
-				_source = AsmPrinter{m_dialect}(*m_ast);
+				// Validate the modified AST in place instead of printing and
+				// re-parsing the whole source.
+				analyze();
+				m_appliedSteps += option;
 			}
 			catch (...)
 			{
 				cerr << endl << "Exception during optimiser step:" << endl;
 				cerr << boost::current_exception_diagnostic_information() << endl;
+				*m_ast = std::move(backup);
 			}
 			cout << "----------------------" << endl;
-			cout << _source << endl;
+			cout << AsmPrinter{m_dialect}(*m_ast) << endl;
+			if (!m_appliedSteps.empty())
+				cout << "Steps applied so far: " << m_appliedSteps << endl;
 		}
 	}
 
@@ -246,6 +286,9 @@ private:
 	shared_ptr<yul::Block> m_ast;
 	Dialect const& m_dialect{EVMDialect::strictAssemblyForEVMObjects(EVMVersion{})};
 	unique_ptr<AsmAnalysisInfo> m_analysisInfo;
+	/// Log of the interactively applied steps; sequences consisting only of optimiser
+	/// step abbreviations can be re-executed in one go via --steps.
+	string m_appliedSteps;
 	set<YulString> const m_reservedIdentifiers = {};
 	NameDispenser m_nameDispenser{m_dialect, m_reservedIdentifiers};
 	OptimiserStepContext m_context{
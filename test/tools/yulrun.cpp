@@ -26,9 +26,12 @@
 #include <libyul/AsmAnalysis.h>
 #include <libyul/Dialect.h>
 #include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/Object.h>
+#include <libyul/ObjectBinary.h>
 #include <libyul/YulStack.h>
 
 #include <liblangutil/DebugInfoSelection.h>
+#include <liblangutil/ErrorReporter.h>
 #include <liblangutil/Exceptions.h>
 #include <liblangutil/EVMVersion.h>
 #include <liblangutil/SourceReferenceFormatter.h>
@@ -57,6 +60,32 @@ namespace
 
 pair<shared_ptr<Block>, shared_ptr<AsmAnalysisInfo>> parse(string const& _source)
 {
+	if (isBinaryObject(_source))
+	{
+		shared_ptr<Object> object = deserializeObject(_source);
+		if (!object || !object->code)
+		{
+			cout << "Invalid binary Yul object." << endl;
+			return {};
+		}
+		ErrorList errors;
+		ErrorReporter errorReporter(errors);
+		auto analysisInfo = make_shared<AsmAnalysisInfo>();
+		AsmAnalyzer analyzer(
+			*analysisInfo,
+			errorReporter,
+			EVMDialect::strictAssemblyForEVMObjects(langutil::EVMVersion{}),
+			{},
+			object->qualifiedDataNames()
+		);
+		if (!analyzer.analyze(*object->code) || errorReporter.hasErrors())
+		{
+			cout << "Invalid binary Yul object." << endl;
+			return {};
+		}
+		return {object->code, analysisInfo};
+	}
+
 	YulStack stack(
 		langutil::EVMVersion(),
 		nullopt,
@@ -277,6 +277,49 @@ BOOST_FIXTURE_TEST_CASE(FitnessMetricMinimum_evaluate_should_compute_minimum_of_
 	BOOST_TEST(metric.metrics() == m_simpleMetrics);
 }
 
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE(FitnessMetricCacheTest)
+
+class EvaluationCountingMetric: public FitnessMetric
+{
+public:
+	size_t evaluate(Chromosome const& _chromosome) override
+	{
+		++m_evaluationCount;
+		return _chromosome.length();
+	}
+
+	size_t evaluationCount() const { return m_evaluationCount; }
+
+private:
+	size_t m_evaluationCount = 0;
+};
+
+BOOST_AUTO_TEST_CASE(evaluate_should_return_the_same_value_as_the_wrapped_metric)
+{
+	auto innerMetric = make_shared<EvaluationCountingMetric>();
+	FitnessMetricCache metric(innerMetric);
+
+	Chromosome chromosome("afc");
+	BOOST_TEST(metric.evaluate(chromosome) == innerMetric->evaluate(chromosome));
+	BOOST_TEST(metric.metric() == innerMetric);
+}
+
+BOOST_AUTO_TEST_CASE(evaluate_should_not_reevaluate_chromosomes_it_has_seen_before)
+{
+	auto innerMetric = make_shared<EvaluationCountingMetric>();
+	FitnessMetricCache metric(innerMetric);
+
+	size_t fitness = metric.evaluate(Chromosome("afc"));
+	BOOST_TEST(innerMetric->evaluationCount() == 1);
+
+	BOOST_TEST(metric.evaluate(Chromosome("afc")) == fitness);
+	BOOST_TEST(innerMetric->evaluationCount() == 1);
+
+	metric.evaluate(Chromosome("fa"));
+	BOOST_TEST(innerMetric->evaluationCount() == 2);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
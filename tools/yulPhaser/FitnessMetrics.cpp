@@ -118,3 +118,22 @@ size_t FitnessMetricMinimum::evaluate(Chromosome const& _chromosome)
 
 	return minimum;
 }
+
+size_t FitnessMetricCache::evaluate(Chromosome const& _chromosome)
+{
+	string key = toString(_chromosome);
+	{
+		shared_lock lock(m_cacheMutex);
+		auto cachedValue = m_cache.find(key);
+		if (cachedValue != m_cache.end())
+			return cachedValue->second;
+	}
+
+	// Two threads may get here with the same chromosome and evaluate it twice but since
+	// metrics are deterministic they will just store the same value.
+	size_t value = m_metric->evaluate(_chromosome);
+
+	unique_lock lock(m_cacheMutex);
+	m_cache.insert({std::move(key), value});
+	return value;
+}
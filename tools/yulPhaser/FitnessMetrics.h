@@ -28,7 +28,11 @@
 #include <libyul/optimiser/Metrics.h>
 
 #include <cstddef>
+#include <map>
+#include <memory>
 #include <optional>
+#include <shared_mutex>
+#include <string>
 
 namespace solidity::phaser
 {
@@ -188,4 +192,29 @@ public:
 	size_t evaluate(Chromosome const& _chromosome) override;
 };
 
+/**
+ * Wrapper that caches the values returned by another fitness metric, keyed by the string
+ * representation of the chromosome.
+ *
+ * Since metrics are required to be deterministic, a cached value never becomes stale. Entries
+ * are small (a string and a number) so no eviction is performed. The cache is guarded by a
+ * shared mutex, which makes the wrapper safe to use from multiple threads evaluating
+ * chromosomes in parallel as long as the wrapped metric is too.
+ */
+class FitnessMetricCache: public FitnessMetric
+{
+public:
+	explicit FitnessMetricCache(std::shared_ptr<FitnessMetric> _metric):
+		m_metric(std::move(_metric)) {}
+
+	std::shared_ptr<FitnessMetric> const& metric() const { return m_metric; }
+
+	size_t evaluate(Chromosome const& _chromosome) override;
+
+private:
+	std::shared_ptr<FitnessMetric> m_metric;
+	std::map<std::string, size_t> m_cache;
+	std::shared_mutex m_cacheMutex;
+};
+
 }
@@ -36,6 +36,7 @@
 #include <libsolutil/CommonIO.h>
 
 #include <iostream>
+#include <thread>
 
 using namespace std;
 using namespace solidity;
@@ -219,6 +220,7 @@ FitnessMetricFactory::Options FitnessMetricFactory::Options::fromCommandLine(po:
 		_arguments["metric-aggregator"].as<MetricAggregatorChoice>(),
 		_arguments["relative-metric-scale"].as<size_t>(),
 		_arguments["chromosome-repetitions"].as<size_t>(),
+		_arguments["fitness-cache"].as<bool>(),
 	};
 }
 
@@ -263,22 +265,29 @@ unique_ptr<FitnessMetric> FitnessMetricFactory::build(
 			assertThrow(false, solidity::util::Exception, "Invalid MetricChoice value.");
 	}
 
+	unique_ptr<FitnessMetric> aggregatedMetric;
 	switch (_options.metricAggregator)
 	{
 		case MetricAggregatorChoice::Average:
-			return make_unique<FitnessMetricAverage>(std::move(metrics));
+			aggregatedMetric = make_unique<FitnessMetricAverage>(std::move(metrics));
+			break;
 		case MetricAggregatorChoice::Sum:
-			return make_unique<FitnessMetricSum>(std::move(metrics));
+			aggregatedMetric = make_unique<FitnessMetricSum>(std::move(metrics));
+			break;
 		case MetricAggregatorChoice::Maximum:
-			return make_unique<FitnessMetricMaximum>(std::move(metrics));
+			aggregatedMetric = make_unique<FitnessMetricMaximum>(std::move(metrics));
+			break;
 		case MetricAggregatorChoice::Minimum:
-			return make_unique<FitnessMetricMinimum>(std::move(metrics));
+			aggregatedMetric = make_unique<FitnessMetricMinimum>(std::move(metrics));
+			break;
 		default:
 			assertThrow(false, solidity::util::Exception, "Invalid MetricAggregatorChoice value.");
 	}
 
-	// FIXME: Workaround for spurious GCC 12.1 warning (https://gcc.gnu.org/bugzilla/show_bug.cgi?id=105794)
-	util::unreachable();
+	if (_options.fitnessCacheEnabled)
+		return make_unique<FitnessMetricCache>(std::move(aggregatedMetric));
+
+	return aggregatedMetric;
 }
 
 PopulationFactory::Options PopulationFactory::Options::fromCommandLine(po::variables_map const& _arguments)
@@ -421,6 +430,7 @@ void Phaser::main(int _argc, char** _argv)
 		return;
 
 	initialiseRNG(arguments.value());
+	initialiseEvaluationParallelism(arguments.value());
 
 	runPhaser(arguments.value());
 }
@@ -461,6 +471,12 @@ Phaser::CommandLineDescription Phaser::buildCommandLineDescription()
 			"or removed using this option. The value given here is applied after it."
 		)
 		("seed", po::value<uint32_t>()->value_name("<NUM>"), "Seed for the random number generator.")
+		(
+			"jobs",
+			po::value<size_t>()->value_name("<NUM>"),
+			"Number of threads used to evaluate the fitness of chromosomes in parallel. "
+			"(default=number of cores available on the machine)"
+		)
 		(
 			"rounds",
 			po::value<size_t>()->value_name("<NUM>"),
@@ -717,6 +733,14 @@ Phaser::CommandLineDescription Phaser::buildCommandLineDescription()
 			"Disabled by default since there's currently no way to set an upper limit on memory usage but "
 			"highly recommended if your computer has enough RAM."
 		)
+		(
+			"fitness-cache",
+			po::bool_switch(),
+			"Enables caching of fitness values, keyed by the whole chromosome.\n"
+			"Unlike --program-cache this does not store any programs so the memory cost is negligible. "
+			"It only helps if the same chromosome gets evaluated more than once, which is common "
+			"in later rounds when the population is dominated by a few top sequences."
+		)
 	;
 	keywordDescription.add(cacheDescription);
 
@@ -792,6 +816,19 @@ void Phaser::initialiseRNG(po::variables_map const& _arguments)
 		cout << "Random seed: " << seed << endl;
 }
 
+void Phaser::initialiseEvaluationParallelism(po::variables_map const& _arguments)
+{
+	size_t threadCount;
+	if (_arguments.count("jobs") > 0)
+		threadCount = _arguments["jobs"].as<size_t>();
+	else
+		// hardware_concurrency() may return 0 if it cannot determine the number of cores.
+		threadCount = max<size_t>(thread::hardware_concurrency(), 1);
+
+	assertThrow(threadCount >= 1, BadInput, "Argument --jobs must be a positive integer.");
+	Population::setEvaluationParallelism(threadCount);
+}
+
 AlgorithmRunner::Options Phaser::buildAlgorithmRunnerOptions(po::variables_map const& _arguments)
 {
 	return {
@@ -158,6 +158,7 @@ public:
 		MetricAggregatorChoice metricAggregator;
 		size_t relativeMetricScale;
 		size_t chromosomeRepetitions;
+		bool fitnessCacheEnabled = false;
 
 		static Options fromCommandLine(boost::program_options::variables_map const& _arguments);
 	};
@@ -266,6 +267,7 @@ private:
 	static CommandLineDescription buildCommandLineDescription();
 	static std::optional<boost::program_options::variables_map> parseCommandLine(int _argc, char** _argv);
 	static void initialiseRNG(boost::program_options::variables_map const& _arguments);
+	static void initialiseEvaluationParallelism(boost::program_options::variables_map const& _arguments);
 	static AlgorithmRunner::Options buildAlgorithmRunnerOptions(boost::program_options::variables_map const& _arguments);
 
 	static void runPhaser(boost::program_options::variables_map const& _arguments);
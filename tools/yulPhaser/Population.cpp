@@ -25,8 +25,12 @@
 #include <libsolutil/CommonIO.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <exception>
+#include <mutex>
 #include <numeric>
+#include <thread>
 
 using namespace std;
 using namespace solidity;
@@ -96,26 +100,23 @@ Population Population::select(Selection const& _selection) const
 
 Population Population::mutate(Selection const& _selection, function<Mutation> _mutation) const
 {
-	vector<Individual> mutatedIndividuals;
+	vector<Chromosome> mutatedChromosomes;
 	for (size_t i: _selection.materialise(m_individuals.size()))
-		mutatedIndividuals.emplace_back(_mutation(m_individuals[i].chromosome), *m_fitnessMetric);
+		mutatedChromosomes.emplace_back(_mutation(m_individuals[i].chromosome));
 
-	return Population(m_fitnessMetric, mutatedIndividuals);
+	return Population(m_fitnessMetric, std::move(mutatedChromosomes));
 }
 
 Population Population::crossover(PairSelection const& _selection, function<Crossover> _crossover) const
 {
-	vector<Individual> crossedIndividuals;
+	vector<Chromosome> crossedChromosomes;
 	for (auto const& [i, j]: _selection.materialise(m_individuals.size()))
-	{
-		auto childChromosome = _crossover(
+		crossedChromosomes.emplace_back(_crossover(
 			m_individuals[i].chromosome,
 			m_individuals[j].chromosome
-		);
-		crossedIndividuals.emplace_back(std::move(childChromosome), *m_fitnessMetric);
-	}
+		));
 
-	return Population(m_fitnessMetric, crossedIndividuals);
+	return Population(m_fitnessMetric, std::move(crossedChromosomes));
 }
 
 tuple<Population, Population> Population::symmetricCrossoverWithRemainder(
@@ -125,15 +126,15 @@ tuple<Population, Population> Population::symmetricCrossoverWithRemainder(
 {
 	vector<int> indexSelected(m_individuals.size(), false);
 
-	vector<Individual> crossedIndividuals;
+	vector<Chromosome> crossedChromosomes;
 	for (auto const& [i, j]: _selection.materialise(m_individuals.size()))
 	{
 		auto children = _symmetricCrossover(
 			m_individuals[i].chromosome,
 			m_individuals[j].chromosome
 		);
-		crossedIndividuals.emplace_back(std::move(get<0>(children)), *m_fitnessMetric);
-		crossedIndividuals.emplace_back(std::move(get<1>(children)), *m_fitnessMetric);
+		crossedChromosomes.emplace_back(std::move(get<0>(children)));
+		crossedChromosomes.emplace_back(std::move(get<1>(children)));
 		indexSelected[i] = true;
 		indexSelected[j] = true;
 	}
@@ -144,7 +145,7 @@ tuple<Population, Population> Population::symmetricCrossoverWithRemainder(
 			remainder.emplace_back(m_individuals[i]);
 
 	return {
-		Population(m_fitnessMetric, crossedIndividuals),
+		Population(m_fitnessMetric, std::move(crossedChromosomes)),
 		Population(m_fitnessMetric, remainder),
 	};
 }
@@ -186,14 +187,69 @@ ostream& phaser::operator<<(ostream& _stream, Population const& _population)
 	return _stream;
 }
 
+size_t Population::s_evaluationParallelism = 1;
+
+void Population::setEvaluationParallelism(size_t _threadCount)
+{
+	assert(_threadCount >= 1);
+	s_evaluationParallelism = _threadCount;
+}
+
 vector<Individual> Population::chromosomesToIndividuals(
 	FitnessMetric& _fitnessMetric,
 	vector<Chromosome> _chromosomes
 )
 {
+	vector<size_t> fitnessValues(_chromosomes.size());
+
+	size_t threadCount = min(s_evaluationParallelism, _chromosomes.size());
+	if (threadCount <= 1)
+		for (size_t i = 0; i < _chromosomes.size(); ++i)
+			fitnessValues[i] = _fitnessMetric.evaluate(_chromosomes[i]);
+	else
+	{
+		atomic<size_t> nextIndex(0);
+		mutex exceptionMutex;
+		exception_ptr workerException;
+
+		auto work = [&]()
+		{
+			while (true)
+			{
+				size_t i = nextIndex.fetch_add(1);
+				if (i >= _chromosomes.size())
+					break;
+
+				try
+				{
+					fitnessValues[i] = _fitnessMetric.evaluate(_chromosomes[i]);
+				}
+				catch (...)
+				{
+					lock_guard<mutex> lock(exceptionMutex);
+					if (!workerException)
+						workerException = current_exception();
+					// Let the remaining workers drain the queue without evaluating anything.
+					nextIndex.store(_chromosomes.size());
+					break;
+				}
+			}
+		};
+
+		vector<thread> threads;
+		for (size_t i = 1; i < threadCount; ++i)
+			threads.emplace_back(work);
+		work();
+		for (thread& thread: threads)
+			thread.join();
+
+		if (workerException)
+			rethrow_exception(workerException);
+	}
+
 	vector<Individual> individuals;
-	for (auto& chromosome: _chromosomes)
-		individuals.emplace_back(std::move(chromosome), _fitnessMetric);
+	for (size_t i = 0; i < _chromosomes.size(); ++i)
+		individuals.emplace_back(std::move(_chromosomes[i]), fitnessValues[i]);
 
 	return individuals;
 }
@@ -116,6 +116,12 @@ public:
 	static size_t uniformChromosomeLength(size_t _min, size_t _max) { return SimulationRNG::uniformInt(_min, _max); }
 	static size_t binomialChromosomeLength(size_t _max) { return SimulationRNG::binomialInt(_max, 0.5); }
 
+	/// Sets the number of threads used to evaluate the fitness of new individuals.
+	/// Affects all populations. For values greater than one the fitness metric must be
+	/// safe to call from multiple threads at once.
+	static void setEvaluationParallelism(size_t _threadCount);
+	static size_t evaluationParallelism() { return s_evaluationParallelism; }
+
 	bool operator==(Population const& _other) const;
 	bool operator!=(Population const& _other) const { return !(*this == _other); }
 
@@ -128,6 +134,8 @@ private:
 	);
 	static std::vector<Individual> sortedIndividuals(std::vector<Individual> _individuals);
 
+	static size_t s_evaluationParallelism;
+
 	std::shared_ptr<FitnessMetric> m_fitnessMetric;
 	std::vector<Individual> m_individuals;
 };
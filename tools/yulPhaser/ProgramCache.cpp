@@ -59,6 +59,8 @@ Program ProgramCache::optimiseProgram(
 	for (size_t i = 1; i < _repetitionCount; ++i)
 		targetOptimisations += _abbreviatedOptimisationSteps;
 
+	unique_lock<mutex> lock(m_mutex);
+
 	size_t prefixSize = 0;
 	for (size_t i = 1; i <= targetOptimisations.size(); ++i)
 	{
@@ -82,8 +84,14 @@ Program ProgramCache::optimiseProgram(
 	for (size_t i = prefixSize + 1; i <= targetOptimisations.size(); ++i)
 	{
 		string stepName = OptimiserSuite::stepAbbreviationToNameMap().at(targetOptimisations[i - 1]);
+
+		// Running the optimiser is the expensive part - do not hold the lock for it.
+		lock.unlock();
 		intermediateProgram.optimise({stepName});
+		lock.lock();
 
+		// Another thread may have created this entry in the meantime. insert() keeps the existing
+		// one in that case, which is fine - the steps are deterministic so the programs are equal.
 		m_entries.insert({targetOptimisations.substr(0, i), {intermediateProgram, m_currentRound}});
 		++m_misses;
 	}
@@ -93,6 +101,8 @@ Program ProgramCache::optimiseProgram(
 
 void ProgramCache::startRound(size_t _roundNumber)
 {
+	lock_guard<mutex> lock(m_mutex);
+
 	assert(_roundNumber > m_currentRound);
 	m_currentRound = _roundNumber;
 
@@ -109,6 +119,8 @@ void ProgramCache::startRound(size_t _roundNumber)
 
 void ProgramCache::clear()
 {
+	lock_guard<mutex> lock(m_mutex);
+
 	m_entries.clear();
 	m_currentRound = 0;
 }
@@ -124,6 +136,8 @@ Program const* ProgramCache::find(string const& _abbreviatedOptimisationSteps) c
 
 CacheStats ProgramCache::gatherStats() const
 {
+	lock_guard<mutex> lock(m_mutex);
+
 	return {
 		/* hits = */ m_hits,
 		/* misses = */ m_misses,
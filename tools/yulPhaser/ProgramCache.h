@@ -24,6 +24,7 @@
 
 #include <cstddef>
 #include <map>
+#include <mutex>
 #include <string>
 
 namespace solidity::phaser
@@ -102,6 +103,10 @@ struct CacheStats
  * There is currently no way to purge entries without starting a new round. Since the programs
  * take a lot of memory, this may lead to the cache eating up all the available RAM if sequences are
  * long and programs large. A limiter based on entry count or total program size would be useful.
+ *
+ * @a optimiseProgram(), @a startRound(), @a clear() and @a gatherStats() may be called from
+ * multiple threads at once. The read-only accessors are not synchronised and must not be used
+ * while another thread is modifying the cache.
  */
 class ProgramCache
 {
@@ -135,6 +140,10 @@ private:
 	// A map should be good enough.
 	std::map<std::string, CacheEntry> m_entries;
 
+	/// Guards @a m_entries, @a m_currentRound, @a m_hits and @a m_misses. Running the optimiser
+	/// itself does not require holding the lock.
+	mutable std::mutex m_mutex;
+
 	Program m_program;
 	size_t m_currentRound = 0;
 	size_t m_hits = 0;